@@ -16,6 +16,7 @@
 #define OHOS_GLOBAL_DATE_TIME_MATCHED_H
 
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <vector>
 #include "date_rule_init.h"
@@ -30,7 +31,7 @@ public:
     std::vector<int> GetMatchedDateTime(icu::UnicodeString& message);
 
 private:
-    std::unique_ptr<DateRuleInit> dateRuleInit;
+    std::shared_ptr<DateRuleInit> dateRuleInit;
 };
 } // namespace I18n
 } // namespace Global
@@ -25,7 +25,7 @@ namespace I18n {
 class MatchedDateTimeInfo {
 public:
     MatchedDateTimeInfo() : _begin(-1), _end(-1), type(0), isTimePeriod(false) {}
-    MatchedDateTimeInfo(int begin, int end, std::string& regex)
+    MatchedDateTimeInfo(int begin, int end, const std::string& regex)
         : _begin(begin), _end(end), regex(regex), type(0), isTimePeriod(false) {}
     ~MatchedDateTimeInfo() {}
 
@@ -15,6 +15,7 @@
 #ifndef OHOS_GLOBAL_RULES_ENGINE_H
 #define OHOS_GLOBAL_RULES_ENGINE_H
 
+#include <memory>
 #include <string>
 #include <unicode/regex.h>
 #include <unordered_map>
@@ -64,7 +65,8 @@ private:
     std::unordered_map<std::string, std::string> subRules;
     std::unordered_map<std::string, std::string> param;
     std::unordered_map<std::string, std::string> paramBackup;
-    std::unordered_map<std::string, icu::UnicodeString> patterns;
+    // compiled once in Init and shared between copies of the engine.
+    std::unordered_map<std::string, std::shared_ptr<icu::RegexPattern>> patterns;
 };
 } // namespace I18n
 } // namespace Global
@@ -130,8 +130,9 @@ void DateRuleInit::GetMatchedInfo(std::vector<MatchedDateTimeInfo>& matches, Mat
     icu::UnicodeString& message)
 {
     // splitting results based on subRules.
-    if (subDetectsMap.find(match.GetRegex()) != subDetectsMap.end()) {
-        RulesEngine subRulesEngine = subDetectsMap[match.GetRegex()];
+    auto subDetect = subDetectsMap.find(match.GetRegex());
+    if (subDetect != subDetectsMap.end()) {
+        RulesEngine& subRulesEngine = subDetect->second;
         icu::UnicodeString subMessage = message.tempSubString(match.GetBegin(), match.GetEnd() - match.GetBegin());
         std::vector<MatchedDateTimeInfo> subMatches = subRulesEngine.Match(subMessage);
         for (auto& subMatch : subMatches) {
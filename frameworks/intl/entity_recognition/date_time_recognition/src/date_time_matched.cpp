@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "date_time_matched.h"
+#include "entity_rules_registry.h"
 #include "i18n_hilog.h"
 
 namespace OHOS {
@@ -20,7 +21,7 @@ namespace Global {
 namespace I18n {
 DateTimeMatched::DateTimeMatched(std::string& locale)
 {
-    dateRuleInit = std::make_unique<DateRuleInit>(locale);
+    dateRuleInit = EntityRulesRegistry::GetDateRule(locale);
     if (dateRuleInit == nullptr) {
         HILOG_ERROR_I18N("DateRuleInit construct failed.");
     }
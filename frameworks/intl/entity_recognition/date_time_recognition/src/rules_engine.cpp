@@ -42,25 +42,17 @@ RulesEngine::~RulesEngine()
 std::vector<MatchedDateTimeInfo> RulesEngine::Match(icu::UnicodeString& message)
 {
     std::vector<MatchedDateTimeInfo> matches;
-    std::vector<std::string> keys;
     for (auto& kv : this->patterns) {
-        keys.push_back(kv.first);
-    }
-    std::string res;
-    message.toUTF8String(res);
-    for (auto& key : keys) {
         UErrorCode status = U_ZERO_ERROR;
-        icu::UnicodeString regex = this->patterns[key];
-        icu::RegexPattern* pattern = icu::RegexPattern::compile(regex,
-            URegexpFlag::UREGEX_CASE_INSENSITIVE, status);
-        if (IsRegexPatternInvalid(pattern) || U_FAILURE(status)) {
+        const std::string& key = kv.first;
+        icu::RegexPattern* pattern = kv.second.get();
+        if (IsRegexPatternInvalid(pattern)) {
             HILOG_ERROR_I18N("Match failed because pattern is nullptr.");
             return matches;
         }
         icu::RegexMatcher* matcher = pattern->matcher(message, status);
         if (IsRegexMatcherInvalid(matcher)) {
             HILOG_ERROR_I18N("Match failed because pattern matcher failed.");
-            delete pattern;
             return matches;
         }
         while (matcher->find(status)) {
@@ -70,7 +62,6 @@ std::vector<MatchedDateTimeInfo> RulesEngine::Match(icu::UnicodeString& message)
             matches.push_back(match);
         }
         delete matcher;
-        delete pattern;
     }
     return matches;
 }
@@ -85,9 +76,18 @@ void RulesEngine::Init()
         bool isVaild = InitRules(rulesValue);
         // replace [param_ ] in the rule with the corresponding regular expression.
         icu::UnicodeString regex = rulesValue.c_str();
-        if (!regex.trim().isEmpty() && isVaild) {
-            this->patterns.insert({rulesKey, regex});
+        if (regex.trim().isEmpty() || !isVaild) {
+            continue;
+        }
+        UErrorCode status = U_ZERO_ERROR;
+        std::shared_ptr<icu::RegexPattern> pattern(icu::RegexPattern::compile(regex,
+            URegexpFlag::UREGEX_CASE_INSENSITIVE, status));
+        if (U_FAILURE(status)) {
+            HILOG_ERROR_I18N("Init: compile rule %{public}s failed.", rulesKey.c_str());
+            pattern = nullptr;
         }
+        // an invalid rule is kept as nullptr so that Match stops at it as before.
+        this->patterns.insert({rulesKey, pattern});
     }
 }
 
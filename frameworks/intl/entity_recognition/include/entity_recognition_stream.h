@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_ENTITY_RECOGNITION_STREAM_H
+#define OHOS_GLOBAL_I18N_ENTITY_RECOGNITION_STREAM_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "entity_recognizer.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+enum class EntityKind {
+    PHONE_NUMBER,
+    DATE_TIME,
+};
+
+struct EntitySpan {
+    EntityKind kind;
+    // Offsets in the whole stream, end is exclusive.
+    size_t utf8Begin;
+    size_t utf8End;
+    size_t utf16Begin;
+    size_t utf16End;
+};
+
+using EntitySpanCallback = std::function<void(const EntitySpan&)>;
+
+/**
+ * Runs an EntityRecognizer over text supplied in chunks. The text is recognized in windows of
+ * chunkLength + overlapLength bytes, and consecutive windows share overlapLength bytes so
+ * entities crossing a window border are still found. Each entity is reported once, in stream
+ * order, and at most one window of text is kept in memory.
+ */
+class EntityRecognitionStream {
+public:
+    EntityRecognitionStream(EntityRecognizer& recognizer, EntitySpanCallback callback,
+        size_t chunkLength = DEFAULT_CHUNK_LENGTH, size_t overlapLength = DEFAULT_OVERLAP_LENGTH);
+
+    /**
+     * @brief Add the next part of the text. A part may end in the middle of a UTF-8 character.
+     */
+    void Append(const std::string& text);
+
+    /**
+     * @brief Recognize the remaining text. The stream can be reused afterwards.
+     */
+    void Finish();
+
+    static constexpr size_t DEFAULT_CHUNK_LENGTH = 4096;
+    static constexpr size_t DEFAULT_OVERLAP_LENGTH = 256;
+
+private:
+    void ProcessWindow(size_t windowLength, bool isLast);
+    void EmitSpans(const std::vector<int>& info, EntityKind kind, const std::vector<size_t>& utf16ToUtf8,
+        size_t commitLength, std::vector<EntitySpan>& spans);
+    size_t AlignToCharBoundary(size_t offset) const;
+
+    EntityRecognizer& recognizer;
+    EntitySpanCallback callback;
+    size_t chunkLength;
+    size_t overlapLength;
+    std::string buffer;
+    size_t bufferPos = 0;
+    size_t windowUtf8Start = 0;
+    size_t windowUtf16Start = 0;
+    size_t committedUtf8 = 0;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
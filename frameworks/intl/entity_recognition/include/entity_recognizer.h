@@ -31,7 +31,6 @@ public:
     std::vector<std::vector<int>> FindEntityInfo(std::string& message);
 
 private:
-    icu::UnicodeString ConvertQanChar(icu::UnicodeString& instr);
     PhoneNumberMatched* phoneNumberMatched;
     DateTimeMatched* dateTimeMatched;
     std::string locale;
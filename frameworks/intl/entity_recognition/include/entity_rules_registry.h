@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_ENTITY_RULES_REGISTRY_H
+#define OHOS_GLOBAL_I18N_ENTITY_RULES_REGISTRY_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "date_rule_init.h"
+#include "phone_number_rule.h"
+#include "phonenumbers/shortnumberinfo.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+/**
+ * Process-wide registry of compiled entity recognition rules. Phone number rules are keyed by
+ * region and date time rules by language. A rule set is parsed once and shared by every
+ * recognizer that uses it, and it is released when the last of them is destroyed.
+ */
+class EntityRulesRegistry {
+public:
+    static std::shared_ptr<PhoneNumberRule> GetPhoneNumberRule(const std::string& region);
+    static std::shared_ptr<DateRuleInit> GetDateRule(const std::string& language);
+    static std::shared_ptr<i18n::phonenumbers::ShortNumberInfo> GetShortNumberInfo();
+
+private:
+    static std::mutex phoneNumberMutex;
+    static std::mutex dateMutex;
+    static std::mutex shortNumberMutex;
+    static std::unordered_map<std::string, std::weak_ptr<PhoneNumberRule>> phoneNumberRules;
+    static std::unordered_map<std::string, std::weak_ptr<DateRuleInit>> dateRules;
+    static std::weak_ptr<i18n::phonenumbers::ShortNumberInfo> shortNumberInfo;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_TEXT_NORMALIZER_H
+#define OHOS_GLOBAL_I18N_TEXT_NORMALIZER_H
+
+#include <unicode/unistr.h>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// Normalization stage shared by the entity recognizers, applied before phone number and date time matching.
+class TextNormalizer {
+public:
+    // replace full-width symbols with half-width symbols, the length of the text is unchanged.
+    static icu::UnicodeString ToHalfWidth(const icu::UnicodeString& text);
+    // return the half-width form of ch, or ch itself when it is not folded.
+    static UChar ToHalfWidth(UChar ch);
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
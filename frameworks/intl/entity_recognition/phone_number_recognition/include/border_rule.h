@@ -15,6 +15,7 @@
 #ifndef OHOS_GLOBAL_I18N_BORDER_RULE_H
 #define OHOS_GLOBAL_I18N_BORDER_RULE_H
 
+#include <memory>
 #include <unicode/regex.h>
 #include "phonenumbers/phonenumbermatch.h"
 
@@ -27,12 +28,14 @@ class BorderRule {
 public:
     BorderRule(icu::UnicodeString& regex, std::string& insensitive, std::string& type);
     int GetType();
-    icu::RegexPattern* GetPattern();
+    const icu::RegexPattern* GetPattern();
     bool Handle(PhoneNumberMatch* match, icu::UnicodeString& message);
 
 private:
+    void CompilePattern();
     int type;
     icu::UnicodeString regex;
+    std::unique_ptr<icu::RegexPattern> regexPattern;
     std::string insensitive;
     static const std::string CONTAIN_STR;
     static const std::string CONTAIN_OR_INTERSECT_STR;
@@ -15,6 +15,7 @@
 #ifndef OHOS_GLOBAL_I18N_FIND_RULE_H
 #define OHOS_GLOBAL_I18N_FIND_RULE_H
 
+#include <memory>
 #include <unicode/regex.h>
 
 namespace OHOS {
@@ -23,10 +24,12 @@ namespace I18n {
 class FindRule {
 public:
     FindRule(icu::UnicodeString& regex, std::string& insensitive);
-    icu::RegexPattern* GetPattern();
+    const icu::RegexPattern* GetPattern();
 
 private:
+    void CompilePattern();
     icu::UnicodeString regex;
+    std::unique_ptr<icu::RegexPattern> regexPattern;
     std::string insensitive;
 };
 } // namespace I18n
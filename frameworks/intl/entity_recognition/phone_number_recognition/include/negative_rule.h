@@ -15,6 +15,7 @@
 #ifndef OHOS_GLOBAL_I18N_NEGATIVE_RULE_H
 #define OHOS_GLOBAL_I18N_NEGATIVE_RULE_H
 
+#include <memory>
 #include <unicode/regex.h>
 
 namespace OHOS {
@@ -23,12 +24,14 @@ namespace I18n {
 class NegativeRule {
 public:
     NegativeRule(icu::UnicodeString& regex, std::string& insensitive);
-    icu::RegexPattern* GetPattern();
+    const icu::RegexPattern* GetPattern();
     icu::UnicodeString Handle(icu::UnicodeString& src);
 
 private:
+    void CompilePattern();
     void ReplaceSpecifiedPos(icu::UnicodeString& chs, int start, int end);
     icu::UnicodeString regex;
+    std::unique_ptr<icu::RegexPattern> regexPattern;
     std::string insensitive;
 };
 } // namespace I18n
@@ -15,6 +15,7 @@
 #ifndef OHOS_GLOBAL_PHONE_NUMBER_MATCHED_H
 #define OHOS_GLOBAL_PHONE_NUMBER_MATCHED_H
 
+#include <memory>
 #include <string>
 #include <unicode/regex.h>
 #include <unordered_set>
@@ -67,9 +68,9 @@ private:
     std::vector<PositiveRule*> GetPositiveRulesInside();
 
     static const UChar32 REPLACE_CHAR;
-    PhoneNumberRule* phoneNumberRule;
+    std::shared_ptr<PhoneNumberRule> phoneNumberRule;
     PhoneNumberUtil* phoneNumberUtil;
-    ShortNumberInfo* shortNumberInfo;
+    std::shared_ptr<ShortNumberInfo> shortNumberInfo;
     std::string country;
 };
 } // namespace I18n
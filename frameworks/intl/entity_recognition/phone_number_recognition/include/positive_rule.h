@@ -15,6 +15,7 @@
 #ifndef OHOS_GLOBAL_I18N_POSITIVE_RULE_H
 #define OHOS_GLOBAL_I18N_POSITIVE_RULE_H
 
+#include <memory>
 #include <unicode/regex.h>
 #include "matched_number_info.h"
 #include "phonenumbers/phonenumbermatch.h"
@@ -26,11 +27,12 @@ using i18n::phonenumbers::PhoneNumberMatch;
 class PositiveRule {
 public:
     PositiveRule(icu::UnicodeString& regex, std::string& HandleType, std::string& insensitive);
-    icu::RegexPattern* GetPattern();
+    const icu::RegexPattern* GetPattern();
     std::vector<MatchedNumberInfo> HandleInner(PhoneNumberMatch* possibleNumber, icu::UnicodeString& message);
     std::vector<MatchedNumberInfo> Handle(PhoneNumberMatch* match, icu::UnicodeString& message);
 
 private:
+    void CompilePattern();
     static std::vector<MatchedNumberInfo> GetNumbersWithSlant(icu::UnicodeString& testStr);
     std::vector<MatchedNumberInfo> HandlePossibleNumberWithPattern(PhoneNumberMatch* possibleNumber,
         icu::UnicodeString& message, bool isStartsWithNumber);
@@ -45,6 +47,7 @@ private:
     icu::UnicodeString DealStringWithOneBracket(icu::UnicodeString& message);
     bool IsNumberWithOneBracket(icu::UnicodeString& message);
     icu::UnicodeString regex;
+    std::unique_ptr<icu::RegexPattern> regexPattern;
     std::string handleType;
     std::string insensitive;
 };
@@ -15,6 +15,7 @@
 #ifndef OHOS_GLOBAL_REGEX_RULE_H
 #define OHOS_GLOBAL_REGEX_RULE_H
 
+#include <memory>
 #include <unicode/regex.h>
 #include <vector>
 #include <string>
@@ -32,13 +33,14 @@ public:
     ~RegexRule();
 
     int GetType(); // border rules
-    icu::RegexPattern* GetPattern(); // positive Rules, negative rules, border rules, find rules
+    const icu::RegexPattern* GetPattern(); // positive Rules, negative rules, border rules, find rules
 
     std::vector<MatchedNumberInfo> Handle(PhoneNumberMatch* possibleNumber, icu::UnicodeString& message);
     PhoneNumberMatch* IsValid(PhoneNumberMatch* possibleNumber, icu::UnicodeString& message); // codes rules
     static int CountDigits(icu::UnicodeString& str);
 
 private:
+    void CompilePattern();
     void StartWithBrackets(icu::UnicodeString& phone); // codes rules
     static std::vector<MatchedNumberInfo> GetNumbersWithSlant(icu::UnicodeString& testStr); // positive Rules
     std::vector<MatchedNumberInfo> HandlePossibleNumberWithPattern(PhoneNumberMatch* possibleNumber,
@@ -62,6 +64,7 @@ private:
 
     int type; // border rules
     icu::UnicodeString regex; // positive Rules, negative rules, border rules, find rules
+    std::unique_ptr<icu::RegexPattern> regexPattern;
 
     // Decide which IsValid function to use
     std::string isValidType; // codes rules
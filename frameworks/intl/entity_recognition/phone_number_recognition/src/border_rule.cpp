@@ -36,6 +36,7 @@ BorderRule::BorderRule(icu::UnicodeString& regex, std::string& insensitive, std:
         this->type = 0;
     }
     this->insensitive = insensitive;
+    CompilePattern();
 }
 
 int BorderRule::GetType()
@@ -43,21 +44,24 @@ int BorderRule::GetType()
     return type;
 }
 
-icu::RegexPattern* BorderRule::GetPattern()
+void BorderRule::CompilePattern()
 {
     // Sets whether regular expression matching is case sensitive
     UErrorCode status = U_ZERO_ERROR;
-    icu::RegexPattern* pattern;
     if (insensitive.compare(TRUE_STR) == 0) {
-        pattern = icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status));
     } else {
-        pattern = icu::RegexPattern::compile(this->regex, 0, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, 0, status));
     }
     if (U_FAILURE(status)) {
-        HILOG_ERROR_I18N("BorderRule::GetPattern: Compile regex pattern failed.");
-        return nullptr;
+        HILOG_ERROR_I18N("BorderRule::CompilePattern: Compile regex pattern failed.");
+        regexPattern = nullptr;
     }
-    return pattern;
+}
+
+const icu::RegexPattern* BorderRule::GetPattern()
+{
+    return regexPattern.get();
 }
 
 bool BorderRule::Handle(PhoneNumberMatch* match, icu::UnicodeString& message)
@@ -69,7 +73,7 @@ bool BorderRule::Handle(PhoneNumberMatch* match, icu::UnicodeString& message)
     int endAddTen = end + 10 > message.length() ? message.length() : end + 10;
     icu::UnicodeString borderStr = message.tempSubString(beginSubTen, endAddTen - beginSubTen);
         
-    icu::RegexPattern* pattern = this->GetPattern();
+    const icu::RegexPattern* pattern = GetPattern();
     if (pattern == nullptr) {
         return false;
     }
@@ -77,7 +81,6 @@ bool BorderRule::Handle(PhoneNumberMatch* match, icu::UnicodeString& message)
     icu::RegexMatcher* mat = pattern->matcher(borderStr, status);
     if (U_FAILURE(status) || mat == nullptr) {
         HILOG_ERROR_I18N("BorderRule::Handle: Pattern matcher failed.");
-        delete pattern;
         return false;
     }
     int type = this->GetType();
@@ -94,12 +97,10 @@ bool BorderRule::Handle(PhoneNumberMatch* match, icu::UnicodeString& message)
         }
         if (isDel) {
             delete mat;
-            delete pattern;
             return false;
         }
     }
     delete mat;
-    delete pattern;
 
     return true;
 }
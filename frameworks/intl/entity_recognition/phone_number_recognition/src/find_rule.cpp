@@ -22,26 +22,27 @@ FindRule::FindRule(icu::UnicodeString& regex, std::string& insensitive)
 {
     this->regex = regex;
     this->insensitive = insensitive;
-    if (regex.length() == 0) {
-        return;
-    }
+    CompilePattern();
 }
 
-icu::RegexPattern* FindRule::GetPattern()
+void FindRule::CompilePattern()
 {
     UErrorCode status = U_ZERO_ERROR;
-    icu::RegexPattern* pattern;
     // Sets whether regular expression matching is case sensitive
     if (insensitive == "True") {
-        pattern = icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status));
     } else {
-        pattern = icu::RegexPattern::compile(this->regex, 0, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, 0, status));
     }
     if (U_FAILURE(status)) {
-        HILOG_ERROR_I18N("FindRule::GetPattern: Compile regex pattern failed.");
-        return nullptr;
+        HILOG_ERROR_I18N("FindRule::CompilePattern: Compile regex pattern failed.");
+        regexPattern = nullptr;
     }
-    return pattern;
+}
+
+const icu::RegexPattern* FindRule::GetPattern()
+{
+    return regexPattern.get();
 }
 } // namespace I18n
 } // namespace Global
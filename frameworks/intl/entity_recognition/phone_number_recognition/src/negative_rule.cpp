@@ -23,23 +23,27 @@ NegativeRule::NegativeRule(icu::UnicodeString& regex, std::string& insensitive)
 {
     this->regex = regex;
     this->insensitive = insensitive;
+    CompilePattern();
 }
 
-icu::RegexPattern* NegativeRule::GetPattern()
+void NegativeRule::CompilePattern()
 {
     UErrorCode status = U_ZERO_ERROR;
-    icu::RegexPattern* pattern;
     // Sets whether regular expression matching is case sensitive
     if (this->insensitive == "True") {
-        pattern = icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status));
     } else {
-        pattern = icu::RegexPattern::compile(this->regex, 0, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, 0, status));
     }
     if (U_FAILURE(status)) {
-        HILOG_ERROR_I18N("NegativeRule::GetPattern: Compile regex pattern failed.");
-        return nullptr;
+        HILOG_ERROR_I18N("NegativeRule::CompilePattern: Compile regex pattern failed.");
+        regexPattern = nullptr;
     }
-    return pattern;
+}
+
+const icu::RegexPattern* NegativeRule::GetPattern()
+{
+    return regexPattern.get();
 }
 
 void NegativeRule::ReplaceSpecifiedPos(icu::UnicodeString& chs, int start, int end)
@@ -57,7 +61,7 @@ void NegativeRule::ReplaceSpecifiedPos(icu::UnicodeString& chs, int start, int e
 icu::UnicodeString NegativeRule::Handle(icu::UnicodeString& src)
 {
     icu::UnicodeString ret = src;
-    icu::RegexPattern* pattern = GetPattern();
+    const icu::RegexPattern* pattern = GetPattern();
     if (pattern == nullptr) {
         HILOG_ERROR_I18N("NegativeRule::Handle: pattern is nullptr.");
         return ret;
@@ -70,7 +74,6 @@ icu::UnicodeString NegativeRule::Handle(icu::UnicodeString& src)
         ReplaceSpecifiedPos(ret, start, end);
     }
     delete matcher;
-    delete pattern;
     return ret;
 }
 } // namespace I18n
@@ -15,6 +15,7 @@
 
 #include <climits>
 #include <set>
+#include "entity_rules_registry.h"
 #include "i18n_hilog.h"
 #include "regex_rule.h"
 #include "phone_number_matched.h"
@@ -31,19 +32,14 @@ const UChar32 PhoneNumberMatched::REPLACE_CHAR = 'A';
 
 PhoneNumberMatched::PhoneNumberMatched(std::string& country)
 {
-    phoneNumberRule = new PhoneNumberRule(country);
+    phoneNumberRule = EntityRulesRegistry::GetPhoneNumberRule(country);
     phoneNumberUtil = PhoneNumberUtil::GetInstance();
-    shortNumberInfo = new ShortNumberInfo();
+    shortNumberInfo = EntityRulesRegistry::GetShortNumberInfo();
     this->country = country;
-    if (phoneNumberRule != nullptr) {
-        phoneNumberRule->Init();
-    }
 }
 
 PhoneNumberMatched::~PhoneNumberMatched()
 {
-    delete phoneNumberRule;
-    delete shortNumberInfo;
 }
 
 std::vector<int> PhoneNumberMatched::GetMatchedPhoneNumber(icu::UnicodeString& message)
@@ -138,14 +134,13 @@ std::vector<MatchedNumberInfo> PhoneNumberMatched::FindShortNumbers(std::string&
     }
     // 1 indicates the last position.
     FindRule* shortRegexRule = GetFindRulesInside()[pos - 1];
-    icu::RegexPattern* shortPattern = shortRegexRule->GetPattern();
+    const icu::RegexPattern* shortPattern = shortRegexRule->GetPattern();
     if (shortPattern == nullptr) {
         HILOG_ERROR_I18N("shortPattern getPattern failed.");
         return matchedNumberInfoList;
     }
     icu::RegexMatcher* shortMatch = shortPattern->matcher(message, status);
     if (U_FAILURE(status) || shortMatch == nullptr) {
-        delete shortPattern;
         HILOG_ERROR_I18N("shortPattern matcher failed.");
         return matchedNumberInfoList;
     }
@@ -172,7 +167,6 @@ std::vector<MatchedNumberInfo> PhoneNumberMatched::FindShortNumbers(std::string&
         }
     }
     delete shortMatch;
-    delete shortPattern;
     return matchedNumberInfoList;
 }
 
@@ -246,7 +240,7 @@ std::vector<PhoneNumberMatch*> PhoneNumberMatched::FindNumbers(std::string& coun
     }
     // 2 indicates the penultimate position.
     FindRule* numberRegexRule = GetFindRulesInside()[pos - 2];
-    icu::RegexPattern* numberPattern = numberRegexRule->GetPattern();
+    const icu::RegexPattern* numberPattern = numberRegexRule->GetPattern();
     if (numberPattern == nullptr) {
         HILOG_ERROR_I18N("numberRegexRule getPattern failed.");
         return matchList;
@@ -255,12 +249,10 @@ std::vector<PhoneNumberMatch*> PhoneNumberMatched::FindNumbers(std::string& coun
     icu::RegexMatcher* numberMatcher = numberPattern->matcher(filteredString, status);
     if (numberMatcher == nullptr) {
         HILOG_ERROR_I18N("numberPattern matcher failed.");
-        delete numberPattern;
         return matchList;
     }
     FindNumbersFromInputString(matchList, numberMatcher, country, filteredString);
     delete numberMatcher;
-    delete numberPattern;
     return matchList;
 }
 
@@ -312,7 +304,7 @@ bool PhoneNumberMatched::HandleWithShortAndShort(std::vector<MatchedNumberInfo>&
             HILOG_ERROR_I18N("PhoneNumberMatched::HandleWithShortAndShort: Get FindRule failed.");
             return false;
         }
-        icu::RegexPattern* pattern = regexRule->GetPattern();
+        const icu::RegexPattern* pattern = regexRule->GetPattern();
         if (pattern == nullptr) {
             HILOG_ERROR_I18N("regexRule getPattern failed.");
             return flag;
@@ -326,7 +318,6 @@ bool PhoneNumberMatched::HandleWithShortAndShort(std::vector<MatchedNumberInfo>&
         UErrorCode status = U_ZERO_ERROR;
         icu::RegexMatcher* matcher = pattern->matcher(str, status);
         if (U_FAILURE(status) || matcher == nullptr) {
-            delete pattern;
             HILOG_ERROR_I18N("pattern matcher failed.");
             return flag;
         }
@@ -336,7 +327,6 @@ bool PhoneNumberMatched::HandleWithShortAndShort(std::vector<MatchedNumberInfo>&
             flag = true;
         }
         delete matcher;
-        delete pattern;
     } else {
         result.push_back(info);
         ReplaceSpecifiedPos(filteredString, pos.first, pos.second);
@@ -29,23 +29,27 @@ PositiveRule::PositiveRule(icu::UnicodeString& regex, std::string& handleType, s
     this->regex = regex;
     this->handleType = handleType;
     this->insensitive = insensitive;
+    CompilePattern();
 }
 
-icu::RegexPattern* PositiveRule::GetPattern()
+void PositiveRule::CompilePattern()
 {
     UErrorCode status = U_ZERO_ERROR;
-    icu::RegexPattern* pattern;
     // Sets whether regular expression matching is case sensitive
     if (insensitive == "True") {
-        pattern = icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status));
     } else {
-        pattern = icu::RegexPattern::compile(this->regex, 0, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, 0, status));
     }
     if (U_FAILURE(status)) {
-        HILOG_ERROR_I18N("PositiveRule::GetPattern: Compile regex pattern failed.");
-        return nullptr;
+        HILOG_ERROR_I18N("PositiveRule::CompilePattern: Compile regex pattern failed.");
+        regexPattern = nullptr;
     }
-    return pattern;
+}
+
+const icu::RegexPattern* PositiveRule::GetPattern()
+{
+    return regexPattern.get();
 }
 
 // check whether the bracket at the start position are redundant
@@ -86,7 +90,7 @@ std::vector<MatchedNumberInfo> PositiveRule::Handle(PhoneNumberMatch* match, icu
     }
     icu::UnicodeString rawString = match->raw_string().c_str();
     icu::UnicodeString str = DealStringWithOneBracket(rawString);
-    icu::RegexPattern* pattern = this->GetPattern();
+    const icu::RegexPattern* pattern = GetPattern();
     if (pattern == nullptr) {
         return {};
     }
@@ -95,7 +99,6 @@ std::vector<MatchedNumberInfo> PositiveRule::Handle(PhoneNumberMatch* match, icu
     if (mat1 != nullptr && mat1->find(status)) {
         std::vector<MatchedNumberInfo> infoList = this->HandleInner(match, message);
         delete mat1;
-        delete pattern;
         return infoList;
     }
     delete mat1;
@@ -103,11 +106,9 @@ std::vector<MatchedNumberInfo> PositiveRule::Handle(PhoneNumberMatch* match, icu
     if (mat2 != nullptr && mat2->find(status)) {
         std::vector<MatchedNumberInfo> infoList = this->HandleInner(match, message);
         delete mat2;
-        delete pattern;
         return infoList;
     }
     delete mat2;
-    delete pattern;
     return {};
 }
 
@@ -165,7 +166,7 @@ std::vector<MatchedNumberInfo> PositiveRule::HandleBlank(PhoneNumberMatch* possi
     if (possibleNumber == nullptr) {
         return matchedNumberInfoList;
     }
-    icu::RegexPattern* pattern = GetPattern();
+    const icu::RegexPattern* pattern = GetPattern();
     if (pattern == nullptr) {
         return matchedNumberInfoList;
     }
@@ -189,7 +190,6 @@ std::vector<MatchedNumberInfo> PositiveRule::HandleBlank(PhoneNumberMatch* possi
     if (matcher->find()) {
         if (negativePattern.find() || number == speString) {
             delete matcher;
-            delete pattern;
             return matchedNumberInfoList;
         }
         MatchedNumberInfo matchedNumberInfo;
@@ -203,7 +203,6 @@ std::vector<MatchedNumberInfo> PositiveRule::HandleBlank(PhoneNumberMatch* possi
         matchedNumberInfoList.push_back(matchedNumberInfo);
     }
     delete matcher;
-    delete pattern;
     return matchedNumberInfoList;
 }
 
@@ -213,7 +212,7 @@ std::vector<MatchedNumberInfo> PositiveRule::HandleSlant(PhoneNumberMatch* possi
     if (possibleNumber == nullptr) {
         return matchedNumberInfoList;
     }
-    icu::RegexPattern* pattern = GetPattern();
+    const icu::RegexPattern* pattern = GetPattern();
     if (pattern == nullptr) {
         return matchedNumberInfoList;
     }
@@ -250,7 +249,6 @@ std::vector<MatchedNumberInfo> PositiveRule::HandleSlant(PhoneNumberMatch* possi
         }
     }
     delete matcher;
-    delete pattern;
     return matchedNumberInfoList;
 }
 
@@ -322,7 +320,7 @@ std::vector<MatchedNumberInfo> PositiveRule::HandlePossibleNumberWithPattern(Pho
     if (possibleNumber == nullptr) {
         return matchedList;
     }
-    icu::RegexPattern* pattern = GetPattern();
+    const icu::RegexPattern* pattern = GetPattern();
     if (pattern == nullptr) {
         HILOG_ERROR_I18N("PositiveRule::HandlePossibleNumberWithPattern: RegexPattern is nullptr.");
         return matchedList;
@@ -348,7 +346,6 @@ std::vector<MatchedNumberInfo> PositiveRule::HandlePossibleNumberWithPattern(Pho
         }
     }
     delete mat;
-    delete pattern;
     return matchedList;
 }
 } // namespace I18n
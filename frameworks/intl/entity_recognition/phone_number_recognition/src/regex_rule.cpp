@@ -42,6 +42,7 @@ RegexRule::RegexRule(icu::UnicodeString& regex, std::string& isValidType, std::s
     this->isValidType = isValidType;
     this->handleType = handleType;
     this->insensitive = insensitive;
+    CompilePattern();
 }
 
 RegexRule::~RegexRule()
@@ -65,21 +66,24 @@ int RegexRule::GetType()
     return type;
 }
 
-icu::RegexPattern* RegexRule::GetPattern()
+void RegexRule::CompilePattern()
 {
     UErrorCode status = U_ZERO_ERROR;
-    icu::RegexPattern* pattern;
     // Sets whether regular expression matching is case sensitive
     if (insensitive == "True") {
-        pattern = icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, URegexpFlag::UREGEX_CASE_INSENSITIVE, status));
     } else {
-        pattern = icu::RegexPattern::compile(this->regex, 0, status);
+        regexPattern.reset(icu::RegexPattern::compile(this->regex, 0, status));
     }
     if (U_FAILURE(status)) {
-        HILOG_ERROR_I18N("RegexRule::GetPattern: Compile regex pattern failed.");
-        return nullptr;
+        HILOG_ERROR_I18N("RegexRule::CompilePattern: Compile regex pattern failed.");
+        regexPattern = nullptr;
     }
-    return pattern;
+}
+
+const icu::RegexPattern* RegexRule::GetPattern()
+{
+    return regexPattern.get();
 }
 
 PhoneNumberMatch* RegexRule::IsValid(PhoneNumberMatch* possibleNumber, icu::UnicodeString& message)
@@ -337,7 +341,7 @@ std::vector<MatchedNumberInfo> RegexRule::HandleBlank(PhoneNumberMatch* possible
     if (possibleNumber == nullptr) {
         return matchedNumberInfoList;
     }
-    icu::RegexPattern* pattern = GetPattern();
+    const icu::RegexPattern* pattern = GetPattern();
     if (pattern == nullptr) {
         return matchedNumberInfoList;
     }
@@ -353,7 +357,6 @@ std::vector<MatchedNumberInfo> RegexRule::HandleBlank(PhoneNumberMatch* possible
     icu::RegexMatcher negativePattern(negativeRegex, 0, status);
     if (U_FAILURE(status)) {
         delete matcher;
-        delete pattern;
         return matchedNumberInfoList;
     }
     negativePattern.reset(number);
@@ -362,7 +365,6 @@ std::vector<MatchedNumberInfo> RegexRule::HandleBlank(PhoneNumberMatch* possible
         icu::UnicodeString speString = "5201314";
         if (negativePattern.find() || number == speString) {
             delete matcher;
-            delete pattern;
             return matchedNumberInfoList;
         }
         MatchedNumberInfo matchedNumberInfo;
@@ -376,7 +378,6 @@ std::vector<MatchedNumberInfo> RegexRule::HandleBlank(PhoneNumberMatch* possible
         matchedNumberInfoList.push_back(matchedNumberInfo);
     }
     delete matcher;
-    delete pattern;
     return matchedNumberInfoList;
 }
 
@@ -386,7 +387,7 @@ std::vector<MatchedNumberInfo> RegexRule::HandleSlant(PhoneNumberMatch* possible
     if (possibleNumber == nullptr) {
         return matchedNumberInfoList;
     }
-    icu::RegexPattern* pattern = GetPattern();
+    const icu::RegexPattern* pattern = GetPattern();
     if (pattern == nullptr) {
         HILOG_ERROR_I18N("RegexRule::HandleSlant: pattern is nullptr.");
         return matchedNumberInfoList;
@@ -424,7 +425,6 @@ std::vector<MatchedNumberInfo> RegexRule::HandleSlant(PhoneNumberMatch* possible
         }
     }
     delete matcher;
-    delete pattern;
     return matchedNumberInfoList;
 }
 
@@ -523,7 +523,7 @@ std::vector<MatchedNumberInfo> RegexRule::HandlePossibleNumberWithPattern(PhoneN
     if (possibleNumber == nullptr) {
         return matchedList;
     }
-    icu::RegexPattern* pattern = GetPattern();
+    const icu::RegexPattern* pattern = GetPattern();
     if (pattern == nullptr) {
         HILOG_ERROR_I18N("RegexPattern is nullptr.");
         return matchedList;
@@ -549,7 +549,6 @@ std::vector<MatchedNumberInfo> RegexRule::HandlePossibleNumberWithPattern(PhoneN
         }
     }
     delete mat;
-    delete pattern;
     return matchedList;
 }
 } // namespace I18n
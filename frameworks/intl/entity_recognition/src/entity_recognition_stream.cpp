@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "entity_recognition_stream.h"
+
+#include <algorithm>
+#include <utility>
+#include "i18n_hilog.h"
+#include "unicode/utf8.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+namespace {
+// A window must advance by more than the longest UTF-8 character after alignment.
+constexpr size_t MIN_WINDOW_ADVANCE = 8;
+constexpr unsigned char UTF8_TRAIL_MASK = 0xC0;
+constexpr unsigned char UTF8_TRAIL_BITS = 0x80;
+constexpr UChar32 MAX_BMP_CODE_POINT = 0xFFFF;
+}
+
+EntityRecognitionStream::EntityRecognitionStream(EntityRecognizer& recognizer, EntitySpanCallback callback,
+    size_t chunkLength, size_t overlapLength) : recognizer(recognizer), callback(std::move(callback)),
+    chunkLength(std::max(chunkLength, overlapLength + MIN_WINDOW_ADVANCE)), overlapLength(overlapLength)
+{
+}
+
+void EntityRecognitionStream::Append(const std::string& text)
+{
+    buffer.append(text);
+    size_t windowLength = chunkLength + overlapLength;
+    while (buffer.length() - bufferPos >= windowLength) {
+        ProcessWindow(windowLength, false);
+    }
+    buffer.erase(0, bufferPos);
+    bufferPos = 0;
+}
+
+void EntityRecognitionStream::Finish()
+{
+    if (buffer.length() > bufferPos) {
+        ProcessWindow(buffer.length() - bufferPos, true);
+    }
+    buffer.clear();
+    bufferPos = 0;
+    windowUtf8Start = 0;
+    windowUtf16Start = 0;
+    committedUtf8 = 0;
+}
+
+void EntityRecognitionStream::ProcessWindow(size_t windowLength, bool isLast)
+{
+    size_t commitLength = windowLength;
+    size_t nextStart = windowLength;
+    if (!isLast) {
+        windowLength = AlignToCharBoundary(bufferPos + windowLength) - bufferPos;
+        commitLength = AlignToCharBoundary(bufferPos + windowLength - overlapLength) - bufferPos;
+        nextStart = AlignToCharBoundary(bufferPos + commitLength - overlapLength) - bufferPos;
+    }
+    std::string window = buffer.substr(bufferPos, windowLength);
+
+    // Map every UTF-16 offset of the window to its UTF-8 offset.
+    std::vector<size_t> utf16ToUtf8;
+    utf16ToUtf8.reserve(windowLength + 1);
+    size_t nextStartUtf16 = 0;
+    int32_t length = static_cast<int32_t>(window.length());
+    int32_t offset = 0;
+    while (offset < length) {
+        size_t charStart = static_cast<size_t>(offset);
+        if (charStart == nextStart) {
+            nextStartUtf16 = utf16ToUtf8.size();
+        }
+        UChar32 c = 0;
+        U8_NEXT(window.data(), offset, length, c);
+        utf16ToUtf8.push_back(charStart);
+        if (c > MAX_BMP_CODE_POINT) {
+            utf16ToUtf8.push_back(charStart);
+        }
+    }
+    if (nextStart >= window.length()) {
+        nextStartUtf16 = utf16ToUtf8.size();
+    }
+    utf16ToUtf8.push_back(window.length());
+
+    std::vector<std::vector<int>> entityInfo = recognizer.FindEntityInfo(window);
+    std::vector<EntitySpan> spans;
+    const EntityKind kinds[] = { EntityKind::PHONE_NUMBER, EntityKind::DATE_TIME };
+    for (size_t i = 0; i < entityInfo.size() && i < sizeof(kinds) / sizeof(kinds[0]); ++i) {
+        EmitSpans(entityInfo[i], kinds[i], utf16ToUtf8, commitLength, spans);
+    }
+    std::stable_sort(spans.begin(), spans.end(), [](const EntitySpan& first, const EntitySpan& second) {
+        return first.utf8Begin < second.utf8Begin;
+    });
+    if (callback) {
+        for (const EntitySpan& span : spans) {
+            callback(span);
+        }
+    }
+
+    committedUtf8 = windowUtf8Start + commitLength;
+    windowUtf8Start += nextStart;
+    windowUtf16Start += nextStartUtf16;
+    bufferPos += nextStart;
+}
+
+void EntityRecognitionStream::EmitSpans(const std::vector<int>& info, EntityKind kind,
+    const std::vector<size_t>& utf16ToUtf8, size_t commitLength, std::vector<EntitySpan>& spans)
+{
+    if (info.empty() || info[0] <= 0) {
+        return;
+    }
+    size_t count = static_cast<size_t>(info[0]);
+    for (size_t i = 0; i < count; ++i) {
+        // Positions are stored as count, begin1, end1, begin2, end2...
+        size_t beginIndex = 2 * i + 1;
+        if (beginIndex + 1 >= info.size() || info[beginIndex] < 0 || info[beginIndex] > info[beginIndex + 1] ||
+            static_cast<size_t>(info[beginIndex + 1]) >= utf16ToUtf8.size()) {
+            HILOG_ERROR_I18N("EntityRecognitionStream::EmitSpans: invalid entity position.");
+            return;
+        }
+        size_t utf16Begin = static_cast<size_t>(info[beginIndex]);
+        size_t utf16End = static_cast<size_t>(info[beginIndex + 1]);
+        size_t utf8Begin = utf16ToUtf8[utf16Begin];
+        // Entities starting in the overlap are reported by the next window, and those starting
+        // before the last commit point were reported by the previous one.
+        if (utf8Begin >= commitLength || windowUtf8Start + utf8Begin < committedUtf8) {
+            continue;
+        }
+        EntitySpan span { kind, windowUtf8Start + utf8Begin, windowUtf8Start + utf16ToUtf8[utf16End],
+            windowUtf16Start + utf16Begin, windowUtf16Start + utf16End };
+        spans.push_back(span);
+    }
+}
+
+size_t EntityRecognitionStream::AlignToCharBoundary(size_t offset) const
+{
+    while (offset > bufferPos && offset < buffer.length() &&
+        (static_cast<unsigned char>(buffer[offset]) & UTF8_TRAIL_MASK) == UTF8_TRAIL_BITS) {
+        --offset;
+    }
+    return offset;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
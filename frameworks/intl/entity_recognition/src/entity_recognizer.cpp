@@ -14,6 +14,7 @@
  */
 #include "entity_recognizer.h"
 #include "i18n_hilog.h"
+#include "text_normalizer.h"
 
 namespace OHOS {
 namespace Global {
@@ -45,7 +46,7 @@ EntityRecognizer::~EntityRecognizer()
 std::vector<std::vector<int>> EntityRecognizer::FindEntityInfo(std::string& message)
 {
     icu::UnicodeString messageStr = message.c_str();
-    messageStr = ConvertQanChar(messageStr);
+    messageStr = TextNormalizer::ToHalfWidth(messageStr);
     std::vector<std::vector<int>> EntityInfo;
     if (phoneNumberMatched == nullptr) {
         HILOG_ERROR_I18N("FindEntityInfo failed because phoneNumberMatched is nullptr.");
@@ -61,28 +62,6 @@ std::vector<std::vector<int>> EntityRecognizer::FindEntityInfo(std::string& mess
     EntityInfo.push_back(dateTimeInfo);
     return EntityInfo;
 }
-
-// replace full-width symbols with half-width symbols
-icu::UnicodeString EntityRecognizer::ConvertQanChar(icu::UnicodeString& instr)
-{
-    icu::UnicodeString result = "";
-    icu::UnicodeString fwchstrFirst = "：／．＼∕，！（）？﹡；：﹣—－【】－＋＝｛％｝１２３４５６７８９０ａｂｃｄｅｆｇｈｉ";
-    icu::UnicodeString fwchstrSecond = "ｊｋｌｍｎｏｐｑｒｓｔｕｖｗｘｙｚＡＢＣＤＥＦＧＨＩＪＫＬＭＮＯＰＱＲＳＴＵＶＷＸＹＺ";
-    icu::UnicodeString fwchstr = fwchstrFirst + fwchstrSecond;
-    icu::UnicodeString hwchstrFirst = ":/.\\/,!()?*;:---[]-+={%}1234567890abcdefghi";
-    icu::UnicodeString hwchstrSecond = "jklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
-    icu::UnicodeString hwchstr = hwchstrFirst + hwchstrSecond;
-    int len = instr.length();
-    for (int i = 0; i < len; i++) {
-        int index = fwchstr.indexOf(instr[i]);
-        if (index == -1) {
-            result += instr[i];
-        } else {
-            result += hwchstr[index];
-        }
-    }
-    return result;
-}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
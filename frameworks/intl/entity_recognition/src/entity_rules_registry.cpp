@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "entity_rules_registry.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+std::mutex EntityRulesRegistry::phoneNumberMutex;
+std::mutex EntityRulesRegistry::dateMutex;
+std::mutex EntityRulesRegistry::shortNumberMutex;
+std::unordered_map<std::string, std::weak_ptr<PhoneNumberRule>> EntityRulesRegistry::phoneNumberRules;
+std::unordered_map<std::string, std::weak_ptr<DateRuleInit>> EntityRulesRegistry::dateRules;
+std::weak_ptr<i18n::phonenumbers::ShortNumberInfo> EntityRulesRegistry::shortNumberInfo;
+
+std::shared_ptr<PhoneNumberRule> EntityRulesRegistry::GetPhoneNumberRule(const std::string& region)
+{
+    std::lock_guard<std::mutex> lock(phoneNumberMutex);
+    std::weak_ptr<PhoneNumberRule>& entry = phoneNumberRules[region];
+    std::shared_ptr<PhoneNumberRule> rule = entry.lock();
+    if (rule != nullptr) {
+        return rule;
+    }
+    std::string country = region;
+    rule = std::make_shared<PhoneNumberRule>(country);
+    rule->Init();
+    entry = rule;
+    return rule;
+}
+
+std::shared_ptr<DateRuleInit> EntityRulesRegistry::GetDateRule(const std::string& language)
+{
+    std::lock_guard<std::mutex> lock(dateMutex);
+    std::weak_ptr<DateRuleInit>& entry = dateRules[language];
+    std::shared_ptr<DateRuleInit> rule = entry.lock();
+    if (rule != nullptr) {
+        return rule;
+    }
+    std::string locale = language;
+    rule = std::make_shared<DateRuleInit>(locale);
+    entry = rule;
+    return rule;
+}
+
+std::shared_ptr<i18n::phonenumbers::ShortNumberInfo> EntityRulesRegistry::GetShortNumberInfo()
+{
+    std::lock_guard<std::mutex> lock(shortNumberMutex);
+    std::shared_ptr<i18n::phonenumbers::ShortNumberInfo> info = shortNumberInfo.lock();
+    if (info == nullptr) {
+        info = std::make_shared<i18n::phonenumbers::ShortNumberInfo>();
+        shortNumberInfo = info;
+    }
+    return info;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "text_normalizer.h"
+#include <array>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+namespace {
+// the full-width forms U+FF01-U+FF5E are the ASCII characters U+0021-U+007E shifted by 0xFEE0.
+constexpr UChar FULL_WIDTH_FIRST = 0xFF01;
+constexpr UChar FULL_WIDTH_LAST = 0xFF5E;
+constexpr UChar FULL_WIDTH_OFFSET = 0xFEE0;
+constexpr size_t FULL_WIDTH_COUNT = FULL_WIDTH_LAST - FULL_WIDTH_FIRST + 1;
+// no character below U+2014 is folded, which keeps ASCII and Latin text on the fast path.
+constexpr UChar MIN_FOLDED_CHAR = 0x2014;
+constexpr char FOLDED_PUNCTUATION[] = "!%()+,-./:;=?\\{}";
+
+constexpr std::array<UChar, FULL_WIDTH_COUNT> BuildHalfWidthTable()
+{
+    std::array<UChar, FULL_WIDTH_COUNT> table {};
+    for (UChar ch = u'0'; ch <= u'9'; ++ch) {
+        table[ch + FULL_WIDTH_OFFSET - FULL_WIDTH_FIRST] = ch;
+    }
+    for (UChar ch = u'a'; ch <= u'z'; ++ch) {
+        table[ch + FULL_WIDTH_OFFSET - FULL_WIDTH_FIRST] = ch;
+    }
+    for (UChar ch = u'A'; ch <= u'Z'; ++ch) {
+        table[ch + FULL_WIDTH_OFFSET - FULL_WIDTH_FIRST] = ch;
+    }
+    for (size_t i = 0; FOLDED_PUNCTUATION[i] != '\0'; ++i) {
+        UChar ch = static_cast<UChar>(FOLDED_PUNCTUATION[i]);
+        table[ch + FULL_WIDTH_OFFSET - FULL_WIDTH_FIRST] = ch;
+    }
+    return table;
+}
+
+// half-width form of each character in U+FF01-U+FF5E, 0 means the character is kept.
+constexpr std::array<UChar, FULL_WIDTH_COUNT> HALF_WIDTH_TABLE = BuildHalfWidthTable();
+} // namespace
+
+UChar TextNormalizer::ToHalfWidth(UChar ch)
+{
+    if (ch < MIN_FOLDED_CHAR) {
+        return ch;
+    }
+    if (ch >= FULL_WIDTH_FIRST && ch <= FULL_WIDTH_LAST) {
+        UChar halfWidth = HALF_WIDTH_TABLE[ch - FULL_WIDTH_FIRST];
+        return halfWidth == 0 ? ch : halfWidth;
+    }
+    switch (ch) {
+        case 0x2014: // EM DASH
+        case 0xFE63: // SMALL HYPHEN-MINUS
+            return u'-';
+        case 0x2215: // DIVISION SLASH
+            return u'/';
+        case 0x3010: // LEFT BLACK LENTICULAR BRACKET
+            return u'[';
+        case 0x3011: // RIGHT BLACK LENTICULAR BRACKET
+            return u']';
+        case 0xFE61: // SMALL ASTERISK
+            return u'*';
+        default:
+            return ch;
+    }
+}
+
+icu::UnicodeString TextNormalizer::ToHalfWidth(const icu::UnicodeString& text)
+{
+    int32_t len = text.length();
+    int32_t first = 0;
+    while (first < len && ToHalfWidth(text.charAt(first)) == text.charAt(first)) {
+        ++first;
+    }
+    if (first == len) {
+        return text;
+    }
+    icu::UnicodeString result(text);
+    UChar* buffer = result.getBuffer(len);
+    if (buffer == nullptr) {
+        return text;
+    }
+    for (int32_t i = first; i < len; ++i) {
+        buffer[i] = ToHalfWidth(buffer[i]);
+    }
+    result.releaseBuffer(len);
+    return result;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
@@ -15,6 +15,8 @@
 #ifndef GLOBAL_I18N_COLLATOR_H
 #define GLOBAL_I18N_COLLATOR_H
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <set>
@@ -39,6 +41,21 @@ typedef enum CompareResult {
     GREATER,
 } CompareResult;
 
+/**
+ * Binary collation keys of a list of strings, stored in one buffer. Keys are compared with
+ * memcmp, so a list is converted to UTF-16 and collated once instead of on every comparison.
+ */
+class SortKeyBatch {
+public:
+    size_t Size() const;
+    bool Less(size_t first, size_t second) const;
+
+private:
+    friend class Collator;
+    std::vector<uint8_t> keys;
+    std::vector<size_t> offsets { 0 };
+};
+
 class Collator {
 public:
     static std::vector<std::string> SupportedLocalesOf(const std::vector<std::string> &requestLocales,
@@ -50,6 +67,32 @@ public:
         const std::string &defaultLocale);
     ~Collator();
     CompareResult Compare(const std::string &first, const std::string &second);
+
+    /**
+     * @brief Get the binary sort key of a string. Two keys compare with memcmp the same way
+     * the strings compare with Compare.
+     *
+     * @param text Indicates the string.
+     * @param sortKey Used to return the sort key.
+     * @return Returns false if the collator is invalid.
+     */
+    bool GetSortKey(const std::string &text, std::vector<uint8_t> &sortKey);
+
+    /**
+     * @brief Get the sort keys of a list of strings.
+     *
+     * @param texts Indicates the strings.
+     * @param batch Used to return the sort keys, in the order of texts.
+     * @return Returns false if the collator is invalid.
+     */
+    bool GetSortKeys(const std::vector<std::string> &texts, SortKeyBatch &batch);
+
+    /**
+     * @brief Sort strings in collation order. Equal strings keep their relative order.
+     *
+     * @param texts Indicates the strings to sort.
+     */
+    void Sort(std::vector<std::string> &texts);
     void ResolvedOptions(std::map<std::string, std::string> &options);
     I18nErrorCode GetError() const;
 
@@ -68,6 +111,8 @@ private:
     icu::Collator *collatorPtr = nullptr;
     bool createSuccess = false;
     I18nErrorCode i18nStatus = I18nErrorCode::SUCCESS;
+    static constexpr size_t SORT_KEY_BYTES_PER_CHAR = 4;
+    static constexpr size_t MIN_SORT_KEY_LENGTH = 32;
 
     static std::set<std::string> GetAvailableLocales();
     void ParseAllOptions(std::map<std::string, std::string> &options);
@@ -79,6 +124,7 @@ private:
     void SetSensitivity();
     void SetIgnorePunctuation();
     bool InitCollator();
+    bool AppendSortKey(const std::string &text, std::vector<uint8_t> &buffer);
     void Init(std::vector<std::string> &localeTags, std::map<std::string, std::string> &options,
         const std::string &defaultLocale);
 };
@@ -39,6 +39,14 @@ public:
     DateTimeFormat(const std::vector<std::string> &localeTags, std::map<std::string, std::string> &configs);
     virtual ~DateTimeFormat();
     std::string Format(int64_t milliseconds);
+
+    /**
+     * @brief Format a batch of timestamps, the time zone is resolved once for the whole batch.
+     *
+     * @param milliseconds Represents the timestamps to format.
+     * @return The formatted strings in the same order as milliseconds.
+     */
+    std::vector<std::string> Format(const std::vector<int64_t> &milliseconds);
     std::string FormatRange(int64_t fromMilliseconds, int64_t toMilliseconds);
     void GetResolvedOptions(std::map<std::string, std::string> &map);
     std::string GetDateStyle() const;
@@ -90,6 +98,8 @@ private:
     std::unique_ptr<icu::DateIntervalFormat> dateIntvFormat = nullptr;
     std::unique_ptr<icu::Calendar> calendar = nullptr;
     std::unique_ptr<LocaleInfo> localeInfo = nullptr;
+    std::unique_ptr<icu::TimeZone> formatTimeZone = nullptr;
+    std::string formatTimeZoneId;
     icu::Locale locale;
     icu::UnicodeString pattern;
     char16_t yearChar = 'Y';
@@ -161,6 +171,8 @@ private:
     bool InitPatternByNumeric();
     void ReplacePattern(const icu::UnicodeString& tempPattern, const icu::UnicodeString& replacePattern);
     bool InitFormatter();
+    const icu::TimeZone* UpdateFormatTimeZone();
+    std::string FormatWithoutZoneUpdate(int64_t milliseconds);
     static icu::UnicodeString GetBestPattern(const icu::UnicodeString& skeleton, const icu::Locale& icuLocale);
     static icu::UnicodeString GetBestPattern(icu::DateFormat::EStyle dateStyle, icu::DateFormat::EStyle timeStyle,
         const icu::Locale& icuLocale);
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 #include "unicode/smpdtfmt.h"
+#include "format_utils.h"
 
 namespace OHOS {
 namespace Global {
@@ -34,6 +35,7 @@ public:
     size_t GetLength() const;
 
     static std::string ConvertFieldIdToDateType(int32_t fieldId);
+    static FormatPartType ConvertFieldIdToPartType(int32_t fieldId);
     static std::pair<icu::UnicodeString, std::vector<DateTimeFormatPart>> ParseToParts(
         std::shared_ptr<icu::SimpleDateFormat> icuSimpleDateFormat, double milliseconds);
 
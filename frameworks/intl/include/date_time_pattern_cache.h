@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_DATE_TIME_PATTERN_CACHE_H
+#define OHOS_GLOBAL_I18N_DATE_TIME_PATTERN_CACHE_H
+
+#include <memory>
+#include <string>
+#include "lru_cache.h"
+#include "unicode/dtptngen.h"
+#include "unicode/locid.h"
+#include "unicode/unistr.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+/**
+ * Bounded LRU caches shared by the date time formatters: prototype DateTimePatternGenerators
+ * keyed by locale name, and resolved patterns keyed by locale name and skeleton.
+ */
+class DateTimePatternCache {
+public:
+    /**
+     * @brief Create a DateTimePatternGenerator for locale by cloning a cached prototype.
+     *
+     * @param locale Represents the locale of the generator.
+     * @param status Output the ICU status, set the same way as DateTimePatternGenerator::createInstance.
+     * @return The generator owned by the caller, nullptr if failed.
+     */
+    static icu::DateTimePatternGenerator* CreateGenerator(const icu::Locale& locale, UErrorCode& status);
+
+    /**
+     * @brief Look up a pattern resolved before for (locale, skeleton).
+     *
+     * @param key Represents the skeleton or any other string which identifies the pattern for the locale.
+     * @return Return true and fill pattern if found.
+     */
+    static bool FindPattern(const icu::Locale& locale, const std::string& key, icu::UnicodeString& pattern);
+    static void AddPattern(const icu::Locale& locale, const std::string& key, const icu::UnicodeString& pattern);
+    static void Clear();
+
+private:
+    static LruCache<std::string, std::shared_ptr<const icu::DateTimePatternGenerator>> generatorCache;
+    static LruCache<std::string, icu::UnicodeString> patternCache;
+    static constexpr size_t GENERATOR_CACHE_CAPACITY = 8;
+    static constexpr size_t PATTERN_CACHE_CAPACITY = 256;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
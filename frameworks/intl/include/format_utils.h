@@ -15,20 +15,101 @@
 #ifndef OHOS_GLOBAL_I18N_FORMAT_UTILS_H
 #define OHOS_GLOBAL_I18N_FORMAT_UTILS_H
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include "unicode/unistr.h"
 #include "unicode/unum.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+enum class FormatPartType : uint8_t {
+    LITERAL = 0,
+    YEAR,
+    YEAR_NAME,
+    RELATED_YEAR,
+    MONTH,
+    DAY,
+    HOUR,
+    MINUTE,
+    SECOND,
+    FRACTIONAL_SECOND,
+    WEEKDAY,
+    DAY_PERIOD,
+    TIME_ZONE_NAME,
+    ERA,
+    INTEGER,
+    FRACTION,
+    DECIMAL,
+    GROUP,
+    CURRENCY,
+    PERCENT_SIGN,
+    EXPONENT_SEPARATOR,
+    EXPONENT_MINUS_SIGN,
+    EXPONENT_INTEGER,
+    COMPACT,
+    UNIT,
+    APPROXIMATELY_SIGN,
+    NAN_VALUE,
+    INFINITY_VALUE,
+    MINUS_SIGN,
+    PLUS_SIGN,
+    UNKNOWN,
+    END,
+};
+
+/**
+ * One part of a formatted string, [begin, end) are byte offsets into FormattedParts::text.
+ */
+struct FormatPartSpan {
+    FormatPartType type;
+    int32_t begin;
+    int32_t end;
+};
+
+/**
+ * The formatted string in UTF-8 and its parts in order, without a string per part.
+ */
+struct FormattedParts {
+    std::string text;
+    std::vector<FormatPartSpan> spans;
+};
+
 class FormatUtils {
 public:
     static std::string GetNumberFieldType(const std::string &napiType,
         const int32_t fieldId, const double number);
+    static FormatPartType GetNumberFieldPartType(const std::string &napiType,
+        const int32_t fieldId, const double number);
+
+    /**
+     * @brief Get the part type name used by formatToParts, such as "integer" or "literal".
+     */
+    static const std::string& GetPartTypeName(FormatPartType type);
+
+    /**
+     * @brief Set parts.text to formatted in UTF-8 and convert parts.spans from UTF-16 offsets into
+     * formatted to UTF-8 offsets into parts.text.
+     *
+     * @param formatted Represents the string returned by icu.
+     * @param parts Represents the parts, whose spans hold UTF-16 offsets on input.
+     */
+    static void SetFormattedText(const icu::UnicodeString& formatted, FormattedParts& parts);
+
+    /**
+     * @brief Get the part type of a name returned by GetPartTypeName, UNKNOWN if there is none.
+     */
+    static FormatPartType GetPartType(const std::string& name);
+
+    /**
+     * @brief Expand the parts to the [type, value] pairs returned by the old formatToParts interfaces.
+     */
+    static void AppendPartStrings(const FormattedParts& parts, std::vector<std::vector<std::string>>& result);
 
 private:
-    static const std::unordered_map<UNumberFormatFields, std::string> NUMBER_FORMAT_FIELD_MAP;
+    static const std::unordered_map<UNumberFormatFields, FormatPartType> NUMBER_FORMAT_FIELD_MAP;
 };
 } // namespace I18n
 } // namespace Global
@@ -16,6 +16,7 @@
 #ifndef OHOS_GLOBAL_HOLIDAY_MANAGER_H
 #define OHOS_GLOBAL_HOLIDAY_MANAGER_H
 
+#include <cstddef>
 #include <string>
 #include <vector>
 #include "map"
@@ -48,6 +49,35 @@ struct HolidayInfoItem {
     std::vector<HolidayLocalName> localNames;
 };
 
+/**
+ * Holidays of a HolidayManager in order of their start day. The range points into the manager and is
+ * valid until SetHolidayData is called or the manager is destroyed.
+ */
+struct HolidayInfoItemRange {
+    const HolidayInfoItem* first = nullptr;
+    const HolidayInfoItem* last = nullptr;
+
+    const HolidayInfoItem* begin() const
+    {
+        return first;
+    }
+
+    const HolidayInfoItem* end() const
+    {
+        return last;
+    }
+
+    size_t size() const
+    {
+        return static_cast<size_t>(last - first);
+    }
+
+    bool empty() const
+    {
+        return first == last;
+    }
+};
+
 class HolidayManager {
 public:
     HolidayManager(const char* path);
@@ -56,15 +86,42 @@ public:
     bool IsHoliday(int32_t year, int32_t month, int32_t day);
     std::vector<HolidayInfoItem> GetHolidayInfoItemArray(int32_t year);
     std::vector<HolidayInfoItem> GetHolidayInfoItemArray();
+
+    /**
+     * @brief Replace the holiday data. Not thread safe: it must not run concurrently with any query,
+     * and it invalidates every range returned by GetHolidayInfoItems.
+     */
     void SetHolidayData(std::map<std::string, std::vector<HolidayInfoItem>> holidayDataMap);
 
+    /**
+     * @brief Get the holidays which start in [fromDateKey, toDateKey) without copying them.
+     *
+     * @param fromDateKey Represents the first day, created by GetDateKey.
+     * @param toDateKey Represents the day after the last day, created by GetDateKey.
+     * @return Returns the holidays in order of their start day. The range is invalidated by
+     * SetHolidayData and is not safe against a concurrent call to it.
+     */
+    HolidayInfoItemRange GetHolidayInfoItems(int32_t fromDateKey, int32_t toDateKey) const;
+
+    /**
+     * @brief Get the integer key of a day, which is year * 10000 + month * 100 + day.
+     *
+     * @return Returns -1 if the date is out of range.
+     */
+    static int32_t GetDateKey(int32_t year, int32_t month, int32_t day);
+
 private:
     std::vector<HolidayInfoItem> ReadHolidayFile(const std::string &path);
     void ParseFileLine(const std::string &line, HolidayInfoItem *holidayItem);
     std::string GetLanguageFromPath(const char* path);
     static std::string& Trim(std::string &str);
-    std::string Format(int32_t year, int32_t month, int32_t day);
-    std::map<std::string, std::vector<HolidayInfoItem>> holidayItemMap;
+    static bool GetCurrentDate(int32_t& year, int32_t& month, int32_t& day);
+    static int32_t ParseDateKey(const std::string& date);
+    void BuildIndex(std::vector<std::pair<int32_t, HolidayInfoItem>>& keyedItems);
+
+    // Sorted start day keys and the holidays starting on them, holidayItems[i] starts on holidayDateKeys[i].
+    std::vector<int32_t> holidayDateKeys;
+    std::vector<HolidayInfoItem> holidayItems;
     static const char* ITEM_BEGIN_TAG;
     static const char* ITEM_END_TAG;
     static const char* ITEM_DTSTART_TAG;
@@ -73,6 +130,11 @@ private:
     static const char* ITEM_RESOURCES_TAG;
     static const int32_t MONTH_GREATER_ONE = 1; // 1 is real month greater than display
     static const int32_t YEAR_START = 1900; // 1900 is where tm_year start
+    static const int32_t MAX_YEAR = 9999;
+    static const int32_t MAX_MONTH = 12;
+    static const int32_t MAX_DAY = 31;
+    static const int32_t YEAR_KEY_UNIT = 10000;
+    static const int32_t MONTH_KEY_UNIT = 100;
 };
 } // namespace I18n
 } // namespace Global
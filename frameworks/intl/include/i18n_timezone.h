@@ -15,6 +15,7 @@
 #ifndef OHOS_GLOBAL_I18N_TIMEZONE_H
 #define OHOS_GLOBAL_I18N_TIMEZONE_H
 
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <mutex>
@@ -27,10 +28,14 @@
 #include <unordered_set>
 #include <vector>
 #include <tuple>
+#include "lru_cache.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+using CityDisplayNameTable = std::unordered_map<std::string, std::string>;
+using CityDisplayNameCache = LruCache<std::string, std::shared_ptr<const CityDisplayNameTable>>;
+
 using GetReplacedTimezoneDisplayName = void (*)(const char*, const char*, char*);
 
 class I18nTimeZone {
@@ -48,10 +53,17 @@ public:
     virtual std::string GetDisplayNameByTaboo(const std::string& localeStr, const std::string& result);
     static std::unique_ptr<I18nTimeZone> CreateInstance(std::string &id, bool isZoneID);
     static std::set<std::string> GetAvailableIDs();
+    static std::shared_ptr<const std::set<std::string>> GetAvailableIDSet();
+    static bool IsAvailableID(const std::string &id);
     static std::unordered_set<std::string> GetAvailableZoneCityIDs();
+    static std::shared_ptr<const std::unordered_set<std::string>> GetAvailableZoneCityIDSet();
+    static bool IsAvailableZoneCityID(const std::string &cityID);
     static std::string GetCityDisplayName(std::string &cityID, std::string &locale);
     static std::vector<std::string> GetTimezoneIdByLocation(const double x, const double y);
+    static std::vector<std::vector<std::string>> GetTimezoneIdsByLocations(
+        const std::vector<std::pair<double, double>>& locations);
     static std::map<std::string, std::string> FindCityDisplayNameMap(std::string &locale);
+    static std::shared_ptr<const CityDisplayNameTable> GetCityDisplayNameTable(const std::string &locale);
     static std::string GetLocaleBaseName(std::string &locale);
     static std::string GetTimezoneIdByCityId(const std::string &cityId);
     static I18nErrorCode SetAppDefaultTimeZoneById(const std::string& zoneID);
@@ -59,6 +71,7 @@ public:
     static std::string GetAppDefaultTimeZoneID();
 
 private:
+    friend class TimezoneLocationIndex;
     static const char *TIMEZONE_KEY;
     static const char *DEFAULT_TIMEZONE;
     static const char *CITY_TIMEZONE_DATA_PATH;
@@ -81,10 +94,11 @@ private:
     static const uint32_t TZ_HALF_OF_SIZE = 2;
     static const uint32_t TZ_MAX_PIXEL_VALUE = 255;
     static constexpr double NUM_PRECISION = 0.1;
+    static constexpr size_t CITY_DISPLAYNAME_CACHE_SIZE = 4;
     static std::set<std::string> supportedLocales;
-    static std::unordered_set<std::string> availableZoneCityIDs;
+    static std::shared_ptr<const std::unordered_set<std::string>> availableZoneCityIDs;
     static std::unordered_map<std::string, std::string> city2TimeZoneID;
-    static std::unordered_map<std::string, std::string> cityDisplayNameCache;
+    static CityDisplayNameCache cityDisplayNameCache;
     static std::map<int, std::string> categoryNum2TimezoneWN;
     static std::map<int, std::string> categoryNum2TimezoneEN;
     static std::map<int, std::string> categoryNum2TimezoneWS;
@@ -95,37 +109,32 @@ private:
     static std::mutex matchLocaleMutex;
     static std::mutex initZoneInfoMutex;
     static std::mutex initSupportedLocalesMutex;
-    static std::mutex cityDisplayNameMutex;
-    static std::string cityDisplayNameCacheLocale;
     static std::string appDefaultTimeZoneID;
-    static bool initAvailableZoneInfo;
+    static std::atomic<bool> initAvailableZoneInfo;
     static bool initSupportedLocales;
-    static bool ReadTimeZoneData(const char *xmlPath);
+    static bool ReadTimeZoneData(const char *xmlPath, std::unordered_set<std::string> &cityIDs);
+    static bool InitAvailableZoneCityIDs();
     static std::string ComputeLocale(std::string &locale);
     icu::TimeZone* GetTimeZone();
     static std::string FindCityDisplayNameFromXml(std::string &cityID, std::string &locale);
-    static std::string FindCityDisplayNameFromXmlInner(std::string &cityID, std::string &locale);
-    static void AddCityDisplayNameCache(const char* xmlCityId, const char* xmlValue);
-    static std::string ResetCityDisplayNameCache(std::string &cityID, std::string &locale);
-    static std::string GetCityDisplayNameFromCache(std::string &cityID);
+    static std::shared_ptr<const CityDisplayNameTable> ParseCityDisplayNames(const std::string &xmlPath);
     static std::string GetCityDisplayNameXmlPath(const std::string &locale);
     static bool GetSupportedLocales();
     static std::string GetFallBack(std::string &localeStr);
     static void GetTimezoneIDFromZoneInfo(std::set<std::string> &availableIDs, std::string &parentPath,
         std::string &parentName);
-    static std::vector<int> GetColorData(const uint16_t x, const uint16_t y,
-                                         uint16_t actualHeight, std::string preferredPath);
     static int InitPngptr(png_structp &png_ptr, png_infop &info_ptr, FILE **fp, std::string preferredPath);
-    static std::vector<std::string> FindTzData();
+    static std::vector<std::string> FindTzData(const std::vector<std::string> &pixelPaths);
     static bool ParamExceedScope(const int x, const int y, int fixedX, int fixedY);
-    static std::string GetPreferredPath(const double x, const std::vector<std::string> &filePaths);
     static void SetVersionPathMap(std::string verison, std::string path,
             std::map<std::string, std::vector<std::string>> *pathMap);
     static std::tuple<uint32_t, uint32_t> GetTzDataWidth(std::vector<std::string> filePaths);
     static void CloseFile(FILE *fp);
     static bool ValidateDataIntegrity(const std::vector<std::string> &pathList);
     static bool CheckLatitudeAndLongitude(const double x, const double y);
-    static std::map<int, std::string> GetTimeZoneCategoryMap(const double x, const double y);
+    static const std::map<int, std::string>& GetTimeZoneCategoryMap(const double x, const double y);
+    static std::vector<std::string> GetTimezoneIdsByPixel(const std::vector<int>& pixel, const double x,
+        const double y);
     static void SetBestMatchLocale(const std::string& key, const std::string& value);
     static const char *GetDeviceCityDisplayNamePath();
 };
@@ -16,9 +16,12 @@
 #define OHOS_GLOBAL_I18N_INTL_DATE_TIME_FORMAT_H
 
 
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include "unicode/datefmt.h"
 #include "unicode/dtitvfmt.h"
@@ -27,6 +30,8 @@
 #include "unicode/locid.h"
 #include "i18n_types.h"
 #include "date_time_format_part.h"
+#include "format_utils.h"
+#include "lru_cache.h"
 
 namespace OHOS {
 namespace Global {
@@ -81,6 +86,14 @@ public:
     std::string Format(double milliseconds);
     std::vector<std::unordered_map<std::string, std::string>> FormatToParts(double milliseconds,
         std::string& errMessage);
+
+    /**
+     * @brief Format milliseconds to the formatted string and the offsets of its parts.
+     *
+     * @param parts Output the formatted string and its parts, empty if failed.
+     * @param errMessage Output the error message if format failed.
+     */
+    void FormatToParts(double milliseconds, FormattedParts& parts, std::string& errMessage);
     std::string FormatRange(double start, double end, std::string& errMessage);
     std::pair<std::string, std::vector<DateTimeFormatPart>> FormatToParts(double milliseconds);
     std::vector<std::unordered_map<std::string, std::string>> FormatRangeToParts(double start, double end,
@@ -89,6 +102,13 @@ public:
     static std::vector<std::string> SupportedLocalesOf(const std::vector<std::string>& requestLocales,
         const std::map<std::string, std::string>& configs, I18nErrorCode& status);
 
+    /**
+     * @brief Hit and miss counters of the process-wide cache of initialized formatters.
+     */
+    static uint64_t GetPrototypeCacheHitCount();
+    static uint64_t GetPrototypeCacheMissCount();
+    static void ClearPrototypeCache();
+
     static const std::string LOCALE_TAG;
     static const std::string LOCALE_MATCHER_TAG;
     static const std::string WEEK_DAY_TAG;
@@ -122,6 +142,33 @@ protected:
     icu::Locale icuLocale;
 
 private:
+    /**
+     * Resolved state of a successfully initialized formatter. The SimpleDateFormat already carries
+     * the calendar and time zone, so a new formatter with the same inputs only needs a clone of it.
+     */
+    struct FormatPrototype {
+        std::string localeMatcher;
+        std::string formatMatcher;
+        std::string hour12;
+        std::string timeZone;
+        std::string calendar;
+        std::string numberingSystem;
+        std::string dateStyle;
+        std::string timeStyle;
+        std::string hourCycle;
+        std::string fractionalSecondDigits;
+        std::string localeString;
+        std::vector<std::string> skeletonOpts;
+        bool isIso8601 = false;
+        std::string skeleton;
+        icu::Locale icuLocale;
+        std::shared_ptr<const icu::SimpleDateFormat> dateFormat;
+    };
+
+    static std::string GetPrototypeKey(const std::vector<std::string>& requestedLocales,
+        const std::unordered_map<std::string, std::string>& configs);
+    std::shared_ptr<const FormatPrototype> CreatePrototype() const;
+    bool InitFromPrototype(const FormatPrototype& prototype);
     bool ParseConfigs(const std::unordered_map<std::string, std::string>& configs,
         std::string& errMessage);
     void InitIcuLocale();
@@ -187,6 +234,9 @@ private:
     icu::DateIntervalFormat* dateIntervalFormat = nullptr;
     static bool icuInitialized;
     static bool Init();
+
+    static constexpr size_t PROTOTYPE_CACHE_CAPACITY = 32;
+    static LruCache<std::string, std::shared_ptr<const FormatPrototype>> prototypeCache;
 };
 } // namespace I18n
 } // namespace Global
@@ -31,6 +31,7 @@ namespace Global {
 namespace I18n {
 class LocaleInfo;
 class IntlLocale;
+class SystemLocaleSnapshot;
 
 class LocaleConfig {
 public:
@@ -282,6 +283,7 @@ public:
     static constexpr int CONFIG_LEN = 128;
 
 private:
+    friend class SystemLocaleSnapshot;
     static void Split(const std::string &src, const std::string &sep, std::vector<std::string> &dest);
     static void Split(const std::string &src, const std::string &sep, std::unordered_set<std::string> &dest);
     static constexpr uint32_t LANGUAGE_LEN = 2;
@@ -26,11 +26,32 @@ class LocaleData {
 public:
     static const std::vector<uint16_t> NEW_LANGUAGES_CODES;
     static const std::vector<uint16_t> OLD_LANGUAGES_CODES;
-    static const std::vector<uint64_t> LOCALE_PARENTS_KEY;
-    static const std::vector<uint64_t> LOCALE_PARENTS_VALUE;
-    static const std::vector<uint64_t> TYPICAL_CODES_VALUE;
-    static const std::vector<uint64_t> LIKELY_TAGS_CODES_KEY;
-    static const std::vector<uint64_t> LIKELY_TAGS_CODES_VALUE;
+
+    /**
+     * @brief Find the parent of encodedLocale in the locale parents table.
+     *
+     * @param encodedLocale Represents the encoded locale to search.
+     * @param parentLocale Output the encoded parent locale when found.
+     * @return Return true if encodedLocale has an explicit parent.
+     */
+    static bool FindParentLocale(uint64_t encodedLocale, uint64_t& parentLocale);
+
+    /**
+     * @brief Find the likely language-script-region locale of encodedLocale.
+     *
+     * @param encodedLocale Represents the encoded locale to search.
+     * @param likelyLocale Output the encoded likely locale when found.
+     * @return Return true if encodedLocale is in the likely tags table.
+     */
+    static bool FindLikelyLocale(uint64_t encodedLocale, uint64_t& likelyLocale);
+
+    /**
+     * @brief Check whether encodedLocale is a typical locale.
+     *
+     * @param encodedLocale Represents the encoded locale to search.
+     * @return Return true if encodedLocale is in the typical locales table.
+     */
+    static bool IsTypicalLocale(uint64_t encodedLocale);
 };
 } // namespace I18n
 } // namespace Global
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_LRU_CACHE_H
+#define OHOS_GLOBAL_I18N_LRU_CACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+/**
+ * Thread safe bounded least recently used cache. Lookups only take a shared lock and mark the entry
+ * as referenced. Entries are kept in insertion order in a list, and eviction gives referenced
+ * entries a second chance by moving them back to the front, so every operation is amortized O(1).
+ */
+template<typename Key, typename Value>
+class LruCache {
+public:
+    explicit LruCache(size_t capacity) : capacity(capacity > 0 ? capacity : 1)
+    {
+    }
+
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    /**
+     * @brief Find a cached value and mark it as recently used.
+     *
+     * @return Returns false if the key is not cached, value is left untouched then.
+     */
+    bool Find(const Key& key, Value& value)
+    {
+        std::shared_lock<std::shared_mutex> lock(cacheMutex);
+        auto iter = index.find(key);
+        if (iter == index.end()) {
+            missCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        hitCount.fetch_add(1, std::memory_order_relaxed);
+        Entry& entry = *iter->second;
+        if (!entry.referenced.load(std::memory_order_relaxed)) {
+            entry.referenced.store(true, std::memory_order_relaxed);
+        }
+        value = entry.value;
+        return true;
+    }
+
+    /**
+     * @brief Add a value, evicting the least recently used entry when the cache is full.
+     *
+     * @return Returns the cached value, which is the existing one if the key was added first
+     * by another thread.
+     */
+    Value Insert(const Key& key, Value value)
+    {
+        std::unique_lock<std::shared_mutex> lock(cacheMutex);
+        auto iter = index.find(key);
+        if (iter != index.end()) {
+            entries.splice(entries.begin(), entries, iter->second);
+            return iter->second->value;
+        }
+        if (entries.size() >= capacity) {
+            Evict();
+        }
+        entries.emplace_front(key, std::move(value));
+        index.emplace(key, entries.begin());
+        return entries.front().value;
+    }
+
+    void Clear()
+    {
+        std::unique_lock<std::shared_mutex> lock(cacheMutex);
+        index.clear();
+        entries.clear();
+    }
+
+    uint64_t GetHitCount() const
+    {
+        return hitCount.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetMissCount() const
+    {
+        return missCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Entry {
+        Entry(const Key& key, Value value) : key(key), value(std::move(value))
+        {
+        }
+
+        const Key key;
+        const Value value;
+        std::atomic<bool> referenced { false };
+    };
+    using EntryList = std::list<Entry>;
+
+    // Called with the exclusive lock held, so lookups cannot mark entries again and each referenced
+    // entry is moved at most once before an unreferenced one reaches the back.
+    void Evict()
+    {
+        while (entries.back().referenced.load(std::memory_order_relaxed)) {
+            entries.back().referenced.store(false, std::memory_order_relaxed);
+            entries.splice(entries.begin(), entries, std::prev(entries.end()));
+        }
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+
+    const size_t capacity;
+    std::shared_mutex cacheMutex;
+    EntryList entries;
+    std::unordered_map<Key, typename EntryList::iterator> index;
+    std::atomic<uint64_t> hitCount { 0 };
+    std::atomic<uint64_t> missCount { 0 };
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -15,8 +15,8 @@
 #ifndef OHOS_GLOBAL_I18N_LUNAR_CALENDAR_H
 #define OHOS_GLOBAL_I18N_LUNAR_CALENDAR_H
 
+#include <cstddef>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "unicode/calendar.h"
@@ -26,6 +26,13 @@
 namespace OHOS {
 namespace Global {
 namespace I18n {
+struct LunarDate {
+    int32_t year = -1;
+    int32_t month = -1;
+    int32_t day = -1;
+    bool isLeapMonth = false;
+};
+
 class LunarCalendar {
 public:
     LunarCalendar();
@@ -36,6 +43,16 @@ public:
     int32_t GetLunarDay();
     bool IsLeapMonth();
 
+    /**
+     * @brief Convert count consecutive gregorian days, starting from year-month-day, to lunar dates.
+     *
+     * @param lunarDates Output the lunar dates, lunarDates[i] is the same as calling SetGregorianDate
+     * with the i-th day after the start date. It is cleared first and left empty on failure.
+     * @return Returns false if the start date is invalid or the days go past the supported range.
+     * The date set by SetGregorianDate is not changed.
+     */
+    bool GetLunarDates(int32_t year, int32_t month, int32_t day, size_t count, std::vector<LunarDate>& lunarDates);
+
 private:
     static int32_t GetLeapDaysInYear(int32_t year);
     static int32_t GetLeapMonthInYear(int32_t year);
@@ -44,13 +61,11 @@ private:
     bool VerifyDate(int32_t year, int32_t month, int32_t day);
     void ConvertDate(int32_t& year, int32_t& month, int32_t& day);
     void CalcDaysFromBaseDate();
+    static int32_t GetDaysFromBaseDate(int32_t year, int32_t month, int32_t day, bool isLeapYear);
     void SolarDateToLunarDate();
-    void AdjustLeapMonth(int32_t& i, int32_t tempDaysCounts, int32_t leapMonth);
-    int32_t GetDaysPerLunarYear(int32_t lunarYear);
+    static LunarDate DaysToLunarDate(int32_t daysCounts);
+    static void AdjustLeapMonth(int32_t& i, int32_t tempDaysCounts, int32_t leapMonth, bool& isLeap);
     bool IsGregorianLeapYear(int32_t year);
-    static std::unordered_map<int32_t, int32_t> daysOfMonth;
-    static std::unordered_map<int32_t, int32_t> accDaysOfMonth;
-    static std::vector<uint32_t> lunarDateInfo;
     static const int32_t VALID_START_YEAR = 1900;
     static const int32_t VALID_END_YEAR = 2100;
     static const int32_t VALID_START_MONTH = 1;
@@ -66,6 +81,15 @@ private:
     static const int32_t BASE_DAYS_PER_LUNAR_YEAR = 348;
     static const int32_t DAYS_IN_BIG_MONTH = 30;
     static const int32_t DAYS_IN_SMALL_MONTH = 29;
+    static const int32_t LUNAR_YEAR_COUNT = END_YEAR - START_YEAR + 1;
+
+    // Days of every lunar year from START_YEAR and the days before each of them.
+    struct LunarYearTable {
+        int32_t daysOfYear[LUNAR_YEAR_COUNT];
+        int32_t accDaysOfYear[LUNAR_YEAR_COUNT + 1];
+    };
+    static constexpr LunarYearTable BuildLunarYearTable();
+    static const LunarYearTable lunarYearTable;
 
     int32_t solarYear = -1;
     int32_t solarMonth = -1;
@@ -15,6 +15,7 @@
 #ifndef OHOS_GLOBAL_I18N_MEASURE_DATA_H
 #define OHOS_GLOBAL_I18N_MEASURE_DATA_H
 
+#include <cstddef>
 #include <vector>
 #include <string>
 #include "unicode/measunit.h"
@@ -22,6 +23,22 @@
 namespace OHOS {
 namespace Global {
 namespace I18n {
+/**
+ * Factors of a resolved unit conversion. A value is converted to the base unit with the
+ * source factors and from the base unit with the target factors, the same as Convert does.
+ */
+struct UnitConversionPlan {
+    double fromFactor = 1.0;
+    double fromOffset = 0.0;
+    double toFactor = 1.0;
+    double toOffset = 0.0;
+
+    double Apply(double value) const
+    {
+        return (fromFactor * value + fromOffset - toOffset) / toFactor;
+    }
+};
+
 uint32_t GetMask(const std::string &region);
 void GetDefaultPreferredUnit(const std::string &region, const std::string &type, std::vector<std::string> &units);
 void GetFallbackPreferredUnit(const std::string &region, const std::string &usage, std::vector<std::string> &units);
@@ -35,6 +52,9 @@ bool ConvertByte(double& number, std::string& unit);
 bool ConvertDate(double& number, std::string& unit);
 int Convert(double &value, const std::string &fromUnit, const std::string &fromMeasSys, const std::string &toUnit,
     const std::string &toMeasSys);
+int CreateConversionPlan(const std::string &fromUnit, const std::string &fromMeasSys, const std::string &toUnit,
+    const std::string &toMeasSys, UnitConversionPlan &plan);
+void ConvertBatch(const UnitConversionPlan &plan, double *values, size_t count);
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
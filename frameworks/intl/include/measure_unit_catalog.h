@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_MEASURE_UNIT_CATALOG_H
+#define OHOS_GLOBAL_I18N_MEASURE_UNIT_CATALOG_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "unicode/measunit.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+/**
+ * Immutable catalog of the measure units available in ICU, built once per process
+ * and shared by NumberFormat and the unit conversion in measure_data.
+ */
+class MeasureUnitCatalog {
+public:
+    static const MeasureUnitCatalog& GetInstance();
+
+    /**
+     * @brief Find the unit whose subtype is the given name, such as "kilometer".
+     *
+     * @param subtype Represents the unit subtype.
+     * @return Return the unit, or nullptr if no available unit has this subtype.
+     */
+    const icu::MeasureUnit* Find(const std::string& subtype) const;
+    bool IsValid() const;
+
+private:
+    MeasureUnitCatalog();
+    MeasureUnitCatalog(const MeasureUnitCatalog&) = delete;
+    MeasureUnitCatalog& operator=(const MeasureUnitCatalog&) = delete;
+
+    std::vector<icu::MeasureUnit> units;
+    std::unordered_map<std::string, size_t> subtypeIndex;
+    bool valid = false;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
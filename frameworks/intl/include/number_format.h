@@ -35,6 +35,7 @@
 #include "unicode/fmtable.h"
 #include "unicode/ures.h"
 #include "unicode/ulocdata.h"
+#include "format_utils.h"
 #include "number_utils.h"
 #include "number_utypes.h"
 #include "i18n_types.h"
@@ -85,6 +86,14 @@ public:
     void FormatToParts(std::vector<std::vector<std::string>> &result);
     void FormatToParts(double number, std::vector<std::vector<std::string>> &result);
     void FormatBigIntToParts(const std::string &number, std::vector<std::vector<std::string>> &result);
+
+    /**
+     * @brief Format number to the formatted string and the offsets of its parts.
+     *
+     * @param parts Output the formatted string and its parts, empty if failed.
+     */
+    void FormatToParts(double number, FormattedParts &parts);
+    void FormatBigIntToParts(const std::string &number, FormattedParts &parts);
     void FormatRangeToParts(double first, double second, std::vector<std::vector<std::string>> &result);
     static std::vector<std::string> SupportedLocalesOf(const std::vector<std::string> &requestLocales,
         const std::map<std::string, std::string> &configs, I18nErrorCode &status);
@@ -154,7 +163,6 @@ private:
     UNumberUnitWidth unitDisplay = UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT;
     UNumberUnitWidth currencyDisplay = UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT;
     UNumberSignDisplay signDisplay = UNumberSignDisplay::UNUM_SIGN_AUTO;
-    static const int MAX_UNIT_NUM = 502;
     static const int DEFAULT_FRACTION_DIGITS = 3;
     static const int DEFAULT_MAX_SIGNIFICANT_DIGITS = 21;
     static const char *DEVICE_TYPE_NAME;
@@ -164,7 +172,6 @@ private:
     static std::mutex numToCurrencyMutex;
     static bool initISO4217;
     static std::unordered_map<std::string, std::string> numToCurrency;
-    icu::MeasureUnit unitArray[MAX_UNIT_NUM];
     static bool icuInitialized;
     static bool Init();
     static std::unordered_map<std::string, UNumberUnitWidth> unitStyle;
@@ -224,18 +231,17 @@ private:
     void RelativeDateTimeFormatToParts(double number, std::string &finalUnit,
         std::vector<std::vector<std::string>> &result);
     bool IsRelativeTimeFormat(double number, std::string &unitForConvert);
-    void AddFormatParts(std::string typeString, std::vector<std::vector<std::string>> &result,
-        icu::UnicodeString &formatResult, int32_t start, int32_t end);
-    std::string GetSubString(icu::UnicodeString &formatResult, int32_t start, int32_t end);
+    static void AddFormatParts(FormatPartType type, std::vector<FormatPartSpan> &spans, int32_t start,
+        int32_t end);
     icu::number::FormattedNumber FormatLongToFormattedNumber(int64_t number);
     void FormattedNumberParts(icu::number::FormattedNumber &formattedNumber,
-        std::vector<std::vector<std::string>> &result, const std::string &napiType, const double &number);
-    void FindAllFormatParts(icu::FormattedValue &formattedNumber, std::vector<std::vector<std::string>> &result,
+        FormattedParts &parts, const std::string &napiType, const double &number);
+    void FindAllFormatParts(icu::FormattedValue &formattedNumber, std::vector<FormatPartSpan> &spans,
         double number, const std::string &napiType, icu::UnicodeString &formatResult);
-    void FindAllFormatParts(icu::FormattedValue &formattedNumber, std::vector<std::vector<std::string>> &result,
+    void FindAllFormatParts(icu::FormattedValue &formattedNumber, std::vector<FormatPartSpan> &spans,
         const double &first, const double &second, icu::UnicodeString &formatResult);
-    void SetEveryFormatPartItem(icu::ConstrainedFieldPosition &cfpo, icu::UnicodeString &formatResult,
-        std::vector<std::vector<std::string>> &result, FormatPartParam &param);
+    void SetEveryFormatPartItem(icu::ConstrainedFieldPosition &cfpo, std::vector<FormatPartSpan> &spans,
+        FormatPartParam &param);
     double GetBigIntFieldType(const std::string &bigintStr);
     void DealWithUnitUsage(bool isFormatRange, double& firstNumber, double& secondNumber);
     bool DealWithUnitConvert(double& finalNumber, std::string& finalUnit);
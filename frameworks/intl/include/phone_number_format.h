@@ -15,11 +15,15 @@
 #ifndef OHOS_GLOBAL_I18N_PHONE_NUMBER_FORMAT_H
 #define OHOS_GLOBAL_I18N_PHONE_NUMBER_FORMAT_H
 
+#include <array>
+#include <atomic>
 #include <map>
 #include <set>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 #include "memory"
+#include "lru_cache.h"
 #include "phonenumbers/phonenumberutil.h"
 #include "phonenumbers/asyoutypeformatter.h"
 
@@ -29,6 +33,7 @@ namespace I18n {
 using i18n::phonenumbers::PhoneNumberUtil;
 using i18n::phonenumbers::AsYouTypeFormatter;
 using ExposeLocationName = int (*)(const char*, const char*, char*, const int, bool);
+using PhoneLocationCache = LruCache<std::string, std::string>;
 
 class PhoneNumberFormat {
 public:
@@ -45,26 +50,45 @@ public:
     virtual std::string getCityName(const std::string& language, const std::string& phonenumber,
         const std::string& locationName);
     static void CloseDynamicHandler();
+    static uint64_t GetLocationCacheHitCount();
+    static uint64_t GetLocationCacheMissCount();
 
 private:
+    static constexpr size_t DIGIT_COUNT = 10;
+    struct DigitSubstitution {
+        uint64_t localeVersion = 0;
+        bool enabled = false;
+        bool addDirectionMarks = false;
+        size_t maxDigitLength = 1;
+        std::array<std::string, DIGIT_COUNT> digits;
+    };
+
     PhoneNumberUtil* GetPhoneNumberUtil();
     void OpenHandler();
     std::string GetAsYouTypeFormatResult(const std::string &number);
-    std::string FormatAllInputNumber(const std::string &originalNumber, std::string &replacedNumber);
+    std::string FormatAllInputNumber(const std::string &originalNumber, const std::string &replacedNumber);
     bool IsNumberTooLong(i18n::phonenumbers::PhoneNumber phoneNumber);
     std::string GetPossibleRegionCode(const i18n::phonenumbers::PhoneNumber &phoneNumber);
+    std::string SubstituteDigits(const std::string &formattedNumber);
+    std::shared_ptr<const DigitSubstitution> GetDigitSubstitution();
+    static std::shared_ptr<const DigitSubstitution> CreateDigitSubstitution(uint64_t localeVersion);
     PhoneNumberUtil *util;
     std::unique_ptr<AsYouTypeFormatter> formatter = nullptr;
     std::string country;
     std::string formatType;
     PhoneNumberUtil::PhoneNumberFormat phoneNumberFormat;
     static void* dynamicHandler;
-    static std::mutex phoneMutex;
-    static std::mutex AS_YOU_TYPE_FORMAT_MUTEX;
+    static std::atomic<ExposeLocationName> locationNameFunc;
+    static std::shared_mutex phoneMutex;
+    static PhoneLocationCache locationCache;
+    static constexpr size_t LOCATION_CACHE_SIZE = 512;
     static size_t MAX_NUMBER_LENGTH;
+    std::mutex asYouTypeMutex;
+    std::shared_ptr<const DigitSubstitution> digitSubstitution = nullptr;
     std::string lastFormatNumber;
+    std::string inputDigits;
+    std::string typingResult;
     bool withOptions = false;
-    static std::map<char, char> VALID_PHONE_NUMBER_CHARS;
 };
 } // namespace I18n
 } // namespace Global
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_PHONE_PREFIX_TRIE_H
+#define OHOS_GLOBAL_I18N_PHONE_PREFIX_TRIE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+/**
+ * Character trie over phone number prefixes. It is filled once while data is loaded and
+ * only read afterwards.
+ */
+class PhonePrefixTrie {
+public:
+    PhonePrefixTrie();
+    void Insert(const std::string& prefix);
+
+    /**
+     * @brief Find the longest inserted prefix of a phone number.
+     *
+     * @param phoneNumber Indicates the phone number to match.
+     * @param length Used to return the length of the longest matched prefix.
+     * @return Returns true if any inserted prefix matches.
+     */
+    bool FindLongestPrefix(const std::string& phoneNumber, size_t& length) const;
+    bool Empty() const;
+
+private:
+    struct Node {
+        std::vector<std::pair<char, uint32_t>> children;
+        bool isEnd = false;
+    };
+    int64_t FindChild(uint32_t node, char c) const;
+
+    std::vector<Node> nodes;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_SYSTEM_LOCALE_SNAPSHOT_H
+#define OHOS_GLOBAL_I18N_SYSTEM_LOCALE_SNAPSHOT_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+struct SystemLocaleInfo {
+    uint64_t version = 0;
+    std::string locale;
+    std::string language;
+    std::string region;
+    std::string timezone;
+    bool is24HourClock = false;
+    bool pseudoLocalization = false;
+};
+
+/**
+ * Process-wide cache of the system locale settings. The parameter handles are resolved once,
+ * and the snapshot is rebuilt only when the commit id of one of them changes.
+ */
+class SystemLocaleSnapshot {
+public:
+    class ParameterBackend {
+    public:
+        virtual ~ParameterBackend() = default;
+        virtual std::string Read(const std::string& key) = 0;
+
+        /**
+         * @brief Obtain a value which changes every time one of the watched parameters is written.
+         */
+        virtual uint64_t GetSerial() = 0;
+    };
+
+    /**
+     * @brief Obtain the current snapshot, refreshing it first if a backing parameter changed.
+     *
+     * @return The immutable snapshot, never nullptr.
+     */
+    static std::shared_ptr<const SystemLocaleInfo> Get();
+
+    /**
+     * @brief Replace the parameter backend, nullptr restores the system parameter backend.
+     * Used to run on hosts without the system parameter service.
+     */
+    static void SetParameterBackend(std::shared_ptr<ParameterBackend> backend);
+
+private:
+    struct SnapshotEntry {
+        std::shared_ptr<const SystemLocaleInfo> info;
+        uint64_t serial = 0;
+    };
+
+    static std::shared_ptr<ParameterBackend> GetParameterBackend();
+    static std::shared_ptr<const SystemLocaleInfo> Load(ParameterBackend& backend, uint64_t version);
+    static std::string ReadRegion(ParameterBackend& backend);
+    static const std::vector<std::string>& GetWatchedKeys();
+
+    static std::mutex updateMutex;
+    static std::shared_ptr<const SnapshotEntry> snapshot;
+    static std::shared_ptr<ParameterBackend> parameterBackend;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
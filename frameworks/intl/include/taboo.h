@@ -16,11 +16,13 @@
 #ifndef OHOS_GLOBAL_I18N_TABOO_H
 #define OHOS_GLOBAL_I18N_TABOO_H
 
+#include <atomic>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <mutex>
+#include "phone_prefix_trie.h"
 
 namespace OHOS {
 namespace Global {
@@ -48,8 +50,19 @@ public:
     std::unordered_set<std::string> GetBlockedRegions(const std::string& language) const;
     std::unordered_set<std::string> GetBlockedCities() const;
     std::unordered_set<std::string> GetBlockedPhoneNumbers() const;
+    bool IsBlockedLanguage(const std::string& language) const;
+    bool IsBlockedRegion(const std::string& region, const std::string& language) const;
+    bool IsBlockedCity(const std::string& cityId) const;
+    bool IsBlockedPhoneNumber(const std::string& phoneNumber) const;
 
 private:
+    using FallbackKeyMap = std::unordered_map<std::string, std::vector<std::string>>;
+    using TabooNameMap = std::unordered_map<std::string, std::string>;
+    struct LocaleTabooData {
+        std::atomic<bool> isLoaded { false };
+        TabooNameMap names;
+    };
+
     void ParseTabooData(const std::string& path, DataFileType fileType, const std::string& Locale = "");
     void ProcessTabooConfigData(const std::string& name, const std::string& value);
     void ProcessTabooLocaleData(const std::string& locale, const std::string& name, const std::string& value);
@@ -60,11 +73,20 @@ private:
     void ReadResourceList();
     std::string GetLanguageFromFileName(const std::string& fileName);
     std::unordered_set<std::string> GetBlockedRegions() const;
+    const std::unordered_set<std::string>* FindBlockedData(
+        const std::unordered_map<std::string, std::unordered_set<std::string>>& blockedData,
+        const std::string& tag) const;
+    const std::unordered_set<std::string>* FindLanguageBlockedRegions(const std::string& language) const;
     void ParseBlockedLanguagesAndRegions(const std::string& key, const std::string& value);
     void ParseBlockedCities(const std::string& key, const std::string& value);
     void ParseBlockedPhoneNumbers(const std::string& key, const std::string& value);
-    void InitLocaleTabooData(const std::string& fallbackLanguage, const std::string& fileName);
+    const TabooNameMap* GetLocaleTabooData(const std::string& fallbackLanguage, const std::string& fileName);
     void InitFallBackSuffixes();
+    void ResolveFallBackData();
+    void BuildFallBackKeys(const std::unordered_set<std::string>& ids, const std::string& keyPrefix,
+        FallbackKeyMap& fallbackKeys) const;
+    std::string ReplaceName(const FallbackKeyMap& fallbackKeys, const std::string& id,
+        const std::string& displayLanguage, const std::string& name);
     // Indicates which regions support name replacement using taboo data.
     std::unordered_set<std::string> supportedRegions;
     // Indicates which languages support name replacement using taboo data.
@@ -75,11 +97,17 @@ private:
     std::unordered_set<std::string> supportedcities;
     // Indicates which phone numbers support location name replacement using taboo data.
     std::unordered_set<std::string> supportedPhoneNumbers;
-    // cache the name replacement taboo data of different locale.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> localeTabooData;
+    // Name replacement keys of every supported id, in fallback order. Resolved once at load time.
+    FallbackKeyMap regionFallBackKeys;
+    FallbackKeyMap languageFallBackKeys;
+    FallbackKeyMap timeZoneFallBackKeys;
+    FallbackKeyMap cityFallBackKeys;
+    FallbackKeyMap phoneNumberFallBackKeys;
+    PhonePrefixTrie supportedPhoneNumberTrie;
+    // cache the name replacement taboo data of different locale, one entry per resource language.
+    std::unordered_map<std::string, LocaleTabooData> localeTabooData;
     // Indicates which locales are supported to find taboo data.
     std::unordered_map<std::string, std::string> resources;
-    std::unordered_set<std::string> initResourcesList;
 
     std::unordered_map<std::string, std::unordered_set<std::string>> blockedLanguages;
     std::unordered_map<std::string, std::unordered_set<std::string>> blockedRegions;
@@ -87,6 +115,13 @@ private:
         std::unordered_set<std::string>>> languageBlockedRegions;
     std::unordered_map<std::string, std::unordered_set<std::string>> blockedCities;
     std::unordered_map<std::string, std::unordered_set<std::string>> blockedPhoneNumbers;
+    // Blocked data selected by the fallback suffixes, resolved once at load time.
+    const std::unordered_set<std::string>* resolvedBlockedLanguages = nullptr;
+    const std::unordered_set<std::string>* resolvedBlockedRegions = nullptr;
+    const std::unordered_map<std::string, std::unordered_set<std::string>>* resolvedLanguageBlockedRegions = nullptr;
+    const std::unordered_set<std::string>* resolvedBlockedCities = nullptr;
+    const std::unordered_set<std::string>* resolvedBlockedPhoneNumbers = nullptr;
+    PhonePrefixTrie blockedPhoneNumberTrie;
 
     std::vector<std::string> fallBackSuffixes;
 
@@ -38,6 +38,10 @@ public:
     std::unordered_set<std::string> GetBlockedRegions(const std::string& language) const;
     std::unordered_set<std::string> GetBlockedCities() const;
     std::unordered_set<std::string> GetBlockedPhoneNumbers() const;
+    bool IsBlockedLanguage(const std::string& language) const;
+    bool IsBlockedRegion(const std::string& region, const std::string& language) const;
+    bool IsBlockedCity(const std::string& cityId) const;
+    bool IsBlockedPhoneNumber(const std::string& phoneNumber) const;
 
 private:
     TabooUtils();
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_TIMEZONE_LOCATION_INDEX_H
+#define OHOS_GLOBAL_I18N_TIMEZONE_LOCATION_INDEX_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+/**
+ * In-memory index over the timezone pixel tiles used by I18nTimeZone::GetTimezoneIdByLocation.
+ * The tile list is resolved again only when one of the data directories changes, and every tile
+ * is decoded on its first lookup, so later lookups are a stat of the directories and an array access.
+ */
+class TimezoneLocationIndex {
+public:
+    static TimezoneLocationIndex& GetInstance();
+
+    /**
+     * @brief Get the category values of the pixel covering a location.
+     *
+     * @param x Represents the longitude.
+     * @param y Represents the latitude.
+     * @return Return the RGB values of the pixel, or an empty vector if the location is not covered.
+     */
+    std::vector<int> GetPixel(const double x, const double y);
+
+    /**
+     * @brief Get the category values of the pixels covering a batch of locations.
+     *
+     * @param locations Represents the (longitude, latitude) pairs.
+     * @return Return the RGB values of each location in the same order, empty for locations not covered.
+     */
+    std::vector<std::vector<int>> GetPixels(const std::vector<std::pair<double, double>>& locations);
+
+    /**
+     * @brief Replace the directories searched for pixel data, an empty list restores the system directories.
+     * Used to switch to another data set without installing it.
+     */
+    void SetDataPaths(const std::vector<std::string>& paths);
+
+private:
+    struct Tile {
+        std::string path;
+        int left = 0;
+        int right = 0;
+        size_t rowBytes = 0;
+        std::vector<uint8_t> pixels;
+        std::atomic<bool> decoded { false };
+    };
+
+    struct TileSet {
+        std::shared_ptr<const std::vector<std::string>> dataPaths;
+        std::vector<int64_t> stamp;
+        std::vector<std::unique_ptr<Tile>> tiles;
+        uint32_t width = 0;
+        uint32_t height = 0;
+    };
+
+    TimezoneLocationIndex();
+    TimezoneLocationIndex(const TimezoneLocationIndex&) = delete;
+    TimezoneLocationIndex& operator=(const TimezoneLocationIndex&) = delete;
+    std::shared_ptr<TileSet> GetTileSet();
+    bool EnsureDecoded(Tile& tile);
+    static std::vector<int64_t> GetDataStamp(const std::vector<std::string>& paths);
+    static void LoadTiles(TileSet& tileSet);
+    static Tile* FindTile(const TileSet& tileSet, const double x);
+    static std::vector<int> ReadPixel(const TileSet& tileSet, const Tile& tile, const double x, const double y);
+    static bool DecodeTile(Tile& tile);
+
+    static const size_t RGB_PIXEL_LENGTH = 3;
+    static const size_t STAMP_FIELD_COUNT = 2;
+    std::mutex loadMutex;
+    std::shared_ptr<const std::vector<std::string>> systemDataPaths;
+    std::shared_ptr<const std::vector<std::string>> dataPaths;
+    std::shared_ptr<TileSet> tileSet;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -16,6 +16,7 @@
 #define OHOS_GLOBAL_I18N_UTILS_H
 
 #include <filesystem>
+#include <memory>
 #include <regex>
 #include <string>
 #include <vector>
@@ -27,8 +28,6 @@
 namespace OHOS {
 namespace Global {
 namespace I18n {
-static std::set<std::string> availableIDs;
-
 void Split(const std::string &src, const std::string &sep, std::vector<std::string> &dest);
 void Split(const std::string& src, const std::string& sep, std::unordered_set<std::string>& dest);
 void Merge(const std::vector<std::string>& src, const std::string& sep, std::string& dest);
@@ -54,6 +53,7 @@ std::string PseudoLocalizationProcessor(const std::string &input);
 std::string PseudoLocalizationProcessor(const std::string &input, bool ifEnforce);
 bool CheckSystemPermission();
 std::set<std::string> GetTimeZoneAvailableIDs();
+std::shared_ptr<const std::set<std::string>> GetTimeZoneAvailableIDSet();
 bool RegexSearchNoExcept(const std::string& str, std::smatch& match, const std::regex& regex);
 std::string LocaleEncode(const std::string& locale);
 bool Eq(double a, double b);
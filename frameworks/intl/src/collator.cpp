@@ -14,7 +14,10 @@
  */
 #include "collator.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
+#include <numeric>
 #include <set>
 #include <string>
 #include <utility>
@@ -324,6 +327,89 @@ CompareResult Collator::Compare(const std::string &first, const std::string &sec
     }
 }
 
+bool Collator::GetSortKey(const std::string &text, std::vector<uint8_t> &sortKey)
+{
+    sortKey.clear();
+    return AppendSortKey(text, sortKey);
+}
+
+bool Collator::GetSortKeys(const std::vector<std::string> &texts, SortKeyBatch &batch)
+{
+    batch.keys.clear();
+    batch.offsets.assign(1, 0);
+    if (!collatorPtr) {
+        return false;
+    }
+    batch.offsets.reserve(texts.size() + 1);
+    for (const std::string &text : texts) {
+        if (!AppendSortKey(text, batch.keys)) {
+            return false;
+        }
+        batch.offsets.push_back(batch.keys.size());
+    }
+    return true;
+}
+
+void Collator::Sort(std::vector<std::string> &texts)
+{
+    SortKeyBatch batch;
+    if (!GetSortKeys(texts, batch)) {
+        HILOG_ERROR_I18N("Collator::Sort: Get sort keys failed.");
+        return;
+    }
+    std::vector<size_t> order(texts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&batch](size_t first, size_t second) {
+        return batch.Less(first, second);
+    });
+    std::vector<std::string> sorted;
+    sorted.reserve(texts.size());
+    for (size_t index : order) {
+        sorted.push_back(std::move(texts[index]));
+    }
+    texts.swap(sorted);
+}
+
+bool Collator::AppendSortKey(const std::string &text, std::vector<uint8_t> &buffer)
+{
+    if (!collatorPtr) {
+        return false;
+    }
+    icu::UnicodeString unicodeText(text.data(), text.length());
+    size_t start = buffer.size();
+    size_t capacity = std::max(text.length() * SORT_KEY_BYTES_PER_CHAR, MIN_SORT_KEY_LENGTH);
+    buffer.resize(start + capacity);
+    int32_t length = collatorPtr->getSortKey(unicodeText, buffer.data() + start, static_cast<int32_t>(capacity));
+    if (length > static_cast<int32_t>(capacity)) {
+        buffer.resize(start + static_cast<size_t>(length));
+        length = collatorPtr->getSortKey(unicodeText, buffer.data() + start, length);
+    }
+    if (length <= 0) {
+        buffer.resize(start);
+        HILOG_ERROR_I18N("Collator::AppendSortKey: Get sort key failed.");
+        return false;
+    }
+    buffer.resize(start + static_cast<size_t>(length));
+    return true;
+}
+
+size_t SortKeyBatch::Size() const
+{
+    return offsets.size() - 1;
+}
+
+bool SortKeyBatch::Less(size_t first, size_t second) const
+{
+    size_t firstLength = offsets[first + 1] - offsets[first];
+    size_t secondLength = offsets[second + 1] - offsets[second];
+    int result = memcmp(keys.data() + offsets[first], keys.data() + offsets[second],
+        std::min(firstLength, secondLength));
+    if (result != 0) {
+        return result < 0;
+    }
+    return firstLength < secondLength;
+}
+
 void Collator::ResolvedOptions(std::map<std::string, std::string> &options)
 {
     options.insert(std::pair<std::string, std::string>("localeMatcher", localeMatcher));
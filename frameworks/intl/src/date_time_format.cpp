@@ -13,10 +13,12 @@
  * limitations under the License.
  */
 #include "date_time_format.h"
+#include "date_time_pattern_cache.h"
 #include "i18n_hilog.h"
 #include "locale_config.h"
 #include "ohos/init_data.h"
 #include "parameter.h"
+#include "system_locale_snapshot.h"
 #include "utils.h"
 
 namespace OHOS {
@@ -312,7 +314,7 @@ void DateTimeFormat::InitDateFormat(UErrorCode &status)
         }
     } else {
         auto patternGenerator =
-            std::unique_ptr<DateTimePatternGenerator>(DateTimePatternGenerator::createInstance(locale, status));
+            std::unique_ptr<DateTimePatternGenerator>(DateTimePatternCache::CreateGenerator(locale, status));
         if (U_FAILURE(status) || patternGenerator == nullptr) {
             HILOG_ERROR_I18N("DateTimeFormat::InitDateFormat: Create DateTimePatternGenerator instance failed.");
             return;
@@ -601,20 +603,59 @@ std::string DateTimeFormat::Format(int64_t milliseconds)
     if (!createSuccess || calendar == nullptr || dateFormat == nullptr) {
         return PseudoLocalizationProcessor("");
     }
+    UpdateFormatTimeZone();
+    return PseudoLocalizationProcessor(FormatWithoutZoneUpdate(milliseconds));
+}
+
+std::vector<std::string> DateTimeFormat::Format(const std::vector<int64_t> &milliseconds)
+{
+    std::vector<std::string> results;
+    results.reserve(milliseconds.size());
+    bool ifEnforce = GetPseudoLocalizationEnforce();
+    if (!createSuccess || calendar == nullptr || dateFormat == nullptr) {
+        results.assign(milliseconds.size(), PseudoLocalizationProcessor("", ifEnforce));
+        return results;
+    }
+    UpdateFormatTimeZone();
+    for (int64_t item : milliseconds) {
+        results.emplace_back(PseudoLocalizationProcessor(FormatWithoutZoneUpdate(item), ifEnforce));
+    }
+    return results;
+}
+
+std::string DateTimeFormat::FormatWithoutZoneUpdate(int64_t milliseconds)
+{
     UErrorCode status = U_ZERO_ERROR;
     std::string result;
     UnicodeString dateString;
     calendar->clear();
-    std::string timezoneStr = timeZone.empty() ? LocaleConfig::GetSystemTimezone() : timeZone;
-    auto zone = std::unique_ptr<TimeZone>(TimeZone::createTimeZone(timezoneStr.c_str()));
-    if (zone != nullptr) {
-        calendar->setTimeZone(*zone);
-        dateFormat->setTimeZone(*zone);
-    }
     calendar->setTime((UDate)milliseconds, status);
     dateFormat->format(calendar->getTime(status), dateString, status);
     dateString.toUTF8String(result);
-    return PseudoLocalizationProcessor(result);
+    return result;
+}
+
+const TimeZone* DateTimeFormat::UpdateFormatTimeZone()
+{
+    std::string timezoneStr = timeZone.empty() ? SystemLocaleSnapshot::Get()->timezone : timeZone;
+    if (formatTimeZone != nullptr && timezoneStr.compare(formatTimeZoneId) == 0) {
+        return formatTimeZone.get();
+    }
+    formatTimeZone = std::unique_ptr<TimeZone>(TimeZone::createTimeZone(timezoneStr.c_str()));
+    formatTimeZoneId = timezoneStr;
+    if (formatTimeZone == nullptr) {
+        return nullptr;
+    }
+    if (calendar != nullptr) {
+        calendar->setTimeZone(*formatTimeZone);
+    }
+    if (dateFormat != nullptr) {
+        dateFormat->setTimeZone(*formatTimeZone);
+    }
+    if (dateIntvFormat != nullptr) {
+        dateIntvFormat->setTimeZone(*formatTimeZone);
+    }
+    return formatTimeZone.get();
 }
 
 std::string DateTimeFormat::FormatRange(int64_t fromMilliseconds, int64_t toMilliseconds)
@@ -626,12 +667,7 @@ std::string DateTimeFormat::FormatRange(int64_t fromMilliseconds, int64_t toMill
     std::string result;
     UnicodeString dateString;
     calendar->clear();
-    std::string timezoneStr = timeZone.empty() ? LocaleConfig::GetSystemTimezone() : timeZone;
-    auto zone = std::unique_ptr<TimeZone>(TimeZone::createTimeZone(timezoneStr.c_str()));
-    if (zone != nullptr) {
-        calendar->setTimeZone(*zone);
-        dateIntvFormat->setTimeZone(*zone);
-    }
+    const TimeZone* zone = UpdateFormatTimeZone();
     calendar->setTime((UDate)fromMilliseconds, status);
     if (U_FAILURE(status)) {
         return PseudoLocalizationProcessor("");
@@ -996,9 +1032,15 @@ bool DateTimeFormat::IsValidPatternNumber(const std::string& number)
 
 icu::UnicodeString DateTimeFormat::GetBestPattern(const icu::UnicodeString& skeleton, const icu::Locale& icuLocale)
 {
+    std::string cacheKey;
+    skeleton.toUTF8String(cacheKey);
+    icu::UnicodeString cachedPattern;
+    if (DateTimePatternCache::FindPattern(icuLocale, cacheKey, cachedPattern)) {
+        return cachedPattern;
+    }
     UErrorCode status = U_ZERO_ERROR;
     auto patternGenerator =
-        std::unique_ptr<DateTimePatternGenerator>(DateTimePatternGenerator::createInstance(icuLocale, status));
+        std::unique_ptr<DateTimePatternGenerator>(DateTimePatternCache::CreateGenerator(icuLocale, status));
     if (U_FAILURE(status) || patternGenerator == nullptr) {
         HILOG_ERROR_I18N("DateTimeFormat::GetBestPattern: Create DateTimePatternGenerator instance failed.");
         return "";
@@ -1018,12 +1060,18 @@ icu::UnicodeString DateTimeFormat::GetBestPattern(const icu::UnicodeString& skel
         HILOG_ERROR_I18N("DateTimeFormat::ReplacePatternByNumeric: Get best pattern from tempPattern failed.");
         return "";
     }
+    DateTimePatternCache::AddPattern(icuLocale, cacheKey, tempPattern);
     return tempPattern;
 }
 
 icu::UnicodeString DateTimeFormat::GetBestPattern(icu::DateFormat::EStyle dateStyle, icu::DateFormat::EStyle timeStyle,
     const icu::Locale& icuLocale)
 {
+    std::string cacheKey = "style:" + std::to_string(dateStyle) + ":" + std::to_string(timeStyle);
+    icu::UnicodeString cachedPattern;
+    if (DateTimePatternCache::FindPattern(icuLocale, cacheKey, cachedPattern)) {
+        return cachedPattern;
+    }
     icu::DateFormat* tempDateFormat = DateFormat::createDateTimeInstance(dateStyle, timeStyle, icuLocale);
     if (tempDateFormat == nullptr) {
         HILOG_ERROR_I18N("DateTimeFormat::GetBestPattern: Create DateFormat instance failed.");
@@ -1037,6 +1085,7 @@ icu::UnicodeString DateTimeFormat::GetBestPattern(icu::DateFormat::EStyle dateSt
     }
     icu::UnicodeString pattern;
     simDateFormatPtr->toPattern(pattern);
+    DateTimePatternCache::AddPattern(icuLocale, cacheKey, pattern);
     return pattern;
 }
 
@@ -20,37 +20,35 @@
 namespace OHOS {
 namespace Global {
 namespace I18n {
-const std::string DEFAULT_DATE_TYPE = "literal";
-
-const std::unordered_map<int32_t, std::string> FIELD_ID_TO_DATE_TYPE = {
-    { UDAT_YEAR_FIELD, "year" },
-    { UDAT_EXTENDED_YEAR_FIELD, "year" },
-    { UDAT_YEAR_NAME_FIELD, "yearName" },
-    { UDAT_MONTH_FIELD, "month" },
-    { UDAT_STANDALONE_MONTH_FIELD, "month" },
-    { UDAT_DATE_FIELD, "day" },
-    { UDAT_HOUR_OF_DAY1_FIELD, "hour" },
-    { UDAT_HOUR_OF_DAY0_FIELD, "hour" },
-    { UDAT_HOUR1_FIELD, "hour" },
-    { UDAT_HOUR0_FIELD, "hour" },
-    { UDAT_MINUTE_FIELD, "minute" },
-    { UDAT_SECOND_FIELD, "second" },
-    { UDAT_DAY_OF_WEEK_FIELD, "weekday" },
-    { UDAT_DOW_LOCAL_FIELD, "weekday" },
-    { UDAT_STANDALONE_DAY_FIELD, "weekday" },
-    { UDAT_AM_PM_FIELD, "dayPeriod" },
-    { UDAT_AM_PM_MIDNIGHT_NOON_FIELD, "dayPeriod" },
-    { UDAT_FLEXIBLE_DAY_PERIOD_FIELD, "dayPeriod" },
-    { UDAT_TIMEZONE_FIELD, "timeZoneName" },
-    { UDAT_TIMEZONE_RFC_FIELD, "timeZoneName" },
-    { UDAT_TIMEZONE_GENERIC_FIELD, "timeZoneName" },
-    { UDAT_TIMEZONE_SPECIAL_FIELD, "timeZoneName" },
-    { UDAT_TIMEZONE_LOCALIZED_GMT_OFFSET_FIELD, "timeZoneName" },
-    { UDAT_TIMEZONE_ISO_FIELD, "timeZoneName" },
-    { UDAT_TIMEZONE_ISO_LOCAL_FIELD, "timeZoneName" },
-    { UDAT_ERA_FIELD, "era" },
-    { UDAT_FRACTIONAL_SECOND_FIELD, "fractionalSecond" },
-    { UDAT_RELATED_YEAR_FIELD, "relatedYear" }
+const std::unordered_map<int32_t, FormatPartType> FIELD_ID_TO_PART_TYPE = {
+    { UDAT_YEAR_FIELD, FormatPartType::YEAR },
+    { UDAT_EXTENDED_YEAR_FIELD, FormatPartType::YEAR },
+    { UDAT_YEAR_NAME_FIELD, FormatPartType::YEAR_NAME },
+    { UDAT_MONTH_FIELD, FormatPartType::MONTH },
+    { UDAT_STANDALONE_MONTH_FIELD, FormatPartType::MONTH },
+    { UDAT_DATE_FIELD, FormatPartType::DAY },
+    { UDAT_HOUR_OF_DAY1_FIELD, FormatPartType::HOUR },
+    { UDAT_HOUR_OF_DAY0_FIELD, FormatPartType::HOUR },
+    { UDAT_HOUR1_FIELD, FormatPartType::HOUR },
+    { UDAT_HOUR0_FIELD, FormatPartType::HOUR },
+    { UDAT_MINUTE_FIELD, FormatPartType::MINUTE },
+    { UDAT_SECOND_FIELD, FormatPartType::SECOND },
+    { UDAT_DAY_OF_WEEK_FIELD, FormatPartType::WEEKDAY },
+    { UDAT_DOW_LOCAL_FIELD, FormatPartType::WEEKDAY },
+    { UDAT_STANDALONE_DAY_FIELD, FormatPartType::WEEKDAY },
+    { UDAT_AM_PM_FIELD, FormatPartType::DAY_PERIOD },
+    { UDAT_AM_PM_MIDNIGHT_NOON_FIELD, FormatPartType::DAY_PERIOD },
+    { UDAT_FLEXIBLE_DAY_PERIOD_FIELD, FormatPartType::DAY_PERIOD },
+    { UDAT_TIMEZONE_FIELD, FormatPartType::TIME_ZONE_NAME },
+    { UDAT_TIMEZONE_RFC_FIELD, FormatPartType::TIME_ZONE_NAME },
+    { UDAT_TIMEZONE_GENERIC_FIELD, FormatPartType::TIME_ZONE_NAME },
+    { UDAT_TIMEZONE_SPECIAL_FIELD, FormatPartType::TIME_ZONE_NAME },
+    { UDAT_TIMEZONE_LOCALIZED_GMT_OFFSET_FIELD, FormatPartType::TIME_ZONE_NAME },
+    { UDAT_TIMEZONE_ISO_FIELD, FormatPartType::TIME_ZONE_NAME },
+    { UDAT_TIMEZONE_ISO_LOCAL_FIELD, FormatPartType::TIME_ZONE_NAME },
+    { UDAT_ERA_FIELD, FormatPartType::ERA },
+    { UDAT_FRACTIONAL_SECOND_FIELD, FormatPartType::FRACTIONAL_SECOND },
+    { UDAT_RELATED_YEAR_FIELD, FormatPartType::RELATED_YEAR }
 };
 
 DateTimeFormatPart::DateTimeFormatPart(int32_t fieldId, size_t start, size_t length) : start(start), length(length)
@@ -64,9 +62,14 @@ DateTimeFormatPart::~DateTimeFormatPart()
 
 std::string DateTimeFormatPart::ConvertFieldIdToDateType(int32_t fieldId)
 {
-    auto iter = FIELD_ID_TO_DATE_TYPE.find(fieldId);
-    if (iter == FIELD_ID_TO_DATE_TYPE.end()) {
-        return DEFAULT_DATE_TYPE;
+    return FormatUtils::GetPartTypeName(ConvertFieldIdToPartType(fieldId));
+}
+
+FormatPartType DateTimeFormatPart::ConvertFieldIdToPartType(int32_t fieldId)
+{
+    auto iter = FIELD_ID_TO_PART_TYPE.find(fieldId);
+    if (iter == FIELD_ID_TO_PART_TYPE.end()) {
+        return FormatPartType::LITERAL;
     }
     return iter->second;
 }
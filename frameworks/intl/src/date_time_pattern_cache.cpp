@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "date_time_pattern_cache.h"
+
+#include "i18n_hilog.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+LruCache<std::string, std::shared_ptr<const icu::DateTimePatternGenerator>>
+    DateTimePatternCache::generatorCache(DateTimePatternCache::GENERATOR_CACHE_CAPACITY);
+LruCache<std::string, icu::UnicodeString> DateTimePatternCache::patternCache(
+    DateTimePatternCache::PATTERN_CACHE_CAPACITY);
+
+icu::DateTimePatternGenerator* DateTimePatternCache::CreateGenerator(const icu::Locale& locale, UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    std::string key = locale.getName();
+    std::shared_ptr<const icu::DateTimePatternGenerator> prototype = nullptr;
+    if (!generatorCache.Find(key, prototype) || prototype == nullptr) {
+        std::shared_ptr<const icu::DateTimePatternGenerator> created(
+            icu::DateTimePatternGenerator::createInstance(locale, status));
+        if (U_FAILURE(status) || created == nullptr) {
+            HILOG_ERROR_I18N("DateTimePatternCache::CreateGenerator: Create DateTimePatternGenerator failed.");
+            return nullptr;
+        }
+        prototype = generatorCache.Insert(key, created);
+    }
+    icu::DateTimePatternGenerator* generator = prototype->clone();
+    if (generator == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return generator;
+}
+
+bool DateTimePatternCache::FindPattern(const icu::Locale& locale, const std::string& key,
+    icu::UnicodeString& pattern)
+{
+    return patternCache.Find(std::string(locale.getName()) + "|" + key, pattern);
+}
+
+void DateTimePatternCache::AddPattern(const icu::Locale& locale, const std::string& key,
+    const icu::UnicodeString& pattern)
+{
+    patternCache.Insert(std::string(locale.getName()) + "|" + key, pattern);
+}
+
+void DateTimePatternCache::Clear()
+{
+    generatorCache.Clear();
+    patternCache.Clear();
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
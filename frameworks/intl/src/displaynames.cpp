@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "displaynames.h"
+#include "date_time_pattern_cache.h"
 #include "i18n_hilog.h"
 #include "locale_config.h"
 #include "locale_helper.h"
@@ -303,7 +304,7 @@ std::string DisplayNames::DisplayDatetimefield(const std::string &code)
     UErrorCode icuStatus = U_ZERO_ERROR;
     icu::Locale locales = icuDisplaynames->getLocale();
     std::unique_ptr<icu::DateTimePatternGenerator> generator(
-        icu::DateTimePatternGenerator::createInstance(locales, icuStatus));
+        DateTimePatternCache::CreateGenerator(locales, icuStatus));
     if (U_FAILURE(icuStatus)) {
         HILOG_ERROR_I18N("DisplayNames::DisplayDatetimefield: create DateTimePatternGenerator fail");
         return "";
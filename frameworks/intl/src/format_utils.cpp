@@ -15,47 +15,123 @@
 
 #include "format_utils.h"
 
+#include <algorithm>
+#include <cmath>
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+
 namespace OHOS {
 namespace Global {
 namespace I18n {
-const std::unordered_map<UNumberFormatFields, std::string> FormatUtils::NUMBER_FORMAT_FIELD_MAP = {
-    { UNUM_FRACTION_FIELD, "fraction" },
-    { UNUM_DECIMAL_SEPARATOR_FIELD, "decimal" },
-    { UNUM_GROUPING_SEPARATOR_FIELD, "group" },
-    { UNUM_CURRENCY_FIELD, "currency" },
-    { UNUM_PERCENT_FIELD, "percentSign" },
-    { UNUM_EXPONENT_SYMBOL_FIELD, "exponentSeparator" },
-    { UNUM_EXPONENT_SIGN_FIELD, "exponentMinusSign" },
-    { UNUM_EXPONENT_FIELD, "exponentInteger" },
-    { UNUM_COMPACT_FIELD, "compact" },
-    { UNUM_MEASURE_UNIT_FIELD, "unit" },
-    { UNUM_APPROXIMATELY_SIGN_FIELD, "approximatelySign" },
+static const std::string PART_TYPE_NAMES[] = {
+    "literal", "year", "yearName", "relatedYear", "month", "day", "hour", "minute", "second",
+    "fractionalSecond", "weekday", "dayPeriod", "timeZoneName", "era", "integer", "fraction", "decimal",
+    "group", "currency", "percentSign", "exponentSeparator", "exponentMinusSign", "exponentInteger",
+    "compact", "unit", "approximatelySign", "nan", "infinity", "minusSign", "plusSign", "unknown"
+};
+static_assert(sizeof(PART_TYPE_NAMES) / sizeof(PART_TYPE_NAMES[0]) == static_cast<size_t>(FormatPartType::END),
+    "PART_TYPE_NAMES must cover FormatPartType");
+
+const std::unordered_map<UNumberFormatFields, FormatPartType> FormatUtils::NUMBER_FORMAT_FIELD_MAP = {
+    { UNUM_FRACTION_FIELD, FormatPartType::FRACTION },
+    { UNUM_DECIMAL_SEPARATOR_FIELD, FormatPartType::DECIMAL },
+    { UNUM_GROUPING_SEPARATOR_FIELD, FormatPartType::GROUP },
+    { UNUM_CURRENCY_FIELD, FormatPartType::CURRENCY },
+    { UNUM_PERCENT_FIELD, FormatPartType::PERCENT_SIGN },
+    { UNUM_EXPONENT_SYMBOL_FIELD, FormatPartType::EXPONENT_SEPARATOR },
+    { UNUM_EXPONENT_SIGN_FIELD, FormatPartType::EXPONENT_MINUS_SIGN },
+    { UNUM_EXPONENT_FIELD, FormatPartType::EXPONENT_INTEGER },
+    { UNUM_COMPACT_FIELD, FormatPartType::COMPACT },
+    { UNUM_MEASURE_UNIT_FIELD, FormatPartType::UNIT },
+    { UNUM_APPROXIMATELY_SIGN_FIELD, FormatPartType::APPROXIMATELY_SIGN },
 };
 
 std::string FormatUtils::GetNumberFieldType(const std::string &napiType,
     const int32_t fieldId, const double number)
+{
+    return GetPartTypeName(GetNumberFieldPartType(napiType, fieldId, number));
+}
+
+FormatPartType FormatUtils::GetNumberFieldPartType(const std::string &napiType,
+    const int32_t fieldId, const double number)
 {
     UNumberFormatFields formatField = static_cast<UNumberFormatFields>(fieldId);
-    if (NUMBER_FORMAT_FIELD_MAP.find(formatField) != NUMBER_FORMAT_FIELD_MAP.end()) {
-        return NUMBER_FORMAT_FIELD_MAP.at(formatField);
+    auto iter = NUMBER_FORMAT_FIELD_MAP.find(formatField);
+    if (iter != NUMBER_FORMAT_FIELD_MAP.end()) {
+        return iter->second;
     }
     bool isBigint = napiType.compare("bigint") == 0;
     switch (formatField) {
         case UNUM_INTEGER_FIELD:
             if (isBigint || std::isfinite(number)) {
-                return "integer";
+                return FormatPartType::INTEGER;
             }
             if (std::isnan(number)) {
-                return "nan";
+                return FormatPartType::NAN_VALUE;
             }
-            return "infinity";
+            return FormatPartType::INFINITY_VALUE;
         case UNUM_SIGN_FIELD:
             if (isBigint) {
-                return number < 0 ? "minusSign" : "plusSign";
+                return number < 0 ? FormatPartType::MINUS_SIGN : FormatPartType::PLUS_SIGN;
             }
-            return std::signbit(number) ? "minusSign" : "plusSign";
+            return std::signbit(number) ? FormatPartType::MINUS_SIGN : FormatPartType::PLUS_SIGN;
         default:
-            return "unknown";
+            return FormatPartType::UNKNOWN;
+    }
+}
+
+const std::string& FormatUtils::GetPartTypeName(FormatPartType type)
+{
+    if (type >= FormatPartType::END) {
+        return PART_TYPE_NAMES[static_cast<size_t>(FormatPartType::UNKNOWN)];
+    }
+    return PART_TYPE_NAMES[static_cast<size_t>(type)];
+}
+
+FormatPartType FormatUtils::GetPartType(const std::string& name)
+{
+    for (size_t i = 0; i < static_cast<size_t>(FormatPartType::END); ++i) {
+        if (PART_TYPE_NAMES[i] == name) {
+            return static_cast<FormatPartType>(i);
+        }
+    }
+    return FormatPartType::UNKNOWN;
+}
+
+void FormatUtils::SetFormattedText(const icu::UnicodeString& formatted, FormattedParts& parts)
+{
+    parts.text.clear();
+    formatted.toUTF8String(parts.text);
+    int32_t length = formatted.length();
+    // Spans are almost always in order, so the UTF-8 offset is carried forward instead of recounted.
+    int32_t utf16Pos = 0;
+    int32_t utf8Pos = 0;
+    auto toUtf8 = [&formatted, &utf16Pos, &utf8Pos](int32_t target) {
+        if (target < utf16Pos) {
+            utf16Pos = 0;
+            utf8Pos = 0;
+        }
+        while (utf16Pos < target) {
+            UChar32 ch = formatted.char32At(utf16Pos);
+            utf16Pos += U16_LENGTH(ch);
+            // toUTF8String writes U+FFFD for an unpaired surrogate.
+            utf8Pos += U_IS_SURROGATE(ch) ? U8_LENGTH(0xFFFD) : U8_LENGTH(ch);
+        }
+        return utf8Pos;
+    };
+    for (FormatPartSpan& span : parts.spans) {
+        int32_t begin = std::min(std::max(span.begin, 0), length);
+        int32_t end = std::max(std::min(span.end, length), begin);
+        span.begin = toUtf8(begin);
+        span.end = toUtf8(end);
+    }
+}
+
+void FormatUtils::AppendPartStrings(const FormattedParts& parts, std::vector<std::vector<std::string>>& result)
+{
+    result.reserve(result.size() + parts.spans.size());
+    for (const FormatPartSpan& span : parts.spans) {
+        result.push_back({ GetPartTypeName(span.type), parts.text.substr(span.begin, span.end - span.begin) });
     }
 }
 } // namespace I18n
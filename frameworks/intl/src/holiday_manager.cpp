@@ -18,7 +18,6 @@
 #include <climits>
 #include <ctime>
 #include <filesystem>
-#include <format>
 #include <fstream>
 #include <iostream>
 #include <regex>
@@ -47,26 +46,19 @@ HolidayManager::HolidayManager(const char* path)
         return;
     }
     std::vector<HolidayInfoItem> items = ReadHolidayFile(absolutePath);
+    std::vector<std::pair<int32_t, HolidayInfoItem>> keyedItems;
+    keyedItems.reserve(items.size());
     for (size_t i = 0; i < items.size(); i++) {
-        struct tm tmObj = {.tm_mday = items[i].day, .tm_mon = items[i].month, .tm_year = items[i].year};
-        char strDate[10];
-        size_t resCode = strftime(strDate, sizeof(strDate), "%Y%m%d", &tmObj);
-        if (resCode == 0) {
-            HILOG_ERROR_I18N("HolidayManager::HolidayManager: strftime error:%{public}zu.", resCode);
-            return;
-        }
-        std::string startDate(strDate);
         items[i].year += YEAR_START;
         items[i].month += MONTH_GREATER_ONE;
-        if (holidayItemMap.find(startDate) != holidayItemMap.end()) {
-            std::vector<HolidayInfoItem> *vetor = &(holidayItemMap.find(startDate)->second);
-            vetor->push_back(items[i]);
-        } else {
-            std::vector<HolidayInfoItem> vetor;
-            vetor.push_back(items[i]);
-            holidayItemMap.insert(std::pair<std::string, std::vector<HolidayInfoItem>>(startDate, vetor));
+        int32_t dateKey = GetDateKey(items[i].year, items[i].month, items[i].day);
+        if (dateKey < 0) {
+            HILOG_ERROR_I18N("HolidayManager::HolidayManager: invalid holiday start date.");
+            continue;
         }
+        keyedItems.emplace_back(dateKey, std::move(items[i]));
     }
+    BuildIndex(keyedItems);
 }
 
 HolidayManager::~HolidayManager()
@@ -75,69 +67,120 @@ HolidayManager::~HolidayManager()
 
 void HolidayManager::SetHolidayData(std::map<std::string, std::vector<HolidayInfoItem>> holidayDataMap)
 {
-    holidayItemMap = holidayDataMap;
+    std::vector<std::pair<int32_t, HolidayInfoItem>> keyedItems;
+    for (auto& holidayData : holidayDataMap) {
+        int32_t dateKey = ParseDateKey(holidayData.first);
+        if (dateKey < 0) {
+            HILOG_ERROR_I18N("HolidayManager::SetHolidayData: invalid date %{public}s.", holidayData.first.c_str());
+            continue;
+        }
+        for (HolidayInfoItem& item : holidayData.second) {
+            keyedItems.emplace_back(dateKey, std::move(item));
+        }
+    }
+    BuildIndex(keyedItems);
+}
+
+void HolidayManager::BuildIndex(std::vector<std::pair<int32_t, HolidayInfoItem>>& keyedItems)
+{
+    // Holidays starting on the same day keep the order in which they were read.
+    std::stable_sort(keyedItems.begin(), keyedItems.end(),
+        [](const std::pair<int32_t, HolidayInfoItem>& left, const std::pair<int32_t, HolidayInfoItem>& right) {
+            return left.first < right.first;
+        });
+    holidayDateKeys.clear();
+    holidayItems.clear();
+    holidayDateKeys.reserve(keyedItems.size());
+    holidayItems.reserve(keyedItems.size());
+    for (auto& keyedItem : keyedItems) {
+        holidayDateKeys.push_back(keyedItem.first);
+        holidayItems.push_back(std::move(keyedItem.second));
+    }
+}
+
+int32_t HolidayManager::GetDateKey(int32_t year, int32_t month, int32_t day)
+{
+    if (year < 0 || year > MAX_YEAR || month < MONTH_GREATER_ONE || month > MAX_MONTH || day < 1 || day > MAX_DAY) {
+        return -1;
+    }
+    return year * YEAR_KEY_UNIT + month * MONTH_KEY_UNIT + day;
+}
+
+int32_t HolidayManager::ParseDateKey(const std::string& date)
+{
+    // 8 is the length of a date formatted as YYYYMMDD
+    if (date.length() != 8 || !std::all_of(date.begin(), date.end(), [](char ch) { return ch >= '0' && ch <= '9'; })) {
+        return -1;
+    }
+    int32_t value = std::stoi(date);
+    return GetDateKey(value / YEAR_KEY_UNIT, value % YEAR_KEY_UNIT / MONTH_KEY_UNIT, value % MONTH_KEY_UNIT);
+}
+
+bool HolidayManager::GetCurrentDate(int32_t& year, int32_t& month, int32_t& day)
+{
+    time_t timeStamp = time(nullptr);
+    struct tm timObj = {};
+    if (localtime_r(&timeStamp, &timObj) == nullptr) {
+        return false;
+    }
+    year = timObj.tm_year + YEAR_START;
+    month = timObj.tm_mon + MONTH_GREATER_ONE;
+    day = timObj.tm_mday;
+    return true;
 }
 
 bool HolidayManager::IsHoliday()
 {
-    time_t timeStamp = time(NULL);
-    struct tm* timObj = localtime(&timeStamp);
-    if (timObj == nullptr) {
+    int32_t year = 0;
+    int32_t month = 0;
+    int32_t day = 0;
+    if (!GetCurrentDate(year, month, day)) {
         return false;
     }
-    int32_t year = timObj->tm_year + YEAR_START;
-    int32_t month = timObj->tm_mon + MONTH_GREATER_ONE;
-    return IsHoliday(year, month, timObj->tm_mday);
+    return IsHoliday(year, month, day);
 }
 
 bool HolidayManager::IsHoliday(int32_t year, int32_t month, int32_t day)
 {
-    std::string startDate = Format(year, month, day);
-    if (holidayItemMap.find(startDate) != holidayItemMap.end()) {
-        std::vector<HolidayInfoItem> list = holidayItemMap.find(startDate)->second;
-        return list.size() > 0;
+    int32_t dateKey = GetDateKey(year, month, day);
+    if (dateKey < 0) {
+        return false;
     }
-    return false;
+    return std::binary_search(holidayDateKeys.begin(), holidayDateKeys.end(), dateKey);
 }
 
-std::string HolidayManager::Format(int32_t year, int32_t month, int32_t day)
+HolidayInfoItemRange HolidayManager::GetHolidayInfoItems(int32_t fromDateKey, int32_t toDateKey) const
 {
-    std::string formated;
-    formated += std::to_string(year);
-    // Numbers less than 10 are one digit
-    formated += month < 10 ? ("0" + std::to_string(month)) : std::to_string(month);
-    // Numbers less than 10 are one digit
-    formated += day < 10 ? ("0" + std::to_string(day)) : std::to_string(day);
-    return formated;
+    HolidayInfoItemRange range;
+    if (fromDateKey >= toDateKey || holidayItems.empty()) {
+        return range;
+    }
+    auto first = std::lower_bound(holidayDateKeys.begin(), holidayDateKeys.end(), fromDateKey);
+    auto last = std::lower_bound(first, holidayDateKeys.end(), toDateKey);
+    range.first = holidayItems.data() + (first - holidayDateKeys.begin());
+    range.last = holidayItems.data() + (last - holidayDateKeys.begin());
+    return range;
 }
 
 std::vector<HolidayInfoItem> HolidayManager::GetHolidayInfoItemArray()
 {
-    time_t timeStamp = time(NULL);
-    struct tm* timObj = localtime(&timeStamp);
-    if (timObj == nullptr) {
+    int32_t year = 0;
+    int32_t month = 0;
+    int32_t day = 0;
+    if (!GetCurrentDate(year, month, day)) {
         std::vector<HolidayInfoItem> emptyList;
         return emptyList;
     }
-    int32_t realYear = timObj->tm_year + YEAR_START;
-    return GetHolidayInfoItemArray(realYear);
+    return GetHolidayInfoItemArray(year);
 }
 
 std::vector<HolidayInfoItem> HolidayManager::GetHolidayInfoItemArray(int32_t year)
 {
-    std::vector<HolidayInfoItem> vetor;
-    std::string formatedYear = std::to_string(year);
-    std::map<std::string, std::vector<HolidayInfoItem>>::iterator iter;
-    for (iter = holidayItemMap.begin(); iter != holidayItemMap.end(); ++iter) {
-        std::string key = iter->first;
-        if (formatedYear == key.substr(0, 4)) { // 4 is the length of full year
-            std::vector<HolidayInfoItem> temp = iter->second;
-            for (size_t i = 0; i < temp.size(); i++) {
-                vetor.push_back(temp[i]);
-            }
-        }
+    if (year < 0 || year > MAX_YEAR) {
+        return {};
     }
-    return vetor;
+    HolidayInfoItemRange range = GetHolidayInfoItems(year * YEAR_KEY_UNIT, (year + 1) * YEAR_KEY_UNIT);
+    return std::vector<HolidayInfoItem>(range.begin(), range.end());
 }
 
 std::vector<HolidayInfoItem> HolidayManager::ReadHolidayFile(const std::string &path)
@@ -184,12 +227,11 @@ void HolidayManager::ParseFileLine(const std::string &line, HolidayInfoItem *hol
     std::string value = line.substr(valuePos + 1, line.length());
     if (tag.compare(ITEM_DTSTART_TAG) == 0) {
         std::string startDate = value.size() >= 8 ? value.substr(0, 8) : ""; // 8 is date formarted string length
-        if (startDate.size() == 8) {
-            struct tm timeObj;
-            strptime(startDate.c_str(), "%Y%m%d", &timeObj);
-            holidayItem->year = timeObj.tm_year;
-            holidayItem->month = timeObj.tm_mon;
-            holidayItem->day = timeObj.tm_mday;
+        int32_t dateKey = ParseDateKey(startDate);
+        if (dateKey >= 0) {
+            holidayItem->year = dateKey / YEAR_KEY_UNIT - YEAR_START;
+            holidayItem->month = dateKey % YEAR_KEY_UNIT / MONTH_KEY_UNIT - MONTH_GREATER_ONE;
+            holidayItem->day = dateKey % MONTH_KEY_UNIT;
         }
     } else if (tag.compare(ITEM_SUMMARY_TAG) == 0) {
         holidayItem->baseName = value;
@@ -43,6 +43,7 @@
 #include <iostream>
 #include <regex>
 #include "timezone_location.h"
+#include "timezone_location_index.h"
 
 namespace OHOS {
 namespace Global {
@@ -68,17 +69,16 @@ const char *I18nTimeZone::CITY_DISPLAYNAME_ROOT_TAG = "display_names";
 const char *I18nTimeZone::CITY_DISPLAYNAME_SECOND_ROOT_TAG = "display_name";
 
 std::set<std::string> I18nTimeZone::supportedLocales {};
-std::unordered_set<std::string> I18nTimeZone::availableZoneCityIDs {};
+std::shared_ptr<const std::unordered_set<std::string>> I18nTimeZone::availableZoneCityIDs =
+    std::make_shared<const std::unordered_set<std::string>>();
 std::unordered_map<std::string, std::string> I18nTimeZone::city2TimeZoneID {};
-std::unordered_map<std::string, std::string> I18nTimeZone::cityDisplayNameCache {};
-std::string I18nTimeZone::cityDisplayNameCacheLocale = "";
+CityDisplayNameCache I18nTimeZone::cityDisplayNameCache(I18nTimeZone::CITY_DISPLAYNAME_CACHE_SIZE);
 std::string I18nTimeZone::appDefaultTimeZoneID = "";
 std::map<std::string, std::string> I18nTimeZone::BEST_MATCH_LOCALE {};
 std::mutex I18nTimeZone::matchLocaleMutex;
 std::mutex I18nTimeZone::initZoneInfoMutex;
 std::mutex I18nTimeZone::initSupportedLocalesMutex;
-std::mutex I18nTimeZone::cityDisplayNameMutex;
-bool I18nTimeZone::initAvailableZoneInfo = false;
+std::atomic<bool> I18nTimeZone::initAvailableZoneInfo(false);
 bool I18nTimeZone::initSupportedLocales = false;
 
 std::map<int, std::string> I18nTimeZone::categoryNum2TimezoneWN {
@@ -621,7 +621,7 @@ I18nTimeZone::I18nTimeZone(std::string &id, bool isZoneID)
             timezone = icu::TimeZone::createTimeZone(unicodeZoneID);
         }
     } else {
-        GetAvailableZoneCityIDs();
+        InitAvailableZoneCityIDs();
         if (city2TimeZoneID.find(id) == city2TimeZoneID.end()) {
             if (!appDefaultTimeZoneID.empty()) {
                 icu::UnicodeString unicodeZoneID(appDefaultTimeZoneID.data(), appDefaultTimeZoneID.length());
@@ -771,7 +771,7 @@ std::string I18nTimeZone::GetDisplayNameByTaboo(
     return tabooUtils->ReplaceTimeZoneName(GetID(), localeStr, result);
 }
 
-bool I18nTimeZone::ReadTimeZoneData(const char *xmlPath)
+bool I18nTimeZone::ReadTimeZoneData(const char *xmlPath, std::unordered_set<std::string> &cityIDs)
 {
     xmlKeepBlanksDefault(0);
     if (xmlPath == nullptr) {
@@ -800,7 +800,7 @@ bool I18nTimeZone::ReadTimeZoneData(const char *xmlPath)
         }
         if (!xmlNodeIsNull) {
             // 0 represents cityid index, 1 represents zoneid index
-            availableZoneCityIDs.insert(reinterpret_cast<const char *>(contents[0]));
+            cityIDs.insert(reinterpret_cast<const char *>(contents[0]));
             const char* pairKey = reinterpret_cast<const char *>(contents[0]);
             const char* pairVal = reinterpret_cast<const char *>(contents[1]);
             city2TimeZoneID.insert(std::make_pair<std::string, std::string>(pairKey, pairVal));
@@ -843,84 +843,140 @@ std::set<std::string> I18nTimeZone::GetAvailableIDs()
     return GetTimeZoneAvailableIDs();
 }
 
+std::shared_ptr<const std::set<std::string>> I18nTimeZone::GetAvailableIDSet()
+{
+    return GetTimeZoneAvailableIDSet();
+}
+
+bool I18nTimeZone::IsAvailableID(const std::string &id)
+{
+    std::shared_ptr<const std::set<std::string>> availableIDs = GetTimeZoneAvailableIDSet();
+    return availableIDs->find(id) != availableIDs->end();
+}
+
 std::unordered_set<std::string> I18nTimeZone::GetAvailableZoneCityIDs()
 {
-    if (initAvailableZoneInfo) {
+    return *GetAvailableZoneCityIDSet();
+}
+
+std::shared_ptr<const std::unordered_set<std::string>> I18nTimeZone::GetAvailableZoneCityIDSet()
+{
+    if (InitAvailableZoneCityIDs()) {
         return availableZoneCityIDs;
     }
     std::lock_guard<std::mutex> lock(initZoneInfoMutex);
-    if (initAvailableZoneInfo) {
-        return availableZoneCityIDs;
+    return availableZoneCityIDs;
+}
+
+bool I18nTimeZone::IsAvailableZoneCityID(const std::string &cityID)
+{
+    std::shared_ptr<const std::unordered_set<std::string>> cityIDs = GetAvailableZoneCityIDSet();
+    return cityIDs->find(cityID) != cityIDs->end();
+}
+
+bool I18nTimeZone::InitAvailableZoneCityIDs()
+{
+    if (initAvailableZoneInfo.load(std::memory_order_acquire)) {
+        return true;
     }
+    std::lock_guard<std::mutex> lock(initZoneInfoMutex);
+    if (initAvailableZoneInfo.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    std::unordered_set<std::string> cityIDs;
     struct stat s;
     if (stat(DISTRO_DEVICE_CITY_TIMEZONE_DATA_PATH, &s) == 0) {
-        ReadTimeZoneData(DISTRO_DEVICE_CITY_TIMEZONE_DATA_PATH);
+        ReadTimeZoneData(DISTRO_DEVICE_CITY_TIMEZONE_DATA_PATH, cityIDs);
     } else if (stat(DEVICE_CITY_TIMEZONE_DATA_PATH, &s) == 0) {
-        ReadTimeZoneData(DEVICE_CITY_TIMEZONE_DATA_PATH);
+        ReadTimeZoneData(DEVICE_CITY_TIMEZONE_DATA_PATH, cityIDs);
     } else {
-        ReadTimeZoneData(CITY_TIMEZONE_DATA_PATH);
+        ReadTimeZoneData(CITY_TIMEZONE_DATA_PATH, cityIDs);
     }
     TabooUtils* tabooUtils = TabooUtils::GetInstance();
     if (tabooUtils == nullptr) {
-        HILOG_ERROR_I18N("I18nTimeZone::GetAvailableZoneCityIDs: tabooUtils is nullptr.");
-        return availableZoneCityIDs;
+        HILOG_ERROR_I18N("I18nTimeZone::InitAvailableZoneCityIDs: tabooUtils is nullptr.");
+        availableZoneCityIDs = std::make_shared<const std::unordered_set<std::string>>(std::move(cityIDs));
+        return false;
     }
-    std::unordered_set<std::string> blockedCities = tabooUtils->GetBlockedCities();
-    for (const auto& city : blockedCities) {
-        if (availableZoneCityIDs.find(city) != availableZoneCityIDs.end()) {
-            availableZoneCityIDs.erase(city);
-            city2TimeZoneID.erase(city);
+    for (auto it = cityIDs.begin(); it != cityIDs.end();) {
+        if (tabooUtils->IsBlockedCity(*it)) {
+            city2TimeZoneID.erase(*it);
+            it = cityIDs.erase(it);
+        } else {
+            ++it;
         }
     }
-    initAvailableZoneInfo = true;
-    return availableZoneCityIDs;
+    availableZoneCityIDs = std::make_shared<const std::unordered_set<std::string>>(std::move(cityIDs));
+    initAvailableZoneInfo.store(true, std::memory_order_release);
+    return true;
 }
 
 std::string I18nTimeZone::FindCityDisplayNameFromXml(std::string &cityID, std::string &locale)
 {
-    std::lock_guard<std::mutex> lock(cityDisplayNameMutex);
-    if (cityDisplayNameCacheLocale.compare(locale) == 0) {
-        return GetCityDisplayNameFromCache(cityID);
+    std::shared_ptr<const CityDisplayNameTable> table = GetCityDisplayNameTable(locale);
+    auto iter = table->find(cityID);
+    if (iter != table->end()) {
+        return iter->second;
     }
-    std::string displayName = FindCityDisplayNameFromXmlInner(cityID, locale);
-    return displayName;
+    HILOG_ERROR_I18N("I18nTimeZone::FindCityDisplayNameFromXml: not found cityID:%{public}s in locale:%{public}s",
+        cityID.c_str(), locale.c_str());
+    return "";
 }
 
-std::string I18nTimeZone::FindCityDisplayNameFromXmlInner(std::string &cityID, std::string &locale)
+std::shared_ptr<const CityDisplayNameTable> I18nTimeZone::GetCityDisplayNameTable(const std::string &locale)
 {
-    xmlKeepBlanksDefault(0);
     std::string xmlPath = GetCityDisplayNameXmlPath(locale);
+    std::shared_ptr<const CityDisplayNameTable> table;
+    if (cityDisplayNameCache.Find(xmlPath, table)) {
+        return table;
+    }
+    table = ParseCityDisplayNames(xmlPath);
+    if (table == nullptr) {
+        // Not cached, so the file is read again once it becomes available.
+        static const std::shared_ptr<const CityDisplayNameTable> emptyTable =
+            std::make_shared<const CityDisplayNameTable>();
+        return emptyTable;
+    }
+    return cityDisplayNameCache.Insert(xmlPath, table);
+}
+
+std::shared_ptr<const CityDisplayNameTable> I18nTimeZone::ParseCityDisplayNames(const std::string &xmlPath)
+{
+    std::shared_ptr<CityDisplayNameTable> table = std::make_shared<CityDisplayNameTable>();
+    xmlKeepBlanksDefault(0);
     xmlDocPtr doc = xmlParseFile(xmlPath.c_str());
     if (!doc) {
-        HILOG_ERROR_I18N("FindCityDisplayNameFromXml: can't parse city displayname: %{public}s", xmlPath.c_str());
-        return "";
+        HILOG_ERROR_I18N("ParseCityDisplayNames: can't parse city displayname file %{public}s", xmlPath.c_str());
+        return nullptr;
     }
     xmlNodePtr cur = xmlDocGetRootElement(doc);
     if (!cur || xmlStrcmp(cur->name, reinterpret_cast<const xmlChar *>(CITY_DISPLAYNAME_ROOT_TAG))) {
         xmlFreeDoc(doc);
         HILOG_ERROR_I18N(
-            "FindCityDisplayNameFromXml: city displayname file %{public}s has wrong root tag.", xmlPath.c_str());
-        return "";
+            "ParseCityDisplayNames: city displayname file %{public}s has wrong root tag.", xmlPath.c_str());
+        return nullptr;
     }
     cur = cur->xmlChildrenNode;
-    cityDisplayNameCache.clear();
     while (cur != nullptr && !xmlStrcmp(cur->name,
         reinterpret_cast<const xmlChar *>(CITY_DISPLAYNAME_SECOND_ROOT_TAG))) {
         xmlNodePtr value = cur->xmlChildrenNode;
         xmlChar *contents[ELEMENT_NUM] = { 0 }; // 2 represent cityid, displayName;
         bool xmlNodeIsNull = false;
-        for (size_t i = 0; i < ELEMENT_NUM && value != nullptr; i++) {
-            contents[i] = xmlNodeGetContent(value);
-            if (contents[i] == nullptr) {
+        for (size_t i = 0; i < ELEMENT_NUM; i++) {
+            if (value == nullptr) {
                 xmlNodeIsNull = true;
                 break;
             }
+            contents[i] = xmlNodeGetContent(value);
             value = value->next;
+            if (contents[i] == nullptr) {
+                xmlNodeIsNull = true;
+            }
         }
         if (!xmlNodeIsNull) {
-            const char* xmlKey = reinterpret_cast<const char *>(contents[0]);
-            const char* xmlValue = reinterpret_cast<const char *>(contents[1]);
-            AddCityDisplayNameCache(xmlKey, xmlValue);
+            const char* key = reinterpret_cast<const char *>(contents[0]);
+            const char* displayName = reinterpret_cast<const char *>(contents[1]);
+            table->emplace(key, displayName);
         }
         for (size_t i = 0; i < ELEMENT_NUM; i++) {
             if (contents[i] != nullptr) {
@@ -930,45 +986,7 @@ std::string I18nTimeZone::FindCityDisplayNameFromXmlInner(std::string &cityID, s
         cur = cur->next;
     }
     xmlFreeDoc(doc);
-    return ResetCityDisplayNameCache(cityID, locale);
-}
-
-std::string I18nTimeZone::ResetCityDisplayNameCache(std::string &cityID, std::string &locale)
-{
-    cityDisplayNameCacheLocale = locale;
-    if (cityDisplayNameCache.find(cityID) != cityDisplayNameCache.end()) {
-        return cityDisplayNameCache.at(cityID);
-    }
-    HILOG_ERROR_I18N("I18nTimeZone::ResetCityDisplayNameCache: not found cityID:%{public}s in locale:%{public}s",
-        cityID.c_str(), locale.c_str());
-    return "";
-}
-
-void I18nTimeZone::AddCityDisplayNameCache(const char* xmlCityId, const char* xmlValue)
-{
-    if (xmlCityId == nullptr) {
-        HILOG_ERROR_I18N("I18nTimeZone::AddCityDisplayNameCache: xmlCityId is NULL.");
-        return;
-    }
-    if (xmlValue == nullptr) {
-        HILOG_ERROR_I18N("I18nTimeZone::AddCityDisplayNameCache: xmlValue is NULL.");
-        return;
-    }
-    std::string cityId(xmlCityId);
-    std::string cityDispName(xmlValue);
-    if (!cityId.empty() && !cityDispName.empty()) {
-        cityDisplayNameCache.insert(std::make_pair(cityId, cityDispName));
-    }
-}
-
-std::string I18nTimeZone::GetCityDisplayNameFromCache(std::string &cityID)
-{
-    if (cityDisplayNameCache.find(cityID) != cityDisplayNameCache.end()) {
-        return cityDisplayNameCache.at(cityID);
-    }
-    HILOG_ERROR_I18N("I18nTimeZone::GetCityDisplayNameFromCache: not found cityID:%{public}s in locale:%{public}s",
-        cityID.c_str(), cityDisplayNameCacheLocale.c_str());
-    return "";
+    return table;
 }
 
 std::string I18nTimeZone::GetCityDisplayNameXmlPath(const std::string &locale)
@@ -983,48 +1001,8 @@ std::string I18nTimeZone::GetCityDisplayNameXmlPath(const std::string &locale)
 
 std::map<std::string, std::string> I18nTimeZone::FindCityDisplayNameMap(std::string &locale)
 {
-    xmlKeepBlanksDefault(0);
-    std::map<std::string, std::string> resultMap;
-    std::string xmlPath = GetCityDisplayNameXmlPath(locale);
-    xmlDocPtr doc = xmlParseFile(xmlPath.c_str());
-    if (!doc) {
-        HILOG_ERROR_I18N("FindCityDisplayNameMap: can't parse city displayname file %{public}s", xmlPath.c_str());
-        return resultMap;
-    }
-    xmlNodePtr cur = xmlDocGetRootElement(doc);
-    if (!cur || xmlStrcmp(cur->name, reinterpret_cast<const xmlChar *>(CITY_DISPLAYNAME_ROOT_TAG))) {
-        xmlFreeDoc(doc);
-        HILOG_ERROR_I18N(
-            "FindCityDisplayNameMap: city displayname file %{public}s has wrong root tag.", xmlPath.c_str());
-        return resultMap;
-    }
-    cur = cur->xmlChildrenNode;
-    while (cur != nullptr && !xmlStrcmp(cur->name,
-        reinterpret_cast<const xmlChar *>(CITY_DISPLAYNAME_SECOND_ROOT_TAG))) {
-        xmlNodePtr value = cur->xmlChildrenNode;
-        xmlChar *contents[ELEMENT_NUM] = { 0 }; // 2 represent cityid, displayName;
-        bool xmlNodeIsNull = false;
-        for (size_t i = 0; i < ELEMENT_NUM && value != nullptr; i++) {
-            contents[i] = xmlNodeGetContent(value);
-            value = value->next;
-            if (contents[i] == nullptr) {
-                xmlNodeIsNull = true;
-            }
-        }
-        if (!xmlNodeIsNull) {
-            const char* key = reinterpret_cast<const char *>(contents[0]);
-            const char* displayName = reinterpret_cast<const char *>(contents[1]);
-            resultMap.insert(std::make_pair<std::string, std::string>(key, displayName));
-        }
-        for (size_t i = 0; i < ELEMENT_NUM; i++) {
-            if (contents[i] != nullptr) {
-                xmlFree(contents[i]);
-            }
-        }
-        cur = cur->next;
-    }
-    xmlFreeDoc(doc);
-    return resultMap;
+    std::shared_ptr<const CityDisplayNameTable> table = GetCityDisplayNameTable(locale);
+    return std::map<std::string, std::string>(table->begin(), table->end());
 }
 
 bool I18nTimeZone::GetSupportedLocales()
@@ -1103,8 +1081,7 @@ void I18nTimeZone::SetBestMatchLocale(const std::string& key, const std::string&
 
 std::string I18nTimeZone::GetCityDisplayName(std::string &cityID, std::string &localeStr)
 {
-    GetAvailableZoneCityIDs();
-    if (availableZoneCityIDs.find(cityID) == availableZoneCityIDs.end()) {
+    if (!IsAvailableZoneCityID(cityID)) {
         HILOG_ERROR_I18N("I18nTimeZone::GetCityDisplayName: %{public}s is not supported cityID.", cityID.c_str());
         return PseudoLocalizationProcessor("");
     }
@@ -1144,7 +1121,7 @@ std::string I18nTimeZone::GetLocaleBaseName(std::string &localeStr)
 
 std::string I18nTimeZone::GetTimezoneIdByCityId(const std::string &cityId)
 {
-    GetAvailableZoneCityIDs();
+    InitAvailableZoneCityIDs();
     if (city2TimeZoneID.find(cityId) == city2TimeZoneID.end()) {
         return "";
     }
@@ -1158,42 +1135,50 @@ std::vector<std::string> I18nTimeZone::GetTimezoneIdByLocation(const double x, c
     if (!CheckLatitudeAndLongitude(x, y)) {
         return tzIdList;
     }
-    std::map<int, std::string> categoryMap = GetTimeZoneCategoryMap(x, y);
-    std::vector<std::string> filePaths = FindTzData();
-    size_t fileCount = filePaths.size();
-    if (fileCount < 1) {
-        return tzIdList;
-    }
-    std::string preferredPath = GetPreferredPath(x, filePaths);
-    if (preferredPath.empty()) {
-        return tzIdList;
+    std::vector<int> pixel = TimezoneLocationIndex::GetInstance().GetPixel(x, y);
+    tzIdList = GetTimezoneIdsByPixel(pixel, x, y);
+#endif
+    return tzIdList;
+}
+
+std::vector<std::vector<std::string>> I18nTimeZone::GetTimezoneIdsByLocations(
+    const std::vector<std::pair<double, double>>& locations)
+{
+    std::vector<std::vector<std::string>> tzIdLists(locations.size());
+#ifdef SUPPORT_GRAPHICS
+    std::vector<std::pair<double, double>> validLocations;
+    std::vector<size_t> validIndexes;
+    for (size_t i = 0; i < locations.size(); i++) {
+        if (CheckLatitudeAndLongitude(locations[i].first, locations[i].second)) {
+            validLocations.push_back(locations[i]);
+            validIndexes.push_back(i);
+        }
     }
-    uint32_t width = 0;
-    uint32_t height = 0;
-    std::tie(width, height) = GetTzDataWidth(filePaths);
-    double calculateX = y * width / (TZ_X_PLUS * 1.0) + width / (TZ_HALF_OF_SIZE * 1.0);
-    double calculateY = x * ((height * fileCount) / (TZ_X_PLUS * TZ_HALF_OF_SIZE * 1.0)) +
-                        (height * fileCount) / (TZ_HALF_OF_SIZE * 1.0);
-    uint16_t fixedX = static_cast<uint16_t>(calculateX);
-    uint16_t fixedY = static_cast<uint16_t>(calculateY);
-    if (ParamExceedScope(fixedX, fixedY, width, height * fileCount)) {
-        HILOG_ERROR_I18N("invalid width:%{public}d or height: %{public}d", fixedX, fixedY);
-        return tzIdList;
+    std::vector<std::vector<int>> pixels = TimezoneLocationIndex::GetInstance().GetPixels(validLocations);
+    for (size_t i = 0; i < pixels.size(); i++) {
+        tzIdLists[validIndexes[i]] = GetTimezoneIdsByPixel(pixels[i], validLocations[i].first,
+            validLocations[i].second);
     }
-    uint16_t actualHeight = fileCount > 1 ? (fixedY % height) : fixedY;
-    std::vector<int> pixel = GetColorData(fixedX, fixedY, actualHeight, preferredPath);
+#endif
+    return tzIdLists;
+}
+
+std::vector<std::string> I18nTimeZone::GetTimezoneIdsByPixel(const std::vector<int>& pixel, const double x,
+    const double y)
+{
+    std::vector<std::string> tzIdList;
+    const std::map<int, std::string>& categoryMap = GetTimeZoneCategoryMap(x, y);
     for (size_t i = 0; i < pixel.size(); i++) {
         //255 is invalid pixel value required
-        if (pixel[i] != TZ_MAX_PIXEL_VALUE && categoryMap.find(pixel[i]) != categoryMap.end()) {
-            std::string zdId = categoryMap[pixel[i]];
-            tzIdList.push_back(zdId);
+        auto iter = categoryMap.find(pixel[i]);
+        if (pixel[i] != TZ_MAX_PIXEL_VALUE && iter != categoryMap.end()) {
+            tzIdList.push_back(iter->second);
         }
     }
-#endif
     return tzIdList;
 }
 
-std::map<int, std::string> I18nTimeZone::GetTimeZoneCategoryMap(const double x, const double y)
+const std::map<int, std::string>& I18nTimeZone::GetTimeZoneCategoryMap(const double x, const double y)
 {
     if (x < 0 && Geq(y, 0)) {
         return categoryNum2TimezoneWN;
@@ -1223,47 +1208,6 @@ bool I18nTimeZone::CheckLatitudeAndLongitude(const double x, const double y)
     return true;
 }
 
-std::vector<int> I18nTimeZone::GetColorData(const uint16_t x, const uint16_t y,
-                                            uint16_t actualHeight, std::string preferredPath)
-{
-    std::vector<int> result;
-    FILE *fp;
-    png_structp png_ptr;
-    png_infop info_ptr;
-    png_bytep row_pointers;
-    int code = InitPngptr(png_ptr, info_ptr, &fp, preferredPath);
-    if (code != 0) {
-        return result;
-    }
-    try {
-        rewind(fp);
-        png_init_io(png_ptr, fp);
-        png_read_info(png_ptr, info_ptr);
-        unsigned int rowbytes = png_get_rowbytes(png_ptr, info_ptr);
-        row_pointers = (png_bytep)png_malloc(png_ptr, rowbytes);
-        if (row_pointers == nullptr) {
-            png_destroy_read_struct(&png_ptr, &info_ptr, 0);
-            CloseFile(fp);
-            HILOG_ERROR_I18N("malloc rowbytes failed.");
-            return result;
-        }
-        png_start_read_image(png_ptr);
-        for (int i = 0; i < (actualHeight + 1); i++) {
-            png_read_row(png_ptr, row_pointers, NULL);
-        }
-        for (size_t i = 0; i < 3; i++) { // 3 is RGB color pixel length
-            std::string pixel = std::to_string(*(row_pointers + x * 3 + i)); // 3 is RGB color pixel length
-            result.push_back(atoi(pixel.c_str()));
-        }
-        png_free(png_ptr, row_pointers);
-        CloseFile(fp);
-    } catch (...) {
-        png_destroy_read_struct(&png_ptr, &info_ptr, 0);
-        CloseFile(fp);
-    }
-    return result;
-}
-
 std::tuple<uint32_t, uint32_t> I18nTimeZone::GetTzDataWidth(std::vector<std::string> filePaths)
 {
     if (filePaths.size() == 0) {
@@ -1338,31 +1282,12 @@ int I18nTimeZone::InitPngptr(png_structp &png_ptr, png_infop &info_ptr, FILE **f
     return 0;
 }
 
-std::string I18nTimeZone::GetPreferredPath(const double x,
-                                           const std::vector<std::string> &filePaths)
-{
-    if (filePaths.size() == 1) {
-        return filePaths.at(0);
-    }
-    int fixedX = static_cast<int>(x + TZ_X_PLUS);
-    for (unsigned int i = 0; i < filePaths.size(); i++) {
-        std::string path = filePaths.at(i);
-        std::string left = path.substr(path.find("-") + 1, 3);
-        std::string right = path.substr(path.find("-") + 4, 3);
-        if (fixedX >= atoi(left.c_str()) && fixedX < atoi(right.c_str())) {
-            return path;
-        }
-    }
-    return "";
-}
-
-std::vector<std::string> I18nTimeZone::FindTzData()
+std::vector<std::string> I18nTimeZone::FindTzData(const std::vector<std::string> &pixelPaths)
 {
     using std::filesystem::directory_iterator;
     std::map<std::string, std::vector<std::string>> pathMap;
     std::regex reg("tz_[0-9]{7}-(\\d{6})\\.dat");
     std::regex regVersion("_[0-9]{7}");
-    const std::vector<std::filesystem::path> pixelPaths = {TZ_PIXEL_PATH, DISTRO_TZ_PIXEL_PATH};
     for (const auto& pixelPath : pixelPaths) {
         if (!FileExist(pixelPath)) {
             HILOG_INFO_I18N("pixelPaths does not exists: %{public}s.", pixelPath.c_str());
@@ -1451,8 +1376,7 @@ const char *I18nTimeZone::GetDeviceCityDisplayNamePath()
 
 I18nErrorCode I18nTimeZone::SetAppDefaultTimeZoneById(const std::string& zoneID)
 {
-    std::set<std::string> availableIDs = GetAvailableIDs();
-    if (availableIDs.find(zoneID) == availableIDs.end()) {
+    if (!IsAvailableID(zoneID)) {
         HILOG_ERROR_I18N("SetAppDefaultTimeZoneById: invalid zoneID.");
         return I18nErrorCode::INVALID_PARAM;
     }
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include "ohos/init_data.h"
 #include "unicode/gregocal.h"
+#include "date_time_pattern_cache.h"
 #include "i18n_hilog.h"
 #include "i18n_timezone.h"
 #include "locale_config.h"
@@ -230,6 +231,12 @@ IntlDateTimeFormat::IntlDateTimeFormat(const std::vector<std::string>& localeTag
         errMessage = "invalid locale";
         return;
     }
+    std::string prototypeKey = GetPrototypeKey(requestedLocales, configs);
+    std::shared_ptr<const FormatPrototype> prototype;
+    if (prototypeCache.Find(prototypeKey, prototype) && prototype != nullptr && InitFromPrototype(*prototype)) {
+        initSuccess = true;
+        return;
+    }
     if (!ParseConfigs(configs, errMessage)) {
         HILOG_ERROR_I18N("IntlDateTimeFormat::IntlDateTimeFormat: Parse configs failed.");
         return;
@@ -263,6 +270,13 @@ IntlDateTimeFormat::IntlDateTimeFormat(const std::vector<std::string>& localeTag
         return;
     }
     initSuccess = true;
+    if (!errMessage.empty()) {
+        return;
+    }
+    prototype = CreatePrototype();
+    if (prototype != nullptr) {
+        prototypeCache.Insert(prototypeKey, prototype);
+    }
 }
 
 IntlDateTimeFormat::~IntlDateTimeFormat()
@@ -295,9 +309,27 @@ std::string IntlDateTimeFormat::Format(double milliseconds)
 std::vector<std::unordered_map<std::string, std::string>> IntlDateTimeFormat::FormatToParts(double milliseconds,
     std::string& errMessage)
 {
+    FormattedParts parts;
+    FormatToParts(milliseconds, parts, errMessage);
+    if (!errMessage.empty()) {
+        return {};
+    }
+    std::vector<std::unordered_map<std::string, std::string>> result(parts.spans.size());
+    for (size_t i = 0; i < parts.spans.size(); ++i) {
+        const FormatPartSpan& span = parts.spans[i];
+        result[i].insert(std::make_pair(PART_TYPE_TAG, FormatUtils::GetPartTypeName(span.type)));
+        result[i].insert(std::make_pair(PART_VALUE_TAG, parts.text.substr(span.begin, span.end - span.begin)));
+    }
+    return result;
+}
+
+void IntlDateTimeFormat::FormatToParts(double milliseconds, FormattedParts& parts, std::string& errMessage)
+{
+    parts.text.clear();
+    parts.spans.clear();
     if (!initSuccess || icuSimpleDateFormat == nullptr) {
         HILOG_ERROR_I18N("IntlDateTimeFormat::Format: Init failed.");
-        return {};
+        return;
     }
     icu::FieldPositionIterator fieldPositionIter;
     icu::UnicodeString formattedParts;
@@ -305,46 +337,26 @@ std::vector<std::unordered_map<std::string, std::string>> IntlDateTimeFormat::Fo
     icuSimpleDateFormat->format(milliseconds, formattedParts, &fieldPositionIter, status);
     if (U_FAILURE(status)) {
         errMessage = "format failed";
-        return {};
+        return;
     }
 
-    int32_t index = 0;
     int32_t preEdgePos = 0;
-    std::vector<CommonDateFormatPart> parts;
     icu::FieldPosition fieldPosition;
     while (fieldPositionIter.next(fieldPosition)) {
-        int32_t fField = fieldPosition.getField();
         int32_t fBeginIndex = fieldPosition.getBeginIndex();
         int32_t fEndIndex = fieldPosition.getEndIndex();
         if (preEdgePos < fBeginIndex) {
-            parts.emplace_back(CommonDateFormatPart(fField, preEdgePos, fBeginIndex, index, true));
-            ++index;
+            parts.spans.push_back({ FormatPartType::LITERAL, preEdgePos, fBeginIndex });
         }
-        parts.emplace_back(CommonDateFormatPart(fField, fBeginIndex, fEndIndex, index, false));
+        parts.spans.push_back({ DateTimeFormatPart::ConvertFieldIdToPartType(fieldPosition.getField()),
+            fBeginIndex, fEndIndex });
         preEdgePos = fEndIndex;
-        ++index;
     }
     int32_t length = formattedParts.length();
     if (preEdgePos < length) {
-        parts.emplace_back(CommonDateFormatPart(-1, preEdgePos, length, index, true));
+        parts.spans.push_back({ FormatPartType::LITERAL, preEdgePos, length });
     }
-    std::vector<std::unordered_map<std::string, std::string>> result(parts.size());
-    for (size_t i = 0; i < parts.size(); ++i) {
-        CommonDateFormatPart part = parts[i];
-        std::string value;
-        icu::UnicodeString tempString = formattedParts.tempSubStringBetween(part.fBeginIndex, part.fEndIndex);
-        tempString.toUTF8String(value);
-        std::string type;
-        if (part.isPreExist) {
-            type = DateTimeFormatPart::ConvertFieldIdToDateType(-1);
-        } else {
-            type = DateTimeFormatPart::ConvertFieldIdToDateType(part.fField);
-        }
-
-        result[i].insert(std::make_pair(PART_TYPE_TAG, type));
-        result[i].insert(std::make_pair(PART_VALUE_TAG, value));
-    }
-    return result;
+    FormatUtils::SetFormattedText(formattedParts, parts);
 }
 
 std::pair<std::string, std::vector<DateTimeFormatPart>> IntlDateTimeFormat::FormatToParts(double milliseconds)
@@ -501,6 +513,117 @@ std::vector<std::string> IntlDateTimeFormat::SupportedLocalesOf(const std::vecto
     return LocaleHelper::LookupSupportedLocales(availableLocales, requestedLocales);
 }
 
+uint64_t IntlDateTimeFormat::GetPrototypeCacheHitCount()
+{
+    return prototypeCache.GetHitCount();
+}
+
+uint64_t IntlDateTimeFormat::GetPrototypeCacheMissCount()
+{
+    return prototypeCache.GetMissCount();
+}
+
+void IntlDateTimeFormat::ClearPrototypeCache()
+{
+    prototypeCache.Clear();
+}
+
+std::string IntlDateTimeFormat::GetPrototypeKey(const std::vector<std::string>& requestedLocales,
+    const std::unordered_map<std::string, std::string>& configs)
+{
+    std::string key;
+    for (const std::string& locale : requestedLocales) {
+        key.append(locale).push_back(',');
+    }
+    std::vector<std::pair<std::string, std::string>> sortedConfigs(configs.begin(), configs.end());
+    std::sort(sortedConfigs.begin(), sortedConfigs.end());
+    for (const auto& config : sortedConfigs) {
+        key.append("|").append(config.first).append("=").append(config.second);
+    }
+    auto iter = configs.find(TIME_ZONE_TAG);
+    if (iter != configs.end() && !iter->second.empty()) {
+        return key;
+    }
+    // The default time zone is resolved at construction, so it is part of the key as well.
+    std::string defaultTimeZoneID = I18nTimeZone::GetAppDefaultTimeZoneID();
+    if (defaultTimeZoneID.empty()) {
+        std::unique_ptr<icu::TimeZone> defaultTimeZone(icu::TimeZone::createDefault());
+        if (defaultTimeZone != nullptr) {
+            icu::UnicodeString id;
+            defaultTimeZone->getID(id);
+            id.toUTF8String(defaultTimeZoneID);
+        }
+    }
+    key.append("|#").append(defaultTimeZoneID);
+    return key;
+}
+
+std::shared_ptr<const IntlDateTimeFormat::FormatPrototype> IntlDateTimeFormat::CreatePrototype() const
+{
+    // Only a formatter whose calendar was adopted by the SimpleDateFormat can be restored from a clone.
+    if (icuSimpleDateFormat == nullptr || icuCalendar == nullptr ||
+        icuSimpleDateFormat->getCalendar() != icuCalendar) {
+        return nullptr;
+    }
+    std::shared_ptr<const icu::SimpleDateFormat> dateFormat(icuSimpleDateFormat->clone());
+    if (dateFormat == nullptr) {
+        return nullptr;
+    }
+    std::shared_ptr<FormatPrototype> prototype = std::make_shared<FormatPrototype>();
+    prototype->localeMatcher = localeMatcher;
+    prototype->formatMatcher = formatMatcher;
+    prototype->hour12 = hour12;
+    prototype->timeZone = timeZone;
+    prototype->calendar = calendar;
+    prototype->numberingSystem = numberingSystem;
+    prototype->dateStyle = dateStyle;
+    prototype->timeStyle = timeStyle;
+    prototype->hourCycle = hourCycle;
+    prototype->fractionalSecondDigits = fractionalSecondDigits;
+    prototype->localeString = localeString;
+    prototype->skeletonOpts = skeletonOpts;
+    prototype->isIso8601 = isIso8601;
+    prototype->skeleton = skeleton;
+    prototype->icuLocale = icuLocale;
+    prototype->dateFormat = dateFormat;
+    return prototype;
+}
+
+bool IntlDateTimeFormat::InitFromPrototype(const FormatPrototype& prototype)
+{
+    if (prototype.dateFormat == nullptr) {
+        return false;
+    }
+    icuSimpleDateFormat.reset(prototype.dateFormat->clone());
+    if (icuSimpleDateFormat == nullptr) {
+        HILOG_ERROR_I18N("IntlDateTimeFormat::InitFromPrototype: Clone icuSimpleDateFormat failed.");
+        return false;
+    }
+    // The calendar and its time zone are owned by the SimpleDateFormat, as after InitIcuSimpleDateFormat.
+    icuCalendar = const_cast<icu::Calendar*>(icuSimpleDateFormat->getCalendar());
+    if (icuCalendar == nullptr) {
+        icuSimpleDateFormat = nullptr;
+        return false;
+    }
+    icuTimeZone = const_cast<icu::TimeZone*>(&icuCalendar->getTimeZone());
+    localeMatcher = prototype.localeMatcher;
+    formatMatcher = prototype.formatMatcher;
+    hour12 = prototype.hour12;
+    timeZone = prototype.timeZone;
+    calendar = prototype.calendar;
+    numberingSystem = prototype.numberingSystem;
+    dateStyle = prototype.dateStyle;
+    timeStyle = prototype.timeStyle;
+    hourCycle = prototype.hourCycle;
+    fractionalSecondDigits = prototype.fractionalSecondDigits;
+    localeString = prototype.localeString;
+    skeletonOpts = prototype.skeletonOpts;
+    isIso8601 = prototype.isIso8601;
+    skeleton = prototype.skeleton;
+    icuLocale = prototype.icuLocale;
+    return true;
+}
+
 bool IntlDateTimeFormat::ParseConfigs(const std::unordered_map<std::string, std::string>& configs,
     std::string& errMessage)
 {
@@ -643,7 +766,7 @@ bool IntlDateTimeFormat::InitIcuTimeZone(const std::unordered_map<std::string, s
 bool IntlDateTimeFormat::InitDateTimePatternGenerator(std::string& errMessage)
 {
     UErrorCode icuStatus = U_ZERO_ERROR;
-    icuDateTimePatternGenerator = icu::DateTimePatternGenerator::createInstance(icuLocale, icuStatus);
+    icuDateTimePatternGenerator = DateTimePatternCache::CreateGenerator(icuLocale, icuStatus);
     if (U_FAILURE(icuStatus) || icuDateTimePatternGenerator == nullptr) {
         if (icuStatus == UErrorCode::U_MISSING_RESOURCE_ERROR) {
             errMessage = "can not find icu data resources";
@@ -1184,6 +1307,8 @@ bool IntlDateTimeFormat::IsValidTimeZoneName(const icu::TimeZone &tz)
     return U_SUCCESS(status) && canonicalFlag;
 }
 
+LruCache<std::string, std::shared_ptr<const IntlDateTimeFormat::FormatPrototype>> IntlDateTimeFormat::prototypeCache(
+    IntlDateTimeFormat::PROTOTYPE_CACHE_CAPACITY);
 bool IntlDateTimeFormat::icuInitialized = IntlDateTimeFormat::Init();
 
 bool IntlDateTimeFormat::Init()
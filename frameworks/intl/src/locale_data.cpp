@@ -15,6 +15,9 @@
 
 #include "locale_data.h"
 
+#include <algorithm>
+#include <array>
+
 namespace OHOS {
 namespace Global {
 namespace I18n {
@@ -34,3950 +37,2420 @@ const std::vector<uint16_t> LocaleData::OLD_LANGUAGES_CODES = {
     static_cast<uint16_t>(0x6964), /* id */
 };
 
-const std::vector<uint64_t> LocaleData::LOCALE_PARENTS_KEY = {
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x656e000000004147), /* en-AG */
-    static_cast<uint64_t>(0x656e000000004149), /* en-AI */
-    static_cast<uint64_t>(0x656e000000004155), /* en-AU */
-    static_cast<uint64_t>(0x656e000000004242), /* en-BB */
-    static_cast<uint64_t>(0x656e00000000424d), /* en-BM */
-    static_cast<uint64_t>(0x656e000000004253), /* en-BS */
-    static_cast<uint64_t>(0x656e000000004257), /* en-BW */
-    static_cast<uint64_t>(0x656e00000000425a), /* en-BZ */
-    static_cast<uint64_t>(0x656e000000004343), /* en-CC */
-    static_cast<uint64_t>(0x656e00000000434b), /* en-CK */
-    static_cast<uint64_t>(0x656e00000000434d), /* en-CM */
-    static_cast<uint64_t>(0x656e000000004358), /* en-CX */
-    static_cast<uint64_t>(0x656e000000004359), /* en-CY */
-    static_cast<uint64_t>(0x656e000000004447), /* en-DG */
-    static_cast<uint64_t>(0x656e00000000444d), /* en-DM */
-    static_cast<uint64_t>(0x656e000000004552), /* en-ER */
-    static_cast<uint64_t>(0x656e00000000464a), /* en-FJ */
-    static_cast<uint64_t>(0x656e00000000464b), /* en-FK */
-    static_cast<uint64_t>(0x656e00000000464d), /* en-FM */
-    static_cast<uint64_t>(0x656e000000004742), /* en-GB */
-    static_cast<uint64_t>(0x656e000000004744), /* en-GD */
-    static_cast<uint64_t>(0x656e000000004747), /* en-GG */
-    static_cast<uint64_t>(0x656e000000004748), /* en-GH */
-    static_cast<uint64_t>(0x656e000000004749), /* en-GI */
-    static_cast<uint64_t>(0x656e00000000474d), /* en-GM */
-    static_cast<uint64_t>(0x656e000000004759), /* en-GY */
-    static_cast<uint64_t>(0x656e00000000484b), /* en-HK */
-    static_cast<uint64_t>(0x656e000000004945), /* en-IE */
-    static_cast<uint64_t>(0x656e00000000494c), /* en-IL */
-    static_cast<uint64_t>(0x656e00000000494d), /* en-IM */
-    static_cast<uint64_t>(0x656e00000000494e), /* en-IN */
-    static_cast<uint64_t>(0x656e00000000494f), /* en-IO */
-    static_cast<uint64_t>(0x656e000000004a45), /* en-JE */
-    static_cast<uint64_t>(0x656e000000004a4d), /* en-JM */
-    static_cast<uint64_t>(0x656e000000004b45), /* en-KE */
-    static_cast<uint64_t>(0x656e000000004b49), /* en-KI */
-    static_cast<uint64_t>(0x656e000000004b4e), /* en-KN */
-    static_cast<uint64_t>(0x656e000000004b59), /* en-KY */
-    static_cast<uint64_t>(0x656e000000004c43), /* en-LC */
-    static_cast<uint64_t>(0x656e000000004c52), /* en-LR */
-    static_cast<uint64_t>(0x656e000000004c53), /* en-LS */
-    static_cast<uint64_t>(0x656e000000004d47), /* en-MG */
-    static_cast<uint64_t>(0x656e000000004d4f), /* en-MO */
-    static_cast<uint64_t>(0x656e000000004d53), /* en-MS */
-    static_cast<uint64_t>(0x656e000000004d54), /* en-MT */
-    static_cast<uint64_t>(0x656e000000004d55), /* en-MU */
-    static_cast<uint64_t>(0x656e000000004d57), /* en-MW */
-    static_cast<uint64_t>(0x656e000000004d59), /* en-MY */
-    static_cast<uint64_t>(0x656e000000004e41), /* en-NA */
-    static_cast<uint64_t>(0x656e000000004e46), /* en-NF */
-    static_cast<uint64_t>(0x656e000000004e47), /* en-NG */
-    static_cast<uint64_t>(0x656e000000004e52), /* en-NR */
-    static_cast<uint64_t>(0x656e000000004e55), /* en-NU */
-    static_cast<uint64_t>(0x656e000000004e5a), /* en-NZ */
-    static_cast<uint64_t>(0x656e000000005047), /* en-PG */
-    static_cast<uint64_t>(0x656e000000005048), /* en-PH */
-    static_cast<uint64_t>(0x656e00000000504b), /* en-PK */
-    static_cast<uint64_t>(0x656e00000000504e), /* en-PN */
-    static_cast<uint64_t>(0x656e000000005057), /* en-PW */
-    static_cast<uint64_t>(0x656e000000005257), /* en-RW */
-    static_cast<uint64_t>(0x656e000000005342), /* en-SB */
-    static_cast<uint64_t>(0x656e000000005343), /* en-SC */
-    static_cast<uint64_t>(0x656e000000005344), /* en-SD */
-    static_cast<uint64_t>(0x656e000000005347), /* en-SG */
-    static_cast<uint64_t>(0x656e000000005348), /* en-SH */
-    static_cast<uint64_t>(0x656e00000000534c), /* en-SL */
-    static_cast<uint64_t>(0x656e000000005353), /* en-SS */
-    static_cast<uint64_t>(0x656e000000005358), /* en-SX */
-    static_cast<uint64_t>(0x656e00000000535a), /* en-SZ */
-    static_cast<uint64_t>(0x656e000000005443), /* en-TC */
-    static_cast<uint64_t>(0x656e00000000544b), /* en-TK */
-    static_cast<uint64_t>(0x656e00000000544f), /* en-TO */
-    static_cast<uint64_t>(0x656e000000005454), /* en-TT */
-    static_cast<uint64_t>(0x656e000000005456), /* en-TV */
-    static_cast<uint64_t>(0x656e00000000545a), /* en-TZ */
-    static_cast<uint64_t>(0x656e000000005547), /* en-UG */
-    static_cast<uint64_t>(0x656e000000005643), /* en-VC */
-    static_cast<uint64_t>(0x656e000000005647), /* en-VG */
-    static_cast<uint64_t>(0x656e000000005655), /* en-VU */
-    static_cast<uint64_t>(0x656e000000005753), /* en-WS */
-    static_cast<uint64_t>(0x656e000000005a41), /* en-ZA */
-    static_cast<uint64_t>(0x656e000000005a4d), /* en-ZM */
-    static_cast<uint64_t>(0x656e000000005a57), /* en-ZW */
-    static_cast<uint64_t>(0x656e000000004154), /* en-AT */
-    static_cast<uint64_t>(0x656e000000004245), /* en-BE */
-    static_cast<uint64_t>(0x656e000000004348), /* en-CH */
-    static_cast<uint64_t>(0x656e000000004445), /* en-DE */
-    static_cast<uint64_t>(0x656e00000000444b), /* en-DK */
-    static_cast<uint64_t>(0x656e000000004649), /* en-FI */
-    static_cast<uint64_t>(0x656e000000004e4c), /* en-NL */
-    static_cast<uint64_t>(0x656e000000005345), /* en-SE */
-    static_cast<uint64_t>(0x656e000000005349), /* en-SI */
-    static_cast<uint64_t>(0x6573000000004152), /* es-AR */
-    static_cast<uint64_t>(0x657300000000424f), /* es-BO */
-    static_cast<uint64_t>(0x6573000000004252), /* es-BR */
-    static_cast<uint64_t>(0x657300000000425a), /* es-BZ */
-    static_cast<uint64_t>(0x657300000000434c), /* es-CL */
-    static_cast<uint64_t>(0x657300000000434f), /* es-CO */
-    static_cast<uint64_t>(0x6573000000004352), /* es-CR */
-    static_cast<uint64_t>(0x6573000000004355), /* es-CU */
-    static_cast<uint64_t>(0x657300000000444f), /* es-DO */
-    static_cast<uint64_t>(0x6573000000004543), /* es-EC */
-    static_cast<uint64_t>(0x6573000000004754), /* es-GT */
-    static_cast<uint64_t>(0x657300000000484e), /* es-HN */
-    static_cast<uint64_t>(0x6573000000004d58), /* es-MX */
-    static_cast<uint64_t>(0x6573000000004e49), /* es-NI */
-    static_cast<uint64_t>(0x6573000000005041), /* es-PA */
-    static_cast<uint64_t>(0x6573000000005045), /* es-PE */
-    static_cast<uint64_t>(0x6573000000005052), /* es-PR */
-    static_cast<uint64_t>(0x6573000000005059), /* es-PY */
-    static_cast<uint64_t>(0x6573000000005356), /* es-SV */
-    static_cast<uint64_t>(0x6573000000005553), /* es-US */
-    static_cast<uint64_t>(0x6573000000005559), /* es-UY */
-    static_cast<uint64_t>(0x6573000000005645), /* es-VE */
-    static_cast<uint64_t>(0x707400000000414f), /* pt-AO */
-    static_cast<uint64_t>(0x7074000000004348), /* pt-CH */
-    static_cast<uint64_t>(0x7074000000004356), /* pt-CV */
-    static_cast<uint64_t>(0x7074000000004652), /* pt-FR */
-    static_cast<uint64_t>(0x7074000000004751), /* pt-GQ */
-    static_cast<uint64_t>(0x7074000000004757), /* pt-GW */
-    static_cast<uint64_t>(0x7074000000004c55), /* pt-LU */
-    static_cast<uint64_t>(0x7074000000004d4f), /* pt-MO */
-    static_cast<uint64_t>(0x7074000000004d5a), /* pt-MZ */
-    static_cast<uint64_t>(0x7074000000005354), /* pt-ST */
-    static_cast<uint64_t>(0x707400000000544c), /* pt-TL */
-    static_cast<uint64_t>(0x617a417261620000), /* az-Arab */
-    static_cast<uint64_t>(0x617a4379726c0000), /* az-Cyrl */
-    static_cast<uint64_t>(0x85734c61746e0000), /* blt-Latn */
-    static_cast<uint64_t>(0x626d4e6b6f6f0000), /* bm-Nkoo */
-    static_cast<uint64_t>(0x62734379726c0000), /* bs-Cyrl */
-    static_cast<uint64_t>(0x870d4c61746e0000), /* byn-Latn */
-    static_cast<uint64_t>(0x6375476c61670000), /* cu-Glag */
-    static_cast<uint64_t>(0x8d24417261620000), /* dje-Arab */
-    static_cast<uint64_t>(0x8f0e417261620000), /* dyo-Arab */
-    static_cast<uint64_t>(0x656e447372740000), /* en-Dsrt */
-    static_cast<uint64_t>(0x656e536861770000), /* en-Shaw */
-    static_cast<uint64_t>(0x666641646c6d0000), /* ff-Adlm */
-    static_cast<uint64_t>(0x6666417261620000), /* ff-Arab */
-    static_cast<uint64_t>(0x6861417261620000), /* ha-Arab */
-    static_cast<uint64_t>(0x68694c61746e0000), /* hi-Latn */
-    static_cast<uint64_t>(0x69754c61746e0000), /* iu-Latn */
-    static_cast<uint64_t>(0x6b6b417261620000), /* kk-Arab */
-    static_cast<uint64_t>(0x6b73446576610000), /* ks-Deva */
-    static_cast<uint64_t>(0x6b75417261620000), /* ku-Arab */
-    static_cast<uint64_t>(0x6b79417261620000), /* ky-Arab */
-    static_cast<uint64_t>(0x6b794c61746e0000), /* ky-Latn */
-    static_cast<uint64_t>(0x6d6c417261620000), /* ml-Arab */
-    static_cast<uint64_t>(0x6d6e4d6f6e670000), /* mn-Mong */
-    static_cast<uint64_t>(0xb1a84d7465690000), /* mni-Mtei */
-    static_cast<uint64_t>(0x6d73417261620000), /* ms-Arab */
-    static_cast<uint64_t>(0x7061417261620000), /* pa-Arab */
-    static_cast<uint64_t>(0xc813446576610000), /* sat-Deva */
-    static_cast<uint64_t>(0x7364446576610000), /* sd-Deva */
-    static_cast<uint64_t>(0x73644b686f6a0000), /* sd-Khoj */
-    static_cast<uint64_t>(0x736453696e640000), /* sd-Sind */
-    static_cast<uint64_t>(0xc8e84c61746e0000), /* shi-Latn */
-    static_cast<uint64_t>(0x736f417261620000), /* so-Arab */
-    static_cast<uint64_t>(0x73724c61746e0000), /* sr-Latn */
-    static_cast<uint64_t>(0x7377417261620000), /* sw-Arab */
-    static_cast<uint64_t>(0x7467417261620000), /* tg-Arab */
-    static_cast<uint64_t>(0x75674379726c0000), /* ug-Cyrl */
-    static_cast<uint64_t>(0x757a417261620000), /* uz-Arab */
-    static_cast<uint64_t>(0x757a4379726c0000), /* uz-Cyrl */
-    static_cast<uint64_t>(0xd4084c61746e0000), /* vai-Latn */
-    static_cast<uint64_t>(0x776f417261620000), /* wo-Arab */
-    static_cast<uint64_t>(0x796f417261620000), /* yo-Arab */
-    static_cast<uint64_t>(0xe28448616e730000), /* yue-Hans */
-    static_cast<uint64_t>(0x7a6848616e740000), /* zh-Hant */
-    static_cast<uint64_t>(0x7a6848616e744d4f), /* zh-Hant-MO */
-    static_cast<uint64_t>(0x617200000000445a), /* ar-DZ */
-    static_cast<uint64_t>(0x6172000000004548), /* ar-EH */
-    static_cast<uint64_t>(0x6172000000004c59), /* ar-LY */
-    static_cast<uint64_t>(0x6172000000004d41), /* ar-MA */
-    static_cast<uint64_t>(0x617200000000544e), /* ar-TN */
+namespace {
+struct LocaleDataEntry {
+    uint64_t key;
+    uint64_t value;
 };
 
-const std::vector<uint64_t> LocaleData::LOCALE_PARENTS_VALUE = {
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x0), /* ROOT Locale */
-    static_cast<uint64_t>(0x7a6848616e74484b), /* zh-Hant-HK */
-    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
-    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
-    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
-    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
-    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
-};
+// Child locale to parent locale, sorted by key.
+constexpr std::array<LocaleDataEntry, 175> LOCALE_PARENTS = {{
+    { 0x617200000000445a, 0x6172000000008025 }, /* ar-DZ -> ar-015 */
+    { 0x6172000000004548, 0x6172000000008025 }, /* ar-EH -> ar-015 */
+    { 0x6172000000004c59, 0x6172000000008025 }, /* ar-LY -> ar-015 */
+    { 0x6172000000004d41, 0x6172000000008025 }, /* ar-MA -> ar-015 */
+    { 0x617200000000544e, 0x6172000000008025 }, /* ar-TN -> ar-015 */
+    { 0x617a417261620000, 0x0 }, /* az-Arab -> ROOT Locale */
+    { 0x617a4379726c0000, 0x0 }, /* az-Cyrl -> ROOT Locale */
+    { 0x626d4e6b6f6f0000, 0x0 }, /* bm-Nkoo -> ROOT Locale */
+    { 0x62734379726c0000, 0x0 }, /* bs-Cyrl -> ROOT Locale */
+    { 0x6375476c61670000, 0x0 }, /* cu-Glag -> ROOT Locale */
+    { 0x656e000000004147, 0x656e000000008001 }, /* en-AG -> en-001 */
+    { 0x656e000000004149, 0x656e000000008001 }, /* en-AI -> en-001 */
+    { 0x656e000000004154, 0x656e0000000084a0 }, /* en-AT -> en-150 */
+    { 0x656e000000004155, 0x656e000000008001 }, /* en-AU -> en-001 */
+    { 0x656e000000004242, 0x656e000000008001 }, /* en-BB -> en-001 */
+    { 0x656e000000004245, 0x656e0000000084a0 }, /* en-BE -> en-150 */
+    { 0x656e00000000424d, 0x656e000000008001 }, /* en-BM -> en-001 */
+    { 0x656e000000004253, 0x656e000000008001 }, /* en-BS -> en-001 */
+    { 0x656e000000004257, 0x656e000000008001 }, /* en-BW -> en-001 */
+    { 0x656e00000000425a, 0x656e000000008001 }, /* en-BZ -> en-001 */
+    { 0x656e000000004343, 0x656e000000008001 }, /* en-CC -> en-001 */
+    { 0x656e000000004348, 0x656e0000000084a0 }, /* en-CH -> en-150 */
+    { 0x656e00000000434b, 0x656e000000008001 }, /* en-CK -> en-001 */
+    { 0x656e00000000434d, 0x656e000000008001 }, /* en-CM -> en-001 */
+    { 0x656e000000004358, 0x656e000000008001 }, /* en-CX -> en-001 */
+    { 0x656e000000004359, 0x656e000000008001 }, /* en-CY -> en-001 */
+    { 0x656e000000004445, 0x656e0000000084a0 }, /* en-DE -> en-150 */
+    { 0x656e000000004447, 0x656e000000008001 }, /* en-DG -> en-001 */
+    { 0x656e00000000444b, 0x656e0000000084a0 }, /* en-DK -> en-150 */
+    { 0x656e00000000444d, 0x656e000000008001 }, /* en-DM -> en-001 */
+    { 0x656e000000004552, 0x656e000000008001 }, /* en-ER -> en-001 */
+    { 0x656e000000004649, 0x656e0000000084a0 }, /* en-FI -> en-150 */
+    { 0x656e00000000464a, 0x656e000000008001 }, /* en-FJ -> en-001 */
+    { 0x656e00000000464b, 0x656e000000008001 }, /* en-FK -> en-001 */
+    { 0x656e00000000464d, 0x656e000000008001 }, /* en-FM -> en-001 */
+    { 0x656e000000004742, 0x656e000000008001 }, /* en-GB -> en-001 */
+    { 0x656e000000004744, 0x656e000000008001 }, /* en-GD -> en-001 */
+    { 0x656e000000004747, 0x656e000000008001 }, /* en-GG -> en-001 */
+    { 0x656e000000004748, 0x656e000000008001 }, /* en-GH -> en-001 */
+    { 0x656e000000004749, 0x656e000000008001 }, /* en-GI -> en-001 */
+    { 0x656e00000000474d, 0x656e000000008001 }, /* en-GM -> en-001 */
+    { 0x656e000000004759, 0x656e000000008001 }, /* en-GY -> en-001 */
+    { 0x656e00000000484b, 0x656e000000008001 }, /* en-HK -> en-001 */
+    { 0x656e000000004945, 0x656e000000008001 }, /* en-IE -> en-001 */
+    { 0x656e00000000494c, 0x656e000000008001 }, /* en-IL -> en-001 */
+    { 0x656e00000000494d, 0x656e000000008001 }, /* en-IM -> en-001 */
+    { 0x656e00000000494e, 0x656e000000008001 }, /* en-IN -> en-001 */
+    { 0x656e00000000494f, 0x656e000000008001 }, /* en-IO -> en-001 */
+    { 0x656e000000004a45, 0x656e000000008001 }, /* en-JE -> en-001 */
+    { 0x656e000000004a4d, 0x656e000000008001 }, /* en-JM -> en-001 */
+    { 0x656e000000004b45, 0x656e000000008001 }, /* en-KE -> en-001 */
+    { 0x656e000000004b49, 0x656e000000008001 }, /* en-KI -> en-001 */
+    { 0x656e000000004b4e, 0x656e000000008001 }, /* en-KN -> en-001 */
+    { 0x656e000000004b59, 0x656e000000008001 }, /* en-KY -> en-001 */
+    { 0x656e000000004c43, 0x656e000000008001 }, /* en-LC -> en-001 */
+    { 0x656e000000004c52, 0x656e000000008001 }, /* en-LR -> en-001 */
+    { 0x656e000000004c53, 0x656e000000008001 }, /* en-LS -> en-001 */
+    { 0x656e000000004d47, 0x656e000000008001 }, /* en-MG -> en-001 */
+    { 0x656e000000004d4f, 0x656e000000008001 }, /* en-MO -> en-001 */
+    { 0x656e000000004d53, 0x656e000000008001 }, /* en-MS -> en-001 */
+    { 0x656e000000004d54, 0x656e000000008001 }, /* en-MT -> en-001 */
+    { 0x656e000000004d55, 0x656e000000008001 }, /* en-MU -> en-001 */
+    { 0x656e000000004d57, 0x656e000000008001 }, /* en-MW -> en-001 */
+    { 0x656e000000004d59, 0x656e000000008001 }, /* en-MY -> en-001 */
+    { 0x656e000000004e41, 0x656e000000008001 }, /* en-NA -> en-001 */
+    { 0x656e000000004e46, 0x656e000000008001 }, /* en-NF -> en-001 */
+    { 0x656e000000004e47, 0x656e000000008001 }, /* en-NG -> en-001 */
+    { 0x656e000000004e4c, 0x656e0000000084a0 }, /* en-NL -> en-150 */
+    { 0x656e000000004e52, 0x656e000000008001 }, /* en-NR -> en-001 */
+    { 0x656e000000004e55, 0x656e000000008001 }, /* en-NU -> en-001 */
+    { 0x656e000000004e5a, 0x656e000000008001 }, /* en-NZ -> en-001 */
+    { 0x656e000000005047, 0x656e000000008001 }, /* en-PG -> en-001 */
+    { 0x656e000000005048, 0x656e000000008001 }, /* en-PH -> en-001 */
+    { 0x656e00000000504b, 0x656e000000008001 }, /* en-PK -> en-001 */
+    { 0x656e00000000504e, 0x656e000000008001 }, /* en-PN -> en-001 */
+    { 0x656e000000005057, 0x656e000000008001 }, /* en-PW -> en-001 */
+    { 0x656e000000005257, 0x656e000000008001 }, /* en-RW -> en-001 */
+    { 0x656e000000005342, 0x656e000000008001 }, /* en-SB -> en-001 */
+    { 0x656e000000005343, 0x656e000000008001 }, /* en-SC -> en-001 */
+    { 0x656e000000005344, 0x656e000000008001 }, /* en-SD -> en-001 */
+    { 0x656e000000005345, 0x656e0000000084a0 }, /* en-SE -> en-150 */
+    { 0x656e000000005347, 0x656e000000008001 }, /* en-SG -> en-001 */
+    { 0x656e000000005348, 0x656e000000008001 }, /* en-SH -> en-001 */
+    { 0x656e000000005349, 0x656e0000000084a0 }, /* en-SI -> en-150 */
+    { 0x656e00000000534c, 0x656e000000008001 }, /* en-SL -> en-001 */
+    { 0x656e000000005353, 0x656e000000008001 }, /* en-SS -> en-001 */
+    { 0x656e000000005358, 0x656e000000008001 }, /* en-SX -> en-001 */
+    { 0x656e00000000535a, 0x656e000000008001 }, /* en-SZ -> en-001 */
+    { 0x656e000000005443, 0x656e000000008001 }, /* en-TC -> en-001 */
+    { 0x656e00000000544b, 0x656e000000008001 }, /* en-TK -> en-001 */
+    { 0x656e00000000544f, 0x656e000000008001 }, /* en-TO -> en-001 */
+    { 0x656e000000005454, 0x656e000000008001 }, /* en-TT -> en-001 */
+    { 0x656e000000005456, 0x656e000000008001 }, /* en-TV -> en-001 */
+    { 0x656e00000000545a, 0x656e000000008001 }, /* en-TZ -> en-001 */
+    { 0x656e000000005547, 0x656e000000008001 }, /* en-UG -> en-001 */
+    { 0x656e000000005643, 0x656e000000008001 }, /* en-VC -> en-001 */
+    { 0x656e000000005647, 0x656e000000008001 }, /* en-VG -> en-001 */
+    { 0x656e000000005655, 0x656e000000008001 }, /* en-VU -> en-001 */
+    { 0x656e000000005753, 0x656e000000008001 }, /* en-WS -> en-001 */
+    { 0x656e000000005a41, 0x656e000000008001 }, /* en-ZA -> en-001 */
+    { 0x656e000000005a4d, 0x656e000000008001 }, /* en-ZM -> en-001 */
+    { 0x656e000000005a57, 0x656e000000008001 }, /* en-ZW -> en-001 */
+    { 0x656e0000000084a0, 0x656e000000008001 }, /* en-150 -> en-001 */
+    { 0x656e447372740000, 0x0 }, /* en-Dsrt -> ROOT Locale */
+    { 0x656e536861770000, 0x0 }, /* en-Shaw -> ROOT Locale */
+    { 0x6573000000004152, 0x6573000000009029 }, /* es-AR -> es-419 */
+    { 0x657300000000424f, 0x6573000000009029 }, /* es-BO -> es-419 */
+    { 0x6573000000004252, 0x6573000000009029 }, /* es-BR -> es-419 */
+    { 0x657300000000425a, 0x6573000000009029 }, /* es-BZ -> es-419 */
+    { 0x657300000000434c, 0x6573000000009029 }, /* es-CL -> es-419 */
+    { 0x657300000000434f, 0x6573000000009029 }, /* es-CO -> es-419 */
+    { 0x6573000000004352, 0x6573000000009029 }, /* es-CR -> es-419 */
+    { 0x6573000000004355, 0x6573000000009029 }, /* es-CU -> es-419 */
+    { 0x657300000000444f, 0x6573000000009029 }, /* es-DO -> es-419 */
+    { 0x6573000000004543, 0x6573000000009029 }, /* es-EC -> es-419 */
+    { 0x6573000000004754, 0x6573000000009029 }, /* es-GT -> es-419 */
+    { 0x657300000000484e, 0x6573000000009029 }, /* es-HN -> es-419 */
+    { 0x6573000000004d58, 0x6573000000009029 }, /* es-MX -> es-419 */
+    { 0x6573000000004e49, 0x6573000000009029 }, /* es-NI -> es-419 */
+    { 0x6573000000005041, 0x6573000000009029 }, /* es-PA -> es-419 */
+    { 0x6573000000005045, 0x6573000000009029 }, /* es-PE -> es-419 */
+    { 0x6573000000005052, 0x6573000000009029 }, /* es-PR -> es-419 */
+    { 0x6573000000005059, 0x6573000000009029 }, /* es-PY -> es-419 */
+    { 0x6573000000005356, 0x6573000000009029 }, /* es-SV -> es-419 */
+    { 0x6573000000005553, 0x6573000000009029 }, /* es-US -> es-419 */
+    { 0x6573000000005559, 0x6573000000009029 }, /* es-UY -> es-419 */
+    { 0x6573000000005645, 0x6573000000009029 }, /* es-VE -> es-419 */
+    { 0x666641646c6d0000, 0x0 }, /* ff-Adlm -> ROOT Locale */
+    { 0x6666417261620000, 0x0 }, /* ff-Arab -> ROOT Locale */
+    { 0x6861417261620000, 0x0 }, /* ha-Arab -> ROOT Locale */
+    { 0x68694c61746e0000, 0x0 }, /* hi-Latn -> ROOT Locale */
+    { 0x69754c61746e0000, 0x0 }, /* iu-Latn -> ROOT Locale */
+    { 0x6b6b417261620000, 0x0 }, /* kk-Arab -> ROOT Locale */
+    { 0x6b73446576610000, 0x0 }, /* ks-Deva -> ROOT Locale */
+    { 0x6b75417261620000, 0x0 }, /* ku-Arab -> ROOT Locale */
+    { 0x6b79417261620000, 0x0 }, /* ky-Arab -> ROOT Locale */
+    { 0x6b794c61746e0000, 0x0 }, /* ky-Latn -> ROOT Locale */
+    { 0x6d6c417261620000, 0x0 }, /* ml-Arab -> ROOT Locale */
+    { 0x6d6e4d6f6e670000, 0x0 }, /* mn-Mong -> ROOT Locale */
+    { 0x6d73417261620000, 0x0 }, /* ms-Arab -> ROOT Locale */
+    { 0x7061417261620000, 0x0 }, /* pa-Arab -> ROOT Locale */
+    { 0x707400000000414f, 0x7074000000005054 }, /* pt-AO -> pt-PT */
+    { 0x7074000000004348, 0x7074000000005054 }, /* pt-CH -> pt-PT */
+    { 0x7074000000004356, 0x7074000000005054 }, /* pt-CV -> pt-PT */
+    { 0x7074000000004652, 0x7074000000005054 }, /* pt-FR -> pt-PT */
+    { 0x7074000000004751, 0x7074000000005054 }, /* pt-GQ -> pt-PT */
+    { 0x7074000000004757, 0x7074000000005054 }, /* pt-GW -> pt-PT */
+    { 0x7074000000004c55, 0x7074000000005054 }, /* pt-LU -> pt-PT */
+    { 0x7074000000004d4f, 0x7074000000005054 }, /* pt-MO -> pt-PT */
+    { 0x7074000000004d5a, 0x7074000000005054 }, /* pt-MZ -> pt-PT */
+    { 0x7074000000005354, 0x7074000000005054 }, /* pt-ST -> pt-PT */
+    { 0x707400000000544c, 0x7074000000005054 }, /* pt-TL -> pt-PT */
+    { 0x7364446576610000, 0x0 }, /* sd-Deva -> ROOT Locale */
+    { 0x73644b686f6a0000, 0x0 }, /* sd-Khoj -> ROOT Locale */
+    { 0x736453696e640000, 0x0 }, /* sd-Sind -> ROOT Locale */
+    { 0x736f417261620000, 0x0 }, /* so-Arab -> ROOT Locale */
+    { 0x73724c61746e0000, 0x0 }, /* sr-Latn -> ROOT Locale */
+    { 0x7377417261620000, 0x0 }, /* sw-Arab -> ROOT Locale */
+    { 0x7467417261620000, 0x0 }, /* tg-Arab -> ROOT Locale */
+    { 0x75674379726c0000, 0x0 }, /* ug-Cyrl -> ROOT Locale */
+    { 0x757a417261620000, 0x0 }, /* uz-Arab -> ROOT Locale */
+    { 0x757a4379726c0000, 0x0 }, /* uz-Cyrl -> ROOT Locale */
+    { 0x776f417261620000, 0x0 }, /* wo-Arab -> ROOT Locale */
+    { 0x796f417261620000, 0x0 }, /* yo-Arab -> ROOT Locale */
+    { 0x7a6848616e740000, 0x0 }, /* zh-Hant -> ROOT Locale */
+    { 0x7a6848616e744d4f, 0x7a6848616e74484b }, /* zh-Hant-MO -> zh-Hant-HK */
+    { 0x85734c61746e0000, 0x0 }, /* blt-Latn -> ROOT Locale */
+    { 0x870d4c61746e0000, 0x0 }, /* byn-Latn -> ROOT Locale */
+    { 0x8d24417261620000, 0x0 }, /* dje-Arab -> ROOT Locale */
+    { 0x8f0e417261620000, 0x0 }, /* dyo-Arab -> ROOT Locale */
+    { 0xb1a84d7465690000, 0x0 }, /* mni-Mtei -> ROOT Locale */
+    { 0xc813446576610000, 0x0 }, /* sat-Deva -> ROOT Locale */
+    { 0xc8e84c61746e0000, 0x0 }, /* shi-Latn -> ROOT Locale */
+    { 0xd4084c61746e0000, 0x0 }, /* vai-Latn -> ROOT Locale */
+    { 0xe28448616e730000, 0x0 }, /* yue-Hans -> ROOT Locale */
+}};
 
-const std::vector<uint64_t> LocaleData::TYPICAL_CODES_VALUE = {
-    static_cast<uint64_t>(0x61614c61746e4554), /* aa-Latn-ET */
-    static_cast<uint64_t>(0x61624379726c4745), /* ab-Cyrl-GE */
-    static_cast<uint64_t>(0x80314c61746e4748), /* abr-Latn-GH */
-    static_cast<uint64_t>(0x80444c61746e4944), /* ace-Latn-ID */
-    static_cast<uint64_t>(0x80474c61746e5547), /* ach-Latn-UG */
-    static_cast<uint64_t>(0x80604c61746e4748), /* ada-Latn-GH */
-    static_cast<uint64_t>(0x806f546962744254), /* adp-Tibt-BT */
-    static_cast<uint64_t>(0x80784379726c5255), /* ady-Cyrl-RU */
-    static_cast<uint64_t>(0x6165417673744952), /* ae-Avst-IR */
-    static_cast<uint64_t>(0x808141726162544e), /* aeb-Arab-TN */
-    static_cast<uint64_t>(0x61664c61746e5a41), /* af-Latn-ZA */
-    static_cast<uint64_t>(0x80d04c61746e434d), /* agq-Latn-CM */
-    static_cast<uint64_t>(0x80ee41686f6d494e), /* aho-Ahom-IN */
-    static_cast<uint64_t>(0x616b4c61746e4748), /* ak-Latn-GH */
-    static_cast<uint64_t>(0x814a587375784951), /* akk-Xsux-IQ */
-    static_cast<uint64_t>(0x816d4c61746e584b), /* aln-Latn-XK */
-    static_cast<uint64_t>(0x81734379726c5255), /* alt-Cyrl-RU */
-    static_cast<uint64_t>(0x616d457468694554), /* am-Ethi-ET */
-    static_cast<uint64_t>(0x818e4c61746e4e47), /* amo-Latn-NG */
-    static_cast<uint64_t>(0x616e4c61746e4553), /* an-Latn-ES */
-    static_cast<uint64_t>(0x81d94c61746e4944), /* aoz-Latn-ID */
-    static_cast<uint64_t>(0x81e3417261625447), /* apd-Arab-TG */
-    static_cast<uint64_t>(0x6172417261624547), /* ar-Arab-EG */
-    static_cast<uint64_t>(0x822241726d694952), /* arc-Armi-IR */
-    static_cast<uint64_t>(0x82224e6261744a4f), /* arc-Nbat-JO */
-    static_cast<uint64_t>(0x822250616c6d5359), /* arc-Palm-SY */
-    static_cast<uint64_t>(0x822d4c61746e434c), /* arn-Latn-CL */
-    static_cast<uint64_t>(0x822e4c61746e424f), /* aro-Latn-BO */
-    static_cast<uint64_t>(0x823041726162445a), /* arq-Arab-DZ */
-    static_cast<uint64_t>(0x8232417261625341), /* ars-Arab-SA */
-    static_cast<uint64_t>(0x8238417261624d41), /* ary-Arab-MA */
-    static_cast<uint64_t>(0x8239417261624547), /* arz-Arab-EG */
-    static_cast<uint64_t>(0x617342656e67494e), /* as-Beng-IN */
-    static_cast<uint64_t>(0x82404c61746e545a), /* asa-Latn-TZ */
-    static_cast<uint64_t>(0x824453676e775553), /* ase-Sgnw-US */
-    static_cast<uint64_t>(0x82534c61746e4553), /* ast-Latn-ES */
-    static_cast<uint64_t>(0x82694c61746e4341), /* atj-Latn-CA */
-    static_cast<uint64_t>(0x61764379726c5255), /* av-Cyrl-RU */
-    static_cast<uint64_t>(0x82c044657661494e), /* awa-Deva-IN */
-    static_cast<uint64_t>(0x61794c61746e424f), /* ay-Latn-BO */
-    static_cast<uint64_t>(0x617a4c61746e415a), /* az-Latn-AZ */
-    static_cast<uint64_t>(0x617a417261624952), /* az-Arab-IR */
-    static_cast<uint64_t>(0x62614379726c5255), /* ba-Cyrl-RU */
-    static_cast<uint64_t>(0x840b41726162504b), /* bal-Arab-PK */
-    static_cast<uint64_t>(0x840d4c61746e4944), /* ban-Latn-ID */
-    static_cast<uint64_t>(0x840f446576614e50), /* bap-Deva-NP */
-    static_cast<uint64_t>(0x84114c61746e4154), /* bar-Latn-AT */
-    static_cast<uint64_t>(0x84124c61746e434d), /* bas-Latn-CM */
-    static_cast<uint64_t>(0x841742616d75434d), /* bax-Bamu-CM */
-    static_cast<uint64_t>(0x84224c61746e4944), /* bbc-Latn-ID */
-    static_cast<uint64_t>(0x84294c61746e434d), /* bbj-Latn-CM */
-    static_cast<uint64_t>(0x84484c61746e4349), /* bci-Latn-CI */
-    static_cast<uint64_t>(0x62654379726c4259), /* be-Cyrl-BY */
-    static_cast<uint64_t>(0x8489417261625344), /* bej-Arab-SD */
-    static_cast<uint64_t>(0x848c4c61746e5a4d), /* bem-Latn-ZM */
-    static_cast<uint64_t>(0x84964c61746e4944), /* bew-Latn-ID */
-    static_cast<uint64_t>(0x84994c61746e545a), /* bez-Latn-TZ */
-    static_cast<uint64_t>(0x84a34c61746e434d), /* bfd-Latn-CM */
-    static_cast<uint64_t>(0x84b054616d6c494e), /* bfq-Taml-IN */
-    static_cast<uint64_t>(0x84b341726162504b), /* bft-Arab-PK */
-    static_cast<uint64_t>(0x84b844657661494e), /* bfy-Deva-IN */
-    static_cast<uint64_t>(0x62674379726c4247), /* bg-Cyrl-BG */
-    static_cast<uint64_t>(0x84c244657661494e), /* bgc-Deva-IN */
-    static_cast<uint64_t>(0x84cd41726162504b), /* bgn-Arab-PK */
-    static_cast<uint64_t>(0x84d74772656b5452), /* bgx-Grek-TR */
-    static_cast<uint64_t>(0x84e144657661494e), /* bhb-Deva-IN */
-    static_cast<uint64_t>(0x84e844657661494e), /* bhi-Deva-IN */
-    static_cast<uint64_t>(0x84ee44657661494e), /* bho-Deva-IN */
-    static_cast<uint64_t>(0x62694c61746e5655), /* bi-Latn-VU */
-    static_cast<uint64_t>(0x850a4c61746e5048), /* bik-Latn-PH */
-    static_cast<uint64_t>(0x850d4c61746e4e47), /* bin-Latn-NG */
-    static_cast<uint64_t>(0x852944657661494e), /* bjj-Deva-IN */
-    static_cast<uint64_t>(0x852d4c61746e4944), /* bjn-Latn-ID */
-    static_cast<uint64_t>(0x85334c61746e534e), /* bjt-Latn-SN */
-    static_cast<uint64_t>(0x854c4c61746e434d), /* bkm-Latn-CM */
-    static_cast<uint64_t>(0x85544c61746e5048), /* bku-Latn-PH */
-    static_cast<uint64_t>(0x857354617674564e), /* blt-Tavt-VN */
-    static_cast<uint64_t>(0x626d4c61746e4d4c), /* bm-Latn-ML */
-    static_cast<uint64_t>(0x85904c61746e4d4c), /* bmq-Latn-ML */
-    static_cast<uint64_t>(0x626e42656e674244), /* bn-Beng-BD */
-    static_cast<uint64_t>(0x626f54696274434e), /* bo-Tibt-CN */
-    static_cast<uint64_t>(0x85f842656e67494e), /* bpy-Beng-IN */
-    static_cast<uint64_t>(0x8608417261624952), /* bqi-Arab-IR */
-    static_cast<uint64_t>(0x86154c61746e4349), /* bqv-Latn-CI */
-    static_cast<uint64_t>(0x62724c61746e4652), /* br-Latn-FR */
-    static_cast<uint64_t>(0x862044657661494e), /* bra-Deva-IN */
-    static_cast<uint64_t>(0x862741726162504b), /* brh-Arab-PK */
-    static_cast<uint64_t>(0x863744657661494e), /* brx-Deva-IN */
-    static_cast<uint64_t>(0x62734c61746e4241), /* bs-Latn-BA */
-    static_cast<uint64_t>(0x8650426173734c52), /* bsq-Bass-LR */
-    static_cast<uint64_t>(0x86524c61746e434d), /* bss-Latn-CM */
-    static_cast<uint64_t>(0x866e4c61746e5048), /* bto-Latn-PH */
-    static_cast<uint64_t>(0x867544657661504b), /* btv-Deva-PK */
-    static_cast<uint64_t>(0x86804379726c5255), /* bua-Cyrl-RU */
-    static_cast<uint64_t>(0x86824c61746e5954), /* buc-Latn-YT */
-    static_cast<uint64_t>(0x86864c61746e4944), /* bug-Latn-ID */
-    static_cast<uint64_t>(0x868c4c61746e434d), /* bum-Latn-CM */
-    static_cast<uint64_t>(0x86a14c61746e4751), /* bvb-Latn-GQ */
-    static_cast<uint64_t>(0x870d457468694552), /* byn-Ethi-ER */
-    static_cast<uint64_t>(0x87154c61746e434d), /* byv-Latn-CM */
-    static_cast<uint64_t>(0x87244c61746e4d4c), /* bze-Latn-ML */
-    static_cast<uint64_t>(0x63614c61746e4553), /* ca-Latn-ES */
-    static_cast<uint64_t>(0x88034c61746e5553), /* cad-Latn-US */
-    static_cast<uint64_t>(0x88474c61746e4e47), /* cch-Latn-NG */
-    static_cast<uint64_t>(0x884f43616b6d4244), /* ccp-Cakm-BD */
-    static_cast<uint64_t>(0x63654379726c5255), /* ce-Cyrl-RU */
-    static_cast<uint64_t>(0x88814c61746e5048), /* ceb-Latn-PH */
-    static_cast<uint64_t>(0x88c64c61746e5547), /* cgg-Latn-UG */
-    static_cast<uint64_t>(0x63684c61746e4755), /* ch-Latn-GU */
-    static_cast<uint64_t>(0x88ea4c61746e464d), /* chk-Latn-FM */
-    static_cast<uint64_t>(0x88ec4379726c5255), /* chm-Cyrl-RU */
-    static_cast<uint64_t>(0x88ee4c61746e5553), /* cho-Latn-US */
-    static_cast<uint64_t>(0x88ef4c61746e4341), /* chp-Latn-CA */
-    static_cast<uint64_t>(0x88f1436865725553), /* chr-Cher-US */
-    static_cast<uint64_t>(0x89024c61746e5553), /* cic-Latn-US */
-    static_cast<uint64_t>(0x8920417261624b48), /* cja-Arab-KH */
-    static_cast<uint64_t>(0x892c4368616d564e), /* cjm-Cham-VN */
-    static_cast<uint64_t>(0x8941417261624951), /* ckb-Arab-IQ */
-    static_cast<uint64_t>(0x8986536f796f4d4e), /* cmg-Soyo-MN */
-    static_cast<uint64_t>(0x636f4c61746e4652), /* co-Latn-FR */
-    static_cast<uint64_t>(0x89cf436f70744547), /* cop-Copt-EG */
-    static_cast<uint64_t>(0x89f24c61746e5048), /* cps-Latn-PH */
-    static_cast<uint64_t>(0x637243616e734341), /* cr-Cans-CA */
-    static_cast<uint64_t>(0x8a274379726c5541), /* crh-Cyrl-UA */
-    static_cast<uint64_t>(0x8a2943616e734341), /* crj-Cans-CA */
-    static_cast<uint64_t>(0x8a2a43616e734341), /* crk-Cans-CA */
-    static_cast<uint64_t>(0x8a2b43616e734341), /* crl-Cans-CA */
-    static_cast<uint64_t>(0x8a2c43616e734341), /* crm-Cans-CA */
-    static_cast<uint64_t>(0x8a324c61746e5343), /* crs-Latn-SC */
-    static_cast<uint64_t>(0x63734c61746e435a), /* cs-Latn-CZ */
-    static_cast<uint64_t>(0x8a414c61746e504c), /* csb-Latn-PL */
-    static_cast<uint64_t>(0x8a5643616e734341), /* csw-Cans-CA */
-    static_cast<uint64_t>(0x8a63506175634d4d), /* ctd-Pauc-MM */
-    static_cast<uint64_t>(0x63754379726c5255), /* cu-Cyrl-RU */
-    static_cast<uint64_t>(0x6375476c61674247), /* cu-Glag-BG */
-    static_cast<uint64_t>(0x63764379726c5255), /* cv-Cyrl-RU */
-    static_cast<uint64_t>(0x63794c61746e4742), /* cy-Latn-GB */
-    static_cast<uint64_t>(0x64614c61746e444b), /* da-Latn-DK */
-    static_cast<uint64_t>(0x8c054c61746e4349), /* daf-Latn-CI */
-    static_cast<uint64_t>(0x8c0a4c61746e5553), /* dak-Latn-US */
-    static_cast<uint64_t>(0x8c114379726c5255), /* dar-Cyrl-RU */
-    static_cast<uint64_t>(0x8c154c61746e4b45), /* dav-Latn-KE */
-    static_cast<uint64_t>(0x8c4241726162494e), /* dcc-Arab-IN */
-    static_cast<uint64_t>(0x64654c61746e4445), /* de-Latn-DE */
-    static_cast<uint64_t>(0x8c8d4c61746e4341), /* den-Latn-CA */
-    static_cast<uint64_t>(0x8cd14c61746e4341), /* dgr-Latn-CA */
-    static_cast<uint64_t>(0x8d244c61746e4e45), /* dje-Latn-NE */
-    static_cast<uint64_t>(0x8da94c61746e4349), /* dnj-Latn-CI */
-    static_cast<uint64_t>(0x8dc844657661494e), /* doi-Deva-IN */
-    static_cast<uint64_t>(0x8e274d6f6e67434e), /* drh-Mong-CN */
-    static_cast<uint64_t>(0x8e414c61746e4445), /* dsb-Latn-DE */
-    static_cast<uint64_t>(0x8e6c4c61746e4d4c), /* dtm-Latn-ML */
-    static_cast<uint64_t>(0x8e6f4c61746e4d59), /* dtp-Latn-MY */
-    static_cast<uint64_t>(0x8e78446576614e50), /* dty-Deva-NP */
-    static_cast<uint64_t>(0x8e804c61746e434d), /* dua-Latn-CM */
-    static_cast<uint64_t>(0x6476546861614d56), /* dv-Thaa-MV */
-    static_cast<uint64_t>(0x8f0e4c61746e534e), /* dyo-Latn-SN */
-    static_cast<uint64_t>(0x8f144c61746e4246), /* dyu-Latn-BF */
-    static_cast<uint64_t>(0x647a546962744254), /* dz-Tibt-BT */
-    static_cast<uint64_t>(0x90344c61746e4b45), /* ebu-Latn-KE */
-    static_cast<uint64_t>(0x65654c61746e4748), /* ee-Latn-GH */
-    static_cast<uint64_t>(0x90a84c61746e4e47), /* efi-Latn-NG */
-    static_cast<uint64_t>(0x90cb4c61746e4954), /* egl-Latn-IT */
-    static_cast<uint64_t>(0x90d8456779704547), /* egy-Egyp-EG */
-    static_cast<uint64_t>(0x91584b616c694d4d), /* eky-Kali-MM */
-    static_cast<uint64_t>(0x656c4772656b4752), /* el-Grek-GR */
-    static_cast<uint64_t>(0x656e4c61746e5553), /* en-Latn-US */
-    static_cast<uint64_t>(0x656e536861774742), /* en-Shaw-GB */
-    static_cast<uint64_t>(0x65734c61746e4553), /* es-Latn-ES */
-    static_cast<uint64_t>(0x9246476f6e6d494e), /* esg-Gonm-IN */
-    static_cast<uint64_t>(0x92544c61746e5553), /* esu-Latn-US */
-    static_cast<uint64_t>(0x65744c61746e4545), /* et-Latn-EE */
-    static_cast<uint64_t>(0x92734974616c4954), /* ett-Ital-IT */
-    static_cast<uint64_t>(0x65754c61746e4553), /* eu-Latn-ES */
-    static_cast<uint64_t>(0x92ce4c61746e434d), /* ewo-Latn-CM */
-    static_cast<uint64_t>(0x92f34c61746e4553), /* ext-Latn-ES */
-    static_cast<uint64_t>(0x6661417261624952), /* fa-Arab-IR */
-    static_cast<uint64_t>(0x940d4c61746e4751), /* fan-Latn-GQ */
-    static_cast<uint64_t>(0x66664c61746e534e), /* ff-Latn-SN */
-    static_cast<uint64_t>(0x666641646c6d474e), /* ff-Adlm-GN */
-    static_cast<uint64_t>(0x94ac4c61746e4d4c), /* ffm-Latn-ML */
-    static_cast<uint64_t>(0x66694c61746e4649), /* fi-Latn-FI */
-    static_cast<uint64_t>(0x9500417261625344), /* fia-Arab-SD */
-    static_cast<uint64_t>(0x950b4c61746e5048), /* fil-Latn-PH */
-    static_cast<uint64_t>(0x95134c61746e5345), /* fit-Latn-SE */
-    static_cast<uint64_t>(0x666a4c61746e464a), /* fj-Latn-FJ */
-    static_cast<uint64_t>(0x666f4c61746e464f), /* fo-Latn-FO */
-    static_cast<uint64_t>(0x95cd4c61746e424a), /* fon-Latn-BJ */
-    static_cast<uint64_t>(0x66724c61746e4652), /* fr-Latn-FR */
-    static_cast<uint64_t>(0x96224c61746e5553), /* frc-Latn-US */
-    static_cast<uint64_t>(0x962f4c61746e4652), /* frp-Latn-FR */
-    static_cast<uint64_t>(0x96314c61746e4445), /* frr-Latn-DE */
-    static_cast<uint64_t>(0x96324c61746e4445), /* frs-Latn-DE */
-    static_cast<uint64_t>(0x968141726162434d), /* fub-Arab-CM */
-    static_cast<uint64_t>(0x96834c61746e5746), /* fud-Latn-WF */
-    static_cast<uint64_t>(0x96854c61746e474e), /* fuf-Latn-GN */
-    static_cast<uint64_t>(0x96904c61746e4e45), /* fuq-Latn-NE */
-    static_cast<uint64_t>(0x96914c61746e4954), /* fur-Latn-IT */
-    static_cast<uint64_t>(0x96954c61746e4e47), /* fuv-Latn-NG */
-    static_cast<uint64_t>(0x96b14c61746e5344), /* fvr-Latn-SD */
-    static_cast<uint64_t>(0x66794c61746e4e4c), /* fy-Latn-NL */
-    static_cast<uint64_t>(0x67614c61746e4945), /* ga-Latn-IE */
-    static_cast<uint64_t>(0x98004c61746e4748), /* gaa-Latn-GH */
-    static_cast<uint64_t>(0x98064c61746e4d44), /* gag-Latn-MD */
-    static_cast<uint64_t>(0x980d48616e73434e), /* gan-Hans-CN */
-    static_cast<uint64_t>(0x98184c61746e4944), /* gay-Latn-ID */
-    static_cast<uint64_t>(0x982c44657661494e), /* gbm-Deva-IN */
-    static_cast<uint64_t>(0x9839417261624952), /* gbz-Arab-IR */
-    static_cast<uint64_t>(0x98514c61746e4746), /* gcr-Latn-GF */
-    static_cast<uint64_t>(0x67644c61746e4742), /* gd-Latn-GB */
-    static_cast<uint64_t>(0x9899457468694554), /* gez-Ethi-ET */
-    static_cast<uint64_t>(0x98cd446576614e50), /* ggn-Deva-NP */
-    static_cast<uint64_t>(0x990b4c61746e4b49), /* gil-Latn-KI */
-    static_cast<uint64_t>(0x992a41726162504b), /* gjk-Arab-PK */
-    static_cast<uint64_t>(0x993441726162504b), /* gju-Arab-PK */
-    static_cast<uint64_t>(0x676c4c61746e4553), /* gl-Latn-ES */
-    static_cast<uint64_t>(0x996a417261624952), /* glk-Arab-IR */
-    static_cast<uint64_t>(0x676e4c61746e5059), /* gn-Latn-PY */
-    static_cast<uint64_t>(0x99cc44657661494e), /* gom-Deva-IN */
-    static_cast<uint64_t>(0x99cd54656c75494e), /* gon-Telu-IN */
-    static_cast<uint64_t>(0x99d14c61746e4944), /* gor-Latn-ID */
-    static_cast<uint64_t>(0x99d24c61746e4e4c), /* gos-Latn-NL */
-    static_cast<uint64_t>(0x99d3476f74685541), /* got-Goth-UA */
-    static_cast<uint64_t>(0x9a22437072744359), /* grc-Cprt-CY */
-    static_cast<uint64_t>(0x9a224c696e624752), /* grc-Linb-GR */
-    static_cast<uint64_t>(0x9a3342656e67494e), /* grt-Beng-IN */
-    static_cast<uint64_t>(0x9a564c61746e4348), /* gsw-Latn-CH */
-    static_cast<uint64_t>(0x677547756a72494e), /* gu-Gujr-IN */
-    static_cast<uint64_t>(0x9a814c61746e4252), /* gub-Latn-BR */
-    static_cast<uint64_t>(0x9a824c61746e434f), /* guc-Latn-CO */
-    static_cast<uint64_t>(0x9a914c61746e4748), /* gur-Latn-GH */
-    static_cast<uint64_t>(0x9a994c61746e4b45), /* guz-Latn-KE */
-    static_cast<uint64_t>(0x67764c61746e494d), /* gv-Latn-IM */
-    static_cast<uint64_t>(0x9ab1446576614e50), /* gvr-Deva-NP */
-    static_cast<uint64_t>(0x9ac84c61746e4341), /* gwi-Latn-CA */
-    static_cast<uint64_t>(0x68614c61746e4e47), /* ha-Latn-NG */
-    static_cast<uint64_t>(0x9c0a48616e73434e), /* hak-Hans-CN */
-    static_cast<uint64_t>(0x9c164c61746e5553), /* haw-Latn-US */
-    static_cast<uint64_t>(0x9c19417261624146), /* haz-Arab-AF */
-    static_cast<uint64_t>(0x686548656272494c), /* he-Hebr-IL */
-    static_cast<uint64_t>(0x686944657661494e), /* hi-Deva-IN */
-    static_cast<uint64_t>(0x9d054c61746e464a), /* hif-Latn-FJ */
-    static_cast<uint64_t>(0x9d0b4c61746e5048), /* hil-Latn-PH */
-    static_cast<uint64_t>(0x9d74486c75775452), /* hlu-Hluw-TR */
-    static_cast<uint64_t>(0x9d83506c7264434e), /* hmd-Plrd-CN */
-    static_cast<uint64_t>(0x9da341726162504b), /* hnd-Arab-PK */
-    static_cast<uint64_t>(0x9da444657661494e), /* hne-Deva-IN */
-    static_cast<uint64_t>(0x9da9486d6e674c41), /* hnj-Hmng-LA */
-    static_cast<uint64_t>(0x9dad4c61746e5048), /* hnn-Latn-PH */
-    static_cast<uint64_t>(0x9dae41726162504b), /* hno-Arab-PK */
-    static_cast<uint64_t>(0x686f4c61746e5047), /* ho-Latn-PG */
-    static_cast<uint64_t>(0x9dc244657661494e), /* hoc-Deva-IN */
-    static_cast<uint64_t>(0x9dc944657661494e), /* hoj-Deva-IN */
-    static_cast<uint64_t>(0x68724c61746e4852), /* hr-Latn-HR */
-    static_cast<uint64_t>(0x9e414c61746e4445), /* hsb-Latn-DE */
-    static_cast<uint64_t>(0x9e4d48616e73434e), /* hsn-Hans-CN */
-    static_cast<uint64_t>(0x68744c61746e4854), /* ht-Latn-HT */
-    static_cast<uint64_t>(0x68754c61746e4855), /* hu-Latn-HU */
-    static_cast<uint64_t>(0x687941726d6e414d), /* hy-Armn-AM */
-    static_cast<uint64_t>(0x687a4c61746e4e41), /* hz-Latn-NA */
-    static_cast<uint64_t>(0xa0204c61746e4d59), /* iba-Latn-MY */
-    static_cast<uint64_t>(0xa0214c61746e4e47), /* ibb-Latn-NG */
-    static_cast<uint64_t>(0x69644c61746e4944), /* id-Latn-ID */
-    static_cast<uint64_t>(0xa0a44c61746e5447), /* ife-Latn-TG */
-    static_cast<uint64_t>(0x69674c61746e4e47), /* ig-Latn-NG */
-    static_cast<uint64_t>(0x696959696969434e), /* ii-Yiii-CN */
-    static_cast<uint64_t>(0x696b4c61746e5553), /* ik-Latn-US */
-    static_cast<uint64_t>(0xa1534c61746e4341), /* ikt-Latn-CA */
-    static_cast<uint64_t>(0xa16e4c61746e5048), /* ilo-Latn-PH */
-    static_cast<uint64_t>(0x696e4c61746e4944), /* in-Latn-ID */
-    static_cast<uint64_t>(0xa1a74379726c5255), /* inh-Cyrl-RU */
-    static_cast<uint64_t>(0x69734c61746e4953), /* is-Latn-IS */
-    static_cast<uint64_t>(0x69744c61746e4954), /* it-Latn-IT */
-    static_cast<uint64_t>(0x697543616e734341), /* iu-Cans-CA */
-    static_cast<uint64_t>(0x697748656272494c), /* iw-Hebr-IL */
-    static_cast<uint64_t>(0xa3274c61746e5255), /* izh-Latn-RU */
-    static_cast<uint64_t>(0x6a614a70616e4a50), /* ja-Jpan-JP */
-    static_cast<uint64_t>(0xa40c4c61746e4a4d), /* jam-Latn-JM */
-    static_cast<uint64_t>(0xa4ce4c61746e434d), /* jgo-Latn-CM */
-    static_cast<uint64_t>(0x6a69486562725541), /* ji-Hebr-UA */
-    static_cast<uint64_t>(0xa5824c61746e545a), /* jmc-Latn-TZ */
-    static_cast<uint64_t>(0xa58b446576614e50), /* jml-Deva-NP */
-    static_cast<uint64_t>(0xa6934c61746e444b), /* jut-Latn-DK */
-    static_cast<uint64_t>(0x6a764c61746e4944), /* jv-Latn-ID */
-    static_cast<uint64_t>(0x6a774c61746e4944), /* jw-Latn-ID */
-    static_cast<uint64_t>(0x6b6147656f724745), /* ka-Geor-GE */
-    static_cast<uint64_t>(0xa8004379726c555a), /* kaa-Cyrl-UZ */
-    static_cast<uint64_t>(0xa8014c61746e445a), /* kab-Latn-DZ */
-    static_cast<uint64_t>(0xa8024c61746e4d4d), /* kac-Latn-MM */
-    static_cast<uint64_t>(0xa8094c61746e4e47), /* kaj-Latn-NG */
-    static_cast<uint64_t>(0xa80c4c61746e4b45), /* kam-Latn-KE */
-    static_cast<uint64_t>(0xa80e4c61746e4d4c), /* kao-Latn-ML */
-    static_cast<uint64_t>(0xa8234379726c5255), /* kbd-Cyrl-RU */
-    static_cast<uint64_t>(0xa838417261624e45), /* kby-Arab-NE */
-    static_cast<uint64_t>(0xa8464c61746e4e47), /* kcg-Latn-NG */
-    static_cast<uint64_t>(0xa84a4c61746e5a57), /* kck-Latn-ZW */
-    static_cast<uint64_t>(0xa8644c61746e545a), /* kde-Latn-TZ */
-    static_cast<uint64_t>(0xa867417261625447), /* kdh-Arab-TG */
-    static_cast<uint64_t>(0xa873546861695448), /* kdt-Thai-TH */
-    static_cast<uint64_t>(0xa8804c61746e4356), /* kea-Latn-CV */
-    static_cast<uint64_t>(0xa88d4c61746e434d), /* ken-Latn-CM */
-    static_cast<uint64_t>(0xa8ae4c61746e4349), /* kfo-Latn-CI */
-    static_cast<uint64_t>(0xa8b144657661494e), /* kfr-Deva-IN */
-    static_cast<uint64_t>(0xa8b844657661494e), /* kfy-Deva-IN */
-    static_cast<uint64_t>(0x6b674c61746e4344), /* kg-Latn-CD */
-    static_cast<uint64_t>(0xa8c44c61746e4944), /* kge-Latn-ID */
-    static_cast<uint64_t>(0xa8cf4c61746e4252), /* kgp-Latn-BR */
-    static_cast<uint64_t>(0xa8e04c61746e494e), /* kha-Latn-IN */
-    static_cast<uint64_t>(0xa8e154616c75434e), /* khb-Talu-CN */
-    static_cast<uint64_t>(0xa8ed44657661494e), /* khn-Deva-IN */
-    static_cast<uint64_t>(0xa8f04c61746e4d4c), /* khq-Latn-ML */
-    static_cast<uint64_t>(0xa8f34d796d72494e), /* kht-Mymr-IN */
-    static_cast<uint64_t>(0xa8f641726162504b), /* khw-Arab-PK */
-    static_cast<uint64_t>(0x6b694c61746e4b45), /* ki-Latn-KE */
-    static_cast<uint64_t>(0xa9144c61746e5452), /* kiu-Latn-TR */
-    static_cast<uint64_t>(0x6b6a4c61746e4e41), /* kj-Latn-NA */
-    static_cast<uint64_t>(0xa9264c616f6f4c41), /* kjg-Laoo-LA */
-    static_cast<uint64_t>(0x6b6b4379726c4b5a), /* kk-Cyrl-KZ */
-    static_cast<uint64_t>(0x6b6b41726162434e), /* kk-Arab-CN */
-    static_cast<uint64_t>(0xa9494c61746e434d), /* kkj-Latn-CM */
-    static_cast<uint64_t>(0x6b6c4c61746e474c), /* kl-Latn-GL */
-    static_cast<uint64_t>(0xa96d4c61746e4b45), /* kln-Latn-KE */
-    static_cast<uint64_t>(0x6b6d4b686d724b48), /* km-Khmr-KH */
-    static_cast<uint64_t>(0xa9814c61746e414f), /* kmb-Latn-AO */
-    static_cast<uint64_t>(0x6b6e4b6e6461494e), /* kn-Knda-IN */
-    static_cast<uint64_t>(0xa9a54c61746e4757), /* knf-Latn-GW */
-    static_cast<uint64_t>(0x6b6f4b6f72654b52), /* ko-Kore-KR */
-    static_cast<uint64_t>(0xa9c84379726c5255), /* koi-Cyrl-RU */
-    static_cast<uint64_t>(0xa9ca44657661494e), /* kok-Deva-IN */
-    static_cast<uint64_t>(0xa9d24c61746e464d), /* kos-Latn-FM */
-    static_cast<uint64_t>(0xa9e44c61746e4c52), /* kpe-Latn-LR */
-    static_cast<uint64_t>(0xaa224379726c5255), /* krc-Cyrl-RU */
-    static_cast<uint64_t>(0xaa284c61746e534c), /* kri-Latn-SL */
-    static_cast<uint64_t>(0xaa294c61746e5048), /* krj-Latn-PH */
-    static_cast<uint64_t>(0xaa2b4c61746e5255), /* krl-Latn-RU */
-    static_cast<uint64_t>(0xaa3444657661494e), /* kru-Deva-IN */
-    static_cast<uint64_t>(0x6b7341726162494e), /* ks-Arab-IN */
-    static_cast<uint64_t>(0xaa414c61746e545a), /* ksb-Latn-TZ */
-    static_cast<uint64_t>(0xaa454c61746e434d), /* ksf-Latn-CM */
-    static_cast<uint64_t>(0xaa474c61746e4445), /* ksh-Latn-DE */
-    static_cast<uint64_t>(0xaa714c61746e4d59), /* ktr-Latn-MY */
-    static_cast<uint64_t>(0x6b754c61746e5452), /* ku-Latn-TR */
-    static_cast<uint64_t>(0x6b75417261624951), /* ku-Arab-IQ */
-    static_cast<uint64_t>(0x6b7559657a694745), /* ku-Yezi-GE */
-    static_cast<uint64_t>(0xaa8c4379726c5255), /* kum-Cyrl-RU */
-    static_cast<uint64_t>(0x6b764379726c5255), /* kv-Cyrl-RU */
-    static_cast<uint64_t>(0xaab14c61746e4944), /* kvr-Latn-ID */
-    static_cast<uint64_t>(0xaab741726162504b), /* kvx-Arab-PK */
-    static_cast<uint64_t>(0x6b774c61746e4742), /* kw-Latn-GB */
-    static_cast<uint64_t>(0xaaeb44657661494e), /* kxl-Deva-IN */
-    static_cast<uint64_t>(0xaaec546861695448), /* kxm-Thai-TH */
-    static_cast<uint64_t>(0xaaef41726162504b), /* kxp-Arab-PK */
-    static_cast<uint64_t>(0x6b794379726c4b47), /* ky-Cyrl-KG */
-    static_cast<uint64_t>(0x6b7941726162434e), /* ky-Arab-CN */
-    static_cast<uint64_t>(0x6b794c61746e5452), /* ky-Latn-TR */
-    static_cast<uint64_t>(0xab294c61746e4d59), /* kzj-Latn-MY */
-    static_cast<uint64_t>(0xab334c61746e4d59), /* kzt-Latn-MY */
-    static_cast<uint64_t>(0x6c614c61746e5641), /* la-Latn-VA */
-    static_cast<uint64_t>(0xac014c696e614752), /* lab-Lina-GR */
-    static_cast<uint64_t>(0xac0348656272494c), /* lad-Hebr-IL */
-    static_cast<uint64_t>(0xac064c61746e545a), /* lag-Latn-TZ */
-    static_cast<uint64_t>(0xac0741726162504b), /* lah-Arab-PK */
-    static_cast<uint64_t>(0xac094c61746e5547), /* laj-Latn-UG */
-    static_cast<uint64_t>(0x6c624c61746e4c55), /* lb-Latn-LU */
-    static_cast<uint64_t>(0xac244379726c5255), /* lbe-Cyrl-RU */
-    static_cast<uint64_t>(0xac364c61746e4944), /* lbw-Latn-ID */
-    static_cast<uint64_t>(0xac4f54686169434e), /* lcp-Thai-CN */
-    static_cast<uint64_t>(0xac8f4c657063494e), /* lep-Lepc-IN */
-    static_cast<uint64_t>(0xac994379726c5255), /* lez-Cyrl-RU */
-    static_cast<uint64_t>(0x6c674c61746e5547), /* lg-Latn-UG */
-    static_cast<uint64_t>(0x6c694c61746e4e4c), /* li-Latn-NL */
-    static_cast<uint64_t>(0xad05446576614e50), /* lif-Deva-NP */
-    static_cast<uint64_t>(0xad054c696d62494e), /* lif-Limb-IN */
-    static_cast<uint64_t>(0xad094c61746e4954), /* lij-Latn-IT */
-    static_cast<uint64_t>(0xad124c697375434e), /* lis-Lisu-CN */
-    static_cast<uint64_t>(0xad2f4c61746e4944), /* ljp-Latn-ID */
-    static_cast<uint64_t>(0xad48417261624952), /* lki-Arab-IR */
-    static_cast<uint64_t>(0xad534c61746e5553), /* lkt-Latn-US */
-    static_cast<uint64_t>(0xad8d54656c75494e), /* lmn-Telu-IN */
-    static_cast<uint64_t>(0xad8e4c61746e4954), /* lmo-Latn-IT */
-    static_cast<uint64_t>(0x6c6e4c61746e4344), /* ln-Latn-CD */
-    static_cast<uint64_t>(0x6c6f4c616f6f4c41), /* lo-Laoo-LA */
-    static_cast<uint64_t>(0xadcb4c61746e4344), /* lol-Latn-CD */
-    static_cast<uint64_t>(0xadd94c61746e5a4d), /* loz-Latn-ZM */
-    static_cast<uint64_t>(0xae22417261624952), /* lrc-Arab-IR */
-    static_cast<uint64_t>(0x6c744c61746e4c54), /* lt-Latn-LT */
-    static_cast<uint64_t>(0xae664c61746e4c56), /* ltg-Latn-LV */
-    static_cast<uint64_t>(0x6c754c61746e4344), /* lu-Latn-CD */
-    static_cast<uint64_t>(0xae804c61746e4344), /* lua-Latn-CD */
-    static_cast<uint64_t>(0xae8e4c61746e4b45), /* luo-Latn-KE */
-    static_cast<uint64_t>(0xae984c61746e4b45), /* luy-Latn-KE */
-    static_cast<uint64_t>(0xae99417261624952), /* luz-Arab-IR */
-    static_cast<uint64_t>(0x6c764c61746e4c56), /* lv-Latn-LV */
-    static_cast<uint64_t>(0xaecb546861695448), /* lwl-Thai-TH */
-    static_cast<uint64_t>(0xaf2748616e73434e), /* lzh-Hans-CN */
-    static_cast<uint64_t>(0xaf394c61746e5452), /* lzz-Latn-TR */
-    static_cast<uint64_t>(0xb0034c61746e4944), /* mad-Latn-ID */
-    static_cast<uint64_t>(0xb0054c61746e434d), /* maf-Latn-CM */
-    static_cast<uint64_t>(0xb00644657661494e), /* mag-Deva-IN */
-    static_cast<uint64_t>(0xb00844657661494e), /* mai-Deva-IN */
-    static_cast<uint64_t>(0xb00a4c61746e4944), /* mak-Latn-ID */
-    static_cast<uint64_t>(0xb00d4c61746e474d), /* man-Latn-GM */
-    static_cast<uint64_t>(0xb00d4e6b6f6f474e), /* man-Nkoo-GN */
-    static_cast<uint64_t>(0xb0124c61746e4b45), /* mas-Latn-KE */
-    static_cast<uint64_t>(0xb0194c61746e4d58), /* maz-Latn-MX */
-    static_cast<uint64_t>(0xb0654379726c5255), /* mdf-Cyrl-RU */
-    static_cast<uint64_t>(0xb0674c61746e5048), /* mdh-Latn-PH */
-    static_cast<uint64_t>(0xb0714c61746e4944), /* mdr-Latn-ID */
-    static_cast<uint64_t>(0xb08d4c61746e534c), /* men-Latn-SL */
-    static_cast<uint64_t>(0xb0914c61746e4b45), /* mer-Latn-KE */
-    static_cast<uint64_t>(0xb0a0417261625448), /* mfa-Arab-TH */
-    static_cast<uint64_t>(0xb0a44c61746e4d55), /* mfe-Latn-MU */
-    static_cast<uint64_t>(0x6d674c61746e4d47), /* mg-Latn-MG */
-    static_cast<uint64_t>(0xb0c74c61746e4d5a), /* mgh-Latn-MZ */
-    static_cast<uint64_t>(0xb0ce4c61746e434d), /* mgo-Latn-CM */
-    static_cast<uint64_t>(0xb0cf446576614e50), /* mgp-Deva-NP */
-    static_cast<uint64_t>(0xb0d84c61746e545a), /* mgy-Latn-TZ */
-    static_cast<uint64_t>(0x6d684c61746e4d48), /* mh-Latn-MH */
-    static_cast<uint64_t>(0x6d694c61746e4e5a), /* mi-Latn-NZ */
-    static_cast<uint64_t>(0xb10d4c61746e4944), /* min-Latn-ID */
-    static_cast<uint64_t>(0xb112486174724951), /* mis-Hatr-IQ */
-    static_cast<uint64_t>(0xb1124d6564664e47), /* mis-Medf-NG */
-    static_cast<uint64_t>(0x6d6b4379726c4d4b), /* mk-Cyrl-MK */
-    static_cast<uint64_t>(0x6d6c4d6c796d494e), /* ml-Mlym-IN */
-    static_cast<uint64_t>(0xb1724c61746e5344), /* mls-Latn-SD */
-    static_cast<uint64_t>(0x6d6e4379726c4d4e), /* mn-Cyrl-MN */
-    static_cast<uint64_t>(0x6d6e4d6f6e67434e), /* mn-Mong-CN */
-    static_cast<uint64_t>(0xb1a842656e67494e), /* mni-Beng-IN */
-    static_cast<uint64_t>(0xb1b64d796d724d4d), /* mnw-Mymr-MM */
-    static_cast<uint64_t>(0x6d6f4c61746e524f), /* mo-Latn-RO */
-    static_cast<uint64_t>(0xb1c44c61746e4341), /* moe-Latn-CA */
-    static_cast<uint64_t>(0xb1c74c61746e4341), /* moh-Latn-CA */
-    static_cast<uint64_t>(0xb1d24c61746e4246), /* mos-Latn-BF */
-    static_cast<uint64_t>(0x6d7244657661494e), /* mr-Deva-IN */
-    static_cast<uint64_t>(0xb223446576614e50), /* mrd-Deva-NP */
-    static_cast<uint64_t>(0xb2294379726c5255), /* mrj-Cyrl-RU */
-    static_cast<uint64_t>(0xb22e4d726f6f4244), /* mro-Mroo-BD */
-    static_cast<uint64_t>(0x6d734c61746e4d59), /* ms-Latn-MY */
-    static_cast<uint64_t>(0x6d744c61746e4d54), /* mt-Latn-MT */
-    static_cast<uint64_t>(0xb27144657661494e), /* mtr-Deva-IN */
-    static_cast<uint64_t>(0xb2804c61746e434d), /* mua-Latn-CM */
-    static_cast<uint64_t>(0xb2924c61746e5553), /* mus-Latn-US */
-    static_cast<uint64_t>(0xb2b841726162504b), /* mvy-Arab-PK */
-    static_cast<uint64_t>(0xb2ca4c61746e4d4c), /* mwk-Latn-ML */
-    static_cast<uint64_t>(0xb2d144657661494e), /* mwr-Deva-IN */
-    static_cast<uint64_t>(0xb2d54c61746e4944), /* mwv-Latn-ID */
-    static_cast<uint64_t>(0xb2d6486d6e705553), /* mww-Hmnp-US */
-    static_cast<uint64_t>(0xb2e24c61746e5a57), /* mxc-Latn-ZW */
-    static_cast<uint64_t>(0x6d794d796d724d4d), /* my-Mymr-MM */
-    static_cast<uint64_t>(0xb3154379726c5255), /* myv-Cyrl-RU */
-    static_cast<uint64_t>(0xb3174c61746e5547), /* myx-Latn-UG */
-    static_cast<uint64_t>(0xb3194d616e644952), /* myz-Mand-IR */
-    static_cast<uint64_t>(0xb32d417261624952), /* mzn-Arab-IR */
-    static_cast<uint64_t>(0x6e614c61746e4e52), /* na-Latn-NR */
-    static_cast<uint64_t>(0xb40d48616e73434e), /* nan-Hans-CN */
-    static_cast<uint64_t>(0xb40f4c61746e4954), /* nap-Latn-IT */
-    static_cast<uint64_t>(0xb4104c61746e4e41), /* naq-Latn-NA */
-    static_cast<uint64_t>(0x6e624c61746e4e4f), /* nb-Latn-NO */
-    static_cast<uint64_t>(0xb4474c61746e4d58), /* nch-Latn-MX */
-    static_cast<uint64_t>(0x6e644c61746e5a57), /* nd-Latn-ZW */
-    static_cast<uint64_t>(0xb4624c61746e4d5a), /* ndc-Latn-MZ */
-    static_cast<uint64_t>(0xb4724c61746e4445), /* nds-Latn-DE */
-    static_cast<uint64_t>(0x6e65446576614e50), /* ne-Deva-NP */
-    static_cast<uint64_t>(0xb496446576614e50), /* new-Deva-NP */
-    static_cast<uint64_t>(0x6e674c61746e4e41), /* ng-Latn-NA */
-    static_cast<uint64_t>(0xb4cb4c61746e4d5a), /* ngl-Latn-MZ */
-    static_cast<uint64_t>(0xb4e44c61746e4d58), /* nhe-Latn-MX */
-    static_cast<uint64_t>(0xb4f64c61746e4d58), /* nhw-Latn-MX */
-    static_cast<uint64_t>(0xb5094c61746e4944), /* nij-Latn-ID */
-    static_cast<uint64_t>(0xb5144c61746e4e55), /* niu-Latn-NU */
-    static_cast<uint64_t>(0xb52e4c61746e494e), /* njo-Latn-IN */
-    static_cast<uint64_t>(0x6e6c4c61746e4e4c), /* nl-Latn-NL */
-    static_cast<uint64_t>(0xb5864c61746e434d), /* nmg-Latn-CM */
-    static_cast<uint64_t>(0x6e6e4c61746e4e4f), /* nn-Latn-NO */
-    static_cast<uint64_t>(0xb5a74c61746e434d), /* nnh-Latn-CM */
-    static_cast<uint64_t>(0xb5af5763686f494e), /* nnp-Wcho-IN */
-    static_cast<uint64_t>(0x6e6f4c61746e4e4f), /* no-Latn-NO */
-    static_cast<uint64_t>(0xb5c34c616e615448), /* nod-Lana-TH */
-    static_cast<uint64_t>(0xb5c444657661494e), /* noe-Deva-IN */
-    static_cast<uint64_t>(0xb5cd52756e725345), /* non-Runr-SE */
-    static_cast<uint64_t>(0xb60e4e6b6f6f474e), /* nqo-Nkoo-GN */
-    static_cast<uint64_t>(0x6e724c61746e5a41), /* nr-Latn-ZA */
-    static_cast<uint64_t>(0xb64a43616e734341), /* nsk-Cans-CA */
-    static_cast<uint64_t>(0xb64e4c61746e5a41), /* nso-Latn-ZA */
-    static_cast<uint64_t>(0xb6924c61746e5353), /* nus-Latn-SS */
-    static_cast<uint64_t>(0x6e764c61746e5553), /* nv-Latn-US */
-    static_cast<uint64_t>(0xb6f04c61746e434e), /* nxq-Latn-CN */
-    static_cast<uint64_t>(0x6e794c61746e4d57), /* ny-Latn-MW */
-    static_cast<uint64_t>(0xb70c4c61746e545a), /* nym-Latn-TZ */
-    static_cast<uint64_t>(0xb70d4c61746e5547), /* nyn-Latn-UG */
-    static_cast<uint64_t>(0xb7284c61746e4748), /* nzi-Latn-GH */
-    static_cast<uint64_t>(0x6f634c61746e4652), /* oc-Latn-FR */
-    static_cast<uint64_t>(0x6f6d4c61746e4554), /* om-Latn-ET */
-    static_cast<uint64_t>(0x6f724f727961494e), /* or-Orya-IN */
-    static_cast<uint64_t>(0x6f734379726c4745), /* os-Cyrl-GE */
-    static_cast<uint64_t>(0xba404f7367655553), /* osa-Osge-US */
-    static_cast<uint64_t>(0xba6a4f726b684d4e), /* otk-Orkh-MN */
-    static_cast<uint64_t>(0x706147757275494e), /* pa-Guru-IN */
-    static_cast<uint64_t>(0x706141726162504b), /* pa-Arab-PK */
-    static_cast<uint64_t>(0xbc064c61746e5048), /* pag-Latn-PH */
-    static_cast<uint64_t>(0xbc0b50686c694952), /* pal-Phli-IR */
-    static_cast<uint64_t>(0xbc0b50686c70434e), /* pal-Phlp-CN */
-    static_cast<uint64_t>(0xbc0c4c61746e5048), /* pam-Latn-PH */
-    static_cast<uint64_t>(0xbc0f4c61746e4157), /* pap-Latn-AW */
-    static_cast<uint64_t>(0xbc144c61746e5057), /* pau-Latn-PW */
-    static_cast<uint64_t>(0xbc434c61746e4652), /* pcd-Latn-FR */
-    static_cast<uint64_t>(0xbc4c4c61746e4e47), /* pcm-Latn-NG */
-    static_cast<uint64_t>(0xbc624c61746e5553), /* pdc-Latn-US */
-    static_cast<uint64_t>(0xbc734c61746e4341), /* pdt-Latn-CA */
-    static_cast<uint64_t>(0xbc8e5870656f4952), /* peo-Xpeo-IR */
-    static_cast<uint64_t>(0xbcab4c61746e4445), /* pfl-Latn-DE */
-    static_cast<uint64_t>(0xbced50686e784c42), /* phn-Phnx-LB */
-    static_cast<uint64_t>(0xbd4042726168494e), /* pka-Brah-IN */
-    static_cast<uint64_t>(0xbd4e4c61746e4b45), /* pko-Latn-KE */
-    static_cast<uint64_t>(0x706c4c61746e504c), /* pl-Latn-PL */
-    static_cast<uint64_t>(0xbd924c61746e4954), /* pms-Latn-IT */
-    static_cast<uint64_t>(0xbdb34772656b4752), /* pnt-Grek-GR */
-    static_cast<uint64_t>(0xbdcd4c61746e464d), /* pon-Latn-FM */
-    static_cast<uint64_t>(0xbde044657661494e), /* ppa-Deva-IN */
-    static_cast<uint64_t>(0xbe204b686172504b), /* pra-Khar-PK */
-    static_cast<uint64_t>(0xbe23417261624952), /* prd-Arab-IR */
-    static_cast<uint64_t>(0x7073417261624146), /* ps-Arab-AF */
-    static_cast<uint64_t>(0x70744c61746e4252), /* pt-Latn-BR */
-    static_cast<uint64_t>(0xbe944c61746e4741), /* puu-Latn-GA */
-    static_cast<uint64_t>(0x71754c61746e5045), /* qu-Latn-PE */
-    static_cast<uint64_t>(0xc2824c61746e4754), /* quc-Latn-GT */
-    static_cast<uint64_t>(0xc2864c61746e4543), /* qug-Latn-EC */
-    static_cast<uint64_t>(0xc40944657661494e), /* raj-Deva-IN */
-    static_cast<uint64_t>(0xc4454c61746e5245), /* rcf-Latn-RE */
-    static_cast<uint64_t>(0xc4894c61746e4944), /* rej-Latn-ID */
-    static_cast<uint64_t>(0xc4cd4c61746e4954), /* rgn-Latn-IT */
-    static_cast<uint64_t>(0xc4e6417261624d4d), /* rhg-Arab-MM */
-    static_cast<uint64_t>(0xc5004c61746e494e), /* ria-Latn-IN */
-    static_cast<uint64_t>(0xc50554666e674d41), /* rif-Tfng-MA */
-    static_cast<uint64_t>(0xc532446576614e50), /* rjs-Deva-NP */
-    static_cast<uint64_t>(0xc55342656e674244), /* rkt-Beng-BD */
-    static_cast<uint64_t>(0x726d4c61746e4348), /* rm-Latn-CH */
-    static_cast<uint64_t>(0xc5854c61746e4649), /* rmf-Latn-FI */
-    static_cast<uint64_t>(0xc58e4c61746e4348), /* rmo-Latn-CH */
-    static_cast<uint64_t>(0xc593417261624952), /* rmt-Arab-IR */
-    static_cast<uint64_t>(0xc5944c61746e5345), /* rmu-Latn-SE */
-    static_cast<uint64_t>(0x726e4c61746e4249), /* rn-Latn-BI */
-    static_cast<uint64_t>(0xc5a64c61746e4d5a), /* rng-Latn-MZ */
-    static_cast<uint64_t>(0x726f4c61746e524f), /* ro-Latn-RO */
-    static_cast<uint64_t>(0xc5c14c61746e4944), /* rob-Latn-ID */
-    static_cast<uint64_t>(0xc5c54c61746e545a), /* rof-Latn-TZ */
-    static_cast<uint64_t>(0xc66c4c61746e464a), /* rtm-Latn-FJ */
-    static_cast<uint64_t>(0x72754379726c5255), /* ru-Cyrl-RU */
-    static_cast<uint64_t>(0xc6844379726c5541), /* rue-Cyrl-UA */
-    static_cast<uint64_t>(0xc6864c61746e5342), /* rug-Latn-SB */
-    static_cast<uint64_t>(0x72774c61746e5257), /* rw-Latn-RW */
-    static_cast<uint64_t>(0xc6ca4c61746e545a), /* rwk-Latn-TZ */
-    static_cast<uint64_t>(0xc7144b616e614a50), /* ryu-Kana-JP */
-    static_cast<uint64_t>(0x736144657661494e), /* sa-Deva-IN */
-    static_cast<uint64_t>(0xc8054c61746e4748), /* saf-Latn-GH */
-    static_cast<uint64_t>(0xc8074379726c5255), /* sah-Cyrl-RU */
-    static_cast<uint64_t>(0xc8104c61746e4b45), /* saq-Latn-KE */
-    static_cast<uint64_t>(0xc8124c61746e4944), /* sas-Latn-ID */
-    static_cast<uint64_t>(0xc8134f6c636b494e), /* sat-Olck-IN */
-    static_cast<uint64_t>(0xc8154c61746e534e), /* sav-Latn-SN */
-    static_cast<uint64_t>(0xc81953617572494e), /* saz-Saur-IN */
-    static_cast<uint64_t>(0xc82f4c61746e545a), /* sbp-Latn-TZ */
-    static_cast<uint64_t>(0x73634c61746e4954), /* sc-Latn-IT */
-    static_cast<uint64_t>(0xc84a44657661494e), /* sck-Deva-IN */
-    static_cast<uint64_t>(0xc84d4c61746e4954), /* scn-Latn-IT */
-    static_cast<uint64_t>(0xc84e4c61746e4742), /* sco-Latn-GB */
-    static_cast<uint64_t>(0xc8524c61746e4341), /* scs-Latn-CA */
-    static_cast<uint64_t>(0x736441726162504b), /* sd-Arab-PK */
-    static_cast<uint64_t>(0x736444657661494e), /* sd-Deva-IN */
-    static_cast<uint64_t>(0x73644b686f6a494e), /* sd-Khoj-IN */
-    static_cast<uint64_t>(0x736453696e64494e), /* sd-Sind-IN */
-    static_cast<uint64_t>(0xc8624c61746e4954), /* sdc-Latn-IT */
-    static_cast<uint64_t>(0xc867417261624952), /* sdh-Arab-IR */
-    static_cast<uint64_t>(0x73654c61746e4e4f), /* se-Latn-NO */
-    static_cast<uint64_t>(0xc8854c61746e4349), /* sef-Latn-CI */
-    static_cast<uint64_t>(0xc8874c61746e4d5a), /* seh-Latn-MZ */
-    static_cast<uint64_t>(0xc8884c61746e4d58), /* sei-Latn-MX */
-    static_cast<uint64_t>(0xc8924c61746e4d4c), /* ses-Latn-ML */
-    static_cast<uint64_t>(0x73674c61746e4346), /* sg-Latn-CF */
-    static_cast<uint64_t>(0xc8c04f67616d4945), /* sga-Ogam-IE */
-    static_cast<uint64_t>(0xc8d24c61746e4c54), /* sgs-Latn-LT */
-    static_cast<uint64_t>(0xc8e854666e674d41), /* shi-Tfng-MA */
-    static_cast<uint64_t>(0xc8ed4d796d724d4d), /* shn-Mymr-MM */
-    static_cast<uint64_t>(0x736953696e684c4b), /* si-Sinh-LK */
-    static_cast<uint64_t>(0xc9034c61746e4554), /* sid-Latn-ET */
-    static_cast<uint64_t>(0x736b4c61746e534b), /* sk-Latn-SK */
-    static_cast<uint64_t>(0xc95141726162504b), /* skr-Arab-PK */
-    static_cast<uint64_t>(0x736c4c61746e5349), /* sl-Latn-SI */
-    static_cast<uint64_t>(0xc9684c61746e504c), /* sli-Latn-PL */
-    static_cast<uint64_t>(0xc9784c61746e4944), /* sly-Latn-ID */
-    static_cast<uint64_t>(0x736d4c61746e5753), /* sm-Latn-WS */
-    static_cast<uint64_t>(0xc9804c61746e5345), /* sma-Latn-SE */
-    static_cast<uint64_t>(0xc9894c61746e5345), /* smj-Latn-SE */
-    static_cast<uint64_t>(0xc98d4c61746e4649), /* smn-Latn-FI */
-    static_cast<uint64_t>(0xc98f53616d72494c), /* smp-Samr-IL */
-    static_cast<uint64_t>(0xc9924c61746e4649), /* sms-Latn-FI */
-    static_cast<uint64_t>(0x736e4c61746e5a57), /* sn-Latn-ZW */
-    static_cast<uint64_t>(0xc9aa4c61746e4d4c), /* snk-Latn-ML */
-    static_cast<uint64_t>(0x736f4c61746e534f), /* so-Latn-SO */
-    static_cast<uint64_t>(0xc9c6536f6764555a), /* sog-Sogd-UZ */
-    static_cast<uint64_t>(0xc9d4546861695448), /* sou-Thai-TH */
-    static_cast<uint64_t>(0x73714c61746e414c), /* sq-Latn-AL */
-    static_cast<uint64_t>(0x73724379726c5253), /* sr-Cyrl-RS */
-    static_cast<uint64_t>(0xca21536f7261494e), /* srb-Sora-IN */
-    static_cast<uint64_t>(0xca2d4c61746e5352), /* srn-Latn-SR */
-    static_cast<uint64_t>(0xca314c61746e534e), /* srr-Latn-SN */
-    static_cast<uint64_t>(0xca3744657661494e), /* srx-Deva-IN */
-    static_cast<uint64_t>(0x73734c61746e5a41), /* ss-Latn-ZA */
-    static_cast<uint64_t>(0xca584c61746e4552), /* ssy-Latn-ER */
-    static_cast<uint64_t>(0x73744c61746e5a41), /* st-Latn-ZA */
-    static_cast<uint64_t>(0xca704c61746e4445), /* stq-Latn-DE */
-    static_cast<uint64_t>(0x73754c61746e4944), /* su-Latn-ID */
-    static_cast<uint64_t>(0xca8a4c61746e545a), /* suk-Latn-TZ */
-    static_cast<uint64_t>(0xca924c61746e474e), /* sus-Latn-GN */
-    static_cast<uint64_t>(0x73764c61746e5345), /* sv-Latn-SE */
-    static_cast<uint64_t>(0x73774c61746e545a), /* sw-Latn-TZ */
-    static_cast<uint64_t>(0xcac1417261625954), /* swb-Arab-YT */
-    static_cast<uint64_t>(0xcac24c61746e4344), /* swc-Latn-CD */
-    static_cast<uint64_t>(0xcac64c61746e4445), /* swg-Latn-DE */
-    static_cast<uint64_t>(0xcad544657661494e), /* swv-Deva-IN */
-    static_cast<uint64_t>(0xcaed4c61746e4944), /* sxn-Latn-ID */
-    static_cast<uint64_t>(0xcb0b42656e674244), /* syl-Beng-BD */
-    static_cast<uint64_t>(0xcb11537972634951), /* syr-Syrc-IQ */
-    static_cast<uint64_t>(0xcb2b4c61746e504c), /* szl-Latn-PL */
-    static_cast<uint64_t>(0x746154616d6c494e), /* ta-Taml-IN */
-    static_cast<uint64_t>(0xcc09446576614e50), /* taj-Deva-NP */
-    static_cast<uint64_t>(0xcc364c61746e5048), /* tbw-Latn-PH */
-    static_cast<uint64_t>(0xcc584b6e6461494e), /* tcy-Knda-IN */
-    static_cast<uint64_t>(0xcc6354616c65434e), /* tdd-Tale-CN */
-    static_cast<uint64_t>(0xcc66446576614e50), /* tdg-Deva-NP */
-    static_cast<uint64_t>(0xcc67446576614e50), /* tdh-Deva-NP */
-    static_cast<uint64_t>(0xcc744c61746e4d59), /* tdu-Latn-MY */
-    static_cast<uint64_t>(0x746554656c75494e), /* te-Telu-IN */
-    static_cast<uint64_t>(0xcc8c4c61746e534c), /* tem-Latn-SL */
-    static_cast<uint64_t>(0xcc8e4c61746e5547), /* teo-Latn-UG */
-    static_cast<uint64_t>(0xcc934c61746e544c), /* tet-Latn-TL */
-    static_cast<uint64_t>(0x74674379726c544a), /* tg-Cyrl-TJ */
-    static_cast<uint64_t>(0x746741726162504b), /* tg-Arab-PK */
-    static_cast<uint64_t>(0x7468546861695448), /* th-Thai-TH */
-    static_cast<uint64_t>(0xcceb446576614e50), /* thl-Deva-NP */
-    static_cast<uint64_t>(0xccf0446576614e50), /* thq-Deva-NP */
-    static_cast<uint64_t>(0xccf1446576614e50), /* thr-Deva-NP */
-    static_cast<uint64_t>(0x7469457468694554), /* ti-Ethi-ET */
-    static_cast<uint64_t>(0xcd06457468694552), /* tig-Ethi-ER */
-    static_cast<uint64_t>(0xcd154c61746e4e47), /* tiv-Latn-NG */
-    static_cast<uint64_t>(0x746b4c61746e544d), /* tk-Latn-TM */
-    static_cast<uint64_t>(0xcd4b4c61746e544b), /* tkl-Latn-TK */
-    static_cast<uint64_t>(0xcd514c61746e415a), /* tkr-Latn-AZ */
-    static_cast<uint64_t>(0xcd53446576614e50), /* tkt-Deva-NP */
-    static_cast<uint64_t>(0x746c4c61746e5048), /* tl-Latn-PH */
-    static_cast<uint64_t>(0xcd784c61746e415a), /* tly-Latn-AZ */
-    static_cast<uint64_t>(0xcd874c61746e4e45), /* tmh-Latn-NE */
-    static_cast<uint64_t>(0x746e4c61746e5a41), /* tn-Latn-ZA */
-    static_cast<uint64_t>(0x746f4c61746e544f), /* to-Latn-TO */
-    static_cast<uint64_t>(0xcdc64c61746e4d57), /* tog-Latn-MW */
-    static_cast<uint64_t>(0xcde84c61746e5047), /* tpi-Latn-PG */
-    static_cast<uint64_t>(0x74724c61746e5452), /* tr-Latn-TR */
-    static_cast<uint64_t>(0xce344c61746e5452), /* tru-Latn-TR */
-    static_cast<uint64_t>(0xce354c61746e5457), /* trv-Latn-TW */
-    static_cast<uint64_t>(0xce3641726162504b), /* trw-Arab-PK */
-    static_cast<uint64_t>(0x74734c61746e5a41), /* ts-Latn-ZA */
-    static_cast<uint64_t>(0xce434772656b4752), /* tsd-Grek-GR */
-    static_cast<uint64_t>(0xce45446576614e50), /* tsf-Deva-NP */
-    static_cast<uint64_t>(0xce464c61746e5048), /* tsg-Latn-PH */
-    static_cast<uint64_t>(0xce49546962744254), /* tsj-Tibt-BT */
-    static_cast<uint64_t>(0x74744379726c5255), /* tt-Cyrl-RU */
-    static_cast<uint64_t>(0xce694c61746e5547), /* ttj-Latn-UG */
-    static_cast<uint64_t>(0xce72546861695448), /* tts-Thai-TH */
-    static_cast<uint64_t>(0xce734c61746e415a), /* ttt-Latn-AZ */
-    static_cast<uint64_t>(0xce8c4c61746e4d57), /* tum-Latn-MW */
-    static_cast<uint64_t>(0xceab4c61746e5456), /* tvl-Latn-TV */
-    static_cast<uint64_t>(0xced04c61746e4e45), /* twq-Latn-NE */
-    static_cast<uint64_t>(0xcee654616e67434e), /* txg-Tang-CN */
-    static_cast<uint64_t>(0x74794c61746e5046), /* ty-Latn-PF */
-    static_cast<uint64_t>(0xcf154379726c5255), /* tyv-Cyrl-RU */
-    static_cast<uint64_t>(0xcf2c4c61746e4d41), /* tzm-Latn-MA */
-    static_cast<uint64_t>(0xd06c4379726c5255), /* udm-Cyrl-RU */
-    static_cast<uint64_t>(0x756741726162434e), /* ug-Arab-CN */
-    static_cast<uint64_t>(0x75674379726c4b5a), /* ug-Cyrl-KZ */
-    static_cast<uint64_t>(0xd0c0556761725359), /* uga-Ugar-SY */
-    static_cast<uint64_t>(0x756b4379726c5541), /* uk-Cyrl-UA */
-    static_cast<uint64_t>(0xd1684c61746e464d), /* uli-Latn-FM */
-    static_cast<uint64_t>(0xd1814c61746e414f), /* umb-Latn-AO */
-    static_cast<uint64_t>(0xd1b142656e67494e), /* unr-Beng-IN */
-    static_cast<uint64_t>(0xd1b1446576614e50), /* unr-Deva-NP */
-    static_cast<uint64_t>(0xd1b742656e67494e), /* unx-Beng-IN */
-    static_cast<uint64_t>(0x757241726162504b), /* ur-Arab-PK */
-    static_cast<uint64_t>(0x757a4c61746e555a), /* uz-Latn-UZ */
-    static_cast<uint64_t>(0x757a417261624146), /* uz-Arab-AF */
-    static_cast<uint64_t>(0xd408566169694c52), /* vai-Vaii-LR */
-    static_cast<uint64_t>(0x76654c61746e5a41), /* ve-Latn-ZA */
-    static_cast<uint64_t>(0xd4824c61746e4954), /* vec-Latn-IT */
-    static_cast<uint64_t>(0xd48f4c61746e5255), /* vep-Latn-RU */
-    static_cast<uint64_t>(0x76694c61746e564e), /* vi-Latn-VN */
-    static_cast<uint64_t>(0xd5024c61746e5358), /* vic-Latn-SX */
-    static_cast<uint64_t>(0xd5724c61746e4245), /* vls-Latn-BE */
-    static_cast<uint64_t>(0xd5854c61746e4445), /* vmf-Latn-DE */
-    static_cast<uint64_t>(0xd5964c61746e4d5a), /* vmw-Latn-MZ */
-    static_cast<uint64_t>(0xd5d34c61746e5255), /* vot-Latn-RU */
-    static_cast<uint64_t>(0xd62e4c61746e4545), /* vro-Latn-EE */
-    static_cast<uint64_t>(0xd68d4c61746e545a), /* vun-Latn-TZ */
-    static_cast<uint64_t>(0x77614c61746e4245), /* wa-Latn-BE */
-    static_cast<uint64_t>(0xd8044c61746e4348), /* wae-Latn-CH */
-    static_cast<uint64_t>(0xd80b457468694554), /* wal-Ethi-ET */
-    static_cast<uint64_t>(0xd8114c61746e5048), /* war-Latn-PH */
-    static_cast<uint64_t>(0xd82f4c61746e4155), /* wbp-Latn-AU */
-    static_cast<uint64_t>(0xd83054656c75494e), /* wbq-Telu-IN */
-    static_cast<uint64_t>(0xd83144657661494e), /* wbr-Deva-IN */
-    static_cast<uint64_t>(0xd9724c61746e5746), /* wls-Latn-WF */
-    static_cast<uint64_t>(0xd9a8417261624b4d), /* wni-Arab-KM */
-    static_cast<uint64_t>(0x776f4c61746e534e), /* wo-Latn-SN */
-    static_cast<uint64_t>(0xda46476f6e67494e), /* wsg-Gong-IN */
-    static_cast<uint64_t>(0xda6c44657661494e), /* wtm-Deva-IN */
-    static_cast<uint64_t>(0xda9448616e73434e), /* wuu-Hans-CN */
-    static_cast<uint64_t>(0xdc154c61746e4252), /* xav-Latn-BR */
-    static_cast<uint64_t>(0xdc4e43687273555a), /* xco-Chrs-UZ */
-    static_cast<uint64_t>(0xdc51436172695452), /* xcr-Cari-TR */
-    static_cast<uint64_t>(0x78684c61746e5a41), /* xh-Latn-ZA */
-    static_cast<uint64_t>(0xdd624c7963695452), /* xlc-Lyci-TR */
-    static_cast<uint64_t>(0xdd634c7964695452), /* xld-Lydi-TR */
-    static_cast<uint64_t>(0xdd8547656f724745), /* xmf-Geor-GE */
-    static_cast<uint64_t>(0xdd8d4d616e69434e), /* xmn-Mani-CN */
-    static_cast<uint64_t>(0xdd914d6572635344), /* xmr-Merc-SD */
-    static_cast<uint64_t>(0xdda04e6172625341), /* xna-Narb-SA */
-    static_cast<uint64_t>(0xddb144657661494e), /* xnr-Deva-IN */
-    static_cast<uint64_t>(0xddc64c61746e5547), /* xog-Latn-UG */
-    static_cast<uint64_t>(0xddf1507274694952), /* xpr-Prti-IR */
-    static_cast<uint64_t>(0xde40536172625945), /* xsa-Sarb-YE */
-    static_cast<uint64_t>(0xde51446576614e50), /* xsr-Deva-NP */
-    static_cast<uint64_t>(0xe00e4c61746e4d5a), /* yao-Latn-MZ */
-    static_cast<uint64_t>(0xe00f4c61746e464d), /* yap-Latn-FM */
-    static_cast<uint64_t>(0xe0154c61746e434d), /* yav-Latn-CM */
-    static_cast<uint64_t>(0xe0214c61746e434d), /* ybb-Latn-CM */
-    static_cast<uint64_t>(0x796f4c61746e4e47), /* yo-Latn-NG */
-    static_cast<uint64_t>(0xe22b4c61746e4252), /* yrl-Latn-BR */
-    static_cast<uint64_t>(0xe2804c61746e4d58), /* yua-Latn-MX */
-    static_cast<uint64_t>(0xe28448616e74484b), /* yue-Hant-HK */
-    static_cast<uint64_t>(0xe28448616e73434e), /* yue-Hans-CN */
-    static_cast<uint64_t>(0x7a614c61746e434e), /* za-Latn-CN */
-    static_cast<uint64_t>(0xe4064c61746e5344), /* zag-Latn-SD */
-    static_cast<uint64_t>(0xe469417261624b4d), /* zdj-Arab-KM */
-    static_cast<uint64_t>(0xe4804c61746e4e4c), /* zea-Latn-NL */
-    static_cast<uint64_t>(0xe4c754666e674d41), /* zgh-Tfng-MA */
-    static_cast<uint64_t>(0x7a6848616e73434e), /* zh-Hans-CN */
-    static_cast<uint64_t>(0x7a68426f706f5457), /* zh-Bopo-TW */
-    static_cast<uint64_t>(0x7a6848616e625457), /* zh-Hanb-TW */
-    static_cast<uint64_t>(0x7a6848616e745457), /* zh-Hant-TW */
-    static_cast<uint64_t>(0xe4f74e736875434e), /* zhx-Nshu-CN */
-    static_cast<uint64_t>(0xe5534b697473434e), /* zkt-Kits-CN */
-    static_cast<uint64_t>(0xe56c4c61746e5447), /* zlm-Latn-TG */
-    static_cast<uint64_t>(0xe5884c61746e4d59), /* zmi-Latn-MY */
-    static_cast<uint64_t>(0x7a754c61746e5a41), /* zu-Latn-ZA */
-    static_cast<uint64_t>(0xe7204c61746e5452), /* zza-Latn-TR */
-    static_cast<uint64_t>(0x656e4c61746e4742), /* en-Latn-GB */
-    static_cast<uint64_t>(0x65734c61746e4d58), /* es-Latn-MX */
-    static_cast<uint64_t>(0x65734c61746e5553), /* es-Latn-US */
+// Typical locales which are the default for their language and script, sorted ascending.
+constexpr std::array<uint64_t, 756> TYPICAL_CODES = {
+    0x61614c61746e4554, /* aa-Latn-ET */
+    0x61624379726c4745, /* ab-Cyrl-GE */
+    0x6165417673744952, /* ae-Avst-IR */
+    0x61664c61746e5a41, /* af-Latn-ZA */
+    0x616b4c61746e4748, /* ak-Latn-GH */
+    0x616d457468694554, /* am-Ethi-ET */
+    0x616e4c61746e4553, /* an-Latn-ES */
+    0x6172417261624547, /* ar-Arab-EG */
+    0x617342656e67494e, /* as-Beng-IN */
+    0x61764379726c5255, /* av-Cyrl-RU */
+    0x61794c61746e424f, /* ay-Latn-BO */
+    0x617a417261624952, /* az-Arab-IR */
+    0x617a4c61746e415a, /* az-Latn-AZ */
+    0x62614379726c5255, /* ba-Cyrl-RU */
+    0x62654379726c4259, /* be-Cyrl-BY */
+    0x62674379726c4247, /* bg-Cyrl-BG */
+    0x62694c61746e5655, /* bi-Latn-VU */
+    0x626d4c61746e4d4c, /* bm-Latn-ML */
+    0x626e42656e674244, /* bn-Beng-BD */
+    0x626f54696274434e, /* bo-Tibt-CN */
+    0x62724c61746e4652, /* br-Latn-FR */
+    0x62734c61746e4241, /* bs-Latn-BA */
+    0x63614c61746e4553, /* ca-Latn-ES */
+    0x63654379726c5255, /* ce-Cyrl-RU */
+    0x63684c61746e4755, /* ch-Latn-GU */
+    0x636f4c61746e4652, /* co-Latn-FR */
+    0x637243616e734341, /* cr-Cans-CA */
+    0x63734c61746e435a, /* cs-Latn-CZ */
+    0x63754379726c5255, /* cu-Cyrl-RU */
+    0x6375476c61674247, /* cu-Glag-BG */
+    0x63764379726c5255, /* cv-Cyrl-RU */
+    0x63794c61746e4742, /* cy-Latn-GB */
+    0x64614c61746e444b, /* da-Latn-DK */
+    0x64654c61746e4445, /* de-Latn-DE */
+    0x6476546861614d56, /* dv-Thaa-MV */
+    0x647a546962744254, /* dz-Tibt-BT */
+    0x65654c61746e4748, /* ee-Latn-GH */
+    0x656c4772656b4752, /* el-Grek-GR */
+    0x656e4c61746e4742, /* en-Latn-GB */
+    0x656e4c61746e5553, /* en-Latn-US */
+    0x656e536861774742, /* en-Shaw-GB */
+    0x65734c61746e4553, /* es-Latn-ES */
+    0x65734c61746e4d58, /* es-Latn-MX */
+    0x65734c61746e5553, /* es-Latn-US */
+    0x65744c61746e4545, /* et-Latn-EE */
+    0x65754c61746e4553, /* eu-Latn-ES */
+    0x6661417261624952, /* fa-Arab-IR */
+    0x666641646c6d474e, /* ff-Adlm-GN */
+    0x66664c61746e534e, /* ff-Latn-SN */
+    0x66694c61746e4649, /* fi-Latn-FI */
+    0x666a4c61746e464a, /* fj-Latn-FJ */
+    0x666f4c61746e464f, /* fo-Latn-FO */
+    0x66724c61746e4652, /* fr-Latn-FR */
+    0x66794c61746e4e4c, /* fy-Latn-NL */
+    0x67614c61746e4945, /* ga-Latn-IE */
+    0x67644c61746e4742, /* gd-Latn-GB */
+    0x676c4c61746e4553, /* gl-Latn-ES */
+    0x676e4c61746e5059, /* gn-Latn-PY */
+    0x677547756a72494e, /* gu-Gujr-IN */
+    0x67764c61746e494d, /* gv-Latn-IM */
+    0x68614c61746e4e47, /* ha-Latn-NG */
+    0x686548656272494c, /* he-Hebr-IL */
+    0x686944657661494e, /* hi-Deva-IN */
+    0x686f4c61746e5047, /* ho-Latn-PG */
+    0x68724c61746e4852, /* hr-Latn-HR */
+    0x68744c61746e4854, /* ht-Latn-HT */
+    0x68754c61746e4855, /* hu-Latn-HU */
+    0x687941726d6e414d, /* hy-Armn-AM */
+    0x687a4c61746e4e41, /* hz-Latn-NA */
+    0x69644c61746e4944, /* id-Latn-ID */
+    0x69674c61746e4e47, /* ig-Latn-NG */
+    0x696959696969434e, /* ii-Yiii-CN */
+    0x696b4c61746e5553, /* ik-Latn-US */
+    0x696e4c61746e4944, /* in-Latn-ID */
+    0x69734c61746e4953, /* is-Latn-IS */
+    0x69744c61746e4954, /* it-Latn-IT */
+    0x697543616e734341, /* iu-Cans-CA */
+    0x697748656272494c, /* iw-Hebr-IL */
+    0x6a614a70616e4a50, /* ja-Jpan-JP */
+    0x6a69486562725541, /* ji-Hebr-UA */
+    0x6a764c61746e4944, /* jv-Latn-ID */
+    0x6a774c61746e4944, /* jw-Latn-ID */
+    0x6b6147656f724745, /* ka-Geor-GE */
+    0x6b674c61746e4344, /* kg-Latn-CD */
+    0x6b694c61746e4b45, /* ki-Latn-KE */
+    0x6b6a4c61746e4e41, /* kj-Latn-NA */
+    0x6b6b41726162434e, /* kk-Arab-CN */
+    0x6b6b4379726c4b5a, /* kk-Cyrl-KZ */
+    0x6b6c4c61746e474c, /* kl-Latn-GL */
+    0x6b6d4b686d724b48, /* km-Khmr-KH */
+    0x6b6e4b6e6461494e, /* kn-Knda-IN */
+    0x6b6f4b6f72654b52, /* ko-Kore-KR */
+    0x6b7341726162494e, /* ks-Arab-IN */
+    0x6b75417261624951, /* ku-Arab-IQ */
+    0x6b754c61746e5452, /* ku-Latn-TR */
+    0x6b7559657a694745, /* ku-Yezi-GE */
+    0x6b764379726c5255, /* kv-Cyrl-RU */
+    0x6b774c61746e4742, /* kw-Latn-GB */
+    0x6b7941726162434e, /* ky-Arab-CN */
+    0x6b794379726c4b47, /* ky-Cyrl-KG */
+    0x6b794c61746e5452, /* ky-Latn-TR */
+    0x6c614c61746e5641, /* la-Latn-VA */
+    0x6c624c61746e4c55, /* lb-Latn-LU */
+    0x6c674c61746e5547, /* lg-Latn-UG */
+    0x6c694c61746e4e4c, /* li-Latn-NL */
+    0x6c6e4c61746e4344, /* ln-Latn-CD */
+    0x6c6f4c616f6f4c41, /* lo-Laoo-LA */
+    0x6c744c61746e4c54, /* lt-Latn-LT */
+    0x6c754c61746e4344, /* lu-Latn-CD */
+    0x6c764c61746e4c56, /* lv-Latn-LV */
+    0x6d674c61746e4d47, /* mg-Latn-MG */
+    0x6d684c61746e4d48, /* mh-Latn-MH */
+    0x6d694c61746e4e5a, /* mi-Latn-NZ */
+    0x6d6b4379726c4d4b, /* mk-Cyrl-MK */
+    0x6d6c4d6c796d494e, /* ml-Mlym-IN */
+    0x6d6e4379726c4d4e, /* mn-Cyrl-MN */
+    0x6d6e4d6f6e67434e, /* mn-Mong-CN */
+    0x6d6f4c61746e524f, /* mo-Latn-RO */
+    0x6d7244657661494e, /* mr-Deva-IN */
+    0x6d734c61746e4d59, /* ms-Latn-MY */
+    0x6d744c61746e4d54, /* mt-Latn-MT */
+    0x6d794d796d724d4d, /* my-Mymr-MM */
+    0x6e614c61746e4e52, /* na-Latn-NR */
+    0x6e624c61746e4e4f, /* nb-Latn-NO */
+    0x6e644c61746e5a57, /* nd-Latn-ZW */
+    0x6e65446576614e50, /* ne-Deva-NP */
+    0x6e674c61746e4e41, /* ng-Latn-NA */
+    0x6e6c4c61746e4e4c, /* nl-Latn-NL */
+    0x6e6e4c61746e4e4f, /* nn-Latn-NO */
+    0x6e6f4c61746e4e4f, /* no-Latn-NO */
+    0x6e724c61746e5a41, /* nr-Latn-ZA */
+    0x6e764c61746e5553, /* nv-Latn-US */
+    0x6e794c61746e4d57, /* ny-Latn-MW */
+    0x6f634c61746e4652, /* oc-Latn-FR */
+    0x6f6d4c61746e4554, /* om-Latn-ET */
+    0x6f724f727961494e, /* or-Orya-IN */
+    0x6f734379726c4745, /* os-Cyrl-GE */
+    0x706141726162504b, /* pa-Arab-PK */
+    0x706147757275494e, /* pa-Guru-IN */
+    0x706c4c61746e504c, /* pl-Latn-PL */
+    0x7073417261624146, /* ps-Arab-AF */
+    0x70744c61746e4252, /* pt-Latn-BR */
+    0x71754c61746e5045, /* qu-Latn-PE */
+    0x726d4c61746e4348, /* rm-Latn-CH */
+    0x726e4c61746e4249, /* rn-Latn-BI */
+    0x726f4c61746e524f, /* ro-Latn-RO */
+    0x72754379726c5255, /* ru-Cyrl-RU */
+    0x72774c61746e5257, /* rw-Latn-RW */
+    0x736144657661494e, /* sa-Deva-IN */
+    0x73634c61746e4954, /* sc-Latn-IT */
+    0x736441726162504b, /* sd-Arab-PK */
+    0x736444657661494e, /* sd-Deva-IN */
+    0x73644b686f6a494e, /* sd-Khoj-IN */
+    0x736453696e64494e, /* sd-Sind-IN */
+    0x73654c61746e4e4f, /* se-Latn-NO */
+    0x73674c61746e4346, /* sg-Latn-CF */
+    0x736953696e684c4b, /* si-Sinh-LK */
+    0x736b4c61746e534b, /* sk-Latn-SK */
+    0x736c4c61746e5349, /* sl-Latn-SI */
+    0x736d4c61746e5753, /* sm-Latn-WS */
+    0x736e4c61746e5a57, /* sn-Latn-ZW */
+    0x736f4c61746e534f, /* so-Latn-SO */
+    0x73714c61746e414c, /* sq-Latn-AL */
+    0x73724379726c5253, /* sr-Cyrl-RS */
+    0x73734c61746e5a41, /* ss-Latn-ZA */
+    0x73744c61746e5a41, /* st-Latn-ZA */
+    0x73754c61746e4944, /* su-Latn-ID */
+    0x73764c61746e5345, /* sv-Latn-SE */
+    0x73774c61746e545a, /* sw-Latn-TZ */
+    0x746154616d6c494e, /* ta-Taml-IN */
+    0x746554656c75494e, /* te-Telu-IN */
+    0x746741726162504b, /* tg-Arab-PK */
+    0x74674379726c544a, /* tg-Cyrl-TJ */
+    0x7468546861695448, /* th-Thai-TH */
+    0x7469457468694554, /* ti-Ethi-ET */
+    0x746b4c61746e544d, /* tk-Latn-TM */
+    0x746c4c61746e5048, /* tl-Latn-PH */
+    0x746e4c61746e5a41, /* tn-Latn-ZA */
+    0x746f4c61746e544f, /* to-Latn-TO */
+    0x74724c61746e5452, /* tr-Latn-TR */
+    0x74734c61746e5a41, /* ts-Latn-ZA */
+    0x74744379726c5255, /* tt-Cyrl-RU */
+    0x74794c61746e5046, /* ty-Latn-PF */
+    0x756741726162434e, /* ug-Arab-CN */
+    0x75674379726c4b5a, /* ug-Cyrl-KZ */
+    0x756b4379726c5541, /* uk-Cyrl-UA */
+    0x757241726162504b, /* ur-Arab-PK */
+    0x757a417261624146, /* uz-Arab-AF */
+    0x757a4c61746e555a, /* uz-Latn-UZ */
+    0x76654c61746e5a41, /* ve-Latn-ZA */
+    0x76694c61746e564e, /* vi-Latn-VN */
+    0x77614c61746e4245, /* wa-Latn-BE */
+    0x776f4c61746e534e, /* wo-Latn-SN */
+    0x78684c61746e5a41, /* xh-Latn-ZA */
+    0x796f4c61746e4e47, /* yo-Latn-NG */
+    0x7a614c61746e434e, /* za-Latn-CN */
+    0x7a68426f706f5457, /* zh-Bopo-TW */
+    0x7a6848616e625457, /* zh-Hanb-TW */
+    0x7a6848616e73434e, /* zh-Hans-CN */
+    0x7a6848616e745457, /* zh-Hant-TW */
+    0x7a754c61746e5a41, /* zu-Latn-ZA */
+    0x80314c61746e4748, /* abr-Latn-GH */
+    0x80444c61746e4944, /* ace-Latn-ID */
+    0x80474c61746e5547, /* ach-Latn-UG */
+    0x80604c61746e4748, /* ada-Latn-GH */
+    0x806f546962744254, /* adp-Tibt-BT */
+    0x80784379726c5255, /* ady-Cyrl-RU */
+    0x808141726162544e, /* aeb-Arab-TN */
+    0x80d04c61746e434d, /* agq-Latn-CM */
+    0x80ee41686f6d494e, /* aho-Ahom-IN */
+    0x814a587375784951, /* akk-Xsux-IQ */
+    0x816d4c61746e584b, /* aln-Latn-XK */
+    0x81734379726c5255, /* alt-Cyrl-RU */
+    0x818e4c61746e4e47, /* amo-Latn-NG */
+    0x81d94c61746e4944, /* aoz-Latn-ID */
+    0x81e3417261625447, /* apd-Arab-TG */
+    0x822241726d694952, /* arc-Armi-IR */
+    0x82224e6261744a4f, /* arc-Nbat-JO */
+    0x822250616c6d5359, /* arc-Palm-SY */
+    0x822d4c61746e434c, /* arn-Latn-CL */
+    0x822e4c61746e424f, /* aro-Latn-BO */
+    0x823041726162445a, /* arq-Arab-DZ */
+    0x8232417261625341, /* ars-Arab-SA */
+    0x8238417261624d41, /* ary-Arab-MA */
+    0x8239417261624547, /* arz-Arab-EG */
+    0x82404c61746e545a, /* asa-Latn-TZ */
+    0x824453676e775553, /* ase-Sgnw-US */
+    0x82534c61746e4553, /* ast-Latn-ES */
+    0x82694c61746e4341, /* atj-Latn-CA */
+    0x82c044657661494e, /* awa-Deva-IN */
+    0x840b41726162504b, /* bal-Arab-PK */
+    0x840d4c61746e4944, /* ban-Latn-ID */
+    0x840f446576614e50, /* bap-Deva-NP */
+    0x84114c61746e4154, /* bar-Latn-AT */
+    0x84124c61746e434d, /* bas-Latn-CM */
+    0x841742616d75434d, /* bax-Bamu-CM */
+    0x84224c61746e4944, /* bbc-Latn-ID */
+    0x84294c61746e434d, /* bbj-Latn-CM */
+    0x84484c61746e4349, /* bci-Latn-CI */
+    0x8489417261625344, /* bej-Arab-SD */
+    0x848c4c61746e5a4d, /* bem-Latn-ZM */
+    0x84964c61746e4944, /* bew-Latn-ID */
+    0x84994c61746e545a, /* bez-Latn-TZ */
+    0x84a34c61746e434d, /* bfd-Latn-CM */
+    0x84b054616d6c494e, /* bfq-Taml-IN */
+    0x84b341726162504b, /* bft-Arab-PK */
+    0x84b844657661494e, /* bfy-Deva-IN */
+    0x84c244657661494e, /* bgc-Deva-IN */
+    0x84cd41726162504b, /* bgn-Arab-PK */
+    0x84d74772656b5452, /* bgx-Grek-TR */
+    0x84e144657661494e, /* bhb-Deva-IN */
+    0x84e844657661494e, /* bhi-Deva-IN */
+    0x84ee44657661494e, /* bho-Deva-IN */
+    0x850a4c61746e5048, /* bik-Latn-PH */
+    0x850d4c61746e4e47, /* bin-Latn-NG */
+    0x852944657661494e, /* bjj-Deva-IN */
+    0x852d4c61746e4944, /* bjn-Latn-ID */
+    0x85334c61746e534e, /* bjt-Latn-SN */
+    0x854c4c61746e434d, /* bkm-Latn-CM */
+    0x85544c61746e5048, /* bku-Latn-PH */
+    0x857354617674564e, /* blt-Tavt-VN */
+    0x85904c61746e4d4c, /* bmq-Latn-ML */
+    0x85f842656e67494e, /* bpy-Beng-IN */
+    0x8608417261624952, /* bqi-Arab-IR */
+    0x86154c61746e4349, /* bqv-Latn-CI */
+    0x862044657661494e, /* bra-Deva-IN */
+    0x862741726162504b, /* brh-Arab-PK */
+    0x863744657661494e, /* brx-Deva-IN */
+    0x8650426173734c52, /* bsq-Bass-LR */
+    0x86524c61746e434d, /* bss-Latn-CM */
+    0x866e4c61746e5048, /* bto-Latn-PH */
+    0x867544657661504b, /* btv-Deva-PK */
+    0x86804379726c5255, /* bua-Cyrl-RU */
+    0x86824c61746e5954, /* buc-Latn-YT */
+    0x86864c61746e4944, /* bug-Latn-ID */
+    0x868c4c61746e434d, /* bum-Latn-CM */
+    0x86a14c61746e4751, /* bvb-Latn-GQ */
+    0x870d457468694552, /* byn-Ethi-ER */
+    0x87154c61746e434d, /* byv-Latn-CM */
+    0x87244c61746e4d4c, /* bze-Latn-ML */
+    0x88034c61746e5553, /* cad-Latn-US */
+    0x88474c61746e4e47, /* cch-Latn-NG */
+    0x884f43616b6d4244, /* ccp-Cakm-BD */
+    0x88814c61746e5048, /* ceb-Latn-PH */
+    0x88c64c61746e5547, /* cgg-Latn-UG */
+    0x88ea4c61746e464d, /* chk-Latn-FM */
+    0x88ec4379726c5255, /* chm-Cyrl-RU */
+    0x88ee4c61746e5553, /* cho-Latn-US */
+    0x88ef4c61746e4341, /* chp-Latn-CA */
+    0x88f1436865725553, /* chr-Cher-US */
+    0x89024c61746e5553, /* cic-Latn-US */
+    0x8920417261624b48, /* cja-Arab-KH */
+    0x892c4368616d564e, /* cjm-Cham-VN */
+    0x8941417261624951, /* ckb-Arab-IQ */
+    0x8986536f796f4d4e, /* cmg-Soyo-MN */
+    0x89cf436f70744547, /* cop-Copt-EG */
+    0x89f24c61746e5048, /* cps-Latn-PH */
+    0x8a274379726c5541, /* crh-Cyrl-UA */
+    0x8a2943616e734341, /* crj-Cans-CA */
+    0x8a2a43616e734341, /* crk-Cans-CA */
+    0x8a2b43616e734341, /* crl-Cans-CA */
+    0x8a2c43616e734341, /* crm-Cans-CA */
+    0x8a324c61746e5343, /* crs-Latn-SC */
+    0x8a414c61746e504c, /* csb-Latn-PL */
+    0x8a5643616e734341, /* csw-Cans-CA */
+    0x8a63506175634d4d, /* ctd-Pauc-MM */
+    0x8c054c61746e4349, /* daf-Latn-CI */
+    0x8c0a4c61746e5553, /* dak-Latn-US */
+    0x8c114379726c5255, /* dar-Cyrl-RU */
+    0x8c154c61746e4b45, /* dav-Latn-KE */
+    0x8c4241726162494e, /* dcc-Arab-IN */
+    0x8c8d4c61746e4341, /* den-Latn-CA */
+    0x8cd14c61746e4341, /* dgr-Latn-CA */
+    0x8d244c61746e4e45, /* dje-Latn-NE */
+    0x8da94c61746e4349, /* dnj-Latn-CI */
+    0x8dc844657661494e, /* doi-Deva-IN */
+    0x8e274d6f6e67434e, /* drh-Mong-CN */
+    0x8e414c61746e4445, /* dsb-Latn-DE */
+    0x8e6c4c61746e4d4c, /* dtm-Latn-ML */
+    0x8e6f4c61746e4d59, /* dtp-Latn-MY */
+    0x8e78446576614e50, /* dty-Deva-NP */
+    0x8e804c61746e434d, /* dua-Latn-CM */
+    0x8f0e4c61746e534e, /* dyo-Latn-SN */
+    0x8f144c61746e4246, /* dyu-Latn-BF */
+    0x90344c61746e4b45, /* ebu-Latn-KE */
+    0x90a84c61746e4e47, /* efi-Latn-NG */
+    0x90cb4c61746e4954, /* egl-Latn-IT */
+    0x90d8456779704547, /* egy-Egyp-EG */
+    0x91584b616c694d4d, /* eky-Kali-MM */
+    0x9246476f6e6d494e, /* esg-Gonm-IN */
+    0x92544c61746e5553, /* esu-Latn-US */
+    0x92734974616c4954, /* ett-Ital-IT */
+    0x92ce4c61746e434d, /* ewo-Latn-CM */
+    0x92f34c61746e4553, /* ext-Latn-ES */
+    0x940d4c61746e4751, /* fan-Latn-GQ */
+    0x94ac4c61746e4d4c, /* ffm-Latn-ML */
+    0x9500417261625344, /* fia-Arab-SD */
+    0x950b4c61746e5048, /* fil-Latn-PH */
+    0x95134c61746e5345, /* fit-Latn-SE */
+    0x95cd4c61746e424a, /* fon-Latn-BJ */
+    0x96224c61746e5553, /* frc-Latn-US */
+    0x962f4c61746e4652, /* frp-Latn-FR */
+    0x96314c61746e4445, /* frr-Latn-DE */
+    0x96324c61746e4445, /* frs-Latn-DE */
+    0x968141726162434d, /* fub-Arab-CM */
+    0x96834c61746e5746, /* fud-Latn-WF */
+    0x96854c61746e474e, /* fuf-Latn-GN */
+    0x96904c61746e4e45, /* fuq-Latn-NE */
+    0x96914c61746e4954, /* fur-Latn-IT */
+    0x96954c61746e4e47, /* fuv-Latn-NG */
+    0x96b14c61746e5344, /* fvr-Latn-SD */
+    0x98004c61746e4748, /* gaa-Latn-GH */
+    0x98064c61746e4d44, /* gag-Latn-MD */
+    0x980d48616e73434e, /* gan-Hans-CN */
+    0x98184c61746e4944, /* gay-Latn-ID */
+    0x982c44657661494e, /* gbm-Deva-IN */
+    0x9839417261624952, /* gbz-Arab-IR */
+    0x98514c61746e4746, /* gcr-Latn-GF */
+    0x9899457468694554, /* gez-Ethi-ET */
+    0x98cd446576614e50, /* ggn-Deva-NP */
+    0x990b4c61746e4b49, /* gil-Latn-KI */
+    0x992a41726162504b, /* gjk-Arab-PK */
+    0x993441726162504b, /* gju-Arab-PK */
+    0x996a417261624952, /* glk-Arab-IR */
+    0x99cc44657661494e, /* gom-Deva-IN */
+    0x99cd54656c75494e, /* gon-Telu-IN */
+    0x99d14c61746e4944, /* gor-Latn-ID */
+    0x99d24c61746e4e4c, /* gos-Latn-NL */
+    0x99d3476f74685541, /* got-Goth-UA */
+    0x9a22437072744359, /* grc-Cprt-CY */
+    0x9a224c696e624752, /* grc-Linb-GR */
+    0x9a3342656e67494e, /* grt-Beng-IN */
+    0x9a564c61746e4348, /* gsw-Latn-CH */
+    0x9a814c61746e4252, /* gub-Latn-BR */
+    0x9a824c61746e434f, /* guc-Latn-CO */
+    0x9a914c61746e4748, /* gur-Latn-GH */
+    0x9a994c61746e4b45, /* guz-Latn-KE */
+    0x9ab1446576614e50, /* gvr-Deva-NP */
+    0x9ac84c61746e4341, /* gwi-Latn-CA */
+    0x9c0a48616e73434e, /* hak-Hans-CN */
+    0x9c164c61746e5553, /* haw-Latn-US */
+    0x9c19417261624146, /* haz-Arab-AF */
+    0x9d054c61746e464a, /* hif-Latn-FJ */
+    0x9d0b4c61746e5048, /* hil-Latn-PH */
+    0x9d74486c75775452, /* hlu-Hluw-TR */
+    0x9d83506c7264434e, /* hmd-Plrd-CN */
+    0x9da341726162504b, /* hnd-Arab-PK */
+    0x9da444657661494e, /* hne-Deva-IN */
+    0x9da9486d6e674c41, /* hnj-Hmng-LA */
+    0x9dad4c61746e5048, /* hnn-Latn-PH */
+    0x9dae41726162504b, /* hno-Arab-PK */
+    0x9dc244657661494e, /* hoc-Deva-IN */
+    0x9dc944657661494e, /* hoj-Deva-IN */
+    0x9e414c61746e4445, /* hsb-Latn-DE */
+    0x9e4d48616e73434e, /* hsn-Hans-CN */
+    0xa0204c61746e4d59, /* iba-Latn-MY */
+    0xa0214c61746e4e47, /* ibb-Latn-NG */
+    0xa0a44c61746e5447, /* ife-Latn-TG */
+    0xa1534c61746e4341, /* ikt-Latn-CA */
+    0xa16e4c61746e5048, /* ilo-Latn-PH */
+    0xa1a74379726c5255, /* inh-Cyrl-RU */
+    0xa3274c61746e5255, /* izh-Latn-RU */
+    0xa40c4c61746e4a4d, /* jam-Latn-JM */
+    0xa4ce4c61746e434d, /* jgo-Latn-CM */
+    0xa5824c61746e545a, /* jmc-Latn-TZ */
+    0xa58b446576614e50, /* jml-Deva-NP */
+    0xa6934c61746e444b, /* jut-Latn-DK */
+    0xa8004379726c555a, /* kaa-Cyrl-UZ */
+    0xa8014c61746e445a, /* kab-Latn-DZ */
+    0xa8024c61746e4d4d, /* kac-Latn-MM */
+    0xa8094c61746e4e47, /* kaj-Latn-NG */
+    0xa80c4c61746e4b45, /* kam-Latn-KE */
+    0xa80e4c61746e4d4c, /* kao-Latn-ML */
+    0xa8234379726c5255, /* kbd-Cyrl-RU */
+    0xa838417261624e45, /* kby-Arab-NE */
+    0xa8464c61746e4e47, /* kcg-Latn-NG */
+    0xa84a4c61746e5a57, /* kck-Latn-ZW */
+    0xa8644c61746e545a, /* kde-Latn-TZ */
+    0xa867417261625447, /* kdh-Arab-TG */
+    0xa873546861695448, /* kdt-Thai-TH */
+    0xa8804c61746e4356, /* kea-Latn-CV */
+    0xa88d4c61746e434d, /* ken-Latn-CM */
+    0xa8ae4c61746e4349, /* kfo-Latn-CI */
+    0xa8b144657661494e, /* kfr-Deva-IN */
+    0xa8b844657661494e, /* kfy-Deva-IN */
+    0xa8c44c61746e4944, /* kge-Latn-ID */
+    0xa8cf4c61746e4252, /* kgp-Latn-BR */
+    0xa8e04c61746e494e, /* kha-Latn-IN */
+    0xa8e154616c75434e, /* khb-Talu-CN */
+    0xa8ed44657661494e, /* khn-Deva-IN */
+    0xa8f04c61746e4d4c, /* khq-Latn-ML */
+    0xa8f34d796d72494e, /* kht-Mymr-IN */
+    0xa8f641726162504b, /* khw-Arab-PK */
+    0xa9144c61746e5452, /* kiu-Latn-TR */
+    0xa9264c616f6f4c41, /* kjg-Laoo-LA */
+    0xa9494c61746e434d, /* kkj-Latn-CM */
+    0xa96d4c61746e4b45, /* kln-Latn-KE */
+    0xa9814c61746e414f, /* kmb-Latn-AO */
+    0xa9a54c61746e4757, /* knf-Latn-GW */
+    0xa9c84379726c5255, /* koi-Cyrl-RU */
+    0xa9ca44657661494e, /* kok-Deva-IN */
+    0xa9d24c61746e464d, /* kos-Latn-FM */
+    0xa9e44c61746e4c52, /* kpe-Latn-LR */
+    0xaa224379726c5255, /* krc-Cyrl-RU */
+    0xaa284c61746e534c, /* kri-Latn-SL */
+    0xaa294c61746e5048, /* krj-Latn-PH */
+    0xaa2b4c61746e5255, /* krl-Latn-RU */
+    0xaa3444657661494e, /* kru-Deva-IN */
+    0xaa414c61746e545a, /* ksb-Latn-TZ */
+    0xaa454c61746e434d, /* ksf-Latn-CM */
+    0xaa474c61746e4445, /* ksh-Latn-DE */
+    0xaa714c61746e4d59, /* ktr-Latn-MY */
+    0xaa8c4379726c5255, /* kum-Cyrl-RU */
+    0xaab14c61746e4944, /* kvr-Latn-ID */
+    0xaab741726162504b, /* kvx-Arab-PK */
+    0xaaeb44657661494e, /* kxl-Deva-IN */
+    0xaaec546861695448, /* kxm-Thai-TH */
+    0xaaef41726162504b, /* kxp-Arab-PK */
+    0xab294c61746e4d59, /* kzj-Latn-MY */
+    0xab334c61746e4d59, /* kzt-Latn-MY */
+    0xac014c696e614752, /* lab-Lina-GR */
+    0xac0348656272494c, /* lad-Hebr-IL */
+    0xac064c61746e545a, /* lag-Latn-TZ */
+    0xac0741726162504b, /* lah-Arab-PK */
+    0xac094c61746e5547, /* laj-Latn-UG */
+    0xac244379726c5255, /* lbe-Cyrl-RU */
+    0xac364c61746e4944, /* lbw-Latn-ID */
+    0xac4f54686169434e, /* lcp-Thai-CN */
+    0xac8f4c657063494e, /* lep-Lepc-IN */
+    0xac994379726c5255, /* lez-Cyrl-RU */
+    0xad05446576614e50, /* lif-Deva-NP */
+    0xad054c696d62494e, /* lif-Limb-IN */
+    0xad094c61746e4954, /* lij-Latn-IT */
+    0xad124c697375434e, /* lis-Lisu-CN */
+    0xad2f4c61746e4944, /* ljp-Latn-ID */
+    0xad48417261624952, /* lki-Arab-IR */
+    0xad534c61746e5553, /* lkt-Latn-US */
+    0xad8d54656c75494e, /* lmn-Telu-IN */
+    0xad8e4c61746e4954, /* lmo-Latn-IT */
+    0xadcb4c61746e4344, /* lol-Latn-CD */
+    0xadd94c61746e5a4d, /* loz-Latn-ZM */
+    0xae22417261624952, /* lrc-Arab-IR */
+    0xae664c61746e4c56, /* ltg-Latn-LV */
+    0xae804c61746e4344, /* lua-Latn-CD */
+    0xae8e4c61746e4b45, /* luo-Latn-KE */
+    0xae984c61746e4b45, /* luy-Latn-KE */
+    0xae99417261624952, /* luz-Arab-IR */
+    0xaecb546861695448, /* lwl-Thai-TH */
+    0xaf2748616e73434e, /* lzh-Hans-CN */
+    0xaf394c61746e5452, /* lzz-Latn-TR */
+    0xb0034c61746e4944, /* mad-Latn-ID */
+    0xb0054c61746e434d, /* maf-Latn-CM */
+    0xb00644657661494e, /* mag-Deva-IN */
+    0xb00844657661494e, /* mai-Deva-IN */
+    0xb00a4c61746e4944, /* mak-Latn-ID */
+    0xb00d4c61746e474d, /* man-Latn-GM */
+    0xb00d4e6b6f6f474e, /* man-Nkoo-GN */
+    0xb0124c61746e4b45, /* mas-Latn-KE */
+    0xb0194c61746e4d58, /* maz-Latn-MX */
+    0xb0654379726c5255, /* mdf-Cyrl-RU */
+    0xb0674c61746e5048, /* mdh-Latn-PH */
+    0xb0714c61746e4944, /* mdr-Latn-ID */
+    0xb08d4c61746e534c, /* men-Latn-SL */
+    0xb0914c61746e4b45, /* mer-Latn-KE */
+    0xb0a0417261625448, /* mfa-Arab-TH */
+    0xb0a44c61746e4d55, /* mfe-Latn-MU */
+    0xb0c74c61746e4d5a, /* mgh-Latn-MZ */
+    0xb0ce4c61746e434d, /* mgo-Latn-CM */
+    0xb0cf446576614e50, /* mgp-Deva-NP */
+    0xb0d84c61746e545a, /* mgy-Latn-TZ */
+    0xb10d4c61746e4944, /* min-Latn-ID */
+    0xb112486174724951, /* mis-Hatr-IQ */
+    0xb1124d6564664e47, /* mis-Medf-NG */
+    0xb1724c61746e5344, /* mls-Latn-SD */
+    0xb1a842656e67494e, /* mni-Beng-IN */
+    0xb1b64d796d724d4d, /* mnw-Mymr-MM */
+    0xb1c44c61746e4341, /* moe-Latn-CA */
+    0xb1c74c61746e4341, /* moh-Latn-CA */
+    0xb1d24c61746e4246, /* mos-Latn-BF */
+    0xb223446576614e50, /* mrd-Deva-NP */
+    0xb2294379726c5255, /* mrj-Cyrl-RU */
+    0xb22e4d726f6f4244, /* mro-Mroo-BD */
+    0xb27144657661494e, /* mtr-Deva-IN */
+    0xb2804c61746e434d, /* mua-Latn-CM */
+    0xb2924c61746e5553, /* mus-Latn-US */
+    0xb2b841726162504b, /* mvy-Arab-PK */
+    0xb2ca4c61746e4d4c, /* mwk-Latn-ML */
+    0xb2d144657661494e, /* mwr-Deva-IN */
+    0xb2d54c61746e4944, /* mwv-Latn-ID */
+    0xb2d6486d6e705553, /* mww-Hmnp-US */
+    0xb2e24c61746e5a57, /* mxc-Latn-ZW */
+    0xb3154379726c5255, /* myv-Cyrl-RU */
+    0xb3174c61746e5547, /* myx-Latn-UG */
+    0xb3194d616e644952, /* myz-Mand-IR */
+    0xb32d417261624952, /* mzn-Arab-IR */
+    0xb40d48616e73434e, /* nan-Hans-CN */
+    0xb40f4c61746e4954, /* nap-Latn-IT */
+    0xb4104c61746e4e41, /* naq-Latn-NA */
+    0xb4474c61746e4d58, /* nch-Latn-MX */
+    0xb4624c61746e4d5a, /* ndc-Latn-MZ */
+    0xb4724c61746e4445, /* nds-Latn-DE */
+    0xb496446576614e50, /* new-Deva-NP */
+    0xb4cb4c61746e4d5a, /* ngl-Latn-MZ */
+    0xb4e44c61746e4d58, /* nhe-Latn-MX */
+    0xb4f64c61746e4d58, /* nhw-Latn-MX */
+    0xb5094c61746e4944, /* nij-Latn-ID */
+    0xb5144c61746e4e55, /* niu-Latn-NU */
+    0xb52e4c61746e494e, /* njo-Latn-IN */
+    0xb5864c61746e434d, /* nmg-Latn-CM */
+    0xb5a74c61746e434d, /* nnh-Latn-CM */
+    0xb5af5763686f494e, /* nnp-Wcho-IN */
+    0xb5c34c616e615448, /* nod-Lana-TH */
+    0xb5c444657661494e, /* noe-Deva-IN */
+    0xb5cd52756e725345, /* non-Runr-SE */
+    0xb60e4e6b6f6f474e, /* nqo-Nkoo-GN */
+    0xb64a43616e734341, /* nsk-Cans-CA */
+    0xb64e4c61746e5a41, /* nso-Latn-ZA */
+    0xb6924c61746e5353, /* nus-Latn-SS */
+    0xb6f04c61746e434e, /* nxq-Latn-CN */
+    0xb70c4c61746e545a, /* nym-Latn-TZ */
+    0xb70d4c61746e5547, /* nyn-Latn-UG */
+    0xb7284c61746e4748, /* nzi-Latn-GH */
+    0xba404f7367655553, /* osa-Osge-US */
+    0xba6a4f726b684d4e, /* otk-Orkh-MN */
+    0xbc064c61746e5048, /* pag-Latn-PH */
+    0xbc0b50686c694952, /* pal-Phli-IR */
+    0xbc0b50686c70434e, /* pal-Phlp-CN */
+    0xbc0c4c61746e5048, /* pam-Latn-PH */
+    0xbc0f4c61746e4157, /* pap-Latn-AW */
+    0xbc144c61746e5057, /* pau-Latn-PW */
+    0xbc434c61746e4652, /* pcd-Latn-FR */
+    0xbc4c4c61746e4e47, /* pcm-Latn-NG */
+    0xbc624c61746e5553, /* pdc-Latn-US */
+    0xbc734c61746e4341, /* pdt-Latn-CA */
+    0xbc8e5870656f4952, /* peo-Xpeo-IR */
+    0xbcab4c61746e4445, /* pfl-Latn-DE */
+    0xbced50686e784c42, /* phn-Phnx-LB */
+    0xbd4042726168494e, /* pka-Brah-IN */
+    0xbd4e4c61746e4b45, /* pko-Latn-KE */
+    0xbd924c61746e4954, /* pms-Latn-IT */
+    0xbdb34772656b4752, /* pnt-Grek-GR */
+    0xbdcd4c61746e464d, /* pon-Latn-FM */
+    0xbde044657661494e, /* ppa-Deva-IN */
+    0xbe204b686172504b, /* pra-Khar-PK */
+    0xbe23417261624952, /* prd-Arab-IR */
+    0xbe944c61746e4741, /* puu-Latn-GA */
+    0xc2824c61746e4754, /* quc-Latn-GT */
+    0xc2864c61746e4543, /* qug-Latn-EC */
+    0xc40944657661494e, /* raj-Deva-IN */
+    0xc4454c61746e5245, /* rcf-Latn-RE */
+    0xc4894c61746e4944, /* rej-Latn-ID */
+    0xc4cd4c61746e4954, /* rgn-Latn-IT */
+    0xc4e6417261624d4d, /* rhg-Arab-MM */
+    0xc5004c61746e494e, /* ria-Latn-IN */
+    0xc50554666e674d41, /* rif-Tfng-MA */
+    0xc532446576614e50, /* rjs-Deva-NP */
+    0xc55342656e674244, /* rkt-Beng-BD */
+    0xc5854c61746e4649, /* rmf-Latn-FI */
+    0xc58e4c61746e4348, /* rmo-Latn-CH */
+    0xc593417261624952, /* rmt-Arab-IR */
+    0xc5944c61746e5345, /* rmu-Latn-SE */
+    0xc5a64c61746e4d5a, /* rng-Latn-MZ */
+    0xc5c14c61746e4944, /* rob-Latn-ID */
+    0xc5c54c61746e545a, /* rof-Latn-TZ */
+    0xc66c4c61746e464a, /* rtm-Latn-FJ */
+    0xc6844379726c5541, /* rue-Cyrl-UA */
+    0xc6864c61746e5342, /* rug-Latn-SB */
+    0xc6ca4c61746e545a, /* rwk-Latn-TZ */
+    0xc7144b616e614a50, /* ryu-Kana-JP */
+    0xc8054c61746e4748, /* saf-Latn-GH */
+    0xc8074379726c5255, /* sah-Cyrl-RU */
+    0xc8104c61746e4b45, /* saq-Latn-KE */
+    0xc8124c61746e4944, /* sas-Latn-ID */
+    0xc8134f6c636b494e, /* sat-Olck-IN */
+    0xc8154c61746e534e, /* sav-Latn-SN */
+    0xc81953617572494e, /* saz-Saur-IN */
+    0xc82f4c61746e545a, /* sbp-Latn-TZ */
+    0xc84a44657661494e, /* sck-Deva-IN */
+    0xc84d4c61746e4954, /* scn-Latn-IT */
+    0xc84e4c61746e4742, /* sco-Latn-GB */
+    0xc8524c61746e4341, /* scs-Latn-CA */
+    0xc8624c61746e4954, /* sdc-Latn-IT */
+    0xc867417261624952, /* sdh-Arab-IR */
+    0xc8854c61746e4349, /* sef-Latn-CI */
+    0xc8874c61746e4d5a, /* seh-Latn-MZ */
+    0xc8884c61746e4d58, /* sei-Latn-MX */
+    0xc8924c61746e4d4c, /* ses-Latn-ML */
+    0xc8c04f67616d4945, /* sga-Ogam-IE */
+    0xc8d24c61746e4c54, /* sgs-Latn-LT */
+    0xc8e854666e674d41, /* shi-Tfng-MA */
+    0xc8ed4d796d724d4d, /* shn-Mymr-MM */
+    0xc9034c61746e4554, /* sid-Latn-ET */
+    0xc95141726162504b, /* skr-Arab-PK */
+    0xc9684c61746e504c, /* sli-Latn-PL */
+    0xc9784c61746e4944, /* sly-Latn-ID */
+    0xc9804c61746e5345, /* sma-Latn-SE */
+    0xc9894c61746e5345, /* smj-Latn-SE */
+    0xc98d4c61746e4649, /* smn-Latn-FI */
+    0xc98f53616d72494c, /* smp-Samr-IL */
+    0xc9924c61746e4649, /* sms-Latn-FI */
+    0xc9aa4c61746e4d4c, /* snk-Latn-ML */
+    0xc9c6536f6764555a, /* sog-Sogd-UZ */
+    0xc9d4546861695448, /* sou-Thai-TH */
+    0xca21536f7261494e, /* srb-Sora-IN */
+    0xca2d4c61746e5352, /* srn-Latn-SR */
+    0xca314c61746e534e, /* srr-Latn-SN */
+    0xca3744657661494e, /* srx-Deva-IN */
+    0xca584c61746e4552, /* ssy-Latn-ER */
+    0xca704c61746e4445, /* stq-Latn-DE */
+    0xca8a4c61746e545a, /* suk-Latn-TZ */
+    0xca924c61746e474e, /* sus-Latn-GN */
+    0xcac1417261625954, /* swb-Arab-YT */
+    0xcac24c61746e4344, /* swc-Latn-CD */
+    0xcac64c61746e4445, /* swg-Latn-DE */
+    0xcad544657661494e, /* swv-Deva-IN */
+    0xcaed4c61746e4944, /* sxn-Latn-ID */
+    0xcb0b42656e674244, /* syl-Beng-BD */
+    0xcb11537972634951, /* syr-Syrc-IQ */
+    0xcb2b4c61746e504c, /* szl-Latn-PL */
+    0xcc09446576614e50, /* taj-Deva-NP */
+    0xcc364c61746e5048, /* tbw-Latn-PH */
+    0xcc584b6e6461494e, /* tcy-Knda-IN */
+    0xcc6354616c65434e, /* tdd-Tale-CN */
+    0xcc66446576614e50, /* tdg-Deva-NP */
+    0xcc67446576614e50, /* tdh-Deva-NP */
+    0xcc744c61746e4d59, /* tdu-Latn-MY */
+    0xcc8c4c61746e534c, /* tem-Latn-SL */
+    0xcc8e4c61746e5547, /* teo-Latn-UG */
+    0xcc934c61746e544c, /* tet-Latn-TL */
+    0xcceb446576614e50, /* thl-Deva-NP */
+    0xccf0446576614e50, /* thq-Deva-NP */
+    0xccf1446576614e50, /* thr-Deva-NP */
+    0xcd06457468694552, /* tig-Ethi-ER */
+    0xcd154c61746e4e47, /* tiv-Latn-NG */
+    0xcd4b4c61746e544b, /* tkl-Latn-TK */
+    0xcd514c61746e415a, /* tkr-Latn-AZ */
+    0xcd53446576614e50, /* tkt-Deva-NP */
+    0xcd784c61746e415a, /* tly-Latn-AZ */
+    0xcd874c61746e4e45, /* tmh-Latn-NE */
+    0xcdc64c61746e4d57, /* tog-Latn-MW */
+    0xcde84c61746e5047, /* tpi-Latn-PG */
+    0xce344c61746e5452, /* tru-Latn-TR */
+    0xce354c61746e5457, /* trv-Latn-TW */
+    0xce3641726162504b, /* trw-Arab-PK */
+    0xce434772656b4752, /* tsd-Grek-GR */
+    0xce45446576614e50, /* tsf-Deva-NP */
+    0xce464c61746e5048, /* tsg-Latn-PH */
+    0xce49546962744254, /* tsj-Tibt-BT */
+    0xce694c61746e5547, /* ttj-Latn-UG */
+    0xce72546861695448, /* tts-Thai-TH */
+    0xce734c61746e415a, /* ttt-Latn-AZ */
+    0xce8c4c61746e4d57, /* tum-Latn-MW */
+    0xceab4c61746e5456, /* tvl-Latn-TV */
+    0xced04c61746e4e45, /* twq-Latn-NE */
+    0xcee654616e67434e, /* txg-Tang-CN */
+    0xcf154379726c5255, /* tyv-Cyrl-RU */
+    0xcf2c4c61746e4d41, /* tzm-Latn-MA */
+    0xd06c4379726c5255, /* udm-Cyrl-RU */
+    0xd0c0556761725359, /* uga-Ugar-SY */
+    0xd1684c61746e464d, /* uli-Latn-FM */
+    0xd1814c61746e414f, /* umb-Latn-AO */
+    0xd1b142656e67494e, /* unr-Beng-IN */
+    0xd1b1446576614e50, /* unr-Deva-NP */
+    0xd1b742656e67494e, /* unx-Beng-IN */
+    0xd408566169694c52, /* vai-Vaii-LR */
+    0xd4824c61746e4954, /* vec-Latn-IT */
+    0xd48f4c61746e5255, /* vep-Latn-RU */
+    0xd5024c61746e5358, /* vic-Latn-SX */
+    0xd5724c61746e4245, /* vls-Latn-BE */
+    0xd5854c61746e4445, /* vmf-Latn-DE */
+    0xd5964c61746e4d5a, /* vmw-Latn-MZ */
+    0xd5d34c61746e5255, /* vot-Latn-RU */
+    0xd62e4c61746e4545, /* vro-Latn-EE */
+    0xd68d4c61746e545a, /* vun-Latn-TZ */
+    0xd8044c61746e4348, /* wae-Latn-CH */
+    0xd80b457468694554, /* wal-Ethi-ET */
+    0xd8114c61746e5048, /* war-Latn-PH */
+    0xd82f4c61746e4155, /* wbp-Latn-AU */
+    0xd83054656c75494e, /* wbq-Telu-IN */
+    0xd83144657661494e, /* wbr-Deva-IN */
+    0xd9724c61746e5746, /* wls-Latn-WF */
+    0xd9a8417261624b4d, /* wni-Arab-KM */
+    0xda46476f6e67494e, /* wsg-Gong-IN */
+    0xda6c44657661494e, /* wtm-Deva-IN */
+    0xda9448616e73434e, /* wuu-Hans-CN */
+    0xdc154c61746e4252, /* xav-Latn-BR */
+    0xdc4e43687273555a, /* xco-Chrs-UZ */
+    0xdc51436172695452, /* xcr-Cari-TR */
+    0xdd624c7963695452, /* xlc-Lyci-TR */
+    0xdd634c7964695452, /* xld-Lydi-TR */
+    0xdd8547656f724745, /* xmf-Geor-GE */
+    0xdd8d4d616e69434e, /* xmn-Mani-CN */
+    0xdd914d6572635344, /* xmr-Merc-SD */
+    0xdda04e6172625341, /* xna-Narb-SA */
+    0xddb144657661494e, /* xnr-Deva-IN */
+    0xddc64c61746e5547, /* xog-Latn-UG */
+    0xddf1507274694952, /* xpr-Prti-IR */
+    0xde40536172625945, /* xsa-Sarb-YE */
+    0xde51446576614e50, /* xsr-Deva-NP */
+    0xe00e4c61746e4d5a, /* yao-Latn-MZ */
+    0xe00f4c61746e464d, /* yap-Latn-FM */
+    0xe0154c61746e434d, /* yav-Latn-CM */
+    0xe0214c61746e434d, /* ybb-Latn-CM */
+    0xe22b4c61746e4252, /* yrl-Latn-BR */
+    0xe2804c61746e4d58, /* yua-Latn-MX */
+    0xe28448616e73434e, /* yue-Hans-CN */
+    0xe28448616e74484b, /* yue-Hant-HK */
+    0xe4064c61746e5344, /* zag-Latn-SD */
+    0xe469417261624b4d, /* zdj-Arab-KM */
+    0xe4804c61746e4e4c, /* zea-Latn-NL */
+    0xe4c754666e674d41, /* zgh-Tfng-MA */
+    0xe4f74e736875434e, /* zhx-Nshu-CN */
+    0xe5534b697473434e, /* zkt-Kits-CN */
+    0xe56c4c61746e5447, /* zlm-Latn-TG */
+    0xe5884c61746e4d59, /* zmi-Latn-MY */
+    0xe7204c61746e5452, /* zza-Latn-TR */
 };
 
-const std::vector<uint64_t> LocaleData::LIKELY_TAGS_CODES_KEY = {
-    static_cast<uint64_t>(0x6161000000000000), /* aa */
-    static_cast<uint64_t>(0x8008000000000000), /* aai */
-    static_cast<uint64_t>(0x800a000000000000), /* aak */
-    static_cast<uint64_t>(0x8014000000000000), /* aau */
-    static_cast<uint64_t>(0x6162000000000000), /* ab */
-    static_cast<uint64_t>(0x8028000000000000), /* abi */
-    static_cast<uint64_t>(0x8030000000000000), /* abq */
-    static_cast<uint64_t>(0x8031000000000000), /* abr */
-    static_cast<uint64_t>(0x8033000000000000), /* abt */
-    static_cast<uint64_t>(0x8038000000000000), /* aby */
-    static_cast<uint64_t>(0x8043000000000000), /* acd */
-    static_cast<uint64_t>(0x8044000000000000), /* ace */
-    static_cast<uint64_t>(0x8047000000000000), /* ach */
-    static_cast<uint64_t>(0x8060000000000000), /* ada */
-    static_cast<uint64_t>(0x8064000000000000), /* ade */
-    static_cast<uint64_t>(0x8069000000000000), /* adj */
-    static_cast<uint64_t>(0x806f000000000000), /* adp */
-    static_cast<uint64_t>(0x8078000000000000), /* ady */
-    static_cast<uint64_t>(0x8079000000000000), /* adz */
-    static_cast<uint64_t>(0x6165000000000000), /* ae */
-    static_cast<uint64_t>(0x8081000000000000), /* aeb */
-    static_cast<uint64_t>(0x8098000000000000), /* aey */
-    static_cast<uint64_t>(0x6166000000000000), /* af */
-    static_cast<uint64_t>(0x80c2000000000000), /* agc */
-    static_cast<uint64_t>(0x80c3000000000000), /* agd */
-    static_cast<uint64_t>(0x80c6000000000000), /* agg */
-    static_cast<uint64_t>(0x80cc000000000000), /* agm */
-    static_cast<uint64_t>(0x80ce000000000000), /* ago */
-    static_cast<uint64_t>(0x80d0000000000000), /* agq */
-    static_cast<uint64_t>(0x80e0000000000000), /* aha */
-    static_cast<uint64_t>(0x80eb000000000000), /* ahl */
-    static_cast<uint64_t>(0x80ee000000000000), /* aho */
-    static_cast<uint64_t>(0x8126000000000000), /* ajg */
-    static_cast<uint64_t>(0x616b000000000000), /* ak */
-    static_cast<uint64_t>(0x814a000000000000), /* akk */
-    static_cast<uint64_t>(0x8160000000000000), /* ala */
-    static_cast<uint64_t>(0x8168000000000000), /* ali */
-    static_cast<uint64_t>(0x816d000000000000), /* aln */
-    static_cast<uint64_t>(0x8173000000000000), /* alt */
-    static_cast<uint64_t>(0x616d000000000000), /* am */
-    static_cast<uint64_t>(0x818c000000000000), /* amm */
-    static_cast<uint64_t>(0x818d000000000000), /* amn */
-    static_cast<uint64_t>(0x818e000000000000), /* amo */
-    static_cast<uint64_t>(0x818f000000000000), /* amp */
-    static_cast<uint64_t>(0x616e000000000000), /* an */
-    static_cast<uint64_t>(0x81a2000000000000), /* anc */
-    static_cast<uint64_t>(0x81aa000000000000), /* ank */
-    static_cast<uint64_t>(0x81ad000000000000), /* ann */
-    static_cast<uint64_t>(0x81b8000000000000), /* any */
-    static_cast<uint64_t>(0x81c9000000000000), /* aoj */
-    static_cast<uint64_t>(0x81cc000000000000), /* aom */
-    static_cast<uint64_t>(0x81d9000000000000), /* aoz */
-    static_cast<uint64_t>(0x81e2000000000000), /* apc */
-    static_cast<uint64_t>(0x81e3000000000000), /* apd */
-    static_cast<uint64_t>(0x81e4000000000000), /* ape */
-    static_cast<uint64_t>(0x81f1000000000000), /* apr */
-    static_cast<uint64_t>(0x81f2000000000000), /* aps */
-    static_cast<uint64_t>(0x81f9000000000000), /* apz */
-    static_cast<uint64_t>(0x6172000000000000), /* ar */
-    static_cast<uint64_t>(0x8222000000000000), /* arc */
-    static_cast<uint64_t>(0x82224e6261740000), /* arc-Nbat */
-    static_cast<uint64_t>(0x822250616c6d0000), /* arc-Palm */
-    static_cast<uint64_t>(0x8227000000000000), /* arh */
-    static_cast<uint64_t>(0x822d000000000000), /* arn */
-    static_cast<uint64_t>(0x822e000000000000), /* aro */
-    static_cast<uint64_t>(0x8230000000000000), /* arq */
-    static_cast<uint64_t>(0x8232000000000000), /* ars */
-    static_cast<uint64_t>(0x8238000000000000), /* ary */
-    static_cast<uint64_t>(0x8239000000000000), /* arz */
-    static_cast<uint64_t>(0x6173000000000000), /* as */
-    static_cast<uint64_t>(0x8240000000000000), /* asa */
-    static_cast<uint64_t>(0x8244000000000000), /* ase */
-    static_cast<uint64_t>(0x8246000000000000), /* asg */
-    static_cast<uint64_t>(0x824e000000000000), /* aso */
-    static_cast<uint64_t>(0x8253000000000000), /* ast */
-    static_cast<uint64_t>(0x8260000000000000), /* ata */
-    static_cast<uint64_t>(0x8266000000000000), /* atg */
-    static_cast<uint64_t>(0x8269000000000000), /* atj */
-    static_cast<uint64_t>(0x8298000000000000), /* auy */
-    static_cast<uint64_t>(0x6176000000000000), /* av */
-    static_cast<uint64_t>(0x82ab000000000000), /* avl */
-    static_cast<uint64_t>(0x82ad000000000000), /* avn */
-    static_cast<uint64_t>(0x82b3000000000000), /* avt */
-    static_cast<uint64_t>(0x82b4000000000000), /* avu */
-    static_cast<uint64_t>(0x82c0000000000000), /* awa */
-    static_cast<uint64_t>(0x82c1000000000000), /* awb */
-    static_cast<uint64_t>(0x82ce000000000000), /* awo */
-    static_cast<uint64_t>(0x82d7000000000000), /* awx */
-    static_cast<uint64_t>(0x6179000000000000), /* ay */
-    static_cast<uint64_t>(0x8301000000000000), /* ayb */
-    static_cast<uint64_t>(0x617a000000000000), /* az */
-    static_cast<uint64_t>(0x617a417261620000), /* az-Arab */
-    static_cast<uint64_t>(0x617a000000004951), /* az-IQ */
-    static_cast<uint64_t>(0x617a000000004952), /* az-IR */
-    static_cast<uint64_t>(0x617a000000005255), /* az-RU */
-    static_cast<uint64_t>(0x6261000000000000), /* ba */
-    static_cast<uint64_t>(0x840b000000000000), /* bal */
-    static_cast<uint64_t>(0x840d000000000000), /* ban */
-    static_cast<uint64_t>(0x840f000000000000), /* bap */
-    static_cast<uint64_t>(0x8411000000000000), /* bar */
-    static_cast<uint64_t>(0x8412000000000000), /* bas */
-    static_cast<uint64_t>(0x8415000000000000), /* bav */
-    static_cast<uint64_t>(0x8417000000000000), /* bax */
-    static_cast<uint64_t>(0x8420000000000000), /* bba */
-    static_cast<uint64_t>(0x8421000000000000), /* bbb */
-    static_cast<uint64_t>(0x8422000000000000), /* bbc */
-    static_cast<uint64_t>(0x8423000000000000), /* bbd */
-    static_cast<uint64_t>(0x8429000000000000), /* bbj */
-    static_cast<uint64_t>(0x842f000000000000), /* bbp */
-    static_cast<uint64_t>(0x8431000000000000), /* bbr */
-    static_cast<uint64_t>(0x8445000000000000), /* bcf */
-    static_cast<uint64_t>(0x8447000000000000), /* bch */
-    static_cast<uint64_t>(0x8448000000000000), /* bci */
-    static_cast<uint64_t>(0x844c000000000000), /* bcm */
-    static_cast<uint64_t>(0x844d000000000000), /* bcn */
-    static_cast<uint64_t>(0x844e000000000000), /* bco */
-    static_cast<uint64_t>(0x8450000000000000), /* bcq */
-    static_cast<uint64_t>(0x8454000000000000), /* bcu */
-    static_cast<uint64_t>(0x8463000000000000), /* bdd */
-    static_cast<uint64_t>(0x6265000000000000), /* be */
-    static_cast<uint64_t>(0x8485000000000000), /* bef */
-    static_cast<uint64_t>(0x8487000000000000), /* beh */
-    static_cast<uint64_t>(0x8489000000000000), /* bej */
-    static_cast<uint64_t>(0x848c000000000000), /* bem */
-    static_cast<uint64_t>(0x8493000000000000), /* bet */
-    static_cast<uint64_t>(0x8496000000000000), /* bew */
-    static_cast<uint64_t>(0x8497000000000000), /* bex */
-    static_cast<uint64_t>(0x8499000000000000), /* bez */
-    static_cast<uint64_t>(0x84a3000000000000), /* bfd */
-    static_cast<uint64_t>(0x84b0000000000000), /* bfq */
-    static_cast<uint64_t>(0x84b3000000000000), /* bft */
-    static_cast<uint64_t>(0x84b8000000000000), /* bfy */
-    static_cast<uint64_t>(0x6267000000000000), /* bg */
-    static_cast<uint64_t>(0x84c2000000000000), /* bgc */
-    static_cast<uint64_t>(0x84cd000000000000), /* bgn */
-    static_cast<uint64_t>(0x84d7000000000000), /* bgx */
-    static_cast<uint64_t>(0x84e1000000000000), /* bhb */
-    static_cast<uint64_t>(0x84e6000000000000), /* bhg */
-    static_cast<uint64_t>(0x84e8000000000000), /* bhi */
-    static_cast<uint64_t>(0x84eb000000000000), /* bhl */
-    static_cast<uint64_t>(0x84ee000000000000), /* bho */
-    static_cast<uint64_t>(0x84f8000000000000), /* bhy */
-    static_cast<uint64_t>(0x6269000000000000), /* bi */
-    static_cast<uint64_t>(0x8501000000000000), /* bib */
-    static_cast<uint64_t>(0x8506000000000000), /* big */
-    static_cast<uint64_t>(0x850a000000000000), /* bik */
-    static_cast<uint64_t>(0x850c000000000000), /* bim */
-    static_cast<uint64_t>(0x850d000000000000), /* bin */
-    static_cast<uint64_t>(0x850e000000000000), /* bio */
-    static_cast<uint64_t>(0x8510000000000000), /* biq */
-    static_cast<uint64_t>(0x8527000000000000), /* bjh */
-    static_cast<uint64_t>(0x8528000000000000), /* bji */
-    static_cast<uint64_t>(0x8529000000000000), /* bjj */
-    static_cast<uint64_t>(0x852d000000000000), /* bjn */
-    static_cast<uint64_t>(0x852e000000000000), /* bjo */
-    static_cast<uint64_t>(0x8531000000000000), /* bjr */
-    static_cast<uint64_t>(0x8533000000000000), /* bjt */
-    static_cast<uint64_t>(0x8539000000000000), /* bjz */
-    static_cast<uint64_t>(0x8542000000000000), /* bkc */
-    static_cast<uint64_t>(0x854c000000000000), /* bkm */
-    static_cast<uint64_t>(0x8550000000000000), /* bkq */
-    static_cast<uint64_t>(0x8554000000000000), /* bku */
-    static_cast<uint64_t>(0x8555000000000000), /* bkv */
-    static_cast<uint64_t>(0x8573000000000000), /* blt */
-    static_cast<uint64_t>(0x626d000000000000), /* bm */
-    static_cast<uint64_t>(0x8587000000000000), /* bmh */
-    static_cast<uint64_t>(0x858a000000000000), /* bmk */
-    static_cast<uint64_t>(0x8590000000000000), /* bmq */
-    static_cast<uint64_t>(0x8594000000000000), /* bmu */
-    static_cast<uint64_t>(0x626e000000000000), /* bn */
-    static_cast<uint64_t>(0x85a6000000000000), /* bng */
-    static_cast<uint64_t>(0x85ac000000000000), /* bnm */
-    static_cast<uint64_t>(0x85af000000000000), /* bnp */
-    static_cast<uint64_t>(0x626f000000000000), /* bo */
-    static_cast<uint64_t>(0x85c9000000000000), /* boj */
-    static_cast<uint64_t>(0x85cc000000000000), /* bom */
-    static_cast<uint64_t>(0x85cd000000000000), /* bon */
-    static_cast<uint64_t>(0x85f8000000000000), /* bpy */
-    static_cast<uint64_t>(0x8602000000000000), /* bqc */
-    static_cast<uint64_t>(0x8608000000000000), /* bqi */
-    static_cast<uint64_t>(0x860f000000000000), /* bqp */
-    static_cast<uint64_t>(0x8615000000000000), /* bqv */
-    static_cast<uint64_t>(0x6272000000000000), /* br */
-    static_cast<uint64_t>(0x8620000000000000), /* bra */
-    static_cast<uint64_t>(0x8627000000000000), /* brh */
-    static_cast<uint64_t>(0x8637000000000000), /* brx */
-    static_cast<uint64_t>(0x8639000000000000), /* brz */
-    static_cast<uint64_t>(0x6273000000000000), /* bs */
-    static_cast<uint64_t>(0x8649000000000000), /* bsj */
-    static_cast<uint64_t>(0x8650000000000000), /* bsq */
-    static_cast<uint64_t>(0x8652000000000000), /* bss */
-    static_cast<uint64_t>(0x8653000000000000), /* bst */
-    static_cast<uint64_t>(0x866e000000000000), /* bto */
-    static_cast<uint64_t>(0x8673000000000000), /* btt */
-    static_cast<uint64_t>(0x8675000000000000), /* btv */
-    static_cast<uint64_t>(0x8680000000000000), /* bua */
-    static_cast<uint64_t>(0x8682000000000000), /* buc */
-    static_cast<uint64_t>(0x8683000000000000), /* bud */
-    static_cast<uint64_t>(0x8686000000000000), /* bug */
-    static_cast<uint64_t>(0x868a000000000000), /* buk */
-    static_cast<uint64_t>(0x868c000000000000), /* bum */
-    static_cast<uint64_t>(0x868e000000000000), /* buo */
-    static_cast<uint64_t>(0x8692000000000000), /* bus */
-    static_cast<uint64_t>(0x8694000000000000), /* buu */
-    static_cast<uint64_t>(0x86a1000000000000), /* bvb */
-    static_cast<uint64_t>(0x86c3000000000000), /* bwd */
-    static_cast<uint64_t>(0x86d1000000000000), /* bwr */
-    static_cast<uint64_t>(0x86e7000000000000), /* bxh */
-    static_cast<uint64_t>(0x8704000000000000), /* bye */
-    static_cast<uint64_t>(0x870d000000000000), /* byn */
-    static_cast<uint64_t>(0x8711000000000000), /* byr */
-    static_cast<uint64_t>(0x8712000000000000), /* bys */
-    static_cast<uint64_t>(0x8715000000000000), /* byv */
-    static_cast<uint64_t>(0x8717000000000000), /* byx */
-    static_cast<uint64_t>(0x8720000000000000), /* bza */
-    static_cast<uint64_t>(0x8724000000000000), /* bze */
-    static_cast<uint64_t>(0x8725000000000000), /* bzf */
-    static_cast<uint64_t>(0x8727000000000000), /* bzh */
-    static_cast<uint64_t>(0x8736000000000000), /* bzw */
-    static_cast<uint64_t>(0x6361000000000000), /* ca */
-    static_cast<uint64_t>(0x8803000000000000), /* cad */
-    static_cast<uint64_t>(0x880d000000000000), /* can */
-    static_cast<uint64_t>(0x8829000000000000), /* cbj */
-    static_cast<uint64_t>(0x8847000000000000), /* cch */
-    static_cast<uint64_t>(0x884f000000000000), /* ccp */
-    static_cast<uint64_t>(0x6365000000000000), /* ce */
-    static_cast<uint64_t>(0x8881000000000000), /* ceb */
-    static_cast<uint64_t>(0x88a0000000000000), /* cfa */
-    static_cast<uint64_t>(0x88c6000000000000), /* cgg */
-    static_cast<uint64_t>(0x6368000000000000), /* ch */
-    static_cast<uint64_t>(0x88ea000000000000), /* chk */
-    static_cast<uint64_t>(0x88ec000000000000), /* chm */
-    static_cast<uint64_t>(0x88ee000000000000), /* cho */
-    static_cast<uint64_t>(0x88ef000000000000), /* chp */
-    static_cast<uint64_t>(0x88f1000000000000), /* chr */
-    static_cast<uint64_t>(0x8902000000000000), /* cic */
-    static_cast<uint64_t>(0x8920000000000000), /* cja */
-    static_cast<uint64_t>(0x892c000000000000), /* cjm */
-    static_cast<uint64_t>(0x8935000000000000), /* cjv */
-    static_cast<uint64_t>(0x8941000000000000), /* ckb */
-    static_cast<uint64_t>(0x894b000000000000), /* ckl */
-    static_cast<uint64_t>(0x894e000000000000), /* cko */
-    static_cast<uint64_t>(0x8958000000000000), /* cky */
-    static_cast<uint64_t>(0x8960000000000000), /* cla */
-    static_cast<uint64_t>(0x8984000000000000), /* cme */
-    static_cast<uint64_t>(0x8986000000000000), /* cmg */
-    static_cast<uint64_t>(0x636f000000000000), /* co */
-    static_cast<uint64_t>(0x89cf000000000000), /* cop */
-    static_cast<uint64_t>(0x89f2000000000000), /* cps */
-    static_cast<uint64_t>(0x6372000000000000), /* cr */
-    static_cast<uint64_t>(0x8a27000000000000), /* crh */
-    static_cast<uint64_t>(0x8a29000000000000), /* crj */
-    static_cast<uint64_t>(0x8a2a000000000000), /* crk */
-    static_cast<uint64_t>(0x8a2b000000000000), /* crl */
-    static_cast<uint64_t>(0x8a2c000000000000), /* crm */
-    static_cast<uint64_t>(0x8a32000000000000), /* crs */
-    static_cast<uint64_t>(0x6373000000000000), /* cs */
-    static_cast<uint64_t>(0x8a41000000000000), /* csb */
-    static_cast<uint64_t>(0x8a56000000000000), /* csw */
-    static_cast<uint64_t>(0x8a63000000000000), /* ctd */
-    static_cast<uint64_t>(0x6375000000000000), /* cu */
-    static_cast<uint64_t>(0x6375476c61670000), /* cu-Glag */
-    static_cast<uint64_t>(0x6376000000000000), /* cv */
-    static_cast<uint64_t>(0x6379000000000000), /* cy */
-    static_cast<uint64_t>(0x6461000000000000), /* da */
-    static_cast<uint64_t>(0x8c03000000000000), /* dad */
-    static_cast<uint64_t>(0x8c05000000000000), /* daf */
-    static_cast<uint64_t>(0x8c06000000000000), /* dag */
-    static_cast<uint64_t>(0x8c07000000000000), /* dah */
-    static_cast<uint64_t>(0x8c0a000000000000), /* dak */
-    static_cast<uint64_t>(0x8c11000000000000), /* dar */
-    static_cast<uint64_t>(0x8c15000000000000), /* dav */
-    static_cast<uint64_t>(0x8c23000000000000), /* dbd */
-    static_cast<uint64_t>(0x8c30000000000000), /* dbq */
-    static_cast<uint64_t>(0x8c42000000000000), /* dcc */
-    static_cast<uint64_t>(0x8c6d000000000000), /* ddn */
-    static_cast<uint64_t>(0x6465000000000000), /* de */
-    static_cast<uint64_t>(0x8c83000000000000), /* ded */
-    static_cast<uint64_t>(0x8c8d000000000000), /* den */
-    static_cast<uint64_t>(0x8cc0000000000000), /* dga */
-    static_cast<uint64_t>(0x8cc7000000000000), /* dgh */
-    static_cast<uint64_t>(0x8cc8000000000000), /* dgi */
-    static_cast<uint64_t>(0x8ccb000000000000), /* dgl */
-    static_cast<uint64_t>(0x8cd1000000000000), /* dgr */
-    static_cast<uint64_t>(0x8cd9000000000000), /* dgz */
-    static_cast<uint64_t>(0x8d00000000000000), /* dia */
-    static_cast<uint64_t>(0x8d24000000000000), /* dje */
-    static_cast<uint64_t>(0x8da9000000000000), /* dnj */
-    static_cast<uint64_t>(0x8dc1000000000000), /* dob */
-    static_cast<uint64_t>(0x8dc8000000000000), /* doi */
-    static_cast<uint64_t>(0x8dcf000000000000), /* dop */
-    static_cast<uint64_t>(0x8dd6000000000000), /* dow */
-    static_cast<uint64_t>(0x8e27000000000000), /* drh */
-    static_cast<uint64_t>(0x8e28000000000000), /* dri */
-    static_cast<uint64_t>(0x8e32000000000000), /* drs */
-    static_cast<uint64_t>(0x8e41000000000000), /* dsb */
-    static_cast<uint64_t>(0x8e6c000000000000), /* dtm */
-    static_cast<uint64_t>(0x8e6f000000000000), /* dtp */
-    static_cast<uint64_t>(0x8e72000000000000), /* dts */
-    static_cast<uint64_t>(0x8e78000000000000), /* dty */
-    static_cast<uint64_t>(0x8e80000000000000), /* dua */
-    static_cast<uint64_t>(0x8e82000000000000), /* duc */
-    static_cast<uint64_t>(0x8e83000000000000), /* dud */
-    static_cast<uint64_t>(0x8e86000000000000), /* dug */
-    static_cast<uint64_t>(0x6476000000000000), /* dv */
-    static_cast<uint64_t>(0x8ea0000000000000), /* dva */
-    static_cast<uint64_t>(0x8ed6000000000000), /* dww */
-    static_cast<uint64_t>(0x8f0e000000000000), /* dyo */
-    static_cast<uint64_t>(0x8f14000000000000), /* dyu */
-    static_cast<uint64_t>(0x647a000000000000), /* dz */
-    static_cast<uint64_t>(0x8f26000000000000), /* dzg */
-    static_cast<uint64_t>(0x9034000000000000), /* ebu */
-    static_cast<uint64_t>(0x6565000000000000), /* ee */
-    static_cast<uint64_t>(0x90a8000000000000), /* efi */
-    static_cast<uint64_t>(0x90cb000000000000), /* egl */
-    static_cast<uint64_t>(0x90d8000000000000), /* egy */
-    static_cast<uint64_t>(0x9140000000000000), /* eka */
-    static_cast<uint64_t>(0x9158000000000000), /* eky */
-    static_cast<uint64_t>(0x656c000000000000), /* el */
-    static_cast<uint64_t>(0x9180000000000000), /* ema */
-    static_cast<uint64_t>(0x9188000000000000), /* emi */
-    static_cast<uint64_t>(0x656e000000000000), /* en */
-    static_cast<uint64_t>(0x656e536861770000), /* en-Shaw */
-    static_cast<uint64_t>(0x91ad000000000000), /* enn */
-    static_cast<uint64_t>(0x91b0000000000000), /* enq */
-    static_cast<uint64_t>(0x656f000000000000), /* eo */
-    static_cast<uint64_t>(0x9228000000000000), /* eri */
-    static_cast<uint64_t>(0x6573000000000000), /* es */
-    static_cast<uint64_t>(0x9246000000000000), /* esg */
-    static_cast<uint64_t>(0x9254000000000000), /* esu */
-    static_cast<uint64_t>(0x6574000000000000), /* et */
-    static_cast<uint64_t>(0x9271000000000000), /* etr */
-    static_cast<uint64_t>(0x9273000000000000), /* ett */
-    static_cast<uint64_t>(0x9274000000000000), /* etu */
-    static_cast<uint64_t>(0x9277000000000000), /* etx */
-    static_cast<uint64_t>(0x6575000000000000), /* eu */
-    static_cast<uint64_t>(0x92ce000000000000), /* ewo */
-    static_cast<uint64_t>(0x92f3000000000000), /* ext */
-    static_cast<uint64_t>(0x9320000000000000), /* eza */
-    static_cast<uint64_t>(0x6661000000000000), /* fa */
-    static_cast<uint64_t>(0x9400000000000000), /* faa */
-    static_cast<uint64_t>(0x9401000000000000), /* fab */
-    static_cast<uint64_t>(0x9406000000000000), /* fag */
-    static_cast<uint64_t>(0x9408000000000000), /* fai */
-    static_cast<uint64_t>(0x940d000000000000), /* fan */
-    static_cast<uint64_t>(0x6666000000000000), /* ff */
-    static_cast<uint64_t>(0x666641646c6d0000), /* ff-Adlm */
-    static_cast<uint64_t>(0x94a8000000000000), /* ffi */
-    static_cast<uint64_t>(0x94ac000000000000), /* ffm */
-    static_cast<uint64_t>(0x6669000000000000), /* fi */
-    static_cast<uint64_t>(0x9500000000000000), /* fia */
-    static_cast<uint64_t>(0x950b000000000000), /* fil */
-    static_cast<uint64_t>(0x9513000000000000), /* fit */
-    static_cast<uint64_t>(0x666a000000000000), /* fj */
-    static_cast<uint64_t>(0x9571000000000000), /* flr */
-    static_cast<uint64_t>(0x958f000000000000), /* fmp */
-    static_cast<uint64_t>(0x666f000000000000), /* fo */
-    static_cast<uint64_t>(0x95c3000000000000), /* fod */
-    static_cast<uint64_t>(0x95cd000000000000), /* fon */
-    static_cast<uint64_t>(0x95d1000000000000), /* for */
-    static_cast<uint64_t>(0x95e4000000000000), /* fpe */
-    static_cast<uint64_t>(0x9612000000000000), /* fqs */
-    static_cast<uint64_t>(0x6672000000000000), /* fr */
-    static_cast<uint64_t>(0x9622000000000000), /* frc */
-    static_cast<uint64_t>(0x962f000000000000), /* frp */
-    static_cast<uint64_t>(0x9631000000000000), /* frr */
-    static_cast<uint64_t>(0x9632000000000000), /* frs */
-    static_cast<uint64_t>(0x9681000000000000), /* fub */
-    static_cast<uint64_t>(0x9683000000000000), /* fud */
-    static_cast<uint64_t>(0x9684000000000000), /* fue */
-    static_cast<uint64_t>(0x9685000000000000), /* fuf */
-    static_cast<uint64_t>(0x9687000000000000), /* fuh */
-    static_cast<uint64_t>(0x9690000000000000), /* fuq */
-    static_cast<uint64_t>(0x9691000000000000), /* fur */
-    static_cast<uint64_t>(0x9695000000000000), /* fuv */
-    static_cast<uint64_t>(0x9698000000000000), /* fuy */
-    static_cast<uint64_t>(0x96b1000000000000), /* fvr */
-    static_cast<uint64_t>(0x6679000000000000), /* fy */
-    static_cast<uint64_t>(0x6761000000000000), /* ga */
-    static_cast<uint64_t>(0x9800000000000000), /* gaa */
-    static_cast<uint64_t>(0x9805000000000000), /* gaf */
-    static_cast<uint64_t>(0x9806000000000000), /* gag */
-    static_cast<uint64_t>(0x9807000000000000), /* gah */
-    static_cast<uint64_t>(0x9809000000000000), /* gaj */
-    static_cast<uint64_t>(0x980c000000000000), /* gam */
-    static_cast<uint64_t>(0x980d000000000000), /* gan */
-    static_cast<uint64_t>(0x9816000000000000), /* gaw */
-    static_cast<uint64_t>(0x9818000000000000), /* gay */
-    static_cast<uint64_t>(0x9820000000000000), /* gba */
-    static_cast<uint64_t>(0x9825000000000000), /* gbf */
-    static_cast<uint64_t>(0x982c000000000000), /* gbm */
-    static_cast<uint64_t>(0x9838000000000000), /* gby */
-    static_cast<uint64_t>(0x9839000000000000), /* gbz */
-    static_cast<uint64_t>(0x9851000000000000), /* gcr */
-    static_cast<uint64_t>(0x6764000000000000), /* gd */
-    static_cast<uint64_t>(0x9864000000000000), /* gde */
-    static_cast<uint64_t>(0x986d000000000000), /* gdn */
-    static_cast<uint64_t>(0x9871000000000000), /* gdr */
-    static_cast<uint64_t>(0x9881000000000000), /* geb */
-    static_cast<uint64_t>(0x9889000000000000), /* gej */
-    static_cast<uint64_t>(0x988b000000000000), /* gel */
-    static_cast<uint64_t>(0x9899000000000000), /* gez */
-    static_cast<uint64_t>(0x98aa000000000000), /* gfk */
-    static_cast<uint64_t>(0x98cd000000000000), /* ggn */
-    static_cast<uint64_t>(0x98f2000000000000), /* ghs */
-    static_cast<uint64_t>(0x990b000000000000), /* gil */
-    static_cast<uint64_t>(0x990c000000000000), /* gim */
-    static_cast<uint64_t>(0x992a000000000000), /* gjk */
-    static_cast<uint64_t>(0x992d000000000000), /* gjn */
-    static_cast<uint64_t>(0x9934000000000000), /* gju */
-    static_cast<uint64_t>(0x994d000000000000), /* gkn */
-    static_cast<uint64_t>(0x994f000000000000), /* gkp */
-    static_cast<uint64_t>(0x676c000000000000), /* gl */
-    static_cast<uint64_t>(0x996a000000000000), /* glk */
-    static_cast<uint64_t>(0x998c000000000000), /* gmm */
-    static_cast<uint64_t>(0x9995000000000000), /* gmv */
-    static_cast<uint64_t>(0x676e000000000000), /* gn */
-    static_cast<uint64_t>(0x99a3000000000000), /* gnd */
-    static_cast<uint64_t>(0x99a6000000000000), /* gng */
-    static_cast<uint64_t>(0x99c3000000000000), /* god */
-    static_cast<uint64_t>(0x99c5000000000000), /* gof */
-    static_cast<uint64_t>(0x99c8000000000000), /* goi */
-    static_cast<uint64_t>(0x99cc000000000000), /* gom */
-    static_cast<uint64_t>(0x99cd000000000000), /* gon */
-    static_cast<uint64_t>(0x99d1000000000000), /* gor */
-    static_cast<uint64_t>(0x99d2000000000000), /* gos */
-    static_cast<uint64_t>(0x99d3000000000000), /* got */
-    static_cast<uint64_t>(0x9a21000000000000), /* grb */
-    static_cast<uint64_t>(0x9a22000000000000), /* grc */
-    static_cast<uint64_t>(0x9a224c696e620000), /* grc-Linb */
-    static_cast<uint64_t>(0x9a33000000000000), /* grt */
-    static_cast<uint64_t>(0x9a36000000000000), /* grw */
-    static_cast<uint64_t>(0x9a56000000000000), /* gsw */
-    static_cast<uint64_t>(0x6775000000000000), /* gu */
-    static_cast<uint64_t>(0x9a81000000000000), /* gub */
-    static_cast<uint64_t>(0x9a82000000000000), /* guc */
-    static_cast<uint64_t>(0x9a83000000000000), /* gud */
-    static_cast<uint64_t>(0x9a91000000000000), /* gur */
-    static_cast<uint64_t>(0x9a96000000000000), /* guw */
-    static_cast<uint64_t>(0x9a97000000000000), /* gux */
-    static_cast<uint64_t>(0x9a99000000000000), /* guz */
-    static_cast<uint64_t>(0x6776000000000000), /* gv */
-    static_cast<uint64_t>(0x9aa5000000000000), /* gvf */
-    static_cast<uint64_t>(0x9ab1000000000000), /* gvr */
-    static_cast<uint64_t>(0x9ab2000000000000), /* gvs */
-    static_cast<uint64_t>(0x9ac2000000000000), /* gwc */
-    static_cast<uint64_t>(0x9ac8000000000000), /* gwi */
-    static_cast<uint64_t>(0x9ad3000000000000), /* gwt */
-    static_cast<uint64_t>(0x9b08000000000000), /* gyi */
-    static_cast<uint64_t>(0x6861000000000000), /* ha */
-    static_cast<uint64_t>(0x686100000000434d), /* ha-CM */
-    static_cast<uint64_t>(0x6861000000005344), /* ha-SD */
-    static_cast<uint64_t>(0x9c06000000000000), /* hag */
-    static_cast<uint64_t>(0x9c0a000000000000), /* hak */
-    static_cast<uint64_t>(0x9c0c000000000000), /* ham */
-    static_cast<uint64_t>(0x9c16000000000000), /* haw */
-    static_cast<uint64_t>(0x9c19000000000000), /* haz */
-    static_cast<uint64_t>(0x9c21000000000000), /* hbb */
-    static_cast<uint64_t>(0x9c78000000000000), /* hdy */
-    static_cast<uint64_t>(0x6865000000000000), /* he */
-    static_cast<uint64_t>(0x9cf8000000000000), /* hhy */
-    static_cast<uint64_t>(0x6869000000000000), /* hi */
-    static_cast<uint64_t>(0x9d00000000000000), /* hia */
-    static_cast<uint64_t>(0x9d05000000000000), /* hif */
-    static_cast<uint64_t>(0x9d06000000000000), /* hig */
-    static_cast<uint64_t>(0x9d07000000000000), /* hih */
-    static_cast<uint64_t>(0x9d0b000000000000), /* hil */
-    static_cast<uint64_t>(0x9d60000000000000), /* hla */
-    static_cast<uint64_t>(0x9d74000000000000), /* hlu */
-    static_cast<uint64_t>(0x9d83000000000000), /* hmd */
-    static_cast<uint64_t>(0x9d93000000000000), /* hmt */
-    static_cast<uint64_t>(0x9da3000000000000), /* hnd */
-    static_cast<uint64_t>(0x9da4000000000000), /* hne */
-    static_cast<uint64_t>(0x9da9000000000000), /* hnj */
-    static_cast<uint64_t>(0x9dad000000000000), /* hnn */
-    static_cast<uint64_t>(0x9dae000000000000), /* hno */
-    static_cast<uint64_t>(0x686f000000000000), /* ho */
-    static_cast<uint64_t>(0x9dc2000000000000), /* hoc */
-    static_cast<uint64_t>(0x9dc9000000000000), /* hoj */
-    static_cast<uint64_t>(0x9dd3000000000000), /* hot */
-    static_cast<uint64_t>(0x6872000000000000), /* hr */
-    static_cast<uint64_t>(0x9e41000000000000), /* hsb */
-    static_cast<uint64_t>(0x9e4d000000000000), /* hsn */
-    static_cast<uint64_t>(0x6874000000000000), /* ht */
-    static_cast<uint64_t>(0x6875000000000000), /* hu */
-    static_cast<uint64_t>(0x9e88000000000000), /* hui */
-    static_cast<uint64_t>(0x6879000000000000), /* hy */
-    static_cast<uint64_t>(0x687a000000000000), /* hz */
-    static_cast<uint64_t>(0x6961000000000000), /* ia */
-    static_cast<uint64_t>(0xa00d000000000000), /* ian */
-    static_cast<uint64_t>(0xa011000000000000), /* iar */
-    static_cast<uint64_t>(0xa020000000000000), /* iba */
-    static_cast<uint64_t>(0xa021000000000000), /* ibb */
-    static_cast<uint64_t>(0xa038000000000000), /* iby */
-    static_cast<uint64_t>(0xa040000000000000), /* ica */
-    static_cast<uint64_t>(0xa047000000000000), /* ich */
-    static_cast<uint64_t>(0x6964000000000000), /* id */
-    static_cast<uint64_t>(0xa063000000000000), /* idd */
-    static_cast<uint64_t>(0xa068000000000000), /* idi */
-    static_cast<uint64_t>(0xa074000000000000), /* idu */
-    static_cast<uint64_t>(0xa0a4000000000000), /* ife */
-    static_cast<uint64_t>(0x6967000000000000), /* ig */
-    static_cast<uint64_t>(0xa0c1000000000000), /* igb */
-    static_cast<uint64_t>(0xa0c4000000000000), /* ige */
-    static_cast<uint64_t>(0x6969000000000000), /* ii */
-    static_cast<uint64_t>(0xa129000000000000), /* ijj */
-    static_cast<uint64_t>(0x696b000000000000), /* ik */
-    static_cast<uint64_t>(0xa14a000000000000), /* ikk */
-    static_cast<uint64_t>(0xa153000000000000), /* ikt */
-    static_cast<uint64_t>(0xa156000000000000), /* ikw */
-    static_cast<uint64_t>(0xa157000000000000), /* ikx */
-    static_cast<uint64_t>(0xa16e000000000000), /* ilo */
-    static_cast<uint64_t>(0xa18e000000000000), /* imo */
-    static_cast<uint64_t>(0x696e000000000000), /* in */
-    static_cast<uint64_t>(0xa1a7000000000000), /* inh */
-    static_cast<uint64_t>(0x696f000000000000), /* io */
-    static_cast<uint64_t>(0xa1d4000000000000), /* iou */
-    static_cast<uint64_t>(0xa228000000000000), /* iri */
-    static_cast<uint64_t>(0x6973000000000000), /* is */
-    static_cast<uint64_t>(0x6974000000000000), /* it */
-    static_cast<uint64_t>(0x6975000000000000), /* iu */
-    static_cast<uint64_t>(0x6977000000000000), /* iw */
-    static_cast<uint64_t>(0xa2cc000000000000), /* iwm */
-    static_cast<uint64_t>(0xa2d2000000000000), /* iws */
-    static_cast<uint64_t>(0xa327000000000000), /* izh */
-    static_cast<uint64_t>(0xa328000000000000), /* izi */
-    static_cast<uint64_t>(0x6a61000000000000), /* ja */
-    static_cast<uint64_t>(0xa401000000000000), /* jab */
-    static_cast<uint64_t>(0xa40c000000000000), /* jam */
-    static_cast<uint64_t>(0xa411000000000000), /* jar */
-    static_cast<uint64_t>(0xa42e000000000000), /* jbo */
-    static_cast<uint64_t>(0xa434000000000000), /* jbu */
-    static_cast<uint64_t>(0xa48d000000000000), /* jen */
-    static_cast<uint64_t>(0xa4ca000000000000), /* jgk */
-    static_cast<uint64_t>(0xa4ce000000000000), /* jgo */
-    static_cast<uint64_t>(0x6a69000000000000), /* ji */
-    static_cast<uint64_t>(0xa501000000000000), /* jib */
-    static_cast<uint64_t>(0xa582000000000000), /* jmc */
-    static_cast<uint64_t>(0xa58b000000000000), /* jml */
-    static_cast<uint64_t>(0xa620000000000000), /* jra */
-    static_cast<uint64_t>(0xa693000000000000), /* jut */
-    static_cast<uint64_t>(0x6a76000000000000), /* jv */
-    static_cast<uint64_t>(0x6a77000000000000), /* jw */
-    static_cast<uint64_t>(0x6b61000000000000), /* ka */
-    static_cast<uint64_t>(0xa800000000000000), /* kaa */
-    static_cast<uint64_t>(0xa801000000000000), /* kab */
-    static_cast<uint64_t>(0xa802000000000000), /* kac */
-    static_cast<uint64_t>(0xa803000000000000), /* kad */
-    static_cast<uint64_t>(0xa808000000000000), /* kai */
-    static_cast<uint64_t>(0xa809000000000000), /* kaj */
-    static_cast<uint64_t>(0xa80c000000000000), /* kam */
-    static_cast<uint64_t>(0xa80e000000000000), /* kao */
-    static_cast<uint64_t>(0xa823000000000000), /* kbd */
-    static_cast<uint64_t>(0xa82c000000000000), /* kbm */
-    static_cast<uint64_t>(0xa82f000000000000), /* kbp */
-    static_cast<uint64_t>(0xa830000000000000), /* kbq */
-    static_cast<uint64_t>(0xa837000000000000), /* kbx */
-    static_cast<uint64_t>(0xa838000000000000), /* kby */
-    static_cast<uint64_t>(0xa846000000000000), /* kcg */
-    static_cast<uint64_t>(0xa84a000000000000), /* kck */
-    static_cast<uint64_t>(0xa84b000000000000), /* kcl */
-    static_cast<uint64_t>(0xa853000000000000), /* kct */
-    static_cast<uint64_t>(0xa864000000000000), /* kde */
-    static_cast<uint64_t>(0xa867000000000000), /* kdh */
-    static_cast<uint64_t>(0xa86b000000000000), /* kdl */
-    static_cast<uint64_t>(0xa873000000000000), /* kdt */
-    static_cast<uint64_t>(0xa880000000000000), /* kea */
-    static_cast<uint64_t>(0xa88d000000000000), /* ken */
-    static_cast<uint64_t>(0xa899000000000000), /* kez */
-    static_cast<uint64_t>(0xa8ae000000000000), /* kfo */
-    static_cast<uint64_t>(0xa8b1000000000000), /* kfr */
-    static_cast<uint64_t>(0xa8b8000000000000), /* kfy */
-    static_cast<uint64_t>(0x6b67000000000000), /* kg */
-    static_cast<uint64_t>(0xa8c4000000000000), /* kge */
-    static_cast<uint64_t>(0xa8c5000000000000), /* kgf */
-    static_cast<uint64_t>(0xa8cf000000000000), /* kgp */
-    static_cast<uint64_t>(0xa8e0000000000000), /* kha */
-    static_cast<uint64_t>(0xa8e1000000000000), /* khb */
-    static_cast<uint64_t>(0xa8ed000000000000), /* khn */
-    static_cast<uint64_t>(0xa8f0000000000000), /* khq */
-    static_cast<uint64_t>(0xa8f2000000000000), /* khs */
-    static_cast<uint64_t>(0xa8f3000000000000), /* kht */
-    static_cast<uint64_t>(0xa8f6000000000000), /* khw */
-    static_cast<uint64_t>(0xa8f9000000000000), /* khz */
-    static_cast<uint64_t>(0x6b69000000000000), /* ki */
-    static_cast<uint64_t>(0xa909000000000000), /* kij */
-    static_cast<uint64_t>(0xa914000000000000), /* kiu */
-    static_cast<uint64_t>(0xa916000000000000), /* kiw */
-    static_cast<uint64_t>(0x6b6a000000000000), /* kj */
-    static_cast<uint64_t>(0xa923000000000000), /* kjd */
-    static_cast<uint64_t>(0xa926000000000000), /* kjg */
-    static_cast<uint64_t>(0xa932000000000000), /* kjs */
-    static_cast<uint64_t>(0xa938000000000000), /* kjy */
-    static_cast<uint64_t>(0x6b6b000000000000), /* kk */
-    static_cast<uint64_t>(0x6b6b000000004146), /* kk-AF */
-    static_cast<uint64_t>(0x6b6b417261620000), /* kk-Arab */
-    static_cast<uint64_t>(0x6b6b00000000434e), /* kk-CN */
-    static_cast<uint64_t>(0x6b6b000000004952), /* kk-IR */
-    static_cast<uint64_t>(0x6b6b000000004d4e), /* kk-MN */
-    static_cast<uint64_t>(0xa942000000000000), /* kkc */
-    static_cast<uint64_t>(0xa949000000000000), /* kkj */
-    static_cast<uint64_t>(0x6b6c000000000000), /* kl */
-    static_cast<uint64_t>(0xa96d000000000000), /* kln */
-    static_cast<uint64_t>(0xa970000000000000), /* klq */
-    static_cast<uint64_t>(0xa973000000000000), /* klt */
-    static_cast<uint64_t>(0xa977000000000000), /* klx */
-    static_cast<uint64_t>(0x6b6d000000000000), /* km */
-    static_cast<uint64_t>(0xa981000000000000), /* kmb */
-    static_cast<uint64_t>(0xa987000000000000), /* kmh */
-    static_cast<uint64_t>(0xa98e000000000000), /* kmo */
-    static_cast<uint64_t>(0xa992000000000000), /* kms */
-    static_cast<uint64_t>(0xa994000000000000), /* kmu */
-    static_cast<uint64_t>(0xa996000000000000), /* kmw */
-    static_cast<uint64_t>(0x6b6e000000000000), /* kn */
-    static_cast<uint64_t>(0xa9a5000000000000), /* knf */
-    static_cast<uint64_t>(0xa9af000000000000), /* knp */
-    static_cast<uint64_t>(0x6b6f000000000000), /* ko */
-    static_cast<uint64_t>(0xa9c8000000000000), /* koi */
-    static_cast<uint64_t>(0xa9ca000000000000), /* kok */
-    static_cast<uint64_t>(0xa9cb000000000000), /* kol */
-    static_cast<uint64_t>(0xa9d2000000000000), /* kos */
-    static_cast<uint64_t>(0xa9d9000000000000), /* koz */
-    static_cast<uint64_t>(0xa9e4000000000000), /* kpe */
-    static_cast<uint64_t>(0xa9e5000000000000), /* kpf */
-    static_cast<uint64_t>(0xa9ee000000000000), /* kpo */
-    static_cast<uint64_t>(0xa9f1000000000000), /* kpr */
-    static_cast<uint64_t>(0xa9f7000000000000), /* kpx */
-    static_cast<uint64_t>(0xaa01000000000000), /* kqb */
-    static_cast<uint64_t>(0xaa05000000000000), /* kqf */
-    static_cast<uint64_t>(0xaa12000000000000), /* kqs */
-    static_cast<uint64_t>(0xaa18000000000000), /* kqy */
-    static_cast<uint64_t>(0x6b72000000000000), /* kr */
-    static_cast<uint64_t>(0xaa22000000000000), /* krc */
-    static_cast<uint64_t>(0xaa28000000000000), /* kri */
-    static_cast<uint64_t>(0xaa29000000000000), /* krj */
-    static_cast<uint64_t>(0xaa2b000000000000), /* krl */
-    static_cast<uint64_t>(0xaa32000000000000), /* krs */
-    static_cast<uint64_t>(0xaa34000000000000), /* kru */
-    static_cast<uint64_t>(0x6b73000000000000), /* ks */
-    static_cast<uint64_t>(0xaa41000000000000), /* ksb */
-    static_cast<uint64_t>(0xaa43000000000000), /* ksd */
-    static_cast<uint64_t>(0xaa45000000000000), /* ksf */
-    static_cast<uint64_t>(0xaa47000000000000), /* ksh */
-    static_cast<uint64_t>(0xaa49000000000000), /* ksj */
-    static_cast<uint64_t>(0xaa51000000000000), /* ksr */
-    static_cast<uint64_t>(0xaa61000000000000), /* ktb */
-    static_cast<uint64_t>(0xaa6c000000000000), /* ktm */
-    static_cast<uint64_t>(0xaa6e000000000000), /* kto */
-    static_cast<uint64_t>(0xaa71000000000000), /* ktr */
-    static_cast<uint64_t>(0x6b75000000000000), /* ku */
-    static_cast<uint64_t>(0x6b75417261620000), /* ku-Arab */
-    static_cast<uint64_t>(0x6b75000000004c42), /* ku-LB */
-    static_cast<uint64_t>(0x6b7559657a690000), /* ku-Yezi */
-    static_cast<uint64_t>(0xaa81000000000000), /* kub */
-    static_cast<uint64_t>(0xaa83000000000000), /* kud */
-    static_cast<uint64_t>(0xaa84000000000000), /* kue */
-    static_cast<uint64_t>(0xaa89000000000000), /* kuj */
-    static_cast<uint64_t>(0xaa8c000000000000), /* kum */
-    static_cast<uint64_t>(0xaa8d000000000000), /* kun */
-    static_cast<uint64_t>(0xaa8f000000000000), /* kup */
-    static_cast<uint64_t>(0xaa92000000000000), /* kus */
-    static_cast<uint64_t>(0x6b76000000000000), /* kv */
-    static_cast<uint64_t>(0xaaa6000000000000), /* kvg */
-    static_cast<uint64_t>(0xaab1000000000000), /* kvr */
-    static_cast<uint64_t>(0xaab7000000000000), /* kvx */
-    static_cast<uint64_t>(0x6b77000000000000), /* kw */
-    static_cast<uint64_t>(0xaac9000000000000), /* kwj */
-    static_cast<uint64_t>(0xaace000000000000), /* kwo */
-    static_cast<uint64_t>(0xaad0000000000000), /* kwq */
-    static_cast<uint64_t>(0xaae0000000000000), /* kxa */
-    static_cast<uint64_t>(0xaae2000000000000), /* kxc */
-    static_cast<uint64_t>(0xaae4000000000000), /* kxe */
-    static_cast<uint64_t>(0xaaeb000000000000), /* kxl */
-    static_cast<uint64_t>(0xaaec000000000000), /* kxm */
-    static_cast<uint64_t>(0xaaef000000000000), /* kxp */
-    static_cast<uint64_t>(0xaaf6000000000000), /* kxw */
-    static_cast<uint64_t>(0xaaf9000000000000), /* kxz */
-    static_cast<uint64_t>(0x6b79000000000000), /* ky */
-    static_cast<uint64_t>(0x6b79417261620000), /* ky-Arab */
-    static_cast<uint64_t>(0x6b7900000000434e), /* ky-CN */
-    static_cast<uint64_t>(0x6b794c61746e0000), /* ky-Latn */
-    static_cast<uint64_t>(0x6b79000000005452), /* ky-TR */
-    static_cast<uint64_t>(0xab04000000000000), /* kye */
-    static_cast<uint64_t>(0xab17000000000000), /* kyx */
-    static_cast<uint64_t>(0xab27000000000000), /* kzh */
-    static_cast<uint64_t>(0xab29000000000000), /* kzj */
-    static_cast<uint64_t>(0xab31000000000000), /* kzr */
-    static_cast<uint64_t>(0xab33000000000000), /* kzt */
-    static_cast<uint64_t>(0x6c61000000000000), /* la */
-    static_cast<uint64_t>(0xac01000000000000), /* lab */
-    static_cast<uint64_t>(0xac03000000000000), /* lad */
-    static_cast<uint64_t>(0xac06000000000000), /* lag */
-    static_cast<uint64_t>(0xac07000000000000), /* lah */
-    static_cast<uint64_t>(0xac09000000000000), /* laj */
-    static_cast<uint64_t>(0xac12000000000000), /* las */
-    static_cast<uint64_t>(0x6c62000000000000), /* lb */
-    static_cast<uint64_t>(0xac24000000000000), /* lbe */
-    static_cast<uint64_t>(0xac34000000000000), /* lbu */
-    static_cast<uint64_t>(0xac36000000000000), /* lbw */
-    static_cast<uint64_t>(0xac4c000000000000), /* lcm */
-    static_cast<uint64_t>(0xac4f000000000000), /* lcp */
-    static_cast<uint64_t>(0xac61000000000000), /* ldb */
-    static_cast<uint64_t>(0xac83000000000000), /* led */
-    static_cast<uint64_t>(0xac84000000000000), /* lee */
-    static_cast<uint64_t>(0xac8c000000000000), /* lem */
-    static_cast<uint64_t>(0xac8f000000000000), /* lep */
-    static_cast<uint64_t>(0xac90000000000000), /* leq */
-    static_cast<uint64_t>(0xac94000000000000), /* leu */
-    static_cast<uint64_t>(0xac99000000000000), /* lez */
-    static_cast<uint64_t>(0x6c67000000000000), /* lg */
-    static_cast<uint64_t>(0xacc6000000000000), /* lgg */
-    static_cast<uint64_t>(0x6c69000000000000), /* li */
-    static_cast<uint64_t>(0xad00000000000000), /* lia */
-    static_cast<uint64_t>(0xad03000000000000), /* lid */
-    static_cast<uint64_t>(0xad05000000000000), /* lif */
-    static_cast<uint64_t>(0xad054c696d620000), /* lif-Limb */
-    static_cast<uint64_t>(0xad06000000000000), /* lig */
-    static_cast<uint64_t>(0xad07000000000000), /* lih */
-    static_cast<uint64_t>(0xad09000000000000), /* lij */
-    static_cast<uint64_t>(0xad12000000000000), /* lis */
-    static_cast<uint64_t>(0xad2f000000000000), /* ljp */
-    static_cast<uint64_t>(0xad48000000000000), /* lki */
-    static_cast<uint64_t>(0xad53000000000000), /* lkt */
-    static_cast<uint64_t>(0xad64000000000000), /* lle */
-    static_cast<uint64_t>(0xad6d000000000000), /* lln */
-    static_cast<uint64_t>(0xad8d000000000000), /* lmn */
-    static_cast<uint64_t>(0xad8e000000000000), /* lmo */
-    static_cast<uint64_t>(0xad8f000000000000), /* lmp */
-    static_cast<uint64_t>(0x6c6e000000000000), /* ln */
-    static_cast<uint64_t>(0xadb2000000000000), /* lns */
-    static_cast<uint64_t>(0xadb4000000000000), /* lnu */
-    static_cast<uint64_t>(0x6c6f000000000000), /* lo */
-    static_cast<uint64_t>(0xadc9000000000000), /* loj */
-    static_cast<uint64_t>(0xadca000000000000), /* lok */
-    static_cast<uint64_t>(0xadcb000000000000), /* lol */
-    static_cast<uint64_t>(0xadd1000000000000), /* lor */
-    static_cast<uint64_t>(0xadd2000000000000), /* los */
-    static_cast<uint64_t>(0xadd9000000000000), /* loz */
-    static_cast<uint64_t>(0xae22000000000000), /* lrc */
-    static_cast<uint64_t>(0x6c74000000000000), /* lt */
-    static_cast<uint64_t>(0xae66000000000000), /* ltg */
-    static_cast<uint64_t>(0x6c75000000000000), /* lu */
-    static_cast<uint64_t>(0xae80000000000000), /* lua */
-    static_cast<uint64_t>(0xae8e000000000000), /* luo */
-    static_cast<uint64_t>(0xae98000000000000), /* luy */
-    static_cast<uint64_t>(0xae99000000000000), /* luz */
-    static_cast<uint64_t>(0x6c76000000000000), /* lv */
-    static_cast<uint64_t>(0xaecb000000000000), /* lwl */
-    static_cast<uint64_t>(0xaf27000000000000), /* lzh */
-    static_cast<uint64_t>(0xaf39000000000000), /* lzz */
-    static_cast<uint64_t>(0xb003000000000000), /* mad */
-    static_cast<uint64_t>(0xb005000000000000), /* maf */
-    static_cast<uint64_t>(0xb006000000000000), /* mag */
-    static_cast<uint64_t>(0xb008000000000000), /* mai */
-    static_cast<uint64_t>(0xb00a000000000000), /* mak */
-    static_cast<uint64_t>(0xb00d000000000000), /* man */
-    static_cast<uint64_t>(0xb00d00000000474e), /* man-GN */
-    static_cast<uint64_t>(0xb00d4e6b6f6f0000), /* man-Nkoo */
-    static_cast<uint64_t>(0xb012000000000000), /* mas */
-    static_cast<uint64_t>(0xb016000000000000), /* maw */
-    static_cast<uint64_t>(0xb019000000000000), /* maz */
-    static_cast<uint64_t>(0xb027000000000000), /* mbh */
-    static_cast<uint64_t>(0xb02e000000000000), /* mbo */
-    static_cast<uint64_t>(0xb030000000000000), /* mbq */
-    static_cast<uint64_t>(0xb034000000000000), /* mbu */
-    static_cast<uint64_t>(0xb036000000000000), /* mbw */
-    static_cast<uint64_t>(0xb048000000000000), /* mci */
-    static_cast<uint64_t>(0xb04f000000000000), /* mcp */
-    static_cast<uint64_t>(0xb050000000000000), /* mcq */
-    static_cast<uint64_t>(0xb051000000000000), /* mcr */
-    static_cast<uint64_t>(0xb054000000000000), /* mcu */
-    static_cast<uint64_t>(0xb060000000000000), /* mda */
-    static_cast<uint64_t>(0xb064000000000000), /* mde */
-    static_cast<uint64_t>(0xb065000000000000), /* mdf */
-    static_cast<uint64_t>(0xb067000000000000), /* mdh */
-    static_cast<uint64_t>(0xb069000000000000), /* mdj */
-    static_cast<uint64_t>(0xb071000000000000), /* mdr */
-    static_cast<uint64_t>(0xb077000000000000), /* mdx */
-    static_cast<uint64_t>(0xb083000000000000), /* med */
-    static_cast<uint64_t>(0xb084000000000000), /* mee */
-    static_cast<uint64_t>(0xb08a000000000000), /* mek */
-    static_cast<uint64_t>(0xb08d000000000000), /* men */
-    static_cast<uint64_t>(0xb091000000000000), /* mer */
-    static_cast<uint64_t>(0xb093000000000000), /* met */
-    static_cast<uint64_t>(0xb094000000000000), /* meu */
-    static_cast<uint64_t>(0xb0a0000000000000), /* mfa */
-    static_cast<uint64_t>(0xb0a4000000000000), /* mfe */
-    static_cast<uint64_t>(0xb0ad000000000000), /* mfn */
-    static_cast<uint64_t>(0xb0ae000000000000), /* mfo */
-    static_cast<uint64_t>(0xb0b0000000000000), /* mfq */
-    static_cast<uint64_t>(0x6d67000000000000), /* mg */
-    static_cast<uint64_t>(0xb0c7000000000000), /* mgh */
-    static_cast<uint64_t>(0xb0cb000000000000), /* mgl */
-    static_cast<uint64_t>(0xb0ce000000000000), /* mgo */
-    static_cast<uint64_t>(0xb0cf000000000000), /* mgp */
-    static_cast<uint64_t>(0xb0d8000000000000), /* mgy */
-    static_cast<uint64_t>(0x6d68000000000000), /* mh */
-    static_cast<uint64_t>(0xb0e8000000000000), /* mhi */
-    static_cast<uint64_t>(0xb0eb000000000000), /* mhl */
-    static_cast<uint64_t>(0x6d69000000000000), /* mi */
-    static_cast<uint64_t>(0xb105000000000000), /* mif */
-    static_cast<uint64_t>(0xb10d000000000000), /* min */
-    static_cast<uint64_t>(0xb112000000000000), /* mis */
-    static_cast<uint64_t>(0xb1124d6564660000), /* mis-Medf */
-    static_cast<uint64_t>(0xb116000000000000), /* miw */
-    static_cast<uint64_t>(0x6d6b000000000000), /* mk */
-    static_cast<uint64_t>(0xb148000000000000), /* mki */
-    static_cast<uint64_t>(0xb14b000000000000), /* mkl */
-    static_cast<uint64_t>(0xb14f000000000000), /* mkp */
-    static_cast<uint64_t>(0xb156000000000000), /* mkw */
-    static_cast<uint64_t>(0x6d6c000000000000), /* ml */
-    static_cast<uint64_t>(0xb164000000000000), /* mle */
-    static_cast<uint64_t>(0xb16f000000000000), /* mlp */
-    static_cast<uint64_t>(0xb172000000000000), /* mls */
-    static_cast<uint64_t>(0xb18e000000000000), /* mmo */
-    static_cast<uint64_t>(0xb194000000000000), /* mmu */
-    static_cast<uint64_t>(0xb197000000000000), /* mmx */
-    static_cast<uint64_t>(0x6d6e000000000000), /* mn */
-    static_cast<uint64_t>(0x6d6e00000000434e), /* mn-CN */
-    static_cast<uint64_t>(0x6d6e4d6f6e670000), /* mn-Mong */
-    static_cast<uint64_t>(0xb1a0000000000000), /* mna */
-    static_cast<uint64_t>(0xb1a5000000000000), /* mnf */
-    static_cast<uint64_t>(0xb1a8000000000000), /* mni */
-    static_cast<uint64_t>(0xb1b6000000000000), /* mnw */
-    static_cast<uint64_t>(0x6d6f000000000000), /* mo */
-    static_cast<uint64_t>(0xb1c0000000000000), /* moa */
-    static_cast<uint64_t>(0xb1c4000000000000), /* moe */
-    static_cast<uint64_t>(0xb1c7000000000000), /* moh */
-    static_cast<uint64_t>(0xb1d2000000000000), /* mos */
-    static_cast<uint64_t>(0xb1d7000000000000), /* mox */
-    static_cast<uint64_t>(0xb1ef000000000000), /* mpp */
-    static_cast<uint64_t>(0xb1f2000000000000), /* mps */
-    static_cast<uint64_t>(0xb1f3000000000000), /* mpt */
-    static_cast<uint64_t>(0xb1f7000000000000), /* mpx */
-    static_cast<uint64_t>(0xb20b000000000000), /* mql */
-    static_cast<uint64_t>(0x6d72000000000000), /* mr */
-    static_cast<uint64_t>(0xb223000000000000), /* mrd */
-    static_cast<uint64_t>(0xb229000000000000), /* mrj */
-    static_cast<uint64_t>(0xb22e000000000000), /* mro */
-    static_cast<uint64_t>(0x6d73000000000000), /* ms */
-    static_cast<uint64_t>(0x6d73000000004343), /* ms-CC */
-    static_cast<uint64_t>(0x6d74000000000000), /* mt */
-    static_cast<uint64_t>(0xb262000000000000), /* mtc */
-    static_cast<uint64_t>(0xb265000000000000), /* mtf */
-    static_cast<uint64_t>(0xb268000000000000), /* mti */
-    static_cast<uint64_t>(0xb271000000000000), /* mtr */
-    static_cast<uint64_t>(0xb280000000000000), /* mua */
-    static_cast<uint64_t>(0xb291000000000000), /* mur */
-    static_cast<uint64_t>(0xb292000000000000), /* mus */
-    static_cast<uint64_t>(0xb2a0000000000000), /* mva */
-    static_cast<uint64_t>(0xb2ad000000000000), /* mvn */
-    static_cast<uint64_t>(0xb2b8000000000000), /* mvy */
-    static_cast<uint64_t>(0xb2ca000000000000), /* mwk */
-    static_cast<uint64_t>(0xb2d1000000000000), /* mwr */
-    static_cast<uint64_t>(0xb2d5000000000000), /* mwv */
-    static_cast<uint64_t>(0xb2d6000000000000), /* mww */
-    static_cast<uint64_t>(0xb2e2000000000000), /* mxc */
-    static_cast<uint64_t>(0xb2ec000000000000), /* mxm */
-    static_cast<uint64_t>(0x6d79000000000000), /* my */
-    static_cast<uint64_t>(0xb30a000000000000), /* myk */
-    static_cast<uint64_t>(0xb30c000000000000), /* mym */
-    static_cast<uint64_t>(0xb315000000000000), /* myv */
-    static_cast<uint64_t>(0xb316000000000000), /* myw */
-    static_cast<uint64_t>(0xb317000000000000), /* myx */
-    static_cast<uint64_t>(0xb319000000000000), /* myz */
-    static_cast<uint64_t>(0xb32a000000000000), /* mzk */
-    static_cast<uint64_t>(0xb32c000000000000), /* mzm */
-    static_cast<uint64_t>(0xb32d000000000000), /* mzn */
-    static_cast<uint64_t>(0xb32f000000000000), /* mzp */
-    static_cast<uint64_t>(0xb336000000000000), /* mzw */
-    static_cast<uint64_t>(0xb339000000000000), /* mzz */
-    static_cast<uint64_t>(0x6e61000000000000), /* na */
-    static_cast<uint64_t>(0xb402000000000000), /* nac */
-    static_cast<uint64_t>(0xb405000000000000), /* naf */
-    static_cast<uint64_t>(0xb40a000000000000), /* nak */
-    static_cast<uint64_t>(0xb40d000000000000), /* nan */
-    static_cast<uint64_t>(0xb40f000000000000), /* nap */
-    static_cast<uint64_t>(0xb410000000000000), /* naq */
-    static_cast<uint64_t>(0xb412000000000000), /* nas */
-    static_cast<uint64_t>(0x6e62000000000000), /* nb */
-    static_cast<uint64_t>(0xb440000000000000), /* nca */
-    static_cast<uint64_t>(0xb444000000000000), /* nce */
-    static_cast<uint64_t>(0xb445000000000000), /* ncf */
-    static_cast<uint64_t>(0xb447000000000000), /* nch */
-    static_cast<uint64_t>(0xb44e000000000000), /* nco */
-    static_cast<uint64_t>(0xb454000000000000), /* ncu */
-    static_cast<uint64_t>(0x6e64000000000000), /* nd */
-    static_cast<uint64_t>(0xb462000000000000), /* ndc */
-    static_cast<uint64_t>(0xb472000000000000), /* nds */
-    static_cast<uint64_t>(0x6e65000000000000), /* ne */
-    static_cast<uint64_t>(0xb481000000000000), /* neb */
-    static_cast<uint64_t>(0xb496000000000000), /* new */
-    static_cast<uint64_t>(0xb497000000000000), /* nex */
-    static_cast<uint64_t>(0xb4b1000000000000), /* nfr */
-    static_cast<uint64_t>(0x6e67000000000000), /* ng */
-    static_cast<uint64_t>(0xb4c0000000000000), /* nga */
-    static_cast<uint64_t>(0xb4c1000000000000), /* ngb */
-    static_cast<uint64_t>(0xb4cb000000000000), /* ngl */
-    static_cast<uint64_t>(0xb4e1000000000000), /* nhb */
-    static_cast<uint64_t>(0xb4e4000000000000), /* nhe */
-    static_cast<uint64_t>(0xb4f6000000000000), /* nhw */
-    static_cast<uint64_t>(0xb505000000000000), /* nif */
-    static_cast<uint64_t>(0xb508000000000000), /* nii */
-    static_cast<uint64_t>(0xb509000000000000), /* nij */
-    static_cast<uint64_t>(0xb50d000000000000), /* nin */
-    static_cast<uint64_t>(0xb514000000000000), /* niu */
-    static_cast<uint64_t>(0xb518000000000000), /* niy */
-    static_cast<uint64_t>(0xb519000000000000), /* niz */
-    static_cast<uint64_t>(0xb52e000000000000), /* njo */
-    static_cast<uint64_t>(0xb546000000000000), /* nkg */
-    static_cast<uint64_t>(0xb54e000000000000), /* nko */
-    static_cast<uint64_t>(0x6e6c000000000000), /* nl */
-    static_cast<uint64_t>(0xb586000000000000), /* nmg */
-    static_cast<uint64_t>(0xb599000000000000), /* nmz */
-    static_cast<uint64_t>(0x6e6e000000000000), /* nn */
-    static_cast<uint64_t>(0xb5a5000000000000), /* nnf */
-    static_cast<uint64_t>(0xb5a7000000000000), /* nnh */
-    static_cast<uint64_t>(0xb5aa000000000000), /* nnk */
-    static_cast<uint64_t>(0xb5ac000000000000), /* nnm */
-    static_cast<uint64_t>(0xb5af000000000000), /* nnp */
-    static_cast<uint64_t>(0x6e6f000000000000), /* no */
-    static_cast<uint64_t>(0xb5c3000000000000), /* nod */
-    static_cast<uint64_t>(0xb5c4000000000000), /* noe */
-    static_cast<uint64_t>(0xb5cd000000000000), /* non */
-    static_cast<uint64_t>(0xb5cf000000000000), /* nop */
-    static_cast<uint64_t>(0xb5d4000000000000), /* nou */
-    static_cast<uint64_t>(0xb60e000000000000), /* nqo */
-    static_cast<uint64_t>(0x6e72000000000000), /* nr */
-    static_cast<uint64_t>(0xb621000000000000), /* nrb */
-    static_cast<uint64_t>(0xb64a000000000000), /* nsk */
-    static_cast<uint64_t>(0xb64d000000000000), /* nsn */
-    static_cast<uint64_t>(0xb64e000000000000), /* nso */
-    static_cast<uint64_t>(0xb652000000000000), /* nss */
-    static_cast<uint64_t>(0xb66c000000000000), /* ntm */
-    static_cast<uint64_t>(0xb671000000000000), /* ntr */
-    static_cast<uint64_t>(0xb688000000000000), /* nui */
-    static_cast<uint64_t>(0xb68f000000000000), /* nup */
-    static_cast<uint64_t>(0xb692000000000000), /* nus */
-    static_cast<uint64_t>(0xb695000000000000), /* nuv */
-    static_cast<uint64_t>(0xb697000000000000), /* nux */
-    static_cast<uint64_t>(0x6e76000000000000), /* nv */
-    static_cast<uint64_t>(0xb6c1000000000000), /* nwb */
-    static_cast<uint64_t>(0xb6f0000000000000), /* nxq */
-    static_cast<uint64_t>(0xb6f1000000000000), /* nxr */
-    static_cast<uint64_t>(0x6e79000000000000), /* ny */
-    static_cast<uint64_t>(0xb70c000000000000), /* nym */
-    static_cast<uint64_t>(0xb70d000000000000), /* nyn */
-    static_cast<uint64_t>(0xb728000000000000), /* nzi */
-    static_cast<uint64_t>(0x6f63000000000000), /* oc */
-    static_cast<uint64_t>(0xb8c2000000000000), /* ogc */
-    static_cast<uint64_t>(0xb951000000000000), /* okr */
-    static_cast<uint64_t>(0xb955000000000000), /* okv */
-    static_cast<uint64_t>(0x6f6d000000000000), /* om */
-    static_cast<uint64_t>(0xb9a6000000000000), /* ong */
-    static_cast<uint64_t>(0xb9ad000000000000), /* onn */
-    static_cast<uint64_t>(0xb9b2000000000000), /* ons */
-    static_cast<uint64_t>(0xb9ec000000000000), /* opm */
-    static_cast<uint64_t>(0x6f72000000000000), /* or */
-    static_cast<uint64_t>(0xba2e000000000000), /* oro */
-    static_cast<uint64_t>(0xba34000000000000), /* oru */
-    static_cast<uint64_t>(0x6f73000000000000), /* os */
-    static_cast<uint64_t>(0xba40000000000000), /* osa */
-    static_cast<uint64_t>(0xba60000000000000), /* ota */
-    static_cast<uint64_t>(0xba6a000000000000), /* otk */
-    static_cast<uint64_t>(0xbb2c000000000000), /* ozm */
-    static_cast<uint64_t>(0x7061000000000000), /* pa */
-    static_cast<uint64_t>(0x7061417261620000), /* pa-Arab */
-    static_cast<uint64_t>(0x706100000000504b), /* pa-PK */
-    static_cast<uint64_t>(0xbc06000000000000), /* pag */
-    static_cast<uint64_t>(0xbc0b000000000000), /* pal */
-    static_cast<uint64_t>(0xbc0b50686c700000), /* pal-Phlp */
-    static_cast<uint64_t>(0xbc0c000000000000), /* pam */
-    static_cast<uint64_t>(0xbc0f000000000000), /* pap */
-    static_cast<uint64_t>(0xbc14000000000000), /* pau */
-    static_cast<uint64_t>(0xbc28000000000000), /* pbi */
-    static_cast<uint64_t>(0xbc43000000000000), /* pcd */
-    static_cast<uint64_t>(0xbc4c000000000000), /* pcm */
-    static_cast<uint64_t>(0xbc62000000000000), /* pdc */
-    static_cast<uint64_t>(0xbc73000000000000), /* pdt */
-    static_cast<uint64_t>(0xbc83000000000000), /* ped */
-    static_cast<uint64_t>(0xbc8e000000000000), /* peo */
-    static_cast<uint64_t>(0xbc97000000000000), /* pex */
-    static_cast<uint64_t>(0xbcab000000000000), /* pfl */
-    static_cast<uint64_t>(0xbceb000000000000), /* phl */
-    static_cast<uint64_t>(0xbced000000000000), /* phn */
-    static_cast<uint64_t>(0xbd0b000000000000), /* pil */
-    static_cast<uint64_t>(0xbd0f000000000000), /* pip */
-    static_cast<uint64_t>(0xbd40000000000000), /* pka */
-    static_cast<uint64_t>(0xbd4e000000000000), /* pko */
-    static_cast<uint64_t>(0x706c000000000000), /* pl */
-    static_cast<uint64_t>(0xbd60000000000000), /* pla */
-    static_cast<uint64_t>(0xbd92000000000000), /* pms */
-    static_cast<uint64_t>(0xbda6000000000000), /* png */
-    static_cast<uint64_t>(0xbdad000000000000), /* pnn */
-    static_cast<uint64_t>(0xbdb3000000000000), /* pnt */
-    static_cast<uint64_t>(0xbdcd000000000000), /* pon */
-    static_cast<uint64_t>(0xbde0000000000000), /* ppa */
-    static_cast<uint64_t>(0xbdee000000000000), /* ppo */
-    static_cast<uint64_t>(0xbe20000000000000), /* pra */
-    static_cast<uint64_t>(0xbe23000000000000), /* prd */
-    static_cast<uint64_t>(0xbe26000000000000), /* prg */
-    static_cast<uint64_t>(0x7073000000000000), /* ps */
-    static_cast<uint64_t>(0xbe52000000000000), /* pss */
-    static_cast<uint64_t>(0x7074000000000000), /* pt */
-    static_cast<uint64_t>(0xbe6f000000000000), /* ptp */
-    static_cast<uint64_t>(0xbe94000000000000), /* puu */
-    static_cast<uint64_t>(0xbec0000000000000), /* pwa */
-    static_cast<uint64_t>(0x7175000000000000), /* qu */
-    static_cast<uint64_t>(0xc282000000000000), /* quc */
-    static_cast<uint64_t>(0xc286000000000000), /* qug */
-    static_cast<uint64_t>(0xc408000000000000), /* rai */
-    static_cast<uint64_t>(0xc409000000000000), /* raj */
-    static_cast<uint64_t>(0xc40e000000000000), /* rao */
-    static_cast<uint64_t>(0xc445000000000000), /* rcf */
-    static_cast<uint64_t>(0xc489000000000000), /* rej */
-    static_cast<uint64_t>(0xc48b000000000000), /* rel */
-    static_cast<uint64_t>(0xc492000000000000), /* res */
-    static_cast<uint64_t>(0xc4cd000000000000), /* rgn */
-    static_cast<uint64_t>(0xc4e6000000000000), /* rhg */
-    static_cast<uint64_t>(0xc500000000000000), /* ria */
-    static_cast<uint64_t>(0xc505000000000000), /* rif */
-    static_cast<uint64_t>(0xc505000000004e4c), /* rif-NL */
-    static_cast<uint64_t>(0xc532000000000000), /* rjs */
-    static_cast<uint64_t>(0xc553000000000000), /* rkt */
-    static_cast<uint64_t>(0x726d000000000000), /* rm */
-    static_cast<uint64_t>(0xc585000000000000), /* rmf */
-    static_cast<uint64_t>(0xc58e000000000000), /* rmo */
-    static_cast<uint64_t>(0xc593000000000000), /* rmt */
-    static_cast<uint64_t>(0xc594000000000000), /* rmu */
-    static_cast<uint64_t>(0x726e000000000000), /* rn */
-    static_cast<uint64_t>(0xc5a0000000000000), /* rna */
-    static_cast<uint64_t>(0xc5a6000000000000), /* rng */
-    static_cast<uint64_t>(0x726f000000000000), /* ro */
-    static_cast<uint64_t>(0xc5c1000000000000), /* rob */
-    static_cast<uint64_t>(0xc5c5000000000000), /* rof */
-    static_cast<uint64_t>(0xc5ce000000000000), /* roo */
-    static_cast<uint64_t>(0xc62e000000000000), /* rro */
-    static_cast<uint64_t>(0xc66c000000000000), /* rtm */
-    static_cast<uint64_t>(0x7275000000000000), /* ru */
-    static_cast<uint64_t>(0xc684000000000000), /* rue */
-    static_cast<uint64_t>(0xc686000000000000), /* rug */
-    static_cast<uint64_t>(0x7277000000000000), /* rw */
-    static_cast<uint64_t>(0xc6ca000000000000), /* rwk */
-    static_cast<uint64_t>(0xc6ce000000000000), /* rwo */
-    static_cast<uint64_t>(0xc714000000000000), /* ryu */
-    static_cast<uint64_t>(0x7361000000000000), /* sa */
-    static_cast<uint64_t>(0xc805000000000000), /* saf */
-    static_cast<uint64_t>(0xc807000000000000), /* sah */
-    static_cast<uint64_t>(0xc810000000000000), /* saq */
-    static_cast<uint64_t>(0xc812000000000000), /* sas */
-    static_cast<uint64_t>(0xc813000000000000), /* sat */
-    static_cast<uint64_t>(0xc815000000000000), /* sav */
-    static_cast<uint64_t>(0xc819000000000000), /* saz */
-    static_cast<uint64_t>(0xc820000000000000), /* sba */
-    static_cast<uint64_t>(0xc824000000000000), /* sbe */
-    static_cast<uint64_t>(0xc82f000000000000), /* sbp */
-    static_cast<uint64_t>(0x7363000000000000), /* sc */
-    static_cast<uint64_t>(0xc84a000000000000), /* sck */
-    static_cast<uint64_t>(0xc84b000000000000), /* scl */
-    static_cast<uint64_t>(0xc84d000000000000), /* scn */
-    static_cast<uint64_t>(0xc84e000000000000), /* sco */
-    static_cast<uint64_t>(0xc852000000000000), /* scs */
-    static_cast<uint64_t>(0x7364000000000000), /* sd */
-    static_cast<uint64_t>(0x7364446576610000), /* sd-Deva */
-    static_cast<uint64_t>(0x73644b686f6a0000), /* sd-Khoj */
-    static_cast<uint64_t>(0x736453696e640000), /* sd-Sind */
-    static_cast<uint64_t>(0xc862000000000000), /* sdc */
-    static_cast<uint64_t>(0xc867000000000000), /* sdh */
-    static_cast<uint64_t>(0x7365000000000000), /* se */
-    static_cast<uint64_t>(0xc885000000000000), /* sef */
-    static_cast<uint64_t>(0xc887000000000000), /* seh */
-    static_cast<uint64_t>(0xc888000000000000), /* sei */
-    static_cast<uint64_t>(0xc892000000000000), /* ses */
-    static_cast<uint64_t>(0x7367000000000000), /* sg */
-    static_cast<uint64_t>(0xc8c0000000000000), /* sga */
-    static_cast<uint64_t>(0xc8d2000000000000), /* sgs */
-    static_cast<uint64_t>(0xc8d6000000000000), /* sgw */
-    static_cast<uint64_t>(0xc8d9000000000000), /* sgz */
-    static_cast<uint64_t>(0xc8e8000000000000), /* shi */
-    static_cast<uint64_t>(0xc8ea000000000000), /* shk */
-    static_cast<uint64_t>(0xc8ed000000000000), /* shn */
-    static_cast<uint64_t>(0xc8f4000000000000), /* shu */
-    static_cast<uint64_t>(0x7369000000000000), /* si */
-    static_cast<uint64_t>(0xc903000000000000), /* sid */
-    static_cast<uint64_t>(0xc906000000000000), /* sig */
-    static_cast<uint64_t>(0xc90b000000000000), /* sil */
-    static_cast<uint64_t>(0xc90c000000000000), /* sim */
-    static_cast<uint64_t>(0xc931000000000000), /* sjr */
-    static_cast<uint64_t>(0x736b000000000000), /* sk */
-    static_cast<uint64_t>(0xc942000000000000), /* skc */
-    static_cast<uint64_t>(0xc951000000000000), /* skr */
-    static_cast<uint64_t>(0xc952000000000000), /* sks */
-    static_cast<uint64_t>(0x736c000000000000), /* sl */
-    static_cast<uint64_t>(0xc963000000000000), /* sld */
-    static_cast<uint64_t>(0xc968000000000000), /* sli */
-    static_cast<uint64_t>(0xc96b000000000000), /* sll */
-    static_cast<uint64_t>(0xc978000000000000), /* sly */
-    static_cast<uint64_t>(0x736d000000000000), /* sm */
-    static_cast<uint64_t>(0xc980000000000000), /* sma */
-    static_cast<uint64_t>(0xc989000000000000), /* smj */
-    static_cast<uint64_t>(0xc98d000000000000), /* smn */
-    static_cast<uint64_t>(0xc98f000000000000), /* smp */
-    static_cast<uint64_t>(0xc990000000000000), /* smq */
-    static_cast<uint64_t>(0xc992000000000000), /* sms */
-    static_cast<uint64_t>(0x736e000000000000), /* sn */
-    static_cast<uint64_t>(0xc9a2000000000000), /* snc */
-    static_cast<uint64_t>(0xc9aa000000000000), /* snk */
-    static_cast<uint64_t>(0xc9af000000000000), /* snp */
-    static_cast<uint64_t>(0xc9b7000000000000), /* snx */
-    static_cast<uint64_t>(0xc9b8000000000000), /* sny */
-    static_cast<uint64_t>(0x736f000000000000), /* so */
-    static_cast<uint64_t>(0xc9c6000000000000), /* sog */
-    static_cast<uint64_t>(0xc9ca000000000000), /* sok */
-    static_cast<uint64_t>(0xc9d0000000000000), /* soq */
-    static_cast<uint64_t>(0xc9d4000000000000), /* sou */
-    static_cast<uint64_t>(0xc9d8000000000000), /* soy */
-    static_cast<uint64_t>(0xc9e3000000000000), /* spd */
-    static_cast<uint64_t>(0xc9eb000000000000), /* spl */
-    static_cast<uint64_t>(0xc9f2000000000000), /* sps */
-    static_cast<uint64_t>(0x7371000000000000), /* sq */
-    static_cast<uint64_t>(0x7372000000000000), /* sr */
-    static_cast<uint64_t>(0x7372000000004d45), /* sr-ME */
-    static_cast<uint64_t>(0x737200000000524f), /* sr-RO */
-    static_cast<uint64_t>(0x7372000000005255), /* sr-RU */
-    static_cast<uint64_t>(0x7372000000005452), /* sr-TR */
-    static_cast<uint64_t>(0xca21000000000000), /* srb */
-    static_cast<uint64_t>(0xca2d000000000000), /* srn */
-    static_cast<uint64_t>(0xca31000000000000), /* srr */
-    static_cast<uint64_t>(0xca37000000000000), /* srx */
-    static_cast<uint64_t>(0x7373000000000000), /* ss */
-    static_cast<uint64_t>(0xca43000000000000), /* ssd */
-    static_cast<uint64_t>(0xca46000000000000), /* ssg */
-    static_cast<uint64_t>(0xca58000000000000), /* ssy */
-    static_cast<uint64_t>(0x7374000000000000), /* st */
-    static_cast<uint64_t>(0xca6a000000000000), /* stk */
-    static_cast<uint64_t>(0xca70000000000000), /* stq */
-    static_cast<uint64_t>(0x7375000000000000), /* su */
-    static_cast<uint64_t>(0xca80000000000000), /* sua */
-    static_cast<uint64_t>(0xca84000000000000), /* sue */
-    static_cast<uint64_t>(0xca8a000000000000), /* suk */
-    static_cast<uint64_t>(0xca91000000000000), /* sur */
-    static_cast<uint64_t>(0xca92000000000000), /* sus */
-    static_cast<uint64_t>(0x7376000000000000), /* sv */
-    static_cast<uint64_t>(0x7377000000000000), /* sw */
-    static_cast<uint64_t>(0xcac1000000000000), /* swb */
-    static_cast<uint64_t>(0xcac2000000000000), /* swc */
-    static_cast<uint64_t>(0xcac6000000000000), /* swg */
-    static_cast<uint64_t>(0xcacf000000000000), /* swp */
-    static_cast<uint64_t>(0xcad5000000000000), /* swv */
-    static_cast<uint64_t>(0xcaed000000000000), /* sxn */
-    static_cast<uint64_t>(0xcaf6000000000000), /* sxw */
-    static_cast<uint64_t>(0xcb0b000000000000), /* syl */
-    static_cast<uint64_t>(0xcb11000000000000), /* syr */
-    static_cast<uint64_t>(0xcb2b000000000000), /* szl */
-    static_cast<uint64_t>(0x7461000000000000), /* ta */
-    static_cast<uint64_t>(0xcc09000000000000), /* taj */
-    static_cast<uint64_t>(0xcc0b000000000000), /* tal */
-    static_cast<uint64_t>(0xcc0d000000000000), /* tan */
-    static_cast<uint64_t>(0xcc10000000000000), /* taq */
-    static_cast<uint64_t>(0xcc22000000000000), /* tbc */
-    static_cast<uint64_t>(0xcc23000000000000), /* tbd */
-    static_cast<uint64_t>(0xcc25000000000000), /* tbf */
-    static_cast<uint64_t>(0xcc26000000000000), /* tbg */
-    static_cast<uint64_t>(0xcc2e000000000000), /* tbo */
-    static_cast<uint64_t>(0xcc36000000000000), /* tbw */
-    static_cast<uint64_t>(0xcc39000000000000), /* tbz */
-    static_cast<uint64_t>(0xcc48000000000000), /* tci */
-    static_cast<uint64_t>(0xcc58000000000000), /* tcy */
-    static_cast<uint64_t>(0xcc63000000000000), /* tdd */
-    static_cast<uint64_t>(0xcc66000000000000), /* tdg */
-    static_cast<uint64_t>(0xcc67000000000000), /* tdh */
-    static_cast<uint64_t>(0xcc74000000000000), /* tdu */
-    static_cast<uint64_t>(0x7465000000000000), /* te */
-    static_cast<uint64_t>(0xcc83000000000000), /* ted */
-    static_cast<uint64_t>(0xcc8c000000000000), /* tem */
-    static_cast<uint64_t>(0xcc8e000000000000), /* teo */
-    static_cast<uint64_t>(0xcc93000000000000), /* tet */
-    static_cast<uint64_t>(0xcca8000000000000), /* tfi */
-    static_cast<uint64_t>(0x7467000000000000), /* tg */
-    static_cast<uint64_t>(0x7467417261620000), /* tg-Arab */
-    static_cast<uint64_t>(0x746700000000504b), /* tg-PK */
-    static_cast<uint64_t>(0xccc2000000000000), /* tgc */
-    static_cast<uint64_t>(0xccce000000000000), /* tgo */
-    static_cast<uint64_t>(0xccd4000000000000), /* tgu */
-    static_cast<uint64_t>(0x7468000000000000), /* th */
-    static_cast<uint64_t>(0xcceb000000000000), /* thl */
-    static_cast<uint64_t>(0xccf0000000000000), /* thq */
-    static_cast<uint64_t>(0xccf1000000000000), /* thr */
-    static_cast<uint64_t>(0x7469000000000000), /* ti */
-    static_cast<uint64_t>(0xcd05000000000000), /* tif */
-    static_cast<uint64_t>(0xcd06000000000000), /* tig */
-    static_cast<uint64_t>(0xcd0a000000000000), /* tik */
-    static_cast<uint64_t>(0xcd0c000000000000), /* tim */
-    static_cast<uint64_t>(0xcd0e000000000000), /* tio */
-    static_cast<uint64_t>(0xcd15000000000000), /* tiv */
-    static_cast<uint64_t>(0x746b000000000000), /* tk */
-    static_cast<uint64_t>(0xcd4b000000000000), /* tkl */
-    static_cast<uint64_t>(0xcd51000000000000), /* tkr */
-    static_cast<uint64_t>(0xcd53000000000000), /* tkt */
-    static_cast<uint64_t>(0x746c000000000000), /* tl */
-    static_cast<uint64_t>(0xcd65000000000000), /* tlf */
-    static_cast<uint64_t>(0xcd77000000000000), /* tlx */
-    static_cast<uint64_t>(0xcd78000000000000), /* tly */
-    static_cast<uint64_t>(0xcd87000000000000), /* tmh */
-    static_cast<uint64_t>(0xcd98000000000000), /* tmy */
-    static_cast<uint64_t>(0x746e000000000000), /* tn */
-    static_cast<uint64_t>(0xcda7000000000000), /* tnh */
-    static_cast<uint64_t>(0x746f000000000000), /* to */
-    static_cast<uint64_t>(0xcdc5000000000000), /* tof */
-    static_cast<uint64_t>(0xcdc6000000000000), /* tog */
-    static_cast<uint64_t>(0xcdd0000000000000), /* toq */
-    static_cast<uint64_t>(0xcde8000000000000), /* tpi */
-    static_cast<uint64_t>(0xcdec000000000000), /* tpm */
-    static_cast<uint64_t>(0xcdf9000000000000), /* tpz */
-    static_cast<uint64_t>(0xce0e000000000000), /* tqo */
-    static_cast<uint64_t>(0x7472000000000000), /* tr */
-    static_cast<uint64_t>(0xce34000000000000), /* tru */
-    static_cast<uint64_t>(0xce35000000000000), /* trv */
-    static_cast<uint64_t>(0xce36000000000000), /* trw */
-    static_cast<uint64_t>(0x7473000000000000), /* ts */
-    static_cast<uint64_t>(0xce43000000000000), /* tsd */
-    static_cast<uint64_t>(0xce45000000000000), /* tsf */
-    static_cast<uint64_t>(0xce46000000000000), /* tsg */
-    static_cast<uint64_t>(0xce49000000000000), /* tsj */
-    static_cast<uint64_t>(0xce56000000000000), /* tsw */
-    static_cast<uint64_t>(0x7474000000000000), /* tt */
-    static_cast<uint64_t>(0xce63000000000000), /* ttd */
-    static_cast<uint64_t>(0xce64000000000000), /* tte */
-    static_cast<uint64_t>(0xce69000000000000), /* ttj */
-    static_cast<uint64_t>(0xce71000000000000), /* ttr */
-    static_cast<uint64_t>(0xce72000000000000), /* tts */
-    static_cast<uint64_t>(0xce73000000000000), /* ttt */
-    static_cast<uint64_t>(0xce87000000000000), /* tuh */
-    static_cast<uint64_t>(0xce8b000000000000), /* tul */
-    static_cast<uint64_t>(0xce8c000000000000), /* tum */
-    static_cast<uint64_t>(0xce90000000000000), /* tuq */
-    static_cast<uint64_t>(0xcea3000000000000), /* tvd */
-    static_cast<uint64_t>(0xceab000000000000), /* tvl */
-    static_cast<uint64_t>(0xceb4000000000000), /* tvu */
-    static_cast<uint64_t>(0xcec7000000000000), /* twh */
-    static_cast<uint64_t>(0xced0000000000000), /* twq */
-    static_cast<uint64_t>(0xcee6000000000000), /* txg */
-    static_cast<uint64_t>(0x7479000000000000), /* ty */
-    static_cast<uint64_t>(0xcf00000000000000), /* tya */
-    static_cast<uint64_t>(0xcf15000000000000), /* tyv */
-    static_cast<uint64_t>(0xcf2c000000000000), /* tzm */
-    static_cast<uint64_t>(0xd034000000000000), /* ubu */
-    static_cast<uint64_t>(0xd06c000000000000), /* udm */
-    static_cast<uint64_t>(0x7567000000000000), /* ug */
-    static_cast<uint64_t>(0x75674379726c0000), /* ug-Cyrl */
-    static_cast<uint64_t>(0x7567000000004b5a), /* ug-KZ */
-    static_cast<uint64_t>(0x7567000000004d4e), /* ug-MN */
-    static_cast<uint64_t>(0xd0c0000000000000), /* uga */
-    static_cast<uint64_t>(0x756b000000000000), /* uk */
-    static_cast<uint64_t>(0xd168000000000000), /* uli */
-    static_cast<uint64_t>(0xd181000000000000), /* umb */
-    static_cast<uint64_t>(0xd1b1000000000000), /* unr */
-    static_cast<uint64_t>(0xd1b1446576610000), /* unr-Deva */
-    static_cast<uint64_t>(0xd1b1000000004e50), /* unr-NP */
-    static_cast<uint64_t>(0xd1b7000000000000), /* unx */
-    static_cast<uint64_t>(0xd1ca000000000000), /* uok */
-    static_cast<uint64_t>(0x7572000000000000), /* ur */
-    static_cast<uint64_t>(0xd228000000000000), /* uri */
-    static_cast<uint64_t>(0xd233000000000000), /* urt */
-    static_cast<uint64_t>(0xd236000000000000), /* urw */
-    static_cast<uint64_t>(0xd240000000000000), /* usa */
-    static_cast<uint64_t>(0xd267000000000000), /* uth */
-    static_cast<uint64_t>(0xd271000000000000), /* utr */
-    static_cast<uint64_t>(0xd2a7000000000000), /* uvh */
-    static_cast<uint64_t>(0xd2ab000000000000), /* uvl */
-    static_cast<uint64_t>(0x757a000000000000), /* uz */
-    static_cast<uint64_t>(0x757a000000004146), /* uz-AF */
-    static_cast<uint64_t>(0x757a417261620000), /* uz-Arab */
-    static_cast<uint64_t>(0x757a00000000434e), /* uz-CN */
-    static_cast<uint64_t>(0xd406000000000000), /* vag */
-    static_cast<uint64_t>(0xd408000000000000), /* vai */
-    static_cast<uint64_t>(0xd40d000000000000), /* van */
-    static_cast<uint64_t>(0x7665000000000000), /* ve */
-    static_cast<uint64_t>(0xd482000000000000), /* vec */
-    static_cast<uint64_t>(0xd48f000000000000), /* vep */
-    static_cast<uint64_t>(0x7669000000000000), /* vi */
-    static_cast<uint64_t>(0xd502000000000000), /* vic */
-    static_cast<uint64_t>(0xd515000000000000), /* viv */
-    static_cast<uint64_t>(0xd572000000000000), /* vls */
-    static_cast<uint64_t>(0xd585000000000000), /* vmf */
-    static_cast<uint64_t>(0xd596000000000000), /* vmw */
-    static_cast<uint64_t>(0x766f000000000000), /* vo */
-    static_cast<uint64_t>(0xd5d3000000000000), /* vot */
-    static_cast<uint64_t>(0xd62e000000000000), /* vro */
-    static_cast<uint64_t>(0xd68d000000000000), /* vun */
-    static_cast<uint64_t>(0xd693000000000000), /* vut */
-    static_cast<uint64_t>(0x7761000000000000), /* wa */
-    static_cast<uint64_t>(0xd804000000000000), /* wae */
-    static_cast<uint64_t>(0xd809000000000000), /* waj */
-    static_cast<uint64_t>(0xd80b000000000000), /* wal */
-    static_cast<uint64_t>(0xd80d000000000000), /* wan */
-    static_cast<uint64_t>(0xd811000000000000), /* war */
-    static_cast<uint64_t>(0xd82f000000000000), /* wbp */
-    static_cast<uint64_t>(0xd830000000000000), /* wbq */
-    static_cast<uint64_t>(0xd831000000000000), /* wbr */
-    static_cast<uint64_t>(0xd848000000000000), /* wci */
-    static_cast<uint64_t>(0xd891000000000000), /* wer */
-    static_cast<uint64_t>(0xd8c8000000000000), /* wgi */
-    static_cast<uint64_t>(0xd8e6000000000000), /* whg */
-    static_cast<uint64_t>(0xd901000000000000), /* wib */
-    static_cast<uint64_t>(0xd914000000000000), /* wiu */
-    static_cast<uint64_t>(0xd915000000000000), /* wiv */
-    static_cast<uint64_t>(0xd920000000000000), /* wja */
-    static_cast<uint64_t>(0xd928000000000000), /* wji */
-    static_cast<uint64_t>(0xd972000000000000), /* wls */
-    static_cast<uint64_t>(0xd98e000000000000), /* wmo */
-    static_cast<uint64_t>(0xd9a2000000000000), /* wnc */
-    static_cast<uint64_t>(0xd9a8000000000000), /* wni */
-    static_cast<uint64_t>(0xd9b4000000000000), /* wnu */
-    static_cast<uint64_t>(0x776f000000000000), /* wo */
-    static_cast<uint64_t>(0xd9c1000000000000), /* wob */
-    static_cast<uint64_t>(0xd9d2000000000000), /* wos */
-    static_cast<uint64_t>(0xda32000000000000), /* wrs */
-    static_cast<uint64_t>(0xda46000000000000), /* wsg */
-    static_cast<uint64_t>(0xda4a000000000000), /* wsk */
-    static_cast<uint64_t>(0xda6c000000000000), /* wtm */
-    static_cast<uint64_t>(0xda94000000000000), /* wuu */
-    static_cast<uint64_t>(0xda95000000000000), /* wuv */
-    static_cast<uint64_t>(0xdac0000000000000), /* wwa */
-    static_cast<uint64_t>(0xdc15000000000000), /* xav */
-    static_cast<uint64_t>(0xdc28000000000000), /* xbi */
-    static_cast<uint64_t>(0xdc4e000000000000), /* xco */
-    static_cast<uint64_t>(0xdc51000000000000), /* xcr */
-    static_cast<uint64_t>(0xdc92000000000000), /* xes */
-    static_cast<uint64_t>(0x7868000000000000), /* xh */
-    static_cast<uint64_t>(0xdd60000000000000), /* xla */
-    static_cast<uint64_t>(0xdd62000000000000), /* xlc */
-    static_cast<uint64_t>(0xdd63000000000000), /* xld */
-    static_cast<uint64_t>(0xdd85000000000000), /* xmf */
-    static_cast<uint64_t>(0xdd8d000000000000), /* xmn */
-    static_cast<uint64_t>(0xdd91000000000000), /* xmr */
-    static_cast<uint64_t>(0xdda0000000000000), /* xna */
-    static_cast<uint64_t>(0xddb1000000000000), /* xnr */
-    static_cast<uint64_t>(0xddc6000000000000), /* xog */
-    static_cast<uint64_t>(0xddcd000000000000), /* xon */
-    static_cast<uint64_t>(0xddf1000000000000), /* xpr */
-    static_cast<uint64_t>(0xde21000000000000), /* xrb */
-    static_cast<uint64_t>(0xde40000000000000), /* xsa */
-    static_cast<uint64_t>(0xde48000000000000), /* xsi */
-    static_cast<uint64_t>(0xde4c000000000000), /* xsm */
-    static_cast<uint64_t>(0xde51000000000000), /* xsr */
-    static_cast<uint64_t>(0xdec4000000000000), /* xwe */
-    static_cast<uint64_t>(0xe00c000000000000), /* yam */
-    static_cast<uint64_t>(0xe00e000000000000), /* yao */
-    static_cast<uint64_t>(0xe00f000000000000), /* yap */
-    static_cast<uint64_t>(0xe012000000000000), /* yas */
-    static_cast<uint64_t>(0xe013000000000000), /* yat */
-    static_cast<uint64_t>(0xe015000000000000), /* yav */
-    static_cast<uint64_t>(0xe018000000000000), /* yay */
-    static_cast<uint64_t>(0xe019000000000000), /* yaz */
-    static_cast<uint64_t>(0xe020000000000000), /* yba */
-    static_cast<uint64_t>(0xe021000000000000), /* ybb */
-    static_cast<uint64_t>(0xe038000000000000), /* yby */
-    static_cast<uint64_t>(0xe091000000000000), /* yer */
-    static_cast<uint64_t>(0xe0d1000000000000), /* ygr */
-    static_cast<uint64_t>(0xe0d6000000000000), /* ygw */
-    static_cast<uint64_t>(0x7969000000000000), /* yi */
-    static_cast<uint64_t>(0xe14e000000000000), /* yko */
-    static_cast<uint64_t>(0xe164000000000000), /* yle */
-    static_cast<uint64_t>(0xe166000000000000), /* ylg */
-    static_cast<uint64_t>(0xe16b000000000000), /* yll */
-    static_cast<uint64_t>(0xe18b000000000000), /* yml */
-    static_cast<uint64_t>(0x796f000000000000), /* yo */
-    static_cast<uint64_t>(0xe1cd000000000000), /* yon */
-    static_cast<uint64_t>(0xe221000000000000), /* yrb */
-    static_cast<uint64_t>(0xe224000000000000), /* yre */
-    static_cast<uint64_t>(0xe22b000000000000), /* yrl */
-    static_cast<uint64_t>(0xe252000000000000), /* yss */
-    static_cast<uint64_t>(0xe280000000000000), /* yua */
-    static_cast<uint64_t>(0xe284000000000000), /* yue */
-    static_cast<uint64_t>(0xe28400000000434e), /* yue-CN */
-    static_cast<uint64_t>(0xe28448616e730000), /* yue-Hans */
-    static_cast<uint64_t>(0xe289000000000000), /* yuj */
-    static_cast<uint64_t>(0xe293000000000000), /* yut */
-    static_cast<uint64_t>(0xe296000000000000), /* yuw */
-    static_cast<uint64_t>(0x7a61000000000000), /* za */
-    static_cast<uint64_t>(0xe406000000000000), /* zag */
-    static_cast<uint64_t>(0xe469000000000000), /* zdj */
-    static_cast<uint64_t>(0xe480000000000000), /* zea */
-    static_cast<uint64_t>(0xe4c7000000000000), /* zgh */
-    static_cast<uint64_t>(0x7a68000000000000), /* zh */
-    static_cast<uint64_t>(0x7a68000000004155), /* zh-AU */
-    static_cast<uint64_t>(0x7a6800000000424e), /* zh-BN */
-    static_cast<uint64_t>(0x7a68426f706f0000), /* zh-Bopo */
-    static_cast<uint64_t>(0x7a68000000004742), /* zh-GB */
-    static_cast<uint64_t>(0x7a68000000004746), /* zh-GF */
-    static_cast<uint64_t>(0x7a6800000000484b), /* zh-HK */
-    static_cast<uint64_t>(0x7a6848616e620000), /* zh-Hanb */
-    static_cast<uint64_t>(0x7a6848616e740000), /* zh-Hant */
-    static_cast<uint64_t>(0x7a68000000004944), /* zh-ID */
-    static_cast<uint64_t>(0x7a68000000004d4f), /* zh-MO */
-    static_cast<uint64_t>(0x7a68000000005041), /* zh-PA */
-    static_cast<uint64_t>(0x7a68000000005046), /* zh-PF */
-    static_cast<uint64_t>(0x7a68000000005048), /* zh-PH */
-    static_cast<uint64_t>(0x7a68000000005352), /* zh-SR */
-    static_cast<uint64_t>(0x7a68000000005448), /* zh-TH */
-    static_cast<uint64_t>(0x7a68000000005457), /* zh-TW */
-    static_cast<uint64_t>(0x7a68000000005553), /* zh-US */
-    static_cast<uint64_t>(0x7a6800000000564e), /* zh-VN */
-    static_cast<uint64_t>(0xe4f7000000000000), /* zhx */
-    static_cast<uint64_t>(0xe500000000000000), /* zia */
-    static_cast<uint64_t>(0xe553000000000000), /* zkt */
-    static_cast<uint64_t>(0xe56c000000000000), /* zlm */
-    static_cast<uint64_t>(0xe588000000000000), /* zmi */
-    static_cast<uint64_t>(0xe5a4000000000000), /* zne */
-    static_cast<uint64_t>(0x7a75000000000000), /* zu */
-    static_cast<uint64_t>(0xe720000000000000), /* zza */
-};
+// Locale to its likely language-script-region locale, sorted by key.
+constexpr std::array<LocaleDataEntry, 1412> LIKELY_TAGS = {{
+    { 0x6161000000000000, 0x61614c61746e4554 }, /* aa -> aa-Latn-ET */
+    { 0x6162000000000000, 0x61624379726c4745 }, /* ab -> ab-Cyrl-GE */
+    { 0x6165000000000000, 0x6165417673744952 }, /* ae -> ae-Avst-IR */
+    { 0x6166000000000000, 0x61664c61746e5a41 }, /* af -> af-Latn-ZA */
+    { 0x616b000000000000, 0x616b4c61746e4748 }, /* ak -> ak-Latn-GH */
+    { 0x616d000000000000, 0x616d457468694554 }, /* am -> am-Ethi-ET */
+    { 0x616e000000000000, 0x616e4c61746e4553 }, /* an -> an-Latn-ES */
+    { 0x6172000000000000, 0x6172417261624547 }, /* ar -> ar-Arab-EG */
+    { 0x6173000000000000, 0x617342656e67494e }, /* as -> as-Beng-IN */
+    { 0x6176000000000000, 0x61764379726c5255 }, /* av -> av-Cyrl-RU */
+    { 0x6179000000000000, 0x61794c61746e424f }, /* ay -> ay-Latn-BO */
+    { 0x617a000000000000, 0x617a4c61746e415a }, /* az -> az-Latn-AZ */
+    { 0x617a000000004951, 0x617a417261624951 }, /* az-IQ -> az-Arab-IQ */
+    { 0x617a000000004952, 0x617a417261624952 }, /* az-IR -> az-Arab-IR */
+    { 0x617a000000005255, 0x617a4379726c5255 }, /* az-RU -> az-Cyrl-RU */
+    { 0x617a417261620000, 0x617a417261624952 }, /* az-Arab -> az-Arab-IR */
+    { 0x6261000000000000, 0x62614379726c5255 }, /* ba -> ba-Cyrl-RU */
+    { 0x6265000000000000, 0x62654379726c4259 }, /* be -> be-Cyrl-BY */
+    { 0x6267000000000000, 0x62674379726c4247 }, /* bg -> bg-Cyrl-BG */
+    { 0x6269000000000000, 0x62694c61746e5655 }, /* bi -> bi-Latn-VU */
+    { 0x626d000000000000, 0x626d4c61746e4d4c }, /* bm -> bm-Latn-ML */
+    { 0x626e000000000000, 0x626e42656e674244 }, /* bn -> bn-Beng-BD */
+    { 0x626f000000000000, 0x626f54696274434e }, /* bo -> bo-Tibt-CN */
+    { 0x6272000000000000, 0x62724c61746e4652 }, /* br -> br-Latn-FR */
+    { 0x6273000000000000, 0x62734c61746e4241 }, /* bs -> bs-Latn-BA */
+    { 0x6361000000000000, 0x63614c61746e4553 }, /* ca -> ca-Latn-ES */
+    { 0x6365000000000000, 0x63654379726c5255 }, /* ce -> ce-Cyrl-RU */
+    { 0x6368000000000000, 0x63684c61746e4755 }, /* ch -> ch-Latn-GU */
+    { 0x636f000000000000, 0x636f4c61746e4652 }, /* co -> co-Latn-FR */
+    { 0x6372000000000000, 0x637243616e734341 }, /* cr -> cr-Cans-CA */
+    { 0x6373000000000000, 0x63734c61746e435a }, /* cs -> cs-Latn-CZ */
+    { 0x6375000000000000, 0x63754379726c5255 }, /* cu -> cu-Cyrl-RU */
+    { 0x6375476c61670000, 0x6375476c61674247 }, /* cu-Glag -> cu-Glag-BG */
+    { 0x6376000000000000, 0x63764379726c5255 }, /* cv -> cv-Cyrl-RU */
+    { 0x6379000000000000, 0x63794c61746e4742 }, /* cy -> cy-Latn-GB */
+    { 0x6461000000000000, 0x64614c61746e444b }, /* da -> da-Latn-DK */
+    { 0x6465000000000000, 0x64654c61746e4445 }, /* de -> de-Latn-DE */
+    { 0x6476000000000000, 0x6476546861614d56 }, /* dv -> dv-Thaa-MV */
+    { 0x647a000000000000, 0x647a546962744254 }, /* dz -> dz-Tibt-BT */
+    { 0x6565000000000000, 0x65654c61746e4748 }, /* ee -> ee-Latn-GH */
+    { 0x656c000000000000, 0x656c4772656b4752 }, /* el -> el-Grek-GR */
+    { 0x656e000000000000, 0x656e4c61746e5553 }, /* en -> en-Latn-US */
+    { 0x656e536861770000, 0x656e536861774742 }, /* en-Shaw -> en-Shaw-GB */
+    { 0x656f000000000000, 0x656f4c61746e8001 }, /* eo -> eo-Latn-001 */
+    { 0x6573000000000000, 0x65734c61746e4553 }, /* es -> es-Latn-ES */
+    { 0x6574000000000000, 0x65744c61746e4545 }, /* et -> et-Latn-EE */
+    { 0x6575000000000000, 0x65754c61746e4553 }, /* eu -> eu-Latn-ES */
+    { 0x6661000000000000, 0x6661417261624952 }, /* fa -> fa-Arab-IR */
+    { 0x6666000000000000, 0x66664c61746e534e }, /* ff -> ff-Latn-SN */
+    { 0x666641646c6d0000, 0x666641646c6d474e }, /* ff-Adlm -> ff-Adlm-GN */
+    { 0x6669000000000000, 0x66694c61746e4649 }, /* fi -> fi-Latn-FI */
+    { 0x666a000000000000, 0x666a4c61746e464a }, /* fj -> fj-Latn-FJ */
+    { 0x666f000000000000, 0x666f4c61746e464f }, /* fo -> fo-Latn-FO */
+    { 0x6672000000000000, 0x66724c61746e4652 }, /* fr -> fr-Latn-FR */
+    { 0x6679000000000000, 0x66794c61746e4e4c }, /* fy -> fy-Latn-NL */
+    { 0x6761000000000000, 0x67614c61746e4945 }, /* ga -> ga-Latn-IE */
+    { 0x6764000000000000, 0x67644c61746e4742 }, /* gd -> gd-Latn-GB */
+    { 0x676c000000000000, 0x676c4c61746e4553 }, /* gl -> gl-Latn-ES */
+    { 0x676e000000000000, 0x676e4c61746e5059 }, /* gn -> gn-Latn-PY */
+    { 0x6775000000000000, 0x677547756a72494e }, /* gu -> gu-Gujr-IN */
+    { 0x6776000000000000, 0x67764c61746e494d }, /* gv -> gv-Latn-IM */
+    { 0x6861000000000000, 0x68614c61746e4e47 }, /* ha -> ha-Latn-NG */
+    { 0x686100000000434d, 0x686141726162434d }, /* ha-CM -> ha-Arab-CM */
+    { 0x6861000000005344, 0x6861417261625344 }, /* ha-SD -> ha-Arab-SD */
+    { 0x6865000000000000, 0x686548656272494c }, /* he -> he-Hebr-IL */
+    { 0x6869000000000000, 0x686944657661494e }, /* hi -> hi-Deva-IN */
+    { 0x686f000000000000, 0x686f4c61746e5047 }, /* ho -> ho-Latn-PG */
+    { 0x6872000000000000, 0x68724c61746e4852 }, /* hr -> hr-Latn-HR */
+    { 0x6874000000000000, 0x68744c61746e4854 }, /* ht -> ht-Latn-HT */
+    { 0x6875000000000000, 0x68754c61746e4855 }, /* hu -> hu-Latn-HU */
+    { 0x6879000000000000, 0x687941726d6e414d }, /* hy -> hy-Armn-AM */
+    { 0x687a000000000000, 0x687a4c61746e4e41 }, /* hz -> hz-Latn-NA */
+    { 0x6961000000000000, 0x69614c61746e8001 }, /* ia -> ia-Latn-001 */
+    { 0x6964000000000000, 0x69644c61746e4944 }, /* id -> id-Latn-ID */
+    { 0x6967000000000000, 0x69674c61746e4e47 }, /* ig -> ig-Latn-NG */
+    { 0x6969000000000000, 0x696959696969434e }, /* ii -> ii-Yiii-CN */
+    { 0x696b000000000000, 0x696b4c61746e5553 }, /* ik -> ik-Latn-US */
+    { 0x696e000000000000, 0x696e4c61746e4944 }, /* in -> in-Latn-ID */
+    { 0x696f000000000000, 0x696f4c61746e8001 }, /* io -> io-Latn-001 */
+    { 0x6973000000000000, 0x69734c61746e4953 }, /* is -> is-Latn-IS */
+    { 0x6974000000000000, 0x69744c61746e4954 }, /* it -> it-Latn-IT */
+    { 0x6975000000000000, 0x697543616e734341 }, /* iu -> iu-Cans-CA */
+    { 0x6977000000000000, 0x697748656272494c }, /* iw -> iw-Hebr-IL */
+    { 0x6a61000000000000, 0x6a614a70616e4a50 }, /* ja -> ja-Jpan-JP */
+    { 0x6a69000000000000, 0x6a69486562725541 }, /* ji -> ji-Hebr-UA */
+    { 0x6a76000000000000, 0x6a764c61746e4944 }, /* jv -> jv-Latn-ID */
+    { 0x6a77000000000000, 0x6a774c61746e4944 }, /* jw -> jw-Latn-ID */
+    { 0x6b61000000000000, 0x6b6147656f724745 }, /* ka -> ka-Geor-GE */
+    { 0x6b67000000000000, 0x6b674c61746e4344 }, /* kg -> kg-Latn-CD */
+    { 0x6b69000000000000, 0x6b694c61746e4b45 }, /* ki -> ki-Latn-KE */
+    { 0x6b6a000000000000, 0x6b6a4c61746e4e41 }, /* kj -> kj-Latn-NA */
+    { 0x6b6b000000000000, 0x6b6b4379726c4b5a }, /* kk -> kk-Cyrl-KZ */
+    { 0x6b6b000000004146, 0x6b6b417261624146 }, /* kk-AF -> kk-Arab-AF */
+    { 0x6b6b00000000434e, 0x6b6b41726162434e }, /* kk-CN -> kk-Arab-CN */
+    { 0x6b6b000000004952, 0x6b6b417261624952 }, /* kk-IR -> kk-Arab-IR */
+    { 0x6b6b000000004d4e, 0x6b6b417261624d4e }, /* kk-MN -> kk-Arab-MN */
+    { 0x6b6b417261620000, 0x6b6b41726162434e }, /* kk-Arab -> kk-Arab-CN */
+    { 0x6b6c000000000000, 0x6b6c4c61746e474c }, /* kl -> kl-Latn-GL */
+    { 0x6b6d000000000000, 0x6b6d4b686d724b48 }, /* km -> km-Khmr-KH */
+    { 0x6b6e000000000000, 0x6b6e4b6e6461494e }, /* kn -> kn-Knda-IN */
+    { 0x6b6f000000000000, 0x6b6f4b6f72654b52 }, /* ko -> ko-Kore-KR */
+    { 0x6b72000000000000, 0x6b724c61746e5a5a }, /* kr -> kr-Latn-ZZ */
+    { 0x6b73000000000000, 0x6b7341726162494e }, /* ks -> ks-Arab-IN */
+    { 0x6b75000000000000, 0x6b754c61746e5452 }, /* ku -> ku-Latn-TR */
+    { 0x6b75000000004c42, 0x6b75417261624c42 }, /* ku-LB -> ku-Arab-LB */
+    { 0x6b75417261620000, 0x6b75417261624951 }, /* ku-Arab -> ku-Arab-IQ */
+    { 0x6b7559657a690000, 0x6b7559657a694745 }, /* ku-Yezi -> ku-Yezi-GE */
+    { 0x6b76000000000000, 0x6b764379726c5255 }, /* kv -> kv-Cyrl-RU */
+    { 0x6b77000000000000, 0x6b774c61746e4742 }, /* kw -> kw-Latn-GB */
+    { 0x6b79000000000000, 0x6b794379726c4b47 }, /* ky -> ky-Cyrl-KG */
+    { 0x6b7900000000434e, 0x6b7941726162434e }, /* ky-CN -> ky-Arab-CN */
+    { 0x6b79000000005452, 0x6b794c61746e5452 }, /* ky-TR -> ky-Latn-TR */
+    { 0x6b79417261620000, 0x6b7941726162434e }, /* ky-Arab -> ky-Arab-CN */
+    { 0x6b794c61746e0000, 0x6b794c61746e5452 }, /* ky-Latn -> ky-Latn-TR */
+    { 0x6c61000000000000, 0x6c614c61746e5641 }, /* la -> la-Latn-VA */
+    { 0x6c62000000000000, 0x6c624c61746e4c55 }, /* lb -> lb-Latn-LU */
+    { 0x6c67000000000000, 0x6c674c61746e5547 }, /* lg -> lg-Latn-UG */
+    { 0x6c69000000000000, 0x6c694c61746e4e4c }, /* li -> li-Latn-NL */
+    { 0x6c6e000000000000, 0x6c6e4c61746e4344 }, /* ln -> ln-Latn-CD */
+    { 0x6c6f000000000000, 0x6c6f4c616f6f4c41 }, /* lo -> lo-Laoo-LA */
+    { 0x6c74000000000000, 0x6c744c61746e4c54 }, /* lt -> lt-Latn-LT */
+    { 0x6c75000000000000, 0x6c754c61746e4344 }, /* lu -> lu-Latn-CD */
+    { 0x6c76000000000000, 0x6c764c61746e4c56 }, /* lv -> lv-Latn-LV */
+    { 0x6d67000000000000, 0x6d674c61746e4d47 }, /* mg -> mg-Latn-MG */
+    { 0x6d68000000000000, 0x6d684c61746e4d48 }, /* mh -> mh-Latn-MH */
+    { 0x6d69000000000000, 0x6d694c61746e4e5a }, /* mi -> mi-Latn-NZ */
+    { 0x6d6b000000000000, 0x6d6b4379726c4d4b }, /* mk -> mk-Cyrl-MK */
+    { 0x6d6c000000000000, 0x6d6c4d6c796d494e }, /* ml -> ml-Mlym-IN */
+    { 0x6d6e000000000000, 0x6d6e4379726c4d4e }, /* mn -> mn-Cyrl-MN */
+    { 0x6d6e00000000434e, 0x6d6e4d6f6e67434e }, /* mn-CN -> mn-Mong-CN */
+    { 0x6d6e4d6f6e670000, 0x6d6e4d6f6e67434e }, /* mn-Mong -> mn-Mong-CN */
+    { 0x6d6f000000000000, 0x6d6f4c61746e524f }, /* mo -> mo-Latn-RO */
+    { 0x6d72000000000000, 0x6d7244657661494e }, /* mr -> mr-Deva-IN */
+    { 0x6d73000000000000, 0x6d734c61746e4d59 }, /* ms -> ms-Latn-MY */
+    { 0x6d73000000004343, 0x6d73417261624343 }, /* ms-CC -> ms-Arab-CC */
+    { 0x6d74000000000000, 0x6d744c61746e4d54 }, /* mt -> mt-Latn-MT */
+    { 0x6d79000000000000, 0x6d794d796d724d4d }, /* my -> my-Mymr-MM */
+    { 0x6e61000000000000, 0x6e614c61746e4e52 }, /* na -> na-Latn-NR */
+    { 0x6e62000000000000, 0x6e624c61746e4e4f }, /* nb -> nb-Latn-NO */
+    { 0x6e64000000000000, 0x6e644c61746e5a57 }, /* nd -> nd-Latn-ZW */
+    { 0x6e65000000000000, 0x6e65446576614e50 }, /* ne -> ne-Deva-NP */
+    { 0x6e67000000000000, 0x6e674c61746e4e41 }, /* ng -> ng-Latn-NA */
+    { 0x6e6c000000000000, 0x6e6c4c61746e4e4c }, /* nl -> nl-Latn-NL */
+    { 0x6e6e000000000000, 0x6e6e4c61746e4e4f }, /* nn -> nn-Latn-NO */
+    { 0x6e6f000000000000, 0x6e6f4c61746e4e4f }, /* no -> no-Latn-NO */
+    { 0x6e72000000000000, 0x6e724c61746e5a41 }, /* nr -> nr-Latn-ZA */
+    { 0x6e76000000000000, 0x6e764c61746e5553 }, /* nv -> nv-Latn-US */
+    { 0x6e79000000000000, 0x6e794c61746e4d57 }, /* ny -> ny-Latn-MW */
+    { 0x6f63000000000000, 0x6f634c61746e4652 }, /* oc -> oc-Latn-FR */
+    { 0x6f6d000000000000, 0x6f6d4c61746e4554 }, /* om -> om-Latn-ET */
+    { 0x6f72000000000000, 0x6f724f727961494e }, /* or -> or-Orya-IN */
+    { 0x6f73000000000000, 0x6f734379726c4745 }, /* os -> os-Cyrl-GE */
+    { 0x7061000000000000, 0x706147757275494e }, /* pa -> pa-Guru-IN */
+    { 0x706100000000504b, 0x706141726162504b }, /* pa-PK -> pa-Arab-PK */
+    { 0x7061417261620000, 0x706141726162504b }, /* pa-Arab -> pa-Arab-PK */
+    { 0x706c000000000000, 0x706c4c61746e504c }, /* pl -> pl-Latn-PL */
+    { 0x7073000000000000, 0x7073417261624146 }, /* ps -> ps-Arab-AF */
+    { 0x7074000000000000, 0x70744c61746e4252 }, /* pt -> pt-Latn-BR */
+    { 0x7175000000000000, 0x71754c61746e5045 }, /* qu -> qu-Latn-PE */
+    { 0x726d000000000000, 0x726d4c61746e4348 }, /* rm -> rm-Latn-CH */
+    { 0x726e000000000000, 0x726e4c61746e4249 }, /* rn -> rn-Latn-BI */
+    { 0x726f000000000000, 0x726f4c61746e524f }, /* ro -> ro-Latn-RO */
+    { 0x7275000000000000, 0x72754379726c5255 }, /* ru -> ru-Cyrl-RU */
+    { 0x7277000000000000, 0x72774c61746e5257 }, /* rw -> rw-Latn-RW */
+    { 0x7361000000000000, 0x736144657661494e }, /* sa -> sa-Deva-IN */
+    { 0x7363000000000000, 0x73634c61746e4954 }, /* sc -> sc-Latn-IT */
+    { 0x7364000000000000, 0x736441726162504b }, /* sd -> sd-Arab-PK */
+    { 0x7364446576610000, 0x736444657661494e }, /* sd-Deva -> sd-Deva-IN */
+    { 0x73644b686f6a0000, 0x73644b686f6a494e }, /* sd-Khoj -> sd-Khoj-IN */
+    { 0x736453696e640000, 0x736453696e64494e }, /* sd-Sind -> sd-Sind-IN */
+    { 0x7365000000000000, 0x73654c61746e4e4f }, /* se -> se-Latn-NO */
+    { 0x7367000000000000, 0x73674c61746e4346 }, /* sg -> sg-Latn-CF */
+    { 0x7369000000000000, 0x736953696e684c4b }, /* si -> si-Sinh-LK */
+    { 0x736b000000000000, 0x736b4c61746e534b }, /* sk -> sk-Latn-SK */
+    { 0x736c000000000000, 0x736c4c61746e5349 }, /* sl -> sl-Latn-SI */
+    { 0x736d000000000000, 0x736d4c61746e5753 }, /* sm -> sm-Latn-WS */
+    { 0x736e000000000000, 0x736e4c61746e5a57 }, /* sn -> sn-Latn-ZW */
+    { 0x736f000000000000, 0x736f4c61746e534f }, /* so -> so-Latn-SO */
+    { 0x7371000000000000, 0x73714c61746e414c }, /* sq -> sq-Latn-AL */
+    { 0x7372000000000000, 0x73724379726c5253 }, /* sr -> sr-Cyrl-RS */
+    { 0x7372000000004d45, 0x73724c61746e4d45 }, /* sr-ME -> sr-Latn-ME */
+    { 0x737200000000524f, 0x73724c61746e524f }, /* sr-RO -> sr-Latn-RO */
+    { 0x7372000000005255, 0x73724c61746e5255 }, /* sr-RU -> sr-Latn-RU */
+    { 0x7372000000005452, 0x73724c61746e5452 }, /* sr-TR -> sr-Latn-TR */
+    { 0x7373000000000000, 0x73734c61746e5a41 }, /* ss -> ss-Latn-ZA */
+    { 0x7374000000000000, 0x73744c61746e5a41 }, /* st -> st-Latn-ZA */
+    { 0x7375000000000000, 0x73754c61746e4944 }, /* su -> su-Latn-ID */
+    { 0x7376000000000000, 0x73764c61746e5345 }, /* sv -> sv-Latn-SE */
+    { 0x7377000000000000, 0x73774c61746e545a }, /* sw -> sw-Latn-TZ */
+    { 0x7461000000000000, 0x746154616d6c494e }, /* ta -> ta-Taml-IN */
+    { 0x7465000000000000, 0x746554656c75494e }, /* te -> te-Telu-IN */
+    { 0x7467000000000000, 0x74674379726c544a }, /* tg -> tg-Cyrl-TJ */
+    { 0x746700000000504b, 0x746741726162504b }, /* tg-PK -> tg-Arab-PK */
+    { 0x7467417261620000, 0x746741726162504b }, /* tg-Arab -> tg-Arab-PK */
+    { 0x7468000000000000, 0x7468546861695448 }, /* th -> th-Thai-TH */
+    { 0x7469000000000000, 0x7469457468694554 }, /* ti -> ti-Ethi-ET */
+    { 0x746b000000000000, 0x746b4c61746e544d }, /* tk -> tk-Latn-TM */
+    { 0x746c000000000000, 0x746c4c61746e5048 }, /* tl -> tl-Latn-PH */
+    { 0x746e000000000000, 0x746e4c61746e5a41 }, /* tn -> tn-Latn-ZA */
+    { 0x746f000000000000, 0x746f4c61746e544f }, /* to -> to-Latn-TO */
+    { 0x7472000000000000, 0x74724c61746e5452 }, /* tr -> tr-Latn-TR */
+    { 0x7473000000000000, 0x74734c61746e5a41 }, /* ts -> ts-Latn-ZA */
+    { 0x7474000000000000, 0x74744379726c5255 }, /* tt -> tt-Cyrl-RU */
+    { 0x7479000000000000, 0x74794c61746e5046 }, /* ty -> ty-Latn-PF */
+    { 0x7567000000000000, 0x756741726162434e }, /* ug -> ug-Arab-CN */
+    { 0x7567000000004b5a, 0x75674379726c4b5a }, /* ug-KZ -> ug-Cyrl-KZ */
+    { 0x7567000000004d4e, 0x75674379726c4d4e }, /* ug-MN -> ug-Cyrl-MN */
+    { 0x75674379726c0000, 0x75674379726c4b5a }, /* ug-Cyrl -> ug-Cyrl-KZ */
+    { 0x756b000000000000, 0x756b4379726c5541 }, /* uk -> uk-Cyrl-UA */
+    { 0x7572000000000000, 0x757241726162504b }, /* ur -> ur-Arab-PK */
+    { 0x757a000000000000, 0x757a4c61746e555a }, /* uz -> uz-Latn-UZ */
+    { 0x757a000000004146, 0x757a417261624146 }, /* uz-AF -> uz-Arab-AF */
+    { 0x757a00000000434e, 0x757a4379726c434e }, /* uz-CN -> uz-Cyrl-CN */
+    { 0x757a417261620000, 0x757a417261624146 }, /* uz-Arab -> uz-Arab-AF */
+    { 0x7665000000000000, 0x76654c61746e5a41 }, /* ve -> ve-Latn-ZA */
+    { 0x7669000000000000, 0x76694c61746e564e }, /* vi -> vi-Latn-VN */
+    { 0x766f000000000000, 0x766f4c61746e8001 }, /* vo -> vo-Latn-001 */
+    { 0x7761000000000000, 0x77614c61746e4245 }, /* wa -> wa-Latn-BE */
+    { 0x776f000000000000, 0x776f4c61746e534e }, /* wo -> wo-Latn-SN */
+    { 0x7868000000000000, 0x78684c61746e5a41 }, /* xh -> xh-Latn-ZA */
+    { 0x7969000000000000, 0x7969486562728001 }, /* yi -> yi-Hebr-001 */
+    { 0x796f000000000000, 0x796f4c61746e4e47 }, /* yo -> yo-Latn-NG */
+    { 0x7a61000000000000, 0x7a614c61746e434e }, /* za -> za-Latn-CN */
+    { 0x7a68000000000000, 0x7a6848616e73434e }, /* zh -> zh-Hans-CN */
+    { 0x7a68000000004155, 0x7a6848616e744155 }, /* zh-AU -> zh-Hant-AU */
+    { 0x7a6800000000424e, 0x7a6848616e74424e }, /* zh-BN -> zh-Hant-BN */
+    { 0x7a68000000004742, 0x7a6848616e744742 }, /* zh-GB -> zh-Hant-GB */
+    { 0x7a68000000004746, 0x7a6848616e744746 }, /* zh-GF -> zh-Hant-GF */
+    { 0x7a6800000000484b, 0x7a6848616e74484b }, /* zh-HK -> zh-Hant-HK */
+    { 0x7a68000000004944, 0x7a6848616e744944 }, /* zh-ID -> zh-Hant-ID */
+    { 0x7a68000000004d4f, 0x7a6848616e744d4f }, /* zh-MO -> zh-Hant-MO */
+    { 0x7a68000000005041, 0x7a6848616e745041 }, /* zh-PA -> zh-Hant-PA */
+    { 0x7a68000000005046, 0x7a6848616e745046 }, /* zh-PF -> zh-Hant-PF */
+    { 0x7a68000000005048, 0x7a6848616e745048 }, /* zh-PH -> zh-Hant-PH */
+    { 0x7a68000000005352, 0x7a6848616e745352 }, /* zh-SR -> zh-Hant-SR */
+    { 0x7a68000000005448, 0x7a6848616e745448 }, /* zh-TH -> zh-Hant-TH */
+    { 0x7a68000000005457, 0x7a6848616e745457 }, /* zh-TW -> zh-Hant-TW */
+    { 0x7a68000000005553, 0x7a6848616e745553 }, /* zh-US -> zh-Hant-US */
+    { 0x7a6800000000564e, 0x7a6848616e74564e }, /* zh-VN -> zh-Hant-VN */
+    { 0x7a68426f706f0000, 0x7a68426f706f5457 }, /* zh-Bopo -> zh-Bopo-TW */
+    { 0x7a6848616e620000, 0x7a6848616e625457 }, /* zh-Hanb -> zh-Hanb-TW */
+    { 0x7a6848616e740000, 0x7a6848616e745457 }, /* zh-Hant -> zh-Hant-TW */
+    { 0x7a75000000000000, 0x7a754c61746e5a41 }, /* zu -> zu-Latn-ZA */
+    { 0x8008000000000000, 0x80084c61746e5a5a }, /* aai -> aai-Latn-ZZ */
+    { 0x800a000000000000, 0x800a4c61746e5a5a }, /* aak -> aak-Latn-ZZ */
+    { 0x8014000000000000, 0x80144c61746e5a5a }, /* aau -> aau-Latn-ZZ */
+    { 0x8028000000000000, 0x80284c61746e5a5a }, /* abi -> abi-Latn-ZZ */
+    { 0x8030000000000000, 0x80304379726c5a5a }, /* abq -> abq-Cyrl-ZZ */
+    { 0x8031000000000000, 0x80314c61746e4748 }, /* abr -> abr-Latn-GH */
+    { 0x8033000000000000, 0x80334c61746e5a5a }, /* abt -> abt-Latn-ZZ */
+    { 0x8038000000000000, 0x80384c61746e5a5a }, /* aby -> aby-Latn-ZZ */
+    { 0x8043000000000000, 0x80434c61746e5a5a }, /* acd -> acd-Latn-ZZ */
+    { 0x8044000000000000, 0x80444c61746e4944 }, /* ace -> ace-Latn-ID */
+    { 0x8047000000000000, 0x80474c61746e5547 }, /* ach -> ach-Latn-UG */
+    { 0x8060000000000000, 0x80604c61746e4748 }, /* ada -> ada-Latn-GH */
+    { 0x8064000000000000, 0x80644c61746e5a5a }, /* ade -> ade-Latn-ZZ */
+    { 0x8069000000000000, 0x80694c61746e5a5a }, /* adj -> adj-Latn-ZZ */
+    { 0x806f000000000000, 0x806f546962744254 }, /* adp -> adp-Tibt-BT */
+    { 0x8078000000000000, 0x80784379726c5255 }, /* ady -> ady-Cyrl-RU */
+    { 0x8079000000000000, 0x80794c61746e5a5a }, /* adz -> adz-Latn-ZZ */
+    { 0x8081000000000000, 0x808141726162544e }, /* aeb -> aeb-Arab-TN */
+    { 0x8098000000000000, 0x80984c61746e5a5a }, /* aey -> aey-Latn-ZZ */
+    { 0x80c2000000000000, 0x80c24c61746e5a5a }, /* agc -> agc-Latn-ZZ */
+    { 0x80c3000000000000, 0x80c34c61746e5a5a }, /* agd -> agd-Latn-ZZ */
+    { 0x80c6000000000000, 0x80c64c61746e5a5a }, /* agg -> agg-Latn-ZZ */
+    { 0x80cc000000000000, 0x80cc4c61746e5a5a }, /* agm -> agm-Latn-ZZ */
+    { 0x80ce000000000000, 0x80ce4c61746e5a5a }, /* ago -> ago-Latn-ZZ */
+    { 0x80d0000000000000, 0x80d04c61746e434d }, /* agq -> agq-Latn-CM */
+    { 0x80e0000000000000, 0x80e04c61746e5a5a }, /* aha -> aha-Latn-ZZ */
+    { 0x80eb000000000000, 0x80eb4c61746e5a5a }, /* ahl -> ahl-Latn-ZZ */
+    { 0x80ee000000000000, 0x80ee41686f6d494e }, /* aho -> aho-Ahom-IN */
+    { 0x8126000000000000, 0x81264c61746e5a5a }, /* ajg -> ajg-Latn-ZZ */
+    { 0x814a000000000000, 0x814a587375784951 }, /* akk -> akk-Xsux-IQ */
+    { 0x8160000000000000, 0x81604c61746e5a5a }, /* ala -> ala-Latn-ZZ */
+    { 0x8168000000000000, 0x81684c61746e5a5a }, /* ali -> ali-Latn-ZZ */
+    { 0x816d000000000000, 0x816d4c61746e584b }, /* aln -> aln-Latn-XK */
+    { 0x8173000000000000, 0x81734379726c5255 }, /* alt -> alt-Cyrl-RU */
+    { 0x818c000000000000, 0x818c4c61746e5a5a }, /* amm -> amm-Latn-ZZ */
+    { 0x818d000000000000, 0x818d4c61746e5a5a }, /* amn -> amn-Latn-ZZ */
+    { 0x818e000000000000, 0x818e4c61746e4e47 }, /* amo -> amo-Latn-NG */
+    { 0x818f000000000000, 0x818f4c61746e5a5a }, /* amp -> amp-Latn-ZZ */
+    { 0x81a2000000000000, 0x81a24c61746e5a5a }, /* anc -> anc-Latn-ZZ */
+    { 0x81aa000000000000, 0x81aa4c61746e5a5a }, /* ank -> ank-Latn-ZZ */
+    { 0x81ad000000000000, 0x81ad4c61746e5a5a }, /* ann -> ann-Latn-ZZ */
+    { 0x81b8000000000000, 0x81b84c61746e5a5a }, /* any -> any-Latn-ZZ */
+    { 0x81c9000000000000, 0x81c94c61746e5a5a }, /* aoj -> aoj-Latn-ZZ */
+    { 0x81cc000000000000, 0x81cc4c61746e5a5a }, /* aom -> aom-Latn-ZZ */
+    { 0x81d9000000000000, 0x81d94c61746e4944 }, /* aoz -> aoz-Latn-ID */
+    { 0x81e2000000000000, 0x81e2417261625a5a }, /* apc -> apc-Arab-ZZ */
+    { 0x81e3000000000000, 0x81e3417261625447 }, /* apd -> apd-Arab-TG */
+    { 0x81e4000000000000, 0x81e44c61746e5a5a }, /* ape -> ape-Latn-ZZ */
+    { 0x81f1000000000000, 0x81f14c61746e5a5a }, /* apr -> apr-Latn-ZZ */
+    { 0x81f2000000000000, 0x81f24c61746e5a5a }, /* aps -> aps-Latn-ZZ */
+    { 0x81f9000000000000, 0x81f94c61746e5a5a }, /* apz -> apz-Latn-ZZ */
+    { 0x8222000000000000, 0x822241726d694952 }, /* arc -> arc-Armi-IR */
+    { 0x82224e6261740000, 0x82224e6261744a4f }, /* arc-Nbat -> arc-Nbat-JO */
+    { 0x822250616c6d0000, 0x822250616c6d5359 }, /* arc-Palm -> arc-Palm-SY */
+    { 0x8227000000000000, 0x82274c61746e5a5a }, /* arh -> arh-Latn-ZZ */
+    { 0x822d000000000000, 0x822d4c61746e434c }, /* arn -> arn-Latn-CL */
+    { 0x822e000000000000, 0x822e4c61746e424f }, /* aro -> aro-Latn-BO */
+    { 0x8230000000000000, 0x823041726162445a }, /* arq -> arq-Arab-DZ */
+    { 0x8232000000000000, 0x8232417261625341 }, /* ars -> ars-Arab-SA */
+    { 0x8238000000000000, 0x8238417261624d41 }, /* ary -> ary-Arab-MA */
+    { 0x8239000000000000, 0x8239417261624547 }, /* arz -> arz-Arab-EG */
+    { 0x8240000000000000, 0x82404c61746e545a }, /* asa -> asa-Latn-TZ */
+    { 0x8244000000000000, 0x824453676e775553 }, /* ase -> ase-Sgnw-US */
+    { 0x8246000000000000, 0x82464c61746e5a5a }, /* asg -> asg-Latn-ZZ */
+    { 0x824e000000000000, 0x824e4c61746e5a5a }, /* aso -> aso-Latn-ZZ */
+    { 0x8253000000000000, 0x82534c61746e4553 }, /* ast -> ast-Latn-ES */
+    { 0x8260000000000000, 0x82604c61746e5a5a }, /* ata -> ata-Latn-ZZ */
+    { 0x8266000000000000, 0x82664c61746e5a5a }, /* atg -> atg-Latn-ZZ */
+    { 0x8269000000000000, 0x82694c61746e4341 }, /* atj -> atj-Latn-CA */
+    { 0x8298000000000000, 0x82984c61746e5a5a }, /* auy -> auy-Latn-ZZ */
+    { 0x82ab000000000000, 0x82ab417261625a5a }, /* avl -> avl-Arab-ZZ */
+    { 0x82ad000000000000, 0x82ad4c61746e5a5a }, /* avn -> avn-Latn-ZZ */
+    { 0x82b3000000000000, 0x82b34c61746e5a5a }, /* avt -> avt-Latn-ZZ */
+    { 0x82b4000000000000, 0x82b44c61746e5a5a }, /* avu -> avu-Latn-ZZ */
+    { 0x82c0000000000000, 0x82c044657661494e }, /* awa -> awa-Deva-IN */
+    { 0x82c1000000000000, 0x82c14c61746e5a5a }, /* awb -> awb-Latn-ZZ */
+    { 0x82ce000000000000, 0x82ce4c61746e5a5a }, /* awo -> awo-Latn-ZZ */
+    { 0x82d7000000000000, 0x82d74c61746e5a5a }, /* awx -> awx-Latn-ZZ */
+    { 0x8301000000000000, 0x83014c61746e5a5a }, /* ayb -> ayb-Latn-ZZ */
+    { 0x840b000000000000, 0x840b41726162504b }, /* bal -> bal-Arab-PK */
+    { 0x840d000000000000, 0x840d4c61746e4944 }, /* ban -> ban-Latn-ID */
+    { 0x840f000000000000, 0x840f446576614e50 }, /* bap -> bap-Deva-NP */
+    { 0x8411000000000000, 0x84114c61746e4154 }, /* bar -> bar-Latn-AT */
+    { 0x8412000000000000, 0x84124c61746e434d }, /* bas -> bas-Latn-CM */
+    { 0x8415000000000000, 0x84154c61746e5a5a }, /* bav -> bav-Latn-ZZ */
+    { 0x8417000000000000, 0x841742616d75434d }, /* bax -> bax-Bamu-CM */
+    { 0x8420000000000000, 0x84204c61746e5a5a }, /* bba -> bba-Latn-ZZ */
+    { 0x8421000000000000, 0x84214c61746e5a5a }, /* bbb -> bbb-Latn-ZZ */
+    { 0x8422000000000000, 0x84224c61746e4944 }, /* bbc -> bbc-Latn-ID */
+    { 0x8423000000000000, 0x84234c61746e5a5a }, /* bbd -> bbd-Latn-ZZ */
+    { 0x8429000000000000, 0x84294c61746e434d }, /* bbj -> bbj-Latn-CM */
+    { 0x842f000000000000, 0x842f4c61746e5a5a }, /* bbp -> bbp-Latn-ZZ */
+    { 0x8431000000000000, 0x84314c61746e5a5a }, /* bbr -> bbr-Latn-ZZ */
+    { 0x8445000000000000, 0x84454c61746e5a5a }, /* bcf -> bcf-Latn-ZZ */
+    { 0x8447000000000000, 0x84474c61746e5a5a }, /* bch -> bch-Latn-ZZ */
+    { 0x8448000000000000, 0x84484c61746e4349 }, /* bci -> bci-Latn-CI */
+    { 0x844c000000000000, 0x844c4c61746e5a5a }, /* bcm -> bcm-Latn-ZZ */
+    { 0x844d000000000000, 0x844d4c61746e5a5a }, /* bcn -> bcn-Latn-ZZ */
+    { 0x844e000000000000, 0x844e4c61746e5a5a }, /* bco -> bco-Latn-ZZ */
+    { 0x8450000000000000, 0x8450457468695a5a }, /* bcq -> bcq-Ethi-ZZ */
+    { 0x8454000000000000, 0x84544c61746e5a5a }, /* bcu -> bcu-Latn-ZZ */
+    { 0x8463000000000000, 0x84634c61746e5a5a }, /* bdd -> bdd-Latn-ZZ */
+    { 0x8485000000000000, 0x84854c61746e5a5a }, /* bef -> bef-Latn-ZZ */
+    { 0x8487000000000000, 0x84874c61746e5a5a }, /* beh -> beh-Latn-ZZ */
+    { 0x8489000000000000, 0x8489417261625344 }, /* bej -> bej-Arab-SD */
+    { 0x848c000000000000, 0x848c4c61746e5a4d }, /* bem -> bem-Latn-ZM */
+    { 0x8493000000000000, 0x84934c61746e5a5a }, /* bet -> bet-Latn-ZZ */
+    { 0x8496000000000000, 0x84964c61746e4944 }, /* bew -> bew-Latn-ID */
+    { 0x8497000000000000, 0x84974c61746e5a5a }, /* bex -> bex-Latn-ZZ */
+    { 0x8499000000000000, 0x84994c61746e545a }, /* bez -> bez-Latn-TZ */
+    { 0x84a3000000000000, 0x84a34c61746e434d }, /* bfd -> bfd-Latn-CM */
+    { 0x84b0000000000000, 0x84b054616d6c494e }, /* bfq -> bfq-Taml-IN */
+    { 0x84b3000000000000, 0x84b341726162504b }, /* bft -> bft-Arab-PK */
+    { 0x84b8000000000000, 0x84b844657661494e }, /* bfy -> bfy-Deva-IN */
+    { 0x84c2000000000000, 0x84c244657661494e }, /* bgc -> bgc-Deva-IN */
+    { 0x84cd000000000000, 0x84cd41726162504b }, /* bgn -> bgn-Arab-PK */
+    { 0x84d7000000000000, 0x84d74772656b5452 }, /* bgx -> bgx-Grek-TR */
+    { 0x84e1000000000000, 0x84e144657661494e }, /* bhb -> bhb-Deva-IN */
+    { 0x84e6000000000000, 0x84e64c61746e5a5a }, /* bhg -> bhg-Latn-ZZ */
+    { 0x84e8000000000000, 0x84e844657661494e }, /* bhi -> bhi-Deva-IN */
+    { 0x84eb000000000000, 0x84eb4c61746e5a5a }, /* bhl -> bhl-Latn-ZZ */
+    { 0x84ee000000000000, 0x84ee44657661494e }, /* bho -> bho-Deva-IN */
+    { 0x84f8000000000000, 0x84f84c61746e5a5a }, /* bhy -> bhy-Latn-ZZ */
+    { 0x8501000000000000, 0x85014c61746e5a5a }, /* bib -> bib-Latn-ZZ */
+    { 0x8506000000000000, 0x85064c61746e5a5a }, /* big -> big-Latn-ZZ */
+    { 0x850a000000000000, 0x850a4c61746e5048 }, /* bik -> bik-Latn-PH */
+    { 0x850c000000000000, 0x850c4c61746e5a5a }, /* bim -> bim-Latn-ZZ */
+    { 0x850d000000000000, 0x850d4c61746e4e47 }, /* bin -> bin-Latn-NG */
+    { 0x850e000000000000, 0x850e4c61746e5a5a }, /* bio -> bio-Latn-ZZ */
+    { 0x8510000000000000, 0x85104c61746e5a5a }, /* biq -> biq-Latn-ZZ */
+    { 0x8527000000000000, 0x85274c61746e5a5a }, /* bjh -> bjh-Latn-ZZ */
+    { 0x8528000000000000, 0x8528457468695a5a }, /* bji -> bji-Ethi-ZZ */
+    { 0x8529000000000000, 0x852944657661494e }, /* bjj -> bjj-Deva-IN */
+    { 0x852d000000000000, 0x852d4c61746e4944 }, /* bjn -> bjn-Latn-ID */
+    { 0x852e000000000000, 0x852e4c61746e5a5a }, /* bjo -> bjo-Latn-ZZ */
+    { 0x8531000000000000, 0x85314c61746e5a5a }, /* bjr -> bjr-Latn-ZZ */
+    { 0x8533000000000000, 0x85334c61746e534e }, /* bjt -> bjt-Latn-SN */
+    { 0x8539000000000000, 0x85394c61746e5a5a }, /* bjz -> bjz-Latn-ZZ */
+    { 0x8542000000000000, 0x85424c61746e5a5a }, /* bkc -> bkc-Latn-ZZ */
+    { 0x854c000000000000, 0x854c4c61746e434d }, /* bkm -> bkm-Latn-CM */
+    { 0x8550000000000000, 0x85504c61746e5a5a }, /* bkq -> bkq-Latn-ZZ */
+    { 0x8554000000000000, 0x85544c61746e5048 }, /* bku -> bku-Latn-PH */
+    { 0x8555000000000000, 0x85554c61746e5a5a }, /* bkv -> bkv-Latn-ZZ */
+    { 0x8573000000000000, 0x857354617674564e }, /* blt -> blt-Tavt-VN */
+    { 0x8587000000000000, 0x85874c61746e5a5a }, /* bmh -> bmh-Latn-ZZ */
+    { 0x858a000000000000, 0x858a4c61746e5a5a }, /* bmk -> bmk-Latn-ZZ */
+    { 0x8590000000000000, 0x85904c61746e4d4c }, /* bmq -> bmq-Latn-ML */
+    { 0x8594000000000000, 0x85944c61746e5a5a }, /* bmu -> bmu-Latn-ZZ */
+    { 0x85a6000000000000, 0x85a64c61746e5a5a }, /* bng -> bng-Latn-ZZ */
+    { 0x85ac000000000000, 0x85ac4c61746e5a5a }, /* bnm -> bnm-Latn-ZZ */
+    { 0x85af000000000000, 0x85af4c61746e5a5a }, /* bnp -> bnp-Latn-ZZ */
+    { 0x85c9000000000000, 0x85c94c61746e5a5a }, /* boj -> boj-Latn-ZZ */
+    { 0x85cc000000000000, 0x85cc4c61746e5a5a }, /* bom -> bom-Latn-ZZ */
+    { 0x85cd000000000000, 0x85cd4c61746e5a5a }, /* bon -> bon-Latn-ZZ */
+    { 0x85f8000000000000, 0x85f842656e67494e }, /* bpy -> bpy-Beng-IN */
+    { 0x8602000000000000, 0x86024c61746e5a5a }, /* bqc -> bqc-Latn-ZZ */
+    { 0x8608000000000000, 0x8608417261624952 }, /* bqi -> bqi-Arab-IR */
+    { 0x860f000000000000, 0x860f4c61746e5a5a }, /* bqp -> bqp-Latn-ZZ */
+    { 0x8615000000000000, 0x86154c61746e4349 }, /* bqv -> bqv-Latn-CI */
+    { 0x8620000000000000, 0x862044657661494e }, /* bra -> bra-Deva-IN */
+    { 0x8627000000000000, 0x862741726162504b }, /* brh -> brh-Arab-PK */
+    { 0x8637000000000000, 0x863744657661494e }, /* brx -> brx-Deva-IN */
+    { 0x8639000000000000, 0x86394c61746e5a5a }, /* brz -> brz-Latn-ZZ */
+    { 0x8649000000000000, 0x86494c61746e5a5a }, /* bsj -> bsj-Latn-ZZ */
+    { 0x8650000000000000, 0x8650426173734c52 }, /* bsq -> bsq-Bass-LR */
+    { 0x8652000000000000, 0x86524c61746e434d }, /* bss -> bss-Latn-CM */
+    { 0x8653000000000000, 0x8653457468695a5a }, /* bst -> bst-Ethi-ZZ */
+    { 0x866e000000000000, 0x866e4c61746e5048 }, /* bto -> bto-Latn-PH */
+    { 0x8673000000000000, 0x86734c61746e5a5a }, /* btt -> btt-Latn-ZZ */
+    { 0x8675000000000000, 0x867544657661504b }, /* btv -> btv-Deva-PK */
+    { 0x8680000000000000, 0x86804379726c5255 }, /* bua -> bua-Cyrl-RU */
+    { 0x8682000000000000, 0x86824c61746e5954 }, /* buc -> buc-Latn-YT */
+    { 0x8683000000000000, 0x86834c61746e5a5a }, /* bud -> bud-Latn-ZZ */
+    { 0x8686000000000000, 0x86864c61746e4944 }, /* bug -> bug-Latn-ID */
+    { 0x868a000000000000, 0x868a4c61746e5a5a }, /* buk -> buk-Latn-ZZ */
+    { 0x868c000000000000, 0x868c4c61746e434d }, /* bum -> bum-Latn-CM */
+    { 0x868e000000000000, 0x868e4c61746e5a5a }, /* buo -> buo-Latn-ZZ */
+    { 0x8692000000000000, 0x86924c61746e5a5a }, /* bus -> bus-Latn-ZZ */
+    { 0x8694000000000000, 0x86944c61746e5a5a }, /* buu -> buu-Latn-ZZ */
+    { 0x86a1000000000000, 0x86a14c61746e4751 }, /* bvb -> bvb-Latn-GQ */
+    { 0x86c3000000000000, 0x86c34c61746e5a5a }, /* bwd -> bwd-Latn-ZZ */
+    { 0x86d1000000000000, 0x86d14c61746e5a5a }, /* bwr -> bwr-Latn-ZZ */
+    { 0x86e7000000000000, 0x86e74c61746e5a5a }, /* bxh -> bxh-Latn-ZZ */
+    { 0x8704000000000000, 0x87044c61746e5a5a }, /* bye -> bye-Latn-ZZ */
+    { 0x870d000000000000, 0x870d457468694552 }, /* byn -> byn-Ethi-ER */
+    { 0x8711000000000000, 0x87114c61746e5a5a }, /* byr -> byr-Latn-ZZ */
+    { 0x8712000000000000, 0x87124c61746e5a5a }, /* bys -> bys-Latn-ZZ */
+    { 0x8715000000000000, 0x87154c61746e434d }, /* byv -> byv-Latn-CM */
+    { 0x8717000000000000, 0x87174c61746e5a5a }, /* byx -> byx-Latn-ZZ */
+    { 0x8720000000000000, 0x87204c61746e5a5a }, /* bza -> bza-Latn-ZZ */
+    { 0x8724000000000000, 0x87244c61746e4d4c }, /* bze -> bze-Latn-ML */
+    { 0x8725000000000000, 0x87254c61746e5a5a }, /* bzf -> bzf-Latn-ZZ */
+    { 0x8727000000000000, 0x87274c61746e5a5a }, /* bzh -> bzh-Latn-ZZ */
+    { 0x8736000000000000, 0x87364c61746e5a5a }, /* bzw -> bzw-Latn-ZZ */
+    { 0x8803000000000000, 0x88034c61746e5553 }, /* cad -> cad-Latn-US */
+    { 0x880d000000000000, 0x880d4c61746e5a5a }, /* can -> can-Latn-ZZ */
+    { 0x8829000000000000, 0x88294c61746e5a5a }, /* cbj -> cbj-Latn-ZZ */
+    { 0x8847000000000000, 0x88474c61746e4e47 }, /* cch -> cch-Latn-NG */
+    { 0x884f000000000000, 0x884f43616b6d4244 }, /* ccp -> ccp-Cakm-BD */
+    { 0x8881000000000000, 0x88814c61746e5048 }, /* ceb -> ceb-Latn-PH */
+    { 0x88a0000000000000, 0x88a04c61746e5a5a }, /* cfa -> cfa-Latn-ZZ */
+    { 0x88c6000000000000, 0x88c64c61746e5547 }, /* cgg -> cgg-Latn-UG */
+    { 0x88ea000000000000, 0x88ea4c61746e464d }, /* chk -> chk-Latn-FM */
+    { 0x88ec000000000000, 0x88ec4379726c5255 }, /* chm -> chm-Cyrl-RU */
+    { 0x88ee000000000000, 0x88ee4c61746e5553 }, /* cho -> cho-Latn-US */
+    { 0x88ef000000000000, 0x88ef4c61746e4341 }, /* chp -> chp-Latn-CA */
+    { 0x88f1000000000000, 0x88f1436865725553 }, /* chr -> chr-Cher-US */
+    { 0x8902000000000000, 0x89024c61746e5553 }, /* cic -> cic-Latn-US */
+    { 0x8920000000000000, 0x8920417261624b48 }, /* cja -> cja-Arab-KH */
+    { 0x892c000000000000, 0x892c4368616d564e }, /* cjm -> cjm-Cham-VN */
+    { 0x8935000000000000, 0x89354c61746e5a5a }, /* cjv -> cjv-Latn-ZZ */
+    { 0x8941000000000000, 0x8941417261624951 }, /* ckb -> ckb-Arab-IQ */
+    { 0x894b000000000000, 0x894b4c61746e5a5a }, /* ckl -> ckl-Latn-ZZ */
+    { 0x894e000000000000, 0x894e4c61746e5a5a }, /* cko -> cko-Latn-ZZ */
+    { 0x8958000000000000, 0x89584c61746e5a5a }, /* cky -> cky-Latn-ZZ */
+    { 0x8960000000000000, 0x89604c61746e5a5a }, /* cla -> cla-Latn-ZZ */
+    { 0x8984000000000000, 0x89844c61746e5a5a }, /* cme -> cme-Latn-ZZ */
+    { 0x8986000000000000, 0x8986536f796f4d4e }, /* cmg -> cmg-Soyo-MN */
+    { 0x89cf000000000000, 0x89cf436f70744547 }, /* cop -> cop-Copt-EG */
+    { 0x89f2000000000000, 0x89f24c61746e5048 }, /* cps -> cps-Latn-PH */
+    { 0x8a27000000000000, 0x8a274379726c5541 }, /* crh -> crh-Cyrl-UA */
+    { 0x8a29000000000000, 0x8a2943616e734341 }, /* crj -> crj-Cans-CA */
+    { 0x8a2a000000000000, 0x8a2a43616e734341 }, /* crk -> crk-Cans-CA */
+    { 0x8a2b000000000000, 0x8a2b43616e734341 }, /* crl -> crl-Cans-CA */
+    { 0x8a2c000000000000, 0x8a2c43616e734341 }, /* crm -> crm-Cans-CA */
+    { 0x8a32000000000000, 0x8a324c61746e5343 }, /* crs -> crs-Latn-SC */
+    { 0x8a41000000000000, 0x8a414c61746e504c }, /* csb -> csb-Latn-PL */
+    { 0x8a56000000000000, 0x8a5643616e734341 }, /* csw -> csw-Cans-CA */
+    { 0x8a63000000000000, 0x8a63506175634d4d }, /* ctd -> ctd-Pauc-MM */
+    { 0x8c03000000000000, 0x8c034c61746e5a5a }, /* dad -> dad-Latn-ZZ */
+    { 0x8c05000000000000, 0x8c054c61746e4349 }, /* daf -> daf-Latn-CI */
+    { 0x8c06000000000000, 0x8c064c61746e5a5a }, /* dag -> dag-Latn-ZZ */
+    { 0x8c07000000000000, 0x8c074c61746e5a5a }, /* dah -> dah-Latn-ZZ */
+    { 0x8c0a000000000000, 0x8c0a4c61746e5553 }, /* dak -> dak-Latn-US */
+    { 0x8c11000000000000, 0x8c114379726c5255 }, /* dar -> dar-Cyrl-RU */
+    { 0x8c15000000000000, 0x8c154c61746e4b45 }, /* dav -> dav-Latn-KE */
+    { 0x8c23000000000000, 0x8c234c61746e5a5a }, /* dbd -> dbd-Latn-ZZ */
+    { 0x8c30000000000000, 0x8c304c61746e5a5a }, /* dbq -> dbq-Latn-ZZ */
+    { 0x8c42000000000000, 0x8c4241726162494e }, /* dcc -> dcc-Arab-IN */
+    { 0x8c6d000000000000, 0x8c6d4c61746e5a5a }, /* ddn -> ddn-Latn-ZZ */
+    { 0x8c83000000000000, 0x8c834c61746e5a5a }, /* ded -> ded-Latn-ZZ */
+    { 0x8c8d000000000000, 0x8c8d4c61746e4341 }, /* den -> den-Latn-CA */
+    { 0x8cc0000000000000, 0x8cc04c61746e5a5a }, /* dga -> dga-Latn-ZZ */
+    { 0x8cc7000000000000, 0x8cc74c61746e5a5a }, /* dgh -> dgh-Latn-ZZ */
+    { 0x8cc8000000000000, 0x8cc84c61746e5a5a }, /* dgi -> dgi-Latn-ZZ */
+    { 0x8ccb000000000000, 0x8ccb417261625a5a }, /* dgl -> dgl-Arab-ZZ */
+    { 0x8cd1000000000000, 0x8cd14c61746e4341 }, /* dgr -> dgr-Latn-CA */
+    { 0x8cd9000000000000, 0x8cd94c61746e5a5a }, /* dgz -> dgz-Latn-ZZ */
+    { 0x8d00000000000000, 0x8d004c61746e5a5a }, /* dia -> dia-Latn-ZZ */
+    { 0x8d24000000000000, 0x8d244c61746e4e45 }, /* dje -> dje-Latn-NE */
+    { 0x8da9000000000000, 0x8da94c61746e4349 }, /* dnj -> dnj-Latn-CI */
+    { 0x8dc1000000000000, 0x8dc14c61746e5a5a }, /* dob -> dob-Latn-ZZ */
+    { 0x8dc8000000000000, 0x8dc844657661494e }, /* doi -> doi-Deva-IN */
+    { 0x8dcf000000000000, 0x8dcf4c61746e5a5a }, /* dop -> dop-Latn-ZZ */
+    { 0x8dd6000000000000, 0x8dd64c61746e5a5a }, /* dow -> dow-Latn-ZZ */
+    { 0x8e27000000000000, 0x8e274d6f6e67434e }, /* drh -> drh-Mong-CN */
+    { 0x8e28000000000000, 0x8e284c61746e5a5a }, /* dri -> dri-Latn-ZZ */
+    { 0x8e32000000000000, 0x8e32457468695a5a }, /* drs -> drs-Ethi-ZZ */
+    { 0x8e41000000000000, 0x8e414c61746e4445 }, /* dsb -> dsb-Latn-DE */
+    { 0x8e6c000000000000, 0x8e6c4c61746e4d4c }, /* dtm -> dtm-Latn-ML */
+    { 0x8e6f000000000000, 0x8e6f4c61746e4d59 }, /* dtp -> dtp-Latn-MY */
+    { 0x8e72000000000000, 0x8e724c61746e5a5a }, /* dts -> dts-Latn-ZZ */
+    { 0x8e78000000000000, 0x8e78446576614e50 }, /* dty -> dty-Deva-NP */
+    { 0x8e80000000000000, 0x8e804c61746e434d }, /* dua -> dua-Latn-CM */
+    { 0x8e82000000000000, 0x8e824c61746e5a5a }, /* duc -> duc-Latn-ZZ */
+    { 0x8e83000000000000, 0x8e834c61746e5a5a }, /* dud -> dud-Latn-ZZ */
+    { 0x8e86000000000000, 0x8e864c61746e5a5a }, /* dug -> dug-Latn-ZZ */
+    { 0x8ea0000000000000, 0x8ea04c61746e5a5a }, /* dva -> dva-Latn-ZZ */
+    { 0x8ed6000000000000, 0x8ed64c61746e5a5a }, /* dww -> dww-Latn-ZZ */
+    { 0x8f0e000000000000, 0x8f0e4c61746e534e }, /* dyo -> dyo-Latn-SN */
+    { 0x8f14000000000000, 0x8f144c61746e4246 }, /* dyu -> dyu-Latn-BF */
+    { 0x8f26000000000000, 0x8f264c61746e5a5a }, /* dzg -> dzg-Latn-ZZ */
+    { 0x9034000000000000, 0x90344c61746e4b45 }, /* ebu -> ebu-Latn-KE */
+    { 0x90a8000000000000, 0x90a84c61746e4e47 }, /* efi -> efi-Latn-NG */
+    { 0x90cb000000000000, 0x90cb4c61746e4954 }, /* egl -> egl-Latn-IT */
+    { 0x90d8000000000000, 0x90d8456779704547 }, /* egy -> egy-Egyp-EG */
+    { 0x9140000000000000, 0x91404c61746e5a5a }, /* eka -> eka-Latn-ZZ */
+    { 0x9158000000000000, 0x91584b616c694d4d }, /* eky -> eky-Kali-MM */
+    { 0x9180000000000000, 0x91804c61746e5a5a }, /* ema -> ema-Latn-ZZ */
+    { 0x9188000000000000, 0x91884c61746e5a5a }, /* emi -> emi-Latn-ZZ */
+    { 0x91ad000000000000, 0x91ad4c61746e5a5a }, /* enn -> enn-Latn-ZZ */
+    { 0x91b0000000000000, 0x91b04c61746e5a5a }, /* enq -> enq-Latn-ZZ */
+    { 0x9228000000000000, 0x92284c61746e5a5a }, /* eri -> eri-Latn-ZZ */
+    { 0x9246000000000000, 0x9246476f6e6d494e }, /* esg -> esg-Gonm-IN */
+    { 0x9254000000000000, 0x92544c61746e5553 }, /* esu -> esu-Latn-US */
+    { 0x9271000000000000, 0x92714c61746e5a5a }, /* etr -> etr-Latn-ZZ */
+    { 0x9273000000000000, 0x92734974616c4954 }, /* ett -> ett-Ital-IT */
+    { 0x9274000000000000, 0x92744c61746e5a5a }, /* etu -> etu-Latn-ZZ */
+    { 0x9277000000000000, 0x92774c61746e5a5a }, /* etx -> etx-Latn-ZZ */
+    { 0x92ce000000000000, 0x92ce4c61746e434d }, /* ewo -> ewo-Latn-CM */
+    { 0x92f3000000000000, 0x92f34c61746e4553 }, /* ext -> ext-Latn-ES */
+    { 0x9320000000000000, 0x93204c61746e5a5a }, /* eza -> eza-Latn-ZZ */
+    { 0x9400000000000000, 0x94004c61746e5a5a }, /* faa -> faa-Latn-ZZ */
+    { 0x9401000000000000, 0x94014c61746e5a5a }, /* fab -> fab-Latn-ZZ */
+    { 0x9406000000000000, 0x94064c61746e5a5a }, /* fag -> fag-Latn-ZZ */
+    { 0x9408000000000000, 0x94084c61746e5a5a }, /* fai -> fai-Latn-ZZ */
+    { 0x940d000000000000, 0x940d4c61746e4751 }, /* fan -> fan-Latn-GQ */
+    { 0x94a8000000000000, 0x94a84c61746e5a5a }, /* ffi -> ffi-Latn-ZZ */
+    { 0x94ac000000000000, 0x94ac4c61746e4d4c }, /* ffm -> ffm-Latn-ML */
+    { 0x9500000000000000, 0x9500417261625344 }, /* fia -> fia-Arab-SD */
+    { 0x950b000000000000, 0x950b4c61746e5048 }, /* fil -> fil-Latn-PH */
+    { 0x9513000000000000, 0x95134c61746e5345 }, /* fit -> fit-Latn-SE */
+    { 0x9571000000000000, 0x95714c61746e5a5a }, /* flr -> flr-Latn-ZZ */
+    { 0x958f000000000000, 0x958f4c61746e5a5a }, /* fmp -> fmp-Latn-ZZ */
+    { 0x95c3000000000000, 0x95c34c61746e5a5a }, /* fod -> fod-Latn-ZZ */
+    { 0x95cd000000000000, 0x95cd4c61746e424a }, /* fon -> fon-Latn-BJ */
+    { 0x95d1000000000000, 0x95d14c61746e5a5a }, /* for -> for-Latn-ZZ */
+    { 0x95e4000000000000, 0x95e44c61746e5a5a }, /* fpe -> fpe-Latn-ZZ */
+    { 0x9612000000000000, 0x96124c61746e5a5a }, /* fqs -> fqs-Latn-ZZ */
+    { 0x9622000000000000, 0x96224c61746e5553 }, /* frc -> frc-Latn-US */
+    { 0x962f000000000000, 0x962f4c61746e4652 }, /* frp -> frp-Latn-FR */
+    { 0x9631000000000000, 0x96314c61746e4445 }, /* frr -> frr-Latn-DE */
+    { 0x9632000000000000, 0x96324c61746e4445 }, /* frs -> frs-Latn-DE */
+    { 0x9681000000000000, 0x968141726162434d }, /* fub -> fub-Arab-CM */
+    { 0x9683000000000000, 0x96834c61746e5746 }, /* fud -> fud-Latn-WF */
+    { 0x9684000000000000, 0x96844c61746e5a5a }, /* fue -> fue-Latn-ZZ */
+    { 0x9685000000000000, 0x96854c61746e474e }, /* fuf -> fuf-Latn-GN */
+    { 0x9687000000000000, 0x96874c61746e5a5a }, /* fuh -> fuh-Latn-ZZ */
+    { 0x9690000000000000, 0x96904c61746e4e45 }, /* fuq -> fuq-Latn-NE */
+    { 0x9691000000000000, 0x96914c61746e4954 }, /* fur -> fur-Latn-IT */
+    { 0x9695000000000000, 0x96954c61746e4e47 }, /* fuv -> fuv-Latn-NG */
+    { 0x9698000000000000, 0x96984c61746e5a5a }, /* fuy -> fuy-Latn-ZZ */
+    { 0x96b1000000000000, 0x96b14c61746e5344 }, /* fvr -> fvr-Latn-SD */
+    { 0x9800000000000000, 0x98004c61746e4748 }, /* gaa -> gaa-Latn-GH */
+    { 0x9805000000000000, 0x98054c61746e5a5a }, /* gaf -> gaf-Latn-ZZ */
+    { 0x9806000000000000, 0x98064c61746e4d44 }, /* gag -> gag-Latn-MD */
+    { 0x9807000000000000, 0x98074c61746e5a5a }, /* gah -> gah-Latn-ZZ */
+    { 0x9809000000000000, 0x98094c61746e5a5a }, /* gaj -> gaj-Latn-ZZ */
+    { 0x980c000000000000, 0x980c4c61746e5a5a }, /* gam -> gam-Latn-ZZ */
+    { 0x980d000000000000, 0x980d48616e73434e }, /* gan -> gan-Hans-CN */
+    { 0x9816000000000000, 0x98164c61746e5a5a }, /* gaw -> gaw-Latn-ZZ */
+    { 0x9818000000000000, 0x98184c61746e4944 }, /* gay -> gay-Latn-ID */
+    { 0x9820000000000000, 0x98204c61746e5a5a }, /* gba -> gba-Latn-ZZ */
+    { 0x9825000000000000, 0x98254c61746e5a5a }, /* gbf -> gbf-Latn-ZZ */
+    { 0x982c000000000000, 0x982c44657661494e }, /* gbm -> gbm-Deva-IN */
+    { 0x9838000000000000, 0x98384c61746e5a5a }, /* gby -> gby-Latn-ZZ */
+    { 0x9839000000000000, 0x9839417261624952 }, /* gbz -> gbz-Arab-IR */
+    { 0x9851000000000000, 0x98514c61746e4746 }, /* gcr -> gcr-Latn-GF */
+    { 0x9864000000000000, 0x98644c61746e5a5a }, /* gde -> gde-Latn-ZZ */
+    { 0x986d000000000000, 0x986d4c61746e5a5a }, /* gdn -> gdn-Latn-ZZ */
+    { 0x9871000000000000, 0x98714c61746e5a5a }, /* gdr -> gdr-Latn-ZZ */
+    { 0x9881000000000000, 0x98814c61746e5a5a }, /* geb -> geb-Latn-ZZ */
+    { 0x9889000000000000, 0x98894c61746e5a5a }, /* gej -> gej-Latn-ZZ */
+    { 0x988b000000000000, 0x988b4c61746e5a5a }, /* gel -> gel-Latn-ZZ */
+    { 0x9899000000000000, 0x9899457468694554 }, /* gez -> gez-Ethi-ET */
+    { 0x98aa000000000000, 0x98aa4c61746e5a5a }, /* gfk -> gfk-Latn-ZZ */
+    { 0x98cd000000000000, 0x98cd446576614e50 }, /* ggn -> ggn-Deva-NP */
+    { 0x98f2000000000000, 0x98f24c61746e5a5a }, /* ghs -> ghs-Latn-ZZ */
+    { 0x990b000000000000, 0x990b4c61746e4b49 }, /* gil -> gil-Latn-KI */
+    { 0x990c000000000000, 0x990c4c61746e5a5a }, /* gim -> gim-Latn-ZZ */
+    { 0x992a000000000000, 0x992a41726162504b }, /* gjk -> gjk-Arab-PK */
+    { 0x992d000000000000, 0x992d4c61746e5a5a }, /* gjn -> gjn-Latn-ZZ */
+    { 0x9934000000000000, 0x993441726162504b }, /* gju -> gju-Arab-PK */
+    { 0x994d000000000000, 0x994d4c61746e5a5a }, /* gkn -> gkn-Latn-ZZ */
+    { 0x994f000000000000, 0x994f4c61746e5a5a }, /* gkp -> gkp-Latn-ZZ */
+    { 0x996a000000000000, 0x996a417261624952 }, /* glk -> glk-Arab-IR */
+    { 0x998c000000000000, 0x998c4c61746e5a5a }, /* gmm -> gmm-Latn-ZZ */
+    { 0x9995000000000000, 0x9995457468695a5a }, /* gmv -> gmv-Ethi-ZZ */
+    { 0x99a3000000000000, 0x99a34c61746e5a5a }, /* gnd -> gnd-Latn-ZZ */
+    { 0x99a6000000000000, 0x99a64c61746e5a5a }, /* gng -> gng-Latn-ZZ */
+    { 0x99c3000000000000, 0x99c34c61746e5a5a }, /* god -> god-Latn-ZZ */
+    { 0x99c5000000000000, 0x99c5457468695a5a }, /* gof -> gof-Ethi-ZZ */
+    { 0x99c8000000000000, 0x99c84c61746e5a5a }, /* goi -> goi-Latn-ZZ */
+    { 0x99cc000000000000, 0x99cc44657661494e }, /* gom -> gom-Deva-IN */
+    { 0x99cd000000000000, 0x99cd54656c75494e }, /* gon -> gon-Telu-IN */
+    { 0x99d1000000000000, 0x99d14c61746e4944 }, /* gor -> gor-Latn-ID */
+    { 0x99d2000000000000, 0x99d24c61746e4e4c }, /* gos -> gos-Latn-NL */
+    { 0x99d3000000000000, 0x99d3476f74685541 }, /* got -> got-Goth-UA */
+    { 0x9a21000000000000, 0x9a214c61746e5a5a }, /* grb -> grb-Latn-ZZ */
+    { 0x9a22000000000000, 0x9a22437072744359 }, /* grc -> grc-Cprt-CY */
+    { 0x9a224c696e620000, 0x9a224c696e624752 }, /* grc-Linb -> grc-Linb-GR */
+    { 0x9a33000000000000, 0x9a3342656e67494e }, /* grt -> grt-Beng-IN */
+    { 0x9a36000000000000, 0x9a364c61746e5a5a }, /* grw -> grw-Latn-ZZ */
+    { 0x9a56000000000000, 0x9a564c61746e4348 }, /* gsw -> gsw-Latn-CH */
+    { 0x9a81000000000000, 0x9a814c61746e4252 }, /* gub -> gub-Latn-BR */
+    { 0x9a82000000000000, 0x9a824c61746e434f }, /* guc -> guc-Latn-CO */
+    { 0x9a83000000000000, 0x9a834c61746e5a5a }, /* gud -> gud-Latn-ZZ */
+    { 0x9a91000000000000, 0x9a914c61746e4748 }, /* gur -> gur-Latn-GH */
+    { 0x9a96000000000000, 0x9a964c61746e5a5a }, /* guw -> guw-Latn-ZZ */
+    { 0x9a97000000000000, 0x9a974c61746e5a5a }, /* gux -> gux-Latn-ZZ */
+    { 0x9a99000000000000, 0x9a994c61746e4b45 }, /* guz -> guz-Latn-KE */
+    { 0x9aa5000000000000, 0x9aa54c61746e5a5a }, /* gvf -> gvf-Latn-ZZ */
+    { 0x9ab1000000000000, 0x9ab1446576614e50 }, /* gvr -> gvr-Deva-NP */
+    { 0x9ab2000000000000, 0x9ab24c61746e5a5a }, /* gvs -> gvs-Latn-ZZ */
+    { 0x9ac2000000000000, 0x9ac2417261625a5a }, /* gwc -> gwc-Arab-ZZ */
+    { 0x9ac8000000000000, 0x9ac84c61746e4341 }, /* gwi -> gwi-Latn-CA */
+    { 0x9ad3000000000000, 0x9ad3417261625a5a }, /* gwt -> gwt-Arab-ZZ */
+    { 0x9b08000000000000, 0x9b084c61746e5a5a }, /* gyi -> gyi-Latn-ZZ */
+    { 0x9c06000000000000, 0x9c064c61746e5a5a }, /* hag -> hag-Latn-ZZ */
+    { 0x9c0a000000000000, 0x9c0a48616e73434e }, /* hak -> hak-Hans-CN */
+    { 0x9c0c000000000000, 0x9c0c4c61746e5a5a }, /* ham -> ham-Latn-ZZ */
+    { 0x9c16000000000000, 0x9c164c61746e5553 }, /* haw -> haw-Latn-US */
+    { 0x9c19000000000000, 0x9c19417261624146 }, /* haz -> haz-Arab-AF */
+    { 0x9c21000000000000, 0x9c214c61746e5a5a }, /* hbb -> hbb-Latn-ZZ */
+    { 0x9c78000000000000, 0x9c78457468695a5a }, /* hdy -> hdy-Ethi-ZZ */
+    { 0x9cf8000000000000, 0x9cf84c61746e5a5a }, /* hhy -> hhy-Latn-ZZ */
+    { 0x9d00000000000000, 0x9d004c61746e5a5a }, /* hia -> hia-Latn-ZZ */
+    { 0x9d05000000000000, 0x9d054c61746e464a }, /* hif -> hif-Latn-FJ */
+    { 0x9d06000000000000, 0x9d064c61746e5a5a }, /* hig -> hig-Latn-ZZ */
+    { 0x9d07000000000000, 0x9d074c61746e5a5a }, /* hih -> hih-Latn-ZZ */
+    { 0x9d0b000000000000, 0x9d0b4c61746e5048 }, /* hil -> hil-Latn-PH */
+    { 0x9d60000000000000, 0x9d604c61746e5a5a }, /* hla -> hla-Latn-ZZ */
+    { 0x9d74000000000000, 0x9d74486c75775452 }, /* hlu -> hlu-Hluw-TR */
+    { 0x9d83000000000000, 0x9d83506c7264434e }, /* hmd -> hmd-Plrd-CN */
+    { 0x9d93000000000000, 0x9d934c61746e5a5a }, /* hmt -> hmt-Latn-ZZ */
+    { 0x9da3000000000000, 0x9da341726162504b }, /* hnd -> hnd-Arab-PK */
+    { 0x9da4000000000000, 0x9da444657661494e }, /* hne -> hne-Deva-IN */
+    { 0x9da9000000000000, 0x9da9486d6e674c41 }, /* hnj -> hnj-Hmng-LA */
+    { 0x9dad000000000000, 0x9dad4c61746e5048 }, /* hnn -> hnn-Latn-PH */
+    { 0x9dae000000000000, 0x9dae41726162504b }, /* hno -> hno-Arab-PK */
+    { 0x9dc2000000000000, 0x9dc244657661494e }, /* hoc -> hoc-Deva-IN */
+    { 0x9dc9000000000000, 0x9dc944657661494e }, /* hoj -> hoj-Deva-IN */
+    { 0x9dd3000000000000, 0x9dd34c61746e5a5a }, /* hot -> hot-Latn-ZZ */
+    { 0x9e41000000000000, 0x9e414c61746e4445 }, /* hsb -> hsb-Latn-DE */
+    { 0x9e4d000000000000, 0x9e4d48616e73434e }, /* hsn -> hsn-Hans-CN */
+    { 0x9e88000000000000, 0x9e884c61746e5a5a }, /* hui -> hui-Latn-ZZ */
+    { 0xa00d000000000000, 0xa00d4c61746e5a5a }, /* ian -> ian-Latn-ZZ */
+    { 0xa011000000000000, 0xa0114c61746e5a5a }, /* iar -> iar-Latn-ZZ */
+    { 0xa020000000000000, 0xa0204c61746e4d59 }, /* iba -> iba-Latn-MY */
+    { 0xa021000000000000, 0xa0214c61746e4e47 }, /* ibb -> ibb-Latn-NG */
+    { 0xa038000000000000, 0xa0384c61746e5a5a }, /* iby -> iby-Latn-ZZ */
+    { 0xa040000000000000, 0xa0404c61746e5a5a }, /* ica -> ica-Latn-ZZ */
+    { 0xa047000000000000, 0xa0474c61746e5a5a }, /* ich -> ich-Latn-ZZ */
+    { 0xa063000000000000, 0xa0634c61746e5a5a }, /* idd -> idd-Latn-ZZ */
+    { 0xa068000000000000, 0xa0684c61746e5a5a }, /* idi -> idi-Latn-ZZ */
+    { 0xa074000000000000, 0xa0744c61746e5a5a }, /* idu -> idu-Latn-ZZ */
+    { 0xa0a4000000000000, 0xa0a44c61746e5447 }, /* ife -> ife-Latn-TG */
+    { 0xa0c1000000000000, 0xa0c14c61746e5a5a }, /* igb -> igb-Latn-ZZ */
+    { 0xa0c4000000000000, 0xa0c44c61746e5a5a }, /* ige -> ige-Latn-ZZ */
+    { 0xa129000000000000, 0xa1294c61746e5a5a }, /* ijj -> ijj-Latn-ZZ */
+    { 0xa14a000000000000, 0xa14a4c61746e5a5a }, /* ikk -> ikk-Latn-ZZ */
+    { 0xa153000000000000, 0xa1534c61746e4341 }, /* ikt -> ikt-Latn-CA */
+    { 0xa156000000000000, 0xa1564c61746e5a5a }, /* ikw -> ikw-Latn-ZZ */
+    { 0xa157000000000000, 0xa1574c61746e5a5a }, /* ikx -> ikx-Latn-ZZ */
+    { 0xa16e000000000000, 0xa16e4c61746e5048 }, /* ilo -> ilo-Latn-PH */
+    { 0xa18e000000000000, 0xa18e4c61746e5a5a }, /* imo -> imo-Latn-ZZ */
+    { 0xa1a7000000000000, 0xa1a74379726c5255 }, /* inh -> inh-Cyrl-RU */
+    { 0xa1d4000000000000, 0xa1d44c61746e5a5a }, /* iou -> iou-Latn-ZZ */
+    { 0xa228000000000000, 0xa2284c61746e5a5a }, /* iri -> iri-Latn-ZZ */
+    { 0xa2cc000000000000, 0xa2cc4c61746e5a5a }, /* iwm -> iwm-Latn-ZZ */
+    { 0xa2d2000000000000, 0xa2d24c61746e5a5a }, /* iws -> iws-Latn-ZZ */
+    { 0xa327000000000000, 0xa3274c61746e5255 }, /* izh -> izh-Latn-RU */
+    { 0xa328000000000000, 0xa3284c61746e5a5a }, /* izi -> izi-Latn-ZZ */
+    { 0xa401000000000000, 0xa4014c61746e5a5a }, /* jab -> jab-Latn-ZZ */
+    { 0xa40c000000000000, 0xa40c4c61746e4a4d }, /* jam -> jam-Latn-JM */
+    { 0xa411000000000000, 0xa4114c61746e5a5a }, /* jar -> jar-Latn-ZZ */
+    { 0xa42e000000000000, 0xa42e4c61746e8001 }, /* jbo -> jbo-Latn-001 */
+    { 0xa434000000000000, 0xa4344c61746e5a5a }, /* jbu -> jbu-Latn-ZZ */
+    { 0xa48d000000000000, 0xa48d4c61746e5a5a }, /* jen -> jen-Latn-ZZ */
+    { 0xa4ca000000000000, 0xa4ca4c61746e5a5a }, /* jgk -> jgk-Latn-ZZ */
+    { 0xa4ce000000000000, 0xa4ce4c61746e434d }, /* jgo -> jgo-Latn-CM */
+    { 0xa501000000000000, 0xa5014c61746e5a5a }, /* jib -> jib-Latn-ZZ */
+    { 0xa582000000000000, 0xa5824c61746e545a }, /* jmc -> jmc-Latn-TZ */
+    { 0xa58b000000000000, 0xa58b446576614e50 }, /* jml -> jml-Deva-NP */
+    { 0xa620000000000000, 0xa6204c61746e5a5a }, /* jra -> jra-Latn-ZZ */
+    { 0xa693000000000000, 0xa6934c61746e444b }, /* jut -> jut-Latn-DK */
+    { 0xa800000000000000, 0xa8004379726c555a }, /* kaa -> kaa-Cyrl-UZ */
+    { 0xa801000000000000, 0xa8014c61746e445a }, /* kab -> kab-Latn-DZ */
+    { 0xa802000000000000, 0xa8024c61746e4d4d }, /* kac -> kac-Latn-MM */
+    { 0xa803000000000000, 0xa8034c61746e5a5a }, /* kad -> kad-Latn-ZZ */
+    { 0xa808000000000000, 0xa8084c61746e5a5a }, /* kai -> kai-Latn-ZZ */
+    { 0xa809000000000000, 0xa8094c61746e4e47 }, /* kaj -> kaj-Latn-NG */
+    { 0xa80c000000000000, 0xa80c4c61746e4b45 }, /* kam -> kam-Latn-KE */
+    { 0xa80e000000000000, 0xa80e4c61746e4d4c }, /* kao -> kao-Latn-ML */
+    { 0xa823000000000000, 0xa8234379726c5255 }, /* kbd -> kbd-Cyrl-RU */
+    { 0xa82c000000000000, 0xa82c4c61746e5a5a }, /* kbm -> kbm-Latn-ZZ */
+    { 0xa82f000000000000, 0xa82f4c61746e5a5a }, /* kbp -> kbp-Latn-ZZ */
+    { 0xa830000000000000, 0xa8304c61746e5a5a }, /* kbq -> kbq-Latn-ZZ */
+    { 0xa837000000000000, 0xa8374c61746e5a5a }, /* kbx -> kbx-Latn-ZZ */
+    { 0xa838000000000000, 0xa838417261624e45 }, /* kby -> kby-Arab-NE */
+    { 0xa846000000000000, 0xa8464c61746e4e47 }, /* kcg -> kcg-Latn-NG */
+    { 0xa84a000000000000, 0xa84a4c61746e5a57 }, /* kck -> kck-Latn-ZW */
+    { 0xa84b000000000000, 0xa84b4c61746e5a5a }, /* kcl -> kcl-Latn-ZZ */
+    { 0xa853000000000000, 0xa8534c61746e5a5a }, /* kct -> kct-Latn-ZZ */
+    { 0xa864000000000000, 0xa8644c61746e545a }, /* kde -> kde-Latn-TZ */
+    { 0xa867000000000000, 0xa867417261625447 }, /* kdh -> kdh-Arab-TG */
+    { 0xa86b000000000000, 0xa86b4c61746e5a5a }, /* kdl -> kdl-Latn-ZZ */
+    { 0xa873000000000000, 0xa873546861695448 }, /* kdt -> kdt-Thai-TH */
+    { 0xa880000000000000, 0xa8804c61746e4356 }, /* kea -> kea-Latn-CV */
+    { 0xa88d000000000000, 0xa88d4c61746e434d }, /* ken -> ken-Latn-CM */
+    { 0xa899000000000000, 0xa8994c61746e5a5a }, /* kez -> kez-Latn-ZZ */
+    { 0xa8ae000000000000, 0xa8ae4c61746e4349 }, /* kfo -> kfo-Latn-CI */
+    { 0xa8b1000000000000, 0xa8b144657661494e }, /* kfr -> kfr-Deva-IN */
+    { 0xa8b8000000000000, 0xa8b844657661494e }, /* kfy -> kfy-Deva-IN */
+    { 0xa8c4000000000000, 0xa8c44c61746e4944 }, /* kge -> kge-Latn-ID */
+    { 0xa8c5000000000000, 0xa8c54c61746e5a5a }, /* kgf -> kgf-Latn-ZZ */
+    { 0xa8cf000000000000, 0xa8cf4c61746e4252 }, /* kgp -> kgp-Latn-BR */
+    { 0xa8e0000000000000, 0xa8e04c61746e494e }, /* kha -> kha-Latn-IN */
+    { 0xa8e1000000000000, 0xa8e154616c75434e }, /* khb -> khb-Talu-CN */
+    { 0xa8ed000000000000, 0xa8ed44657661494e }, /* khn -> khn-Deva-IN */
+    { 0xa8f0000000000000, 0xa8f04c61746e4d4c }, /* khq -> khq-Latn-ML */
+    { 0xa8f2000000000000, 0xa8f24c61746e5a5a }, /* khs -> khs-Latn-ZZ */
+    { 0xa8f3000000000000, 0xa8f34d796d72494e }, /* kht -> kht-Mymr-IN */
+    { 0xa8f6000000000000, 0xa8f641726162504b }, /* khw -> khw-Arab-PK */
+    { 0xa8f9000000000000, 0xa8f94c61746e5a5a }, /* khz -> khz-Latn-ZZ */
+    { 0xa909000000000000, 0xa9094c61746e5a5a }, /* kij -> kij-Latn-ZZ */
+    { 0xa914000000000000, 0xa9144c61746e5452 }, /* kiu -> kiu-Latn-TR */
+    { 0xa916000000000000, 0xa9164c61746e5a5a }, /* kiw -> kiw-Latn-ZZ */
+    { 0xa923000000000000, 0xa9234c61746e5a5a }, /* kjd -> kjd-Latn-ZZ */
+    { 0xa926000000000000, 0xa9264c616f6f4c41 }, /* kjg -> kjg-Laoo-LA */
+    { 0xa932000000000000, 0xa9324c61746e5a5a }, /* kjs -> kjs-Latn-ZZ */
+    { 0xa938000000000000, 0xa9384c61746e5a5a }, /* kjy -> kjy-Latn-ZZ */
+    { 0xa942000000000000, 0xa9424c61746e5a5a }, /* kkc -> kkc-Latn-ZZ */
+    { 0xa949000000000000, 0xa9494c61746e434d }, /* kkj -> kkj-Latn-CM */
+    { 0xa96d000000000000, 0xa96d4c61746e4b45 }, /* kln -> kln-Latn-KE */
+    { 0xa970000000000000, 0xa9704c61746e5a5a }, /* klq -> klq-Latn-ZZ */
+    { 0xa973000000000000, 0xa9734c61746e5a5a }, /* klt -> klt-Latn-ZZ */
+    { 0xa977000000000000, 0xa9774c61746e5a5a }, /* klx -> klx-Latn-ZZ */
+    { 0xa981000000000000, 0xa9814c61746e414f }, /* kmb -> kmb-Latn-AO */
+    { 0xa987000000000000, 0xa9874c61746e5a5a }, /* kmh -> kmh-Latn-ZZ */
+    { 0xa98e000000000000, 0xa98e4c61746e5a5a }, /* kmo -> kmo-Latn-ZZ */
+    { 0xa992000000000000, 0xa9924c61746e5a5a }, /* kms -> kms-Latn-ZZ */
+    { 0xa994000000000000, 0xa9944c61746e5a5a }, /* kmu -> kmu-Latn-ZZ */
+    { 0xa996000000000000, 0xa9964c61746e5a5a }, /* kmw -> kmw-Latn-ZZ */
+    { 0xa9a5000000000000, 0xa9a54c61746e4757 }, /* knf -> knf-Latn-GW */
+    { 0xa9af000000000000, 0xa9af4c61746e5a5a }, /* knp -> knp-Latn-ZZ */
+    { 0xa9c8000000000000, 0xa9c84379726c5255 }, /* koi -> koi-Cyrl-RU */
+    { 0xa9ca000000000000, 0xa9ca44657661494e }, /* kok -> kok-Deva-IN */
+    { 0xa9cb000000000000, 0xa9cb4c61746e5a5a }, /* kol -> kol-Latn-ZZ */
+    { 0xa9d2000000000000, 0xa9d24c61746e464d }, /* kos -> kos-Latn-FM */
+    { 0xa9d9000000000000, 0xa9d94c61746e5a5a }, /* koz -> koz-Latn-ZZ */
+    { 0xa9e4000000000000, 0xa9e44c61746e4c52 }, /* kpe -> kpe-Latn-LR */
+    { 0xa9e5000000000000, 0xa9e54c61746e5a5a }, /* kpf -> kpf-Latn-ZZ */
+    { 0xa9ee000000000000, 0xa9ee4c61746e5a5a }, /* kpo -> kpo-Latn-ZZ */
+    { 0xa9f1000000000000, 0xa9f14c61746e5a5a }, /* kpr -> kpr-Latn-ZZ */
+    { 0xa9f7000000000000, 0xa9f74c61746e5a5a }, /* kpx -> kpx-Latn-ZZ */
+    { 0xaa01000000000000, 0xaa014c61746e5a5a }, /* kqb -> kqb-Latn-ZZ */
+    { 0xaa05000000000000, 0xaa054c61746e5a5a }, /* kqf -> kqf-Latn-ZZ */
+    { 0xaa12000000000000, 0xaa124c61746e5a5a }, /* kqs -> kqs-Latn-ZZ */
+    { 0xaa18000000000000, 0xaa18457468695a5a }, /* kqy -> kqy-Ethi-ZZ */
+    { 0xaa22000000000000, 0xaa224379726c5255 }, /* krc -> krc-Cyrl-RU */
+    { 0xaa28000000000000, 0xaa284c61746e534c }, /* kri -> kri-Latn-SL */
+    { 0xaa29000000000000, 0xaa294c61746e5048 }, /* krj -> krj-Latn-PH */
+    { 0xaa2b000000000000, 0xaa2b4c61746e5255 }, /* krl -> krl-Latn-RU */
+    { 0xaa32000000000000, 0xaa324c61746e5a5a }, /* krs -> krs-Latn-ZZ */
+    { 0xaa34000000000000, 0xaa3444657661494e }, /* kru -> kru-Deva-IN */
+    { 0xaa41000000000000, 0xaa414c61746e545a }, /* ksb -> ksb-Latn-TZ */
+    { 0xaa43000000000000, 0xaa434c61746e5a5a }, /* ksd -> ksd-Latn-ZZ */
+    { 0xaa45000000000000, 0xaa454c61746e434d }, /* ksf -> ksf-Latn-CM */
+    { 0xaa47000000000000, 0xaa474c61746e4445 }, /* ksh -> ksh-Latn-DE */
+    { 0xaa49000000000000, 0xaa494c61746e5a5a }, /* ksj -> ksj-Latn-ZZ */
+    { 0xaa51000000000000, 0xaa514c61746e5a5a }, /* ksr -> ksr-Latn-ZZ */
+    { 0xaa61000000000000, 0xaa61457468695a5a }, /* ktb -> ktb-Ethi-ZZ */
+    { 0xaa6c000000000000, 0xaa6c4c61746e5a5a }, /* ktm -> ktm-Latn-ZZ */
+    { 0xaa6e000000000000, 0xaa6e4c61746e5a5a }, /* kto -> kto-Latn-ZZ */
+    { 0xaa71000000000000, 0xaa714c61746e4d59 }, /* ktr -> ktr-Latn-MY */
+    { 0xaa81000000000000, 0xaa814c61746e5a5a }, /* kub -> kub-Latn-ZZ */
+    { 0xaa83000000000000, 0xaa834c61746e5a5a }, /* kud -> kud-Latn-ZZ */
+    { 0xaa84000000000000, 0xaa844c61746e5a5a }, /* kue -> kue-Latn-ZZ */
+    { 0xaa89000000000000, 0xaa894c61746e5a5a }, /* kuj -> kuj-Latn-ZZ */
+    { 0xaa8c000000000000, 0xaa8c4379726c5255 }, /* kum -> kum-Cyrl-RU */
+    { 0xaa8d000000000000, 0xaa8d4c61746e5a5a }, /* kun -> kun-Latn-ZZ */
+    { 0xaa8f000000000000, 0xaa8f4c61746e5a5a }, /* kup -> kup-Latn-ZZ */
+    { 0xaa92000000000000, 0xaa924c61746e5a5a }, /* kus -> kus-Latn-ZZ */
+    { 0xaaa6000000000000, 0xaaa64c61746e5a5a }, /* kvg -> kvg-Latn-ZZ */
+    { 0xaab1000000000000, 0xaab14c61746e4944 }, /* kvr -> kvr-Latn-ID */
+    { 0xaab7000000000000, 0xaab741726162504b }, /* kvx -> kvx-Arab-PK */
+    { 0xaac9000000000000, 0xaac94c61746e5a5a }, /* kwj -> kwj-Latn-ZZ */
+    { 0xaace000000000000, 0xaace4c61746e5a5a }, /* kwo -> kwo-Latn-ZZ */
+    { 0xaad0000000000000, 0xaad04c61746e5a5a }, /* kwq -> kwq-Latn-ZZ */
+    { 0xaae0000000000000, 0xaae04c61746e5a5a }, /* kxa -> kxa-Latn-ZZ */
+    { 0xaae2000000000000, 0xaae2457468695a5a }, /* kxc -> kxc-Ethi-ZZ */
+    { 0xaae4000000000000, 0xaae44c61746e5a5a }, /* kxe -> kxe-Latn-ZZ */
+    { 0xaaeb000000000000, 0xaaeb44657661494e }, /* kxl -> kxl-Deva-IN */
+    { 0xaaec000000000000, 0xaaec546861695448 }, /* kxm -> kxm-Thai-TH */
+    { 0xaaef000000000000, 0xaaef41726162504b }, /* kxp -> kxp-Arab-PK */
+    { 0xaaf6000000000000, 0xaaf64c61746e5a5a }, /* kxw -> kxw-Latn-ZZ */
+    { 0xaaf9000000000000, 0xaaf94c61746e5a5a }, /* kxz -> kxz-Latn-ZZ */
+    { 0xab04000000000000, 0xab044c61746e5a5a }, /* kye -> kye-Latn-ZZ */
+    { 0xab17000000000000, 0xab174c61746e5a5a }, /* kyx -> kyx-Latn-ZZ */
+    { 0xab27000000000000, 0xab27417261625a5a }, /* kzh -> kzh-Arab-ZZ */
+    { 0xab29000000000000, 0xab294c61746e4d59 }, /* kzj -> kzj-Latn-MY */
+    { 0xab31000000000000, 0xab314c61746e5a5a }, /* kzr -> kzr-Latn-ZZ */
+    { 0xab33000000000000, 0xab334c61746e4d59 }, /* kzt -> kzt-Latn-MY */
+    { 0xac01000000000000, 0xac014c696e614752 }, /* lab -> lab-Lina-GR */
+    { 0xac03000000000000, 0xac0348656272494c }, /* lad -> lad-Hebr-IL */
+    { 0xac06000000000000, 0xac064c61746e545a }, /* lag -> lag-Latn-TZ */
+    { 0xac07000000000000, 0xac0741726162504b }, /* lah -> lah-Arab-PK */
+    { 0xac09000000000000, 0xac094c61746e5547 }, /* laj -> laj-Latn-UG */
+    { 0xac12000000000000, 0xac124c61746e5a5a }, /* las -> las-Latn-ZZ */
+    { 0xac24000000000000, 0xac244379726c5255 }, /* lbe -> lbe-Cyrl-RU */
+    { 0xac34000000000000, 0xac344c61746e5a5a }, /* lbu -> lbu-Latn-ZZ */
+    { 0xac36000000000000, 0xac364c61746e4944 }, /* lbw -> lbw-Latn-ID */
+    { 0xac4c000000000000, 0xac4c4c61746e5a5a }, /* lcm -> lcm-Latn-ZZ */
+    { 0xac4f000000000000, 0xac4f54686169434e }, /* lcp -> lcp-Thai-CN */
+    { 0xac61000000000000, 0xac614c61746e5a5a }, /* ldb -> ldb-Latn-ZZ */
+    { 0xac83000000000000, 0xac834c61746e5a5a }, /* led -> led-Latn-ZZ */
+    { 0xac84000000000000, 0xac844c61746e5a5a }, /* lee -> lee-Latn-ZZ */
+    { 0xac8c000000000000, 0xac8c4c61746e5a5a }, /* lem -> lem-Latn-ZZ */
+    { 0xac8f000000000000, 0xac8f4c657063494e }, /* lep -> lep-Lepc-IN */
+    { 0xac90000000000000, 0xac904c61746e5a5a }, /* leq -> leq-Latn-ZZ */
+    { 0xac94000000000000, 0xac944c61746e5a5a }, /* leu -> leu-Latn-ZZ */
+    { 0xac99000000000000, 0xac994379726c5255 }, /* lez -> lez-Cyrl-RU */
+    { 0xacc6000000000000, 0xacc64c61746e5a5a }, /* lgg -> lgg-Latn-ZZ */
+    { 0xad00000000000000, 0xad004c61746e5a5a }, /* lia -> lia-Latn-ZZ */
+    { 0xad03000000000000, 0xad034c61746e5a5a }, /* lid -> lid-Latn-ZZ */
+    { 0xad05000000000000, 0xad05446576614e50 }, /* lif -> lif-Deva-NP */
+    { 0xad054c696d620000, 0xad054c696d62494e }, /* lif-Limb -> lif-Limb-IN */
+    { 0xad06000000000000, 0xad064c61746e5a5a }, /* lig -> lig-Latn-ZZ */
+    { 0xad07000000000000, 0xad074c61746e5a5a }, /* lih -> lih-Latn-ZZ */
+    { 0xad09000000000000, 0xad094c61746e4954 }, /* lij -> lij-Latn-IT */
+    { 0xad12000000000000, 0xad124c697375434e }, /* lis -> lis-Lisu-CN */
+    { 0xad2f000000000000, 0xad2f4c61746e4944 }, /* ljp -> ljp-Latn-ID */
+    { 0xad48000000000000, 0xad48417261624952 }, /* lki -> lki-Arab-IR */
+    { 0xad53000000000000, 0xad534c61746e5553 }, /* lkt -> lkt-Latn-US */
+    { 0xad64000000000000, 0xad644c61746e5a5a }, /* lle -> lle-Latn-ZZ */
+    { 0xad6d000000000000, 0xad6d4c61746e5a5a }, /* lln -> lln-Latn-ZZ */
+    { 0xad8d000000000000, 0xad8d54656c75494e }, /* lmn -> lmn-Telu-IN */
+    { 0xad8e000000000000, 0xad8e4c61746e4954 }, /* lmo -> lmo-Latn-IT */
+    { 0xad8f000000000000, 0xad8f4c61746e5a5a }, /* lmp -> lmp-Latn-ZZ */
+    { 0xadb2000000000000, 0xadb24c61746e5a5a }, /* lns -> lns-Latn-ZZ */
+    { 0xadb4000000000000, 0xadb44c61746e5a5a }, /* lnu -> lnu-Latn-ZZ */
+    { 0xadc9000000000000, 0xadc94c61746e5a5a }, /* loj -> loj-Latn-ZZ */
+    { 0xadca000000000000, 0xadca4c61746e5a5a }, /* lok -> lok-Latn-ZZ */
+    { 0xadcb000000000000, 0xadcb4c61746e4344 }, /* lol -> lol-Latn-CD */
+    { 0xadd1000000000000, 0xadd14c61746e5a5a }, /* lor -> lor-Latn-ZZ */
+    { 0xadd2000000000000, 0xadd24c61746e5a5a }, /* los -> los-Latn-ZZ */
+    { 0xadd9000000000000, 0xadd94c61746e5a4d }, /* loz -> loz-Latn-ZM */
+    { 0xae22000000000000, 0xae22417261624952 }, /* lrc -> lrc-Arab-IR */
+    { 0xae66000000000000, 0xae664c61746e4c56 }, /* ltg -> ltg-Latn-LV */
+    { 0xae80000000000000, 0xae804c61746e4344 }, /* lua -> lua-Latn-CD */
+    { 0xae8e000000000000, 0xae8e4c61746e4b45 }, /* luo -> luo-Latn-KE */
+    { 0xae98000000000000, 0xae984c61746e4b45 }, /* luy -> luy-Latn-KE */
+    { 0xae99000000000000, 0xae99417261624952 }, /* luz -> luz-Arab-IR */
+    { 0xaecb000000000000, 0xaecb546861695448 }, /* lwl -> lwl-Thai-TH */
+    { 0xaf27000000000000, 0xaf2748616e73434e }, /* lzh -> lzh-Hans-CN */
+    { 0xaf39000000000000, 0xaf394c61746e5452 }, /* lzz -> lzz-Latn-TR */
+    { 0xb003000000000000, 0xb0034c61746e4944 }, /* mad -> mad-Latn-ID */
+    { 0xb005000000000000, 0xb0054c61746e434d }, /* maf -> maf-Latn-CM */
+    { 0xb006000000000000, 0xb00644657661494e }, /* mag -> mag-Deva-IN */
+    { 0xb008000000000000, 0xb00844657661494e }, /* mai -> mai-Deva-IN */
+    { 0xb00a000000000000, 0xb00a4c61746e4944 }, /* mak -> mak-Latn-ID */
+    { 0xb00d000000000000, 0xb00d4c61746e474d }, /* man -> man-Latn-GM */
+    { 0xb00d00000000474e, 0xb00d4e6b6f6f474e }, /* man-GN -> man-Nkoo-GN */
+    { 0xb00d4e6b6f6f0000, 0xb00d4e6b6f6f474e }, /* man-Nkoo -> man-Nkoo-GN */
+    { 0xb012000000000000, 0xb0124c61746e4b45 }, /* mas -> mas-Latn-KE */
+    { 0xb016000000000000, 0xb0164c61746e5a5a }, /* maw -> maw-Latn-ZZ */
+    { 0xb019000000000000, 0xb0194c61746e4d58 }, /* maz -> maz-Latn-MX */
+    { 0xb027000000000000, 0xb0274c61746e5a5a }, /* mbh -> mbh-Latn-ZZ */
+    { 0xb02e000000000000, 0xb02e4c61746e5a5a }, /* mbo -> mbo-Latn-ZZ */
+    { 0xb030000000000000, 0xb0304c61746e5a5a }, /* mbq -> mbq-Latn-ZZ */
+    { 0xb034000000000000, 0xb0344c61746e5a5a }, /* mbu -> mbu-Latn-ZZ */
+    { 0xb036000000000000, 0xb0364c61746e5a5a }, /* mbw -> mbw-Latn-ZZ */
+    { 0xb048000000000000, 0xb0484c61746e5a5a }, /* mci -> mci-Latn-ZZ */
+    { 0xb04f000000000000, 0xb04f4c61746e5a5a }, /* mcp -> mcp-Latn-ZZ */
+    { 0xb050000000000000, 0xb0504c61746e5a5a }, /* mcq -> mcq-Latn-ZZ */
+    { 0xb051000000000000, 0xb0514c61746e5a5a }, /* mcr -> mcr-Latn-ZZ */
+    { 0xb054000000000000, 0xb0544c61746e5a5a }, /* mcu -> mcu-Latn-ZZ */
+    { 0xb060000000000000, 0xb0604c61746e5a5a }, /* mda -> mda-Latn-ZZ */
+    { 0xb064000000000000, 0xb064417261625a5a }, /* mde -> mde-Arab-ZZ */
+    { 0xb065000000000000, 0xb0654379726c5255 }, /* mdf -> mdf-Cyrl-RU */
+    { 0xb067000000000000, 0xb0674c61746e5048 }, /* mdh -> mdh-Latn-PH */
+    { 0xb069000000000000, 0xb0694c61746e5a5a }, /* mdj -> mdj-Latn-ZZ */
+    { 0xb071000000000000, 0xb0714c61746e4944 }, /* mdr -> mdr-Latn-ID */
+    { 0xb077000000000000, 0xb077457468695a5a }, /* mdx -> mdx-Ethi-ZZ */
+    { 0xb083000000000000, 0xb0834c61746e5a5a }, /* med -> med-Latn-ZZ */
+    { 0xb084000000000000, 0xb0844c61746e5a5a }, /* mee -> mee-Latn-ZZ */
+    { 0xb08a000000000000, 0xb08a4c61746e5a5a }, /* mek -> mek-Latn-ZZ */
+    { 0xb08d000000000000, 0xb08d4c61746e534c }, /* men -> men-Latn-SL */
+    { 0xb091000000000000, 0xb0914c61746e4b45 }, /* mer -> mer-Latn-KE */
+    { 0xb093000000000000, 0xb0934c61746e5a5a }, /* met -> met-Latn-ZZ */
+    { 0xb094000000000000, 0xb0944c61746e5a5a }, /* meu -> meu-Latn-ZZ */
+    { 0xb0a0000000000000, 0xb0a0417261625448 }, /* mfa -> mfa-Arab-TH */
+    { 0xb0a4000000000000, 0xb0a44c61746e4d55 }, /* mfe -> mfe-Latn-MU */
+    { 0xb0ad000000000000, 0xb0ad4c61746e5a5a }, /* mfn -> mfn-Latn-ZZ */
+    { 0xb0ae000000000000, 0xb0ae4c61746e5a5a }, /* mfo -> mfo-Latn-ZZ */
+    { 0xb0b0000000000000, 0xb0b04c61746e5a5a }, /* mfq -> mfq-Latn-ZZ */
+    { 0xb0c7000000000000, 0xb0c74c61746e4d5a }, /* mgh -> mgh-Latn-MZ */
+    { 0xb0cb000000000000, 0xb0cb4c61746e5a5a }, /* mgl -> mgl-Latn-ZZ */
+    { 0xb0ce000000000000, 0xb0ce4c61746e434d }, /* mgo -> mgo-Latn-CM */
+    { 0xb0cf000000000000, 0xb0cf446576614e50 }, /* mgp -> mgp-Deva-NP */
+    { 0xb0d8000000000000, 0xb0d84c61746e545a }, /* mgy -> mgy-Latn-TZ */
+    { 0xb0e8000000000000, 0xb0e84c61746e5a5a }, /* mhi -> mhi-Latn-ZZ */
+    { 0xb0eb000000000000, 0xb0eb4c61746e5a5a }, /* mhl -> mhl-Latn-ZZ */
+    { 0xb105000000000000, 0xb1054c61746e5a5a }, /* mif -> mif-Latn-ZZ */
+    { 0xb10d000000000000, 0xb10d4c61746e4944 }, /* min -> min-Latn-ID */
+    { 0xb112000000000000, 0xb112486174724951 }, /* mis -> mis-Hatr-IQ */
+    { 0xb1124d6564660000, 0xb1124d6564664e47 }, /* mis-Medf -> mis-Medf-NG */
+    { 0xb116000000000000, 0xb1164c61746e5a5a }, /* miw -> miw-Latn-ZZ */
+    { 0xb148000000000000, 0xb148417261625a5a }, /* mki -> mki-Arab-ZZ */
+    { 0xb14b000000000000, 0xb14b4c61746e5a5a }, /* mkl -> mkl-Latn-ZZ */
+    { 0xb14f000000000000, 0xb14f4c61746e5a5a }, /* mkp -> mkp-Latn-ZZ */
+    { 0xb156000000000000, 0xb1564c61746e5a5a }, /* mkw -> mkw-Latn-ZZ */
+    { 0xb164000000000000, 0xb1644c61746e5a5a }, /* mle -> mle-Latn-ZZ */
+    { 0xb16f000000000000, 0xb16f4c61746e5a5a }, /* mlp -> mlp-Latn-ZZ */
+    { 0xb172000000000000, 0xb1724c61746e5344 }, /* mls -> mls-Latn-SD */
+    { 0xb18e000000000000, 0xb18e4c61746e5a5a }, /* mmo -> mmo-Latn-ZZ */
+    { 0xb194000000000000, 0xb1944c61746e5a5a }, /* mmu -> mmu-Latn-ZZ */
+    { 0xb197000000000000, 0xb1974c61746e5a5a }, /* mmx -> mmx-Latn-ZZ */
+    { 0xb1a0000000000000, 0xb1a04c61746e5a5a }, /* mna -> mna-Latn-ZZ */
+    { 0xb1a5000000000000, 0xb1a54c61746e5a5a }, /* mnf -> mnf-Latn-ZZ */
+    { 0xb1a8000000000000, 0xb1a842656e67494e }, /* mni -> mni-Beng-IN */
+    { 0xb1b6000000000000, 0xb1b64d796d724d4d }, /* mnw -> mnw-Mymr-MM */
+    { 0xb1c0000000000000, 0xb1c04c61746e5a5a }, /* moa -> moa-Latn-ZZ */
+    { 0xb1c4000000000000, 0xb1c44c61746e4341 }, /* moe -> moe-Latn-CA */
+    { 0xb1c7000000000000, 0xb1c74c61746e4341 }, /* moh -> moh-Latn-CA */
+    { 0xb1d2000000000000, 0xb1d24c61746e4246 }, /* mos -> mos-Latn-BF */
+    { 0xb1d7000000000000, 0xb1d74c61746e5a5a }, /* mox -> mox-Latn-ZZ */
+    { 0xb1ef000000000000, 0xb1ef4c61746e5a5a }, /* mpp -> mpp-Latn-ZZ */
+    { 0xb1f2000000000000, 0xb1f24c61746e5a5a }, /* mps -> mps-Latn-ZZ */
+    { 0xb1f3000000000000, 0xb1f34c61746e5a5a }, /* mpt -> mpt-Latn-ZZ */
+    { 0xb1f7000000000000, 0xb1f74c61746e5a5a }, /* mpx -> mpx-Latn-ZZ */
+    { 0xb20b000000000000, 0xb20b4c61746e5a5a }, /* mql -> mql-Latn-ZZ */
+    { 0xb223000000000000, 0xb223446576614e50 }, /* mrd -> mrd-Deva-NP */
+    { 0xb229000000000000, 0xb2294379726c5255 }, /* mrj -> mrj-Cyrl-RU */
+    { 0xb22e000000000000, 0xb22e4d726f6f4244 }, /* mro -> mro-Mroo-BD */
+    { 0xb262000000000000, 0xb2624c61746e5a5a }, /* mtc -> mtc-Latn-ZZ */
+    { 0xb265000000000000, 0xb2654c61746e5a5a }, /* mtf -> mtf-Latn-ZZ */
+    { 0xb268000000000000, 0xb2684c61746e5a5a }, /* mti -> mti-Latn-ZZ */
+    { 0xb271000000000000, 0xb27144657661494e }, /* mtr -> mtr-Deva-IN */
+    { 0xb280000000000000, 0xb2804c61746e434d }, /* mua -> mua-Latn-CM */
+    { 0xb291000000000000, 0xb2914c61746e5a5a }, /* mur -> mur-Latn-ZZ */
+    { 0xb292000000000000, 0xb2924c61746e5553 }, /* mus -> mus-Latn-US */
+    { 0xb2a0000000000000, 0xb2a04c61746e5a5a }, /* mva -> mva-Latn-ZZ */
+    { 0xb2ad000000000000, 0xb2ad4c61746e5a5a }, /* mvn -> mvn-Latn-ZZ */
+    { 0xb2b8000000000000, 0xb2b841726162504b }, /* mvy -> mvy-Arab-PK */
+    { 0xb2ca000000000000, 0xb2ca4c61746e4d4c }, /* mwk -> mwk-Latn-ML */
+    { 0xb2d1000000000000, 0xb2d144657661494e }, /* mwr -> mwr-Deva-IN */
+    { 0xb2d5000000000000, 0xb2d54c61746e4944 }, /* mwv -> mwv-Latn-ID */
+    { 0xb2d6000000000000, 0xb2d6486d6e705553 }, /* mww -> mww-Hmnp-US */
+    { 0xb2e2000000000000, 0xb2e24c61746e5a57 }, /* mxc -> mxc-Latn-ZW */
+    { 0xb2ec000000000000, 0xb2ec4c61746e5a5a }, /* mxm -> mxm-Latn-ZZ */
+    { 0xb30a000000000000, 0xb30a4c61746e5a5a }, /* myk -> myk-Latn-ZZ */
+    { 0xb30c000000000000, 0xb30c457468695a5a }, /* mym -> mym-Ethi-ZZ */
+    { 0xb315000000000000, 0xb3154379726c5255 }, /* myv -> myv-Cyrl-RU */
+    { 0xb316000000000000, 0xb3164c61746e5a5a }, /* myw -> myw-Latn-ZZ */
+    { 0xb317000000000000, 0xb3174c61746e5547 }, /* myx -> myx-Latn-UG */
+    { 0xb319000000000000, 0xb3194d616e644952 }, /* myz -> myz-Mand-IR */
+    { 0xb32a000000000000, 0xb32a4c61746e5a5a }, /* mzk -> mzk-Latn-ZZ */
+    { 0xb32c000000000000, 0xb32c4c61746e5a5a }, /* mzm -> mzm-Latn-ZZ */
+    { 0xb32d000000000000, 0xb32d417261624952 }, /* mzn -> mzn-Arab-IR */
+    { 0xb32f000000000000, 0xb32f4c61746e5a5a }, /* mzp -> mzp-Latn-ZZ */
+    { 0xb336000000000000, 0xb3364c61746e5a5a }, /* mzw -> mzw-Latn-ZZ */
+    { 0xb339000000000000, 0xb3394c61746e5a5a }, /* mzz -> mzz-Latn-ZZ */
+    { 0xb402000000000000, 0xb4024c61746e5a5a }, /* nac -> nac-Latn-ZZ */
+    { 0xb405000000000000, 0xb4054c61746e5a5a }, /* naf -> naf-Latn-ZZ */
+    { 0xb40a000000000000, 0xb40a4c61746e5a5a }, /* nak -> nak-Latn-ZZ */
+    { 0xb40d000000000000, 0xb40d48616e73434e }, /* nan -> nan-Hans-CN */
+    { 0xb40f000000000000, 0xb40f4c61746e4954 }, /* nap -> nap-Latn-IT */
+    { 0xb410000000000000, 0xb4104c61746e4e41 }, /* naq -> naq-Latn-NA */
+    { 0xb412000000000000, 0xb4124c61746e5a5a }, /* nas -> nas-Latn-ZZ */
+    { 0xb440000000000000, 0xb4404c61746e5a5a }, /* nca -> nca-Latn-ZZ */
+    { 0xb444000000000000, 0xb4444c61746e5a5a }, /* nce -> nce-Latn-ZZ */
+    { 0xb445000000000000, 0xb4454c61746e5a5a }, /* ncf -> ncf-Latn-ZZ */
+    { 0xb447000000000000, 0xb4474c61746e4d58 }, /* nch -> nch-Latn-MX */
+    { 0xb44e000000000000, 0xb44e4c61746e5a5a }, /* nco -> nco-Latn-ZZ */
+    { 0xb454000000000000, 0xb4544c61746e5a5a }, /* ncu -> ncu-Latn-ZZ */
+    { 0xb462000000000000, 0xb4624c61746e4d5a }, /* ndc -> ndc-Latn-MZ */
+    { 0xb472000000000000, 0xb4724c61746e4445 }, /* nds -> nds-Latn-DE */
+    { 0xb481000000000000, 0xb4814c61746e5a5a }, /* neb -> neb-Latn-ZZ */
+    { 0xb496000000000000, 0xb496446576614e50 }, /* new -> new-Deva-NP */
+    { 0xb497000000000000, 0xb4974c61746e5a5a }, /* nex -> nex-Latn-ZZ */
+    { 0xb4b1000000000000, 0xb4b14c61746e5a5a }, /* nfr -> nfr-Latn-ZZ */
+    { 0xb4c0000000000000, 0xb4c04c61746e5a5a }, /* nga -> nga-Latn-ZZ */
+    { 0xb4c1000000000000, 0xb4c14c61746e5a5a }, /* ngb -> ngb-Latn-ZZ */
+    { 0xb4cb000000000000, 0xb4cb4c61746e4d5a }, /* ngl -> ngl-Latn-MZ */
+    { 0xb4e1000000000000, 0xb4e14c61746e5a5a }, /* nhb -> nhb-Latn-ZZ */
+    { 0xb4e4000000000000, 0xb4e44c61746e4d58 }, /* nhe -> nhe-Latn-MX */
+    { 0xb4f6000000000000, 0xb4f64c61746e4d58 }, /* nhw -> nhw-Latn-MX */
+    { 0xb505000000000000, 0xb5054c61746e5a5a }, /* nif -> nif-Latn-ZZ */
+    { 0xb508000000000000, 0xb5084c61746e5a5a }, /* nii -> nii-Latn-ZZ */
+    { 0xb509000000000000, 0xb5094c61746e4944 }, /* nij -> nij-Latn-ID */
+    { 0xb50d000000000000, 0xb50d4c61746e5a5a }, /* nin -> nin-Latn-ZZ */
+    { 0xb514000000000000, 0xb5144c61746e4e55 }, /* niu -> niu-Latn-NU */
+    { 0xb518000000000000, 0xb5184c61746e5a5a }, /* niy -> niy-Latn-ZZ */
+    { 0xb519000000000000, 0xb5194c61746e5a5a }, /* niz -> niz-Latn-ZZ */
+    { 0xb52e000000000000, 0xb52e4c61746e494e }, /* njo -> njo-Latn-IN */
+    { 0xb546000000000000, 0xb5464c61746e5a5a }, /* nkg -> nkg-Latn-ZZ */
+    { 0xb54e000000000000, 0xb54e4c61746e5a5a }, /* nko -> nko-Latn-ZZ */
+    { 0xb586000000000000, 0xb5864c61746e434d }, /* nmg -> nmg-Latn-CM */
+    { 0xb599000000000000, 0xb5994c61746e5a5a }, /* nmz -> nmz-Latn-ZZ */
+    { 0xb5a5000000000000, 0xb5a54c61746e5a5a }, /* nnf -> nnf-Latn-ZZ */
+    { 0xb5a7000000000000, 0xb5a74c61746e434d }, /* nnh -> nnh-Latn-CM */
+    { 0xb5aa000000000000, 0xb5aa4c61746e5a5a }, /* nnk -> nnk-Latn-ZZ */
+    { 0xb5ac000000000000, 0xb5ac4c61746e5a5a }, /* nnm -> nnm-Latn-ZZ */
+    { 0xb5af000000000000, 0xb5af5763686f494e }, /* nnp -> nnp-Wcho-IN */
+    { 0xb5c3000000000000, 0xb5c34c616e615448 }, /* nod -> nod-Lana-TH */
+    { 0xb5c4000000000000, 0xb5c444657661494e }, /* noe -> noe-Deva-IN */
+    { 0xb5cd000000000000, 0xb5cd52756e725345 }, /* non -> non-Runr-SE */
+    { 0xb5cf000000000000, 0xb5cf4c61746e5a5a }, /* nop -> nop-Latn-ZZ */
+    { 0xb5d4000000000000, 0xb5d44c61746e5a5a }, /* nou -> nou-Latn-ZZ */
+    { 0xb60e000000000000, 0xb60e4e6b6f6f474e }, /* nqo -> nqo-Nkoo-GN */
+    { 0xb621000000000000, 0xb6214c61746e5a5a }, /* nrb -> nrb-Latn-ZZ */
+    { 0xb64a000000000000, 0xb64a43616e734341 }, /* nsk -> nsk-Cans-CA */
+    { 0xb64d000000000000, 0xb64d4c61746e5a5a }, /* nsn -> nsn-Latn-ZZ */
+    { 0xb64e000000000000, 0xb64e4c61746e5a41 }, /* nso -> nso-Latn-ZA */
+    { 0xb652000000000000, 0xb6524c61746e5a5a }, /* nss -> nss-Latn-ZZ */
+    { 0xb66c000000000000, 0xb66c4c61746e5a5a }, /* ntm -> ntm-Latn-ZZ */
+    { 0xb671000000000000, 0xb6714c61746e5a5a }, /* ntr -> ntr-Latn-ZZ */
+    { 0xb688000000000000, 0xb6884c61746e5a5a }, /* nui -> nui-Latn-ZZ */
+    { 0xb68f000000000000, 0xb68f4c61746e5a5a }, /* nup -> nup-Latn-ZZ */
+    { 0xb692000000000000, 0xb6924c61746e5353 }, /* nus -> nus-Latn-SS */
+    { 0xb695000000000000, 0xb6954c61746e5a5a }, /* nuv -> nuv-Latn-ZZ */
+    { 0xb697000000000000, 0xb6974c61746e5a5a }, /* nux -> nux-Latn-ZZ */
+    { 0xb6c1000000000000, 0xb6c14c61746e5a5a }, /* nwb -> nwb-Latn-ZZ */
+    { 0xb6f0000000000000, 0xb6f04c61746e434e }, /* nxq -> nxq-Latn-CN */
+    { 0xb6f1000000000000, 0xb6f14c61746e5a5a }, /* nxr -> nxr-Latn-ZZ */
+    { 0xb70c000000000000, 0xb70c4c61746e545a }, /* nym -> nym-Latn-TZ */
+    { 0xb70d000000000000, 0xb70d4c61746e5547 }, /* nyn -> nyn-Latn-UG */
+    { 0xb728000000000000, 0xb7284c61746e4748 }, /* nzi -> nzi-Latn-GH */
+    { 0xb8c2000000000000, 0xb8c24c61746e5a5a }, /* ogc -> ogc-Latn-ZZ */
+    { 0xb951000000000000, 0xb9514c61746e5a5a }, /* okr -> okr-Latn-ZZ */
+    { 0xb955000000000000, 0xb9554c61746e5a5a }, /* okv -> okv-Latn-ZZ */
+    { 0xb9a6000000000000, 0xb9a64c61746e5a5a }, /* ong -> ong-Latn-ZZ */
+    { 0xb9ad000000000000, 0xb9ad4c61746e5a5a }, /* onn -> onn-Latn-ZZ */
+    { 0xb9b2000000000000, 0xb9b24c61746e5a5a }, /* ons -> ons-Latn-ZZ */
+    { 0xb9ec000000000000, 0xb9ec4c61746e5a5a }, /* opm -> opm-Latn-ZZ */
+    { 0xba2e000000000000, 0xba2e4c61746e5a5a }, /* oro -> oro-Latn-ZZ */
+    { 0xba34000000000000, 0xba34417261625a5a }, /* oru -> oru-Arab-ZZ */
+    { 0xba40000000000000, 0xba404f7367655553 }, /* osa -> osa-Osge-US */
+    { 0xba60000000000000, 0xba60417261625a5a }, /* ota -> ota-Arab-ZZ */
+    { 0xba6a000000000000, 0xba6a4f726b684d4e }, /* otk -> otk-Orkh-MN */
+    { 0xbb2c000000000000, 0xbb2c4c61746e5a5a }, /* ozm -> ozm-Latn-ZZ */
+    { 0xbc06000000000000, 0xbc064c61746e5048 }, /* pag -> pag-Latn-PH */
+    { 0xbc0b000000000000, 0xbc0b50686c694952 }, /* pal -> pal-Phli-IR */
+    { 0xbc0b50686c700000, 0xbc0b50686c70434e }, /* pal-Phlp -> pal-Phlp-CN */
+    { 0xbc0c000000000000, 0xbc0c4c61746e5048 }, /* pam -> pam-Latn-PH */
+    { 0xbc0f000000000000, 0xbc0f4c61746e4157 }, /* pap -> pap-Latn-AW */
+    { 0xbc14000000000000, 0xbc144c61746e5057 }, /* pau -> pau-Latn-PW */
+    { 0xbc28000000000000, 0xbc284c61746e5a5a }, /* pbi -> pbi-Latn-ZZ */
+    { 0xbc43000000000000, 0xbc434c61746e4652 }, /* pcd -> pcd-Latn-FR */
+    { 0xbc4c000000000000, 0xbc4c4c61746e4e47 }, /* pcm -> pcm-Latn-NG */
+    { 0xbc62000000000000, 0xbc624c61746e5553 }, /* pdc -> pdc-Latn-US */
+    { 0xbc73000000000000, 0xbc734c61746e4341 }, /* pdt -> pdt-Latn-CA */
+    { 0xbc83000000000000, 0xbc834c61746e5a5a }, /* ped -> ped-Latn-ZZ */
+    { 0xbc8e000000000000, 0xbc8e5870656f4952 }, /* peo -> peo-Xpeo-IR */
+    { 0xbc97000000000000, 0xbc974c61746e5a5a }, /* pex -> pex-Latn-ZZ */
+    { 0xbcab000000000000, 0xbcab4c61746e4445 }, /* pfl -> pfl-Latn-DE */
+    { 0xbceb000000000000, 0xbceb417261625a5a }, /* phl -> phl-Arab-ZZ */
+    { 0xbced000000000000, 0xbced50686e784c42 }, /* phn -> phn-Phnx-LB */
+    { 0xbd0b000000000000, 0xbd0b4c61746e5a5a }, /* pil -> pil-Latn-ZZ */
+    { 0xbd0f000000000000, 0xbd0f4c61746e5a5a }, /* pip -> pip-Latn-ZZ */
+    { 0xbd40000000000000, 0xbd4042726168494e }, /* pka -> pka-Brah-IN */
+    { 0xbd4e000000000000, 0xbd4e4c61746e4b45 }, /* pko -> pko-Latn-KE */
+    { 0xbd60000000000000, 0xbd604c61746e5a5a }, /* pla -> pla-Latn-ZZ */
+    { 0xbd92000000000000, 0xbd924c61746e4954 }, /* pms -> pms-Latn-IT */
+    { 0xbda6000000000000, 0xbda64c61746e5a5a }, /* png -> png-Latn-ZZ */
+    { 0xbdad000000000000, 0xbdad4c61746e5a5a }, /* pnn -> pnn-Latn-ZZ */
+    { 0xbdb3000000000000, 0xbdb34772656b4752 }, /* pnt -> pnt-Grek-GR */
+    { 0xbdcd000000000000, 0xbdcd4c61746e464d }, /* pon -> pon-Latn-FM */
+    { 0xbde0000000000000, 0xbde044657661494e }, /* ppa -> ppa-Deva-IN */
+    { 0xbdee000000000000, 0xbdee4c61746e5a5a }, /* ppo -> ppo-Latn-ZZ */
+    { 0xbe20000000000000, 0xbe204b686172504b }, /* pra -> pra-Khar-PK */
+    { 0xbe23000000000000, 0xbe23417261624952 }, /* prd -> prd-Arab-IR */
+    { 0xbe26000000000000, 0xbe264c61746e8001 }, /* prg -> prg-Latn-001 */
+    { 0xbe52000000000000, 0xbe524c61746e5a5a }, /* pss -> pss-Latn-ZZ */
+    { 0xbe6f000000000000, 0xbe6f4c61746e5a5a }, /* ptp -> ptp-Latn-ZZ */
+    { 0xbe94000000000000, 0xbe944c61746e4741 }, /* puu -> puu-Latn-GA */
+    { 0xbec0000000000000, 0xbec04c61746e5a5a }, /* pwa -> pwa-Latn-ZZ */
+    { 0xc282000000000000, 0xc2824c61746e4754 }, /* quc -> quc-Latn-GT */
+    { 0xc286000000000000, 0xc2864c61746e4543 }, /* qug -> qug-Latn-EC */
+    { 0xc408000000000000, 0xc4084c61746e5a5a }, /* rai -> rai-Latn-ZZ */
+    { 0xc409000000000000, 0xc40944657661494e }, /* raj -> raj-Deva-IN */
+    { 0xc40e000000000000, 0xc40e4c61746e5a5a }, /* rao -> rao-Latn-ZZ */
+    { 0xc445000000000000, 0xc4454c61746e5245 }, /* rcf -> rcf-Latn-RE */
+    { 0xc489000000000000, 0xc4894c61746e4944 }, /* rej -> rej-Latn-ID */
+    { 0xc48b000000000000, 0xc48b4c61746e5a5a }, /* rel -> rel-Latn-ZZ */
+    { 0xc492000000000000, 0xc4924c61746e5a5a }, /* res -> res-Latn-ZZ */
+    { 0xc4cd000000000000, 0xc4cd4c61746e4954 }, /* rgn -> rgn-Latn-IT */
+    { 0xc4e6000000000000, 0xc4e6417261624d4d }, /* rhg -> rhg-Arab-MM */
+    { 0xc500000000000000, 0xc5004c61746e494e }, /* ria -> ria-Latn-IN */
+    { 0xc505000000000000, 0xc50554666e674d41 }, /* rif -> rif-Tfng-MA */
+    { 0xc505000000004e4c, 0xc5054c61746e4e4c }, /* rif-NL -> rif-Latn-NL */
+    { 0xc532000000000000, 0xc532446576614e50 }, /* rjs -> rjs-Deva-NP */
+    { 0xc553000000000000, 0xc55342656e674244 }, /* rkt -> rkt-Beng-BD */
+    { 0xc585000000000000, 0xc5854c61746e4649 }, /* rmf -> rmf-Latn-FI */
+    { 0xc58e000000000000, 0xc58e4c61746e4348 }, /* rmo -> rmo-Latn-CH */
+    { 0xc593000000000000, 0xc593417261624952 }, /* rmt -> rmt-Arab-IR */
+    { 0xc594000000000000, 0xc5944c61746e5345 }, /* rmu -> rmu-Latn-SE */
+    { 0xc5a0000000000000, 0xc5a04c61746e5a5a }, /* rna -> rna-Latn-ZZ */
+    { 0xc5a6000000000000, 0xc5a64c61746e4d5a }, /* rng -> rng-Latn-MZ */
+    { 0xc5c1000000000000, 0xc5c14c61746e4944 }, /* rob -> rob-Latn-ID */
+    { 0xc5c5000000000000, 0xc5c54c61746e545a }, /* rof -> rof-Latn-TZ */
+    { 0xc5ce000000000000, 0xc5ce4c61746e5a5a }, /* roo -> roo-Latn-ZZ */
+    { 0xc62e000000000000, 0xc62e4c61746e5a5a }, /* rro -> rro-Latn-ZZ */
+    { 0xc66c000000000000, 0xc66c4c61746e464a }, /* rtm -> rtm-Latn-FJ */
+    { 0xc684000000000000, 0xc6844379726c5541 }, /* rue -> rue-Cyrl-UA */
+    { 0xc686000000000000, 0xc6864c61746e5342 }, /* rug -> rug-Latn-SB */
+    { 0xc6ca000000000000, 0xc6ca4c61746e545a }, /* rwk -> rwk-Latn-TZ */
+    { 0xc6ce000000000000, 0xc6ce4c61746e5a5a }, /* rwo -> rwo-Latn-ZZ */
+    { 0xc714000000000000, 0xc7144b616e614a50 }, /* ryu -> ryu-Kana-JP */
+    { 0xc805000000000000, 0xc8054c61746e4748 }, /* saf -> saf-Latn-GH */
+    { 0xc807000000000000, 0xc8074379726c5255 }, /* sah -> sah-Cyrl-RU */
+    { 0xc810000000000000, 0xc8104c61746e4b45 }, /* saq -> saq-Latn-KE */
+    { 0xc812000000000000, 0xc8124c61746e4944 }, /* sas -> sas-Latn-ID */
+    { 0xc813000000000000, 0xc8134f6c636b494e }, /* sat -> sat-Olck-IN */
+    { 0xc815000000000000, 0xc8154c61746e534e }, /* sav -> sav-Latn-SN */
+    { 0xc819000000000000, 0xc81953617572494e }, /* saz -> saz-Saur-IN */
+    { 0xc820000000000000, 0xc8204c61746e5a5a }, /* sba -> sba-Latn-ZZ */
+    { 0xc824000000000000, 0xc8244c61746e5a5a }, /* sbe -> sbe-Latn-ZZ */
+    { 0xc82f000000000000, 0xc82f4c61746e545a }, /* sbp -> sbp-Latn-TZ */
+    { 0xc84a000000000000, 0xc84a44657661494e }, /* sck -> sck-Deva-IN */
+    { 0xc84b000000000000, 0xc84b417261625a5a }, /* scl -> scl-Arab-ZZ */
+    { 0xc84d000000000000, 0xc84d4c61746e4954 }, /* scn -> scn-Latn-IT */
+    { 0xc84e000000000000, 0xc84e4c61746e4742 }, /* sco -> sco-Latn-GB */
+    { 0xc852000000000000, 0xc8524c61746e4341 }, /* scs -> scs-Latn-CA */
+    { 0xc862000000000000, 0xc8624c61746e4954 }, /* sdc -> sdc-Latn-IT */
+    { 0xc867000000000000, 0xc867417261624952 }, /* sdh -> sdh-Arab-IR */
+    { 0xc885000000000000, 0xc8854c61746e4349 }, /* sef -> sef-Latn-CI */
+    { 0xc887000000000000, 0xc8874c61746e4d5a }, /* seh -> seh-Latn-MZ */
+    { 0xc888000000000000, 0xc8884c61746e4d58 }, /* sei -> sei-Latn-MX */
+    { 0xc892000000000000, 0xc8924c61746e4d4c }, /* ses -> ses-Latn-ML */
+    { 0xc8c0000000000000, 0xc8c04f67616d4945 }, /* sga -> sga-Ogam-IE */
+    { 0xc8d2000000000000, 0xc8d24c61746e4c54 }, /* sgs -> sgs-Latn-LT */
+    { 0xc8d6000000000000, 0xc8d6457468695a5a }, /* sgw -> sgw-Ethi-ZZ */
+    { 0xc8d9000000000000, 0xc8d94c61746e5a5a }, /* sgz -> sgz-Latn-ZZ */
+    { 0xc8e8000000000000, 0xc8e854666e674d41 }, /* shi -> shi-Tfng-MA */
+    { 0xc8ea000000000000, 0xc8ea4c61746e5a5a }, /* shk -> shk-Latn-ZZ */
+    { 0xc8ed000000000000, 0xc8ed4d796d724d4d }, /* shn -> shn-Mymr-MM */
+    { 0xc8f4000000000000, 0xc8f4417261625a5a }, /* shu -> shu-Arab-ZZ */
+    { 0xc903000000000000, 0xc9034c61746e4554 }, /* sid -> sid-Latn-ET */
+    { 0xc906000000000000, 0xc9064c61746e5a5a }, /* sig -> sig-Latn-ZZ */
+    { 0xc90b000000000000, 0xc90b4c61746e5a5a }, /* sil -> sil-Latn-ZZ */
+    { 0xc90c000000000000, 0xc90c4c61746e5a5a }, /* sim -> sim-Latn-ZZ */
+    { 0xc931000000000000, 0xc9314c61746e5a5a }, /* sjr -> sjr-Latn-ZZ */
+    { 0xc942000000000000, 0xc9424c61746e5a5a }, /* skc -> skc-Latn-ZZ */
+    { 0xc951000000000000, 0xc95141726162504b }, /* skr -> skr-Arab-PK */
+    { 0xc952000000000000, 0xc9524c61746e5a5a }, /* sks -> sks-Latn-ZZ */
+    { 0xc963000000000000, 0xc9634c61746e5a5a }, /* sld -> sld-Latn-ZZ */
+    { 0xc968000000000000, 0xc9684c61746e504c }, /* sli -> sli-Latn-PL */
+    { 0xc96b000000000000, 0xc96b4c61746e5a5a }, /* sll -> sll-Latn-ZZ */
+    { 0xc978000000000000, 0xc9784c61746e4944 }, /* sly -> sly-Latn-ID */
+    { 0xc980000000000000, 0xc9804c61746e5345 }, /* sma -> sma-Latn-SE */
+    { 0xc989000000000000, 0xc9894c61746e5345 }, /* smj -> smj-Latn-SE */
+    { 0xc98d000000000000, 0xc98d4c61746e4649 }, /* smn -> smn-Latn-FI */
+    { 0xc98f000000000000, 0xc98f53616d72494c }, /* smp -> smp-Samr-IL */
+    { 0xc990000000000000, 0xc9904c61746e5a5a }, /* smq -> smq-Latn-ZZ */
+    { 0xc992000000000000, 0xc9924c61746e4649 }, /* sms -> sms-Latn-FI */
+    { 0xc9a2000000000000, 0xc9a24c61746e5a5a }, /* snc -> snc-Latn-ZZ */
+    { 0xc9aa000000000000, 0xc9aa4c61746e4d4c }, /* snk -> snk-Latn-ML */
+    { 0xc9af000000000000, 0xc9af4c61746e5a5a }, /* snp -> snp-Latn-ZZ */
+    { 0xc9b7000000000000, 0xc9b74c61746e5a5a }, /* snx -> snx-Latn-ZZ */
+    { 0xc9b8000000000000, 0xc9b84c61746e5a5a }, /* sny -> sny-Latn-ZZ */
+    { 0xc9c6000000000000, 0xc9c6536f6764555a }, /* sog -> sog-Sogd-UZ */
+    { 0xc9ca000000000000, 0xc9ca4c61746e5a5a }, /* sok -> sok-Latn-ZZ */
+    { 0xc9d0000000000000, 0xc9d04c61746e5a5a }, /* soq -> soq-Latn-ZZ */
+    { 0xc9d4000000000000, 0xc9d4546861695448 }, /* sou -> sou-Thai-TH */
+    { 0xc9d8000000000000, 0xc9d84c61746e5a5a }, /* soy -> soy-Latn-ZZ */
+    { 0xc9e3000000000000, 0xc9e34c61746e5a5a }, /* spd -> spd-Latn-ZZ */
+    { 0xc9eb000000000000, 0xc9eb4c61746e5a5a }, /* spl -> spl-Latn-ZZ */
+    { 0xc9f2000000000000, 0xc9f24c61746e5a5a }, /* sps -> sps-Latn-ZZ */
+    { 0xca21000000000000, 0xca21536f7261494e }, /* srb -> srb-Sora-IN */
+    { 0xca2d000000000000, 0xca2d4c61746e5352 }, /* srn -> srn-Latn-SR */
+    { 0xca31000000000000, 0xca314c61746e534e }, /* srr -> srr-Latn-SN */
+    { 0xca37000000000000, 0xca3744657661494e }, /* srx -> srx-Deva-IN */
+    { 0xca43000000000000, 0xca434c61746e5a5a }, /* ssd -> ssd-Latn-ZZ */
+    { 0xca46000000000000, 0xca464c61746e5a5a }, /* ssg -> ssg-Latn-ZZ */
+    { 0xca58000000000000, 0xca584c61746e4552 }, /* ssy -> ssy-Latn-ER */
+    { 0xca6a000000000000, 0xca6a4c61746e5a5a }, /* stk -> stk-Latn-ZZ */
+    { 0xca70000000000000, 0xca704c61746e4445 }, /* stq -> stq-Latn-DE */
+    { 0xca80000000000000, 0xca804c61746e5a5a }, /* sua -> sua-Latn-ZZ */
+    { 0xca84000000000000, 0xca844c61746e5a5a }, /* sue -> sue-Latn-ZZ */
+    { 0xca8a000000000000, 0xca8a4c61746e545a }, /* suk -> suk-Latn-TZ */
+    { 0xca91000000000000, 0xca914c61746e5a5a }, /* sur -> sur-Latn-ZZ */
+    { 0xca92000000000000, 0xca924c61746e474e }, /* sus -> sus-Latn-GN */
+    { 0xcac1000000000000, 0xcac1417261625954 }, /* swb -> swb-Arab-YT */
+    { 0xcac2000000000000, 0xcac24c61746e4344 }, /* swc -> swc-Latn-CD */
+    { 0xcac6000000000000, 0xcac64c61746e4445 }, /* swg -> swg-Latn-DE */
+    { 0xcacf000000000000, 0xcacf4c61746e5a5a }, /* swp -> swp-Latn-ZZ */
+    { 0xcad5000000000000, 0xcad544657661494e }, /* swv -> swv-Deva-IN */
+    { 0xcaed000000000000, 0xcaed4c61746e4944 }, /* sxn -> sxn-Latn-ID */
+    { 0xcaf6000000000000, 0xcaf64c61746e5a5a }, /* sxw -> sxw-Latn-ZZ */
+    { 0xcb0b000000000000, 0xcb0b42656e674244 }, /* syl -> syl-Beng-BD */
+    { 0xcb11000000000000, 0xcb11537972634951 }, /* syr -> syr-Syrc-IQ */
+    { 0xcb2b000000000000, 0xcb2b4c61746e504c }, /* szl -> szl-Latn-PL */
+    { 0xcc09000000000000, 0xcc09446576614e50 }, /* taj -> taj-Deva-NP */
+    { 0xcc0b000000000000, 0xcc0b4c61746e5a5a }, /* tal -> tal-Latn-ZZ */
+    { 0xcc0d000000000000, 0xcc0d4c61746e5a5a }, /* tan -> tan-Latn-ZZ */
+    { 0xcc10000000000000, 0xcc104c61746e5a5a }, /* taq -> taq-Latn-ZZ */
+    { 0xcc22000000000000, 0xcc224c61746e5a5a }, /* tbc -> tbc-Latn-ZZ */
+    { 0xcc23000000000000, 0xcc234c61746e5a5a }, /* tbd -> tbd-Latn-ZZ */
+    { 0xcc25000000000000, 0xcc254c61746e5a5a }, /* tbf -> tbf-Latn-ZZ */
+    { 0xcc26000000000000, 0xcc264c61746e5a5a }, /* tbg -> tbg-Latn-ZZ */
+    { 0xcc2e000000000000, 0xcc2e4c61746e5a5a }, /* tbo -> tbo-Latn-ZZ */
+    { 0xcc36000000000000, 0xcc364c61746e5048 }, /* tbw -> tbw-Latn-PH */
+    { 0xcc39000000000000, 0xcc394c61746e5a5a }, /* tbz -> tbz-Latn-ZZ */
+    { 0xcc48000000000000, 0xcc484c61746e5a5a }, /* tci -> tci-Latn-ZZ */
+    { 0xcc58000000000000, 0xcc584b6e6461494e }, /* tcy -> tcy-Knda-IN */
+    { 0xcc63000000000000, 0xcc6354616c65434e }, /* tdd -> tdd-Tale-CN */
+    { 0xcc66000000000000, 0xcc66446576614e50 }, /* tdg -> tdg-Deva-NP */
+    { 0xcc67000000000000, 0xcc67446576614e50 }, /* tdh -> tdh-Deva-NP */
+    { 0xcc74000000000000, 0xcc744c61746e4d59 }, /* tdu -> tdu-Latn-MY */
+    { 0xcc83000000000000, 0xcc834c61746e5a5a }, /* ted -> ted-Latn-ZZ */
+    { 0xcc8c000000000000, 0xcc8c4c61746e534c }, /* tem -> tem-Latn-SL */
+    { 0xcc8e000000000000, 0xcc8e4c61746e5547 }, /* teo -> teo-Latn-UG */
+    { 0xcc93000000000000, 0xcc934c61746e544c }, /* tet -> tet-Latn-TL */
+    { 0xcca8000000000000, 0xcca84c61746e5a5a }, /* tfi -> tfi-Latn-ZZ */
+    { 0xccc2000000000000, 0xccc24c61746e5a5a }, /* tgc -> tgc-Latn-ZZ */
+    { 0xccce000000000000, 0xccce4c61746e5a5a }, /* tgo -> tgo-Latn-ZZ */
+    { 0xccd4000000000000, 0xccd44c61746e5a5a }, /* tgu -> tgu-Latn-ZZ */
+    { 0xcceb000000000000, 0xcceb446576614e50 }, /* thl -> thl-Deva-NP */
+    { 0xccf0000000000000, 0xccf0446576614e50 }, /* thq -> thq-Deva-NP */
+    { 0xccf1000000000000, 0xccf1446576614e50 }, /* thr -> thr-Deva-NP */
+    { 0xcd05000000000000, 0xcd054c61746e5a5a }, /* tif -> tif-Latn-ZZ */
+    { 0xcd06000000000000, 0xcd06457468694552 }, /* tig -> tig-Ethi-ER */
+    { 0xcd0a000000000000, 0xcd0a4c61746e5a5a }, /* tik -> tik-Latn-ZZ */
+    { 0xcd0c000000000000, 0xcd0c4c61746e5a5a }, /* tim -> tim-Latn-ZZ */
+    { 0xcd0e000000000000, 0xcd0e4c61746e5a5a }, /* tio -> tio-Latn-ZZ */
+    { 0xcd15000000000000, 0xcd154c61746e4e47 }, /* tiv -> tiv-Latn-NG */
+    { 0xcd4b000000000000, 0xcd4b4c61746e544b }, /* tkl -> tkl-Latn-TK */
+    { 0xcd51000000000000, 0xcd514c61746e415a }, /* tkr -> tkr-Latn-AZ */
+    { 0xcd53000000000000, 0xcd53446576614e50 }, /* tkt -> tkt-Deva-NP */
+    { 0xcd65000000000000, 0xcd654c61746e5a5a }, /* tlf -> tlf-Latn-ZZ */
+    { 0xcd77000000000000, 0xcd774c61746e5a5a }, /* tlx -> tlx-Latn-ZZ */
+    { 0xcd78000000000000, 0xcd784c61746e415a }, /* tly -> tly-Latn-AZ */
+    { 0xcd87000000000000, 0xcd874c61746e4e45 }, /* tmh -> tmh-Latn-NE */
+    { 0xcd98000000000000, 0xcd984c61746e5a5a }, /* tmy -> tmy-Latn-ZZ */
+    { 0xcda7000000000000, 0xcda74c61746e5a5a }, /* tnh -> tnh-Latn-ZZ */
+    { 0xcdc5000000000000, 0xcdc54c61746e5a5a }, /* tof -> tof-Latn-ZZ */
+    { 0xcdc6000000000000, 0xcdc64c61746e4d57 }, /* tog -> tog-Latn-MW */
+    { 0xcdd0000000000000, 0xcdd04c61746e5a5a }, /* toq -> toq-Latn-ZZ */
+    { 0xcde8000000000000, 0xcde84c61746e5047 }, /* tpi -> tpi-Latn-PG */
+    { 0xcdec000000000000, 0xcdec4c61746e5a5a }, /* tpm -> tpm-Latn-ZZ */
+    { 0xcdf9000000000000, 0xcdf94c61746e5a5a }, /* tpz -> tpz-Latn-ZZ */
+    { 0xce0e000000000000, 0xce0e4c61746e5a5a }, /* tqo -> tqo-Latn-ZZ */
+    { 0xce34000000000000, 0xce344c61746e5452 }, /* tru -> tru-Latn-TR */
+    { 0xce35000000000000, 0xce354c61746e5457 }, /* trv -> trv-Latn-TW */
+    { 0xce36000000000000, 0xce3641726162504b }, /* trw -> trw-Arab-PK */
+    { 0xce43000000000000, 0xce434772656b4752 }, /* tsd -> tsd-Grek-GR */
+    { 0xce45000000000000, 0xce45446576614e50 }, /* tsf -> tsf-Deva-NP */
+    { 0xce46000000000000, 0xce464c61746e5048 }, /* tsg -> tsg-Latn-PH */
+    { 0xce49000000000000, 0xce49546962744254 }, /* tsj -> tsj-Tibt-BT */
+    { 0xce56000000000000, 0xce564c61746e5a5a }, /* tsw -> tsw-Latn-ZZ */
+    { 0xce63000000000000, 0xce634c61746e5a5a }, /* ttd -> ttd-Latn-ZZ */
+    { 0xce64000000000000, 0xce644c61746e5a5a }, /* tte -> tte-Latn-ZZ */
+    { 0xce69000000000000, 0xce694c61746e5547 }, /* ttj -> ttj-Latn-UG */
+    { 0xce71000000000000, 0xce714c61746e5a5a }, /* ttr -> ttr-Latn-ZZ */
+    { 0xce72000000000000, 0xce72546861695448 }, /* tts -> tts-Thai-TH */
+    { 0xce73000000000000, 0xce734c61746e415a }, /* ttt -> ttt-Latn-AZ */
+    { 0xce87000000000000, 0xce874c61746e5a5a }, /* tuh -> tuh-Latn-ZZ */
+    { 0xce8b000000000000, 0xce8b4c61746e5a5a }, /* tul -> tul-Latn-ZZ */
+    { 0xce8c000000000000, 0xce8c4c61746e4d57 }, /* tum -> tum-Latn-MW */
+    { 0xce90000000000000, 0xce904c61746e5a5a }, /* tuq -> tuq-Latn-ZZ */
+    { 0xcea3000000000000, 0xcea34c61746e5a5a }, /* tvd -> tvd-Latn-ZZ */
+    { 0xceab000000000000, 0xceab4c61746e5456 }, /* tvl -> tvl-Latn-TV */
+    { 0xceb4000000000000, 0xceb44c61746e5a5a }, /* tvu -> tvu-Latn-ZZ */
+    { 0xcec7000000000000, 0xcec74c61746e5a5a }, /* twh -> twh-Latn-ZZ */
+    { 0xced0000000000000, 0xced04c61746e4e45 }, /* twq -> twq-Latn-NE */
+    { 0xcee6000000000000, 0xcee654616e67434e }, /* txg -> txg-Tang-CN */
+    { 0xcf00000000000000, 0xcf004c61746e5a5a }, /* tya -> tya-Latn-ZZ */
+    { 0xcf15000000000000, 0xcf154379726c5255 }, /* tyv -> tyv-Cyrl-RU */
+    { 0xcf2c000000000000, 0xcf2c4c61746e4d41 }, /* tzm -> tzm-Latn-MA */
+    { 0xd034000000000000, 0xd0344c61746e5a5a }, /* ubu -> ubu-Latn-ZZ */
+    { 0xd06c000000000000, 0xd06c4379726c5255 }, /* udm -> udm-Cyrl-RU */
+    { 0xd0c0000000000000, 0xd0c0556761725359 }, /* uga -> uga-Ugar-SY */
+    { 0xd168000000000000, 0xd1684c61746e464d }, /* uli -> uli-Latn-FM */
+    { 0xd181000000000000, 0xd1814c61746e414f }, /* umb -> umb-Latn-AO */
+    { 0xd1b1000000000000, 0xd1b142656e67494e }, /* unr -> unr-Beng-IN */
+    { 0xd1b1000000004e50, 0xd1b1446576614e50 }, /* unr-NP -> unr-Deva-NP */
+    { 0xd1b1446576610000, 0xd1b1446576614e50 }, /* unr-Deva -> unr-Deva-NP */
+    { 0xd1b7000000000000, 0xd1b742656e67494e }, /* unx -> unx-Beng-IN */
+    { 0xd1ca000000000000, 0xd1ca4c61746e5a5a }, /* uok -> uok-Latn-ZZ */
+    { 0xd228000000000000, 0xd2284c61746e5a5a }, /* uri -> uri-Latn-ZZ */
+    { 0xd233000000000000, 0xd2334c61746e5a5a }, /* urt -> urt-Latn-ZZ */
+    { 0xd236000000000000, 0xd2364c61746e5a5a }, /* urw -> urw-Latn-ZZ */
+    { 0xd240000000000000, 0xd2404c61746e5a5a }, /* usa -> usa-Latn-ZZ */
+    { 0xd267000000000000, 0xd2674c61746e5a5a }, /* uth -> uth-Latn-ZZ */
+    { 0xd271000000000000, 0xd2714c61746e5a5a }, /* utr -> utr-Latn-ZZ */
+    { 0xd2a7000000000000, 0xd2a74c61746e5a5a }, /* uvh -> uvh-Latn-ZZ */
+    { 0xd2ab000000000000, 0xd2ab4c61746e5a5a }, /* uvl -> uvl-Latn-ZZ */
+    { 0xd406000000000000, 0xd4064c61746e5a5a }, /* vag -> vag-Latn-ZZ */
+    { 0xd408000000000000, 0xd408566169694c52 }, /* vai -> vai-Vaii-LR */
+    { 0xd40d000000000000, 0xd40d4c61746e5a5a }, /* van -> van-Latn-ZZ */
+    { 0xd482000000000000, 0xd4824c61746e4954 }, /* vec -> vec-Latn-IT */
+    { 0xd48f000000000000, 0xd48f4c61746e5255 }, /* vep -> vep-Latn-RU */
+    { 0xd502000000000000, 0xd5024c61746e5358 }, /* vic -> vic-Latn-SX */
+    { 0xd515000000000000, 0xd5154c61746e5a5a }, /* viv -> viv-Latn-ZZ */
+    { 0xd572000000000000, 0xd5724c61746e4245 }, /* vls -> vls-Latn-BE */
+    { 0xd585000000000000, 0xd5854c61746e4445 }, /* vmf -> vmf-Latn-DE */
+    { 0xd596000000000000, 0xd5964c61746e4d5a }, /* vmw -> vmw-Latn-MZ */
+    { 0xd5d3000000000000, 0xd5d34c61746e5255 }, /* vot -> vot-Latn-RU */
+    { 0xd62e000000000000, 0xd62e4c61746e4545 }, /* vro -> vro-Latn-EE */
+    { 0xd68d000000000000, 0xd68d4c61746e545a }, /* vun -> vun-Latn-TZ */
+    { 0xd693000000000000, 0xd6934c61746e5a5a }, /* vut -> vut-Latn-ZZ */
+    { 0xd804000000000000, 0xd8044c61746e4348 }, /* wae -> wae-Latn-CH */
+    { 0xd809000000000000, 0xd8094c61746e5a5a }, /* waj -> waj-Latn-ZZ */
+    { 0xd80b000000000000, 0xd80b457468694554 }, /* wal -> wal-Ethi-ET */
+    { 0xd80d000000000000, 0xd80d4c61746e5a5a }, /* wan -> wan-Latn-ZZ */
+    { 0xd811000000000000, 0xd8114c61746e5048 }, /* war -> war-Latn-PH */
+    { 0xd82f000000000000, 0xd82f4c61746e4155 }, /* wbp -> wbp-Latn-AU */
+    { 0xd830000000000000, 0xd83054656c75494e }, /* wbq -> wbq-Telu-IN */
+    { 0xd831000000000000, 0xd83144657661494e }, /* wbr -> wbr-Deva-IN */
+    { 0xd848000000000000, 0xd8484c61746e5a5a }, /* wci -> wci-Latn-ZZ */
+    { 0xd891000000000000, 0xd8914c61746e5a5a }, /* wer -> wer-Latn-ZZ */
+    { 0xd8c8000000000000, 0xd8c84c61746e5a5a }, /* wgi -> wgi-Latn-ZZ */
+    { 0xd8e6000000000000, 0xd8e64c61746e5a5a }, /* whg -> whg-Latn-ZZ */
+    { 0xd901000000000000, 0xd9014c61746e5a5a }, /* wib -> wib-Latn-ZZ */
+    { 0xd914000000000000, 0xd9144c61746e5a5a }, /* wiu -> wiu-Latn-ZZ */
+    { 0xd915000000000000, 0xd9154c61746e5a5a }, /* wiv -> wiv-Latn-ZZ */
+    { 0xd920000000000000, 0xd9204c61746e5a5a }, /* wja -> wja-Latn-ZZ */
+    { 0xd928000000000000, 0xd9284c61746e5a5a }, /* wji -> wji-Latn-ZZ */
+    { 0xd972000000000000, 0xd9724c61746e5746 }, /* wls -> wls-Latn-WF */
+    { 0xd98e000000000000, 0xd98e4c61746e5a5a }, /* wmo -> wmo-Latn-ZZ */
+    { 0xd9a2000000000000, 0xd9a24c61746e5a5a }, /* wnc -> wnc-Latn-ZZ */
+    { 0xd9a8000000000000, 0xd9a8417261624b4d }, /* wni -> wni-Arab-KM */
+    { 0xd9b4000000000000, 0xd9b44c61746e5a5a }, /* wnu -> wnu-Latn-ZZ */
+    { 0xd9c1000000000000, 0xd9c14c61746e5a5a }, /* wob -> wob-Latn-ZZ */
+    { 0xd9d2000000000000, 0xd9d24c61746e5a5a }, /* wos -> wos-Latn-ZZ */
+    { 0xda32000000000000, 0xda324c61746e5a5a }, /* wrs -> wrs-Latn-ZZ */
+    { 0xda46000000000000, 0xda46476f6e67494e }, /* wsg -> wsg-Gong-IN */
+    { 0xda4a000000000000, 0xda4a4c61746e5a5a }, /* wsk -> wsk-Latn-ZZ */
+    { 0xda6c000000000000, 0xda6c44657661494e }, /* wtm -> wtm-Deva-IN */
+    { 0xda94000000000000, 0xda9448616e73434e }, /* wuu -> wuu-Hans-CN */
+    { 0xda95000000000000, 0xda954c61746e5a5a }, /* wuv -> wuv-Latn-ZZ */
+    { 0xdac0000000000000, 0xdac04c61746e5a5a }, /* wwa -> wwa-Latn-ZZ */
+    { 0xdc15000000000000, 0xdc154c61746e4252 }, /* xav -> xav-Latn-BR */
+    { 0xdc28000000000000, 0xdc284c61746e5a5a }, /* xbi -> xbi-Latn-ZZ */
+    { 0xdc4e000000000000, 0xdc4e43687273555a }, /* xco -> xco-Chrs-UZ */
+    { 0xdc51000000000000, 0xdc51436172695452 }, /* xcr -> xcr-Cari-TR */
+    { 0xdc92000000000000, 0xdc924c61746e5a5a }, /* xes -> xes-Latn-ZZ */
+    { 0xdd60000000000000, 0xdd604c61746e5a5a }, /* xla -> xla-Latn-ZZ */
+    { 0xdd62000000000000, 0xdd624c7963695452 }, /* xlc -> xlc-Lyci-TR */
+    { 0xdd63000000000000, 0xdd634c7964695452 }, /* xld -> xld-Lydi-TR */
+    { 0xdd85000000000000, 0xdd8547656f724745 }, /* xmf -> xmf-Geor-GE */
+    { 0xdd8d000000000000, 0xdd8d4d616e69434e }, /* xmn -> xmn-Mani-CN */
+    { 0xdd91000000000000, 0xdd914d6572635344 }, /* xmr -> xmr-Merc-SD */
+    { 0xdda0000000000000, 0xdda04e6172625341 }, /* xna -> xna-Narb-SA */
+    { 0xddb1000000000000, 0xddb144657661494e }, /* xnr -> xnr-Deva-IN */
+    { 0xddc6000000000000, 0xddc64c61746e5547 }, /* xog -> xog-Latn-UG */
+    { 0xddcd000000000000, 0xddcd4c61746e5a5a }, /* xon -> xon-Latn-ZZ */
+    { 0xddf1000000000000, 0xddf1507274694952 }, /* xpr -> xpr-Prti-IR */
+    { 0xde21000000000000, 0xde214c61746e5a5a }, /* xrb -> xrb-Latn-ZZ */
+    { 0xde40000000000000, 0xde40536172625945 }, /* xsa -> xsa-Sarb-YE */
+    { 0xde48000000000000, 0xde484c61746e5a5a }, /* xsi -> xsi-Latn-ZZ */
+    { 0xde4c000000000000, 0xde4c4c61746e5a5a }, /* xsm -> xsm-Latn-ZZ */
+    { 0xde51000000000000, 0xde51446576614e50 }, /* xsr -> xsr-Deva-NP */
+    { 0xdec4000000000000, 0xdec44c61746e5a5a }, /* xwe -> xwe-Latn-ZZ */
+    { 0xe00c000000000000, 0xe00c4c61746e5a5a }, /* yam -> yam-Latn-ZZ */
+    { 0xe00e000000000000, 0xe00e4c61746e4d5a }, /* yao -> yao-Latn-MZ */
+    { 0xe00f000000000000, 0xe00f4c61746e464d }, /* yap -> yap-Latn-FM */
+    { 0xe012000000000000, 0xe0124c61746e5a5a }, /* yas -> yas-Latn-ZZ */
+    { 0xe013000000000000, 0xe0134c61746e5a5a }, /* yat -> yat-Latn-ZZ */
+    { 0xe015000000000000, 0xe0154c61746e434d }, /* yav -> yav-Latn-CM */
+    { 0xe018000000000000, 0xe0184c61746e5a5a }, /* yay -> yay-Latn-ZZ */
+    { 0xe019000000000000, 0xe0194c61746e5a5a }, /* yaz -> yaz-Latn-ZZ */
+    { 0xe020000000000000, 0xe0204c61746e5a5a }, /* yba -> yba-Latn-ZZ */
+    { 0xe021000000000000, 0xe0214c61746e434d }, /* ybb -> ybb-Latn-CM */
+    { 0xe038000000000000, 0xe0384c61746e5a5a }, /* yby -> yby-Latn-ZZ */
+    { 0xe091000000000000, 0xe0914c61746e5a5a }, /* yer -> yer-Latn-ZZ */
+    { 0xe0d1000000000000, 0xe0d14c61746e5a5a }, /* ygr -> ygr-Latn-ZZ */
+    { 0xe0d6000000000000, 0xe0d64c61746e5a5a }, /* ygw -> ygw-Latn-ZZ */
+    { 0xe14e000000000000, 0xe14e4c61746e5a5a }, /* yko -> yko-Latn-ZZ */
+    { 0xe164000000000000, 0xe1644c61746e5a5a }, /* yle -> yle-Latn-ZZ */
+    { 0xe166000000000000, 0xe1664c61746e5a5a }, /* ylg -> ylg-Latn-ZZ */
+    { 0xe16b000000000000, 0xe16b4c61746e5a5a }, /* yll -> yll-Latn-ZZ */
+    { 0xe18b000000000000, 0xe18b4c61746e5a5a }, /* yml -> yml-Latn-ZZ */
+    { 0xe1cd000000000000, 0xe1cd4c61746e5a5a }, /* yon -> yon-Latn-ZZ */
+    { 0xe221000000000000, 0xe2214c61746e5a5a }, /* yrb -> yrb-Latn-ZZ */
+    { 0xe224000000000000, 0xe2244c61746e5a5a }, /* yre -> yre-Latn-ZZ */
+    { 0xe22b000000000000, 0xe22b4c61746e4252 }, /* yrl -> yrl-Latn-BR */
+    { 0xe252000000000000, 0xe2524c61746e5a5a }, /* yss -> yss-Latn-ZZ */
+    { 0xe280000000000000, 0xe2804c61746e4d58 }, /* yua -> yua-Latn-MX */
+    { 0xe284000000000000, 0xe28448616e74484b }, /* yue -> yue-Hant-HK */
+    { 0xe28400000000434e, 0xe28448616e73434e }, /* yue-CN -> yue-Hans-CN */
+    { 0xe28448616e730000, 0xe28448616e73434e }, /* yue-Hans -> yue-Hans-CN */
+    { 0xe289000000000000, 0xe2894c61746e5a5a }, /* yuj -> yuj-Latn-ZZ */
+    { 0xe293000000000000, 0xe2934c61746e5a5a }, /* yut -> yut-Latn-ZZ */
+    { 0xe296000000000000, 0xe2964c61746e5a5a }, /* yuw -> yuw-Latn-ZZ */
+    { 0xe406000000000000, 0xe4064c61746e5344 }, /* zag -> zag-Latn-SD */
+    { 0xe469000000000000, 0xe469417261624b4d }, /* zdj -> zdj-Arab-KM */
+    { 0xe480000000000000, 0xe4804c61746e4e4c }, /* zea -> zea-Latn-NL */
+    { 0xe4c7000000000000, 0xe4c754666e674d41 }, /* zgh -> zgh-Tfng-MA */
+    { 0xe4f7000000000000, 0xe4f74e736875434e }, /* zhx -> zhx-Nshu-CN */
+    { 0xe500000000000000, 0xe5004c61746e5a5a }, /* zia -> zia-Latn-ZZ */
+    { 0xe553000000000000, 0xe5534b697473434e }, /* zkt -> zkt-Kits-CN */
+    { 0xe56c000000000000, 0xe56c4c61746e5447 }, /* zlm -> zlm-Latn-TG */
+    { 0xe588000000000000, 0xe5884c61746e4d59 }, /* zmi -> zmi-Latn-MY */
+    { 0xe5a4000000000000, 0xe5a44c61746e5a5a }, /* zne -> zne-Latn-ZZ */
+    { 0xe720000000000000, 0xe7204c61746e5452 }, /* zza -> zza-Latn-TR */
+}};
 
-const std::vector<uint64_t> LocaleData::LIKELY_TAGS_CODES_VALUE = {
-    static_cast<uint64_t>(0x61614c61746e4554), /* aa-Latn-ET */
-    static_cast<uint64_t>(0x80084c61746e5a5a), /* aai-Latn-ZZ */
-    static_cast<uint64_t>(0x800a4c61746e5a5a), /* aak-Latn-ZZ */
-    static_cast<uint64_t>(0x80144c61746e5a5a), /* aau-Latn-ZZ */
-    static_cast<uint64_t>(0x61624379726c4745), /* ab-Cyrl-GE */
-    static_cast<uint64_t>(0x80284c61746e5a5a), /* abi-Latn-ZZ */
-    static_cast<uint64_t>(0x80304379726c5a5a), /* abq-Cyrl-ZZ */
-    static_cast<uint64_t>(0x80314c61746e4748), /* abr-Latn-GH */
-    static_cast<uint64_t>(0x80334c61746e5a5a), /* abt-Latn-ZZ */
-    static_cast<uint64_t>(0x80384c61746e5a5a), /* aby-Latn-ZZ */
-    static_cast<uint64_t>(0x80434c61746e5a5a), /* acd-Latn-ZZ */
-    static_cast<uint64_t>(0x80444c61746e4944), /* ace-Latn-ID */
-    static_cast<uint64_t>(0x80474c61746e5547), /* ach-Latn-UG */
-    static_cast<uint64_t>(0x80604c61746e4748), /* ada-Latn-GH */
-    static_cast<uint64_t>(0x80644c61746e5a5a), /* ade-Latn-ZZ */
-    static_cast<uint64_t>(0x80694c61746e5a5a), /* adj-Latn-ZZ */
-    static_cast<uint64_t>(0x806f546962744254), /* adp-Tibt-BT */
-    static_cast<uint64_t>(0x80784379726c5255), /* ady-Cyrl-RU */
-    static_cast<uint64_t>(0x80794c61746e5a5a), /* adz-Latn-ZZ */
-    static_cast<uint64_t>(0x6165417673744952), /* ae-Avst-IR */
-    static_cast<uint64_t>(0x808141726162544e), /* aeb-Arab-TN */
-    static_cast<uint64_t>(0x80984c61746e5a5a), /* aey-Latn-ZZ */
-    static_cast<uint64_t>(0x61664c61746e5a41), /* af-Latn-ZA */
-    static_cast<uint64_t>(0x80c24c61746e5a5a), /* agc-Latn-ZZ */
-    static_cast<uint64_t>(0x80c34c61746e5a5a), /* agd-Latn-ZZ */
-    static_cast<uint64_t>(0x80c64c61746e5a5a), /* agg-Latn-ZZ */
-    static_cast<uint64_t>(0x80cc4c61746e5a5a), /* agm-Latn-ZZ */
-    static_cast<uint64_t>(0x80ce4c61746e5a5a), /* ago-Latn-ZZ */
-    static_cast<uint64_t>(0x80d04c61746e434d), /* agq-Latn-CM */
-    static_cast<uint64_t>(0x80e04c61746e5a5a), /* aha-Latn-ZZ */
-    static_cast<uint64_t>(0x80eb4c61746e5a5a), /* ahl-Latn-ZZ */
-    static_cast<uint64_t>(0x80ee41686f6d494e), /* aho-Ahom-IN */
-    static_cast<uint64_t>(0x81264c61746e5a5a), /* ajg-Latn-ZZ */
-    static_cast<uint64_t>(0x616b4c61746e4748), /* ak-Latn-GH */
-    static_cast<uint64_t>(0x814a587375784951), /* akk-Xsux-IQ */
-    static_cast<uint64_t>(0x81604c61746e5a5a), /* ala-Latn-ZZ */
-    static_cast<uint64_t>(0x81684c61746e5a5a), /* ali-Latn-ZZ */
-    static_cast<uint64_t>(0x816d4c61746e584b), /* aln-Latn-XK */
-    static_cast<uint64_t>(0x81734379726c5255), /* alt-Cyrl-RU */
-    static_cast<uint64_t>(0x616d457468694554), /* am-Ethi-ET */
-    static_cast<uint64_t>(0x818c4c61746e5a5a), /* amm-Latn-ZZ */
-    static_cast<uint64_t>(0x818d4c61746e5a5a), /* amn-Latn-ZZ */
-    static_cast<uint64_t>(0x818e4c61746e4e47), /* amo-Latn-NG */
-    static_cast<uint64_t>(0x818f4c61746e5a5a), /* amp-Latn-ZZ */
-    static_cast<uint64_t>(0x616e4c61746e4553), /* an-Latn-ES */
-    static_cast<uint64_t>(0x81a24c61746e5a5a), /* anc-Latn-ZZ */
-    static_cast<uint64_t>(0x81aa4c61746e5a5a), /* ank-Latn-ZZ */
-    static_cast<uint64_t>(0x81ad4c61746e5a5a), /* ann-Latn-ZZ */
-    static_cast<uint64_t>(0x81b84c61746e5a5a), /* any-Latn-ZZ */
-    static_cast<uint64_t>(0x81c94c61746e5a5a), /* aoj-Latn-ZZ */
-    static_cast<uint64_t>(0x81cc4c61746e5a5a), /* aom-Latn-ZZ */
-    static_cast<uint64_t>(0x81d94c61746e4944), /* aoz-Latn-ID */
-    static_cast<uint64_t>(0x81e2417261625a5a), /* apc-Arab-ZZ */
-    static_cast<uint64_t>(0x81e3417261625447), /* apd-Arab-TG */
-    static_cast<uint64_t>(0x81e44c61746e5a5a), /* ape-Latn-ZZ */
-    static_cast<uint64_t>(0x81f14c61746e5a5a), /* apr-Latn-ZZ */
-    static_cast<uint64_t>(0x81f24c61746e5a5a), /* aps-Latn-ZZ */
-    static_cast<uint64_t>(0x81f94c61746e5a5a), /* apz-Latn-ZZ */
-    static_cast<uint64_t>(0x6172417261624547), /* ar-Arab-EG */
-    static_cast<uint64_t>(0x822241726d694952), /* arc-Armi-IR */
-    static_cast<uint64_t>(0x82224e6261744a4f), /* arc-Nbat-JO */
-    static_cast<uint64_t>(0x822250616c6d5359), /* arc-Palm-SY */
-    static_cast<uint64_t>(0x82274c61746e5a5a), /* arh-Latn-ZZ */
-    static_cast<uint64_t>(0x822d4c61746e434c), /* arn-Latn-CL */
-    static_cast<uint64_t>(0x822e4c61746e424f), /* aro-Latn-BO */
-    static_cast<uint64_t>(0x823041726162445a), /* arq-Arab-DZ */
-    static_cast<uint64_t>(0x8232417261625341), /* ars-Arab-SA */
-    static_cast<uint64_t>(0x8238417261624d41), /* ary-Arab-MA */
-    static_cast<uint64_t>(0x8239417261624547), /* arz-Arab-EG */
-    static_cast<uint64_t>(0x617342656e67494e), /* as-Beng-IN */
-    static_cast<uint64_t>(0x82404c61746e545a), /* asa-Latn-TZ */
-    static_cast<uint64_t>(0x824453676e775553), /* ase-Sgnw-US */
-    static_cast<uint64_t>(0x82464c61746e5a5a), /* asg-Latn-ZZ */
-    static_cast<uint64_t>(0x824e4c61746e5a5a), /* aso-Latn-ZZ */
-    static_cast<uint64_t>(0x82534c61746e4553), /* ast-Latn-ES */
-    static_cast<uint64_t>(0x82604c61746e5a5a), /* ata-Latn-ZZ */
-    static_cast<uint64_t>(0x82664c61746e5a5a), /* atg-Latn-ZZ */
-    static_cast<uint64_t>(0x82694c61746e4341), /* atj-Latn-CA */
-    static_cast<uint64_t>(0x82984c61746e5a5a), /* auy-Latn-ZZ */
-    static_cast<uint64_t>(0x61764379726c5255), /* av-Cyrl-RU */
-    static_cast<uint64_t>(0x82ab417261625a5a), /* avl-Arab-ZZ */
-    static_cast<uint64_t>(0x82ad4c61746e5a5a), /* avn-Latn-ZZ */
-    static_cast<uint64_t>(0x82b34c61746e5a5a), /* avt-Latn-ZZ */
-    static_cast<uint64_t>(0x82b44c61746e5a5a), /* avu-Latn-ZZ */
-    static_cast<uint64_t>(0x82c044657661494e), /* awa-Deva-IN */
-    static_cast<uint64_t>(0x82c14c61746e5a5a), /* awb-Latn-ZZ */
-    static_cast<uint64_t>(0x82ce4c61746e5a5a), /* awo-Latn-ZZ */
-    static_cast<uint64_t>(0x82d74c61746e5a5a), /* awx-Latn-ZZ */
-    static_cast<uint64_t>(0x61794c61746e424f), /* ay-Latn-BO */
-    static_cast<uint64_t>(0x83014c61746e5a5a), /* ayb-Latn-ZZ */
-    static_cast<uint64_t>(0x617a4c61746e415a), /* az-Latn-AZ */
-    static_cast<uint64_t>(0x617a417261624952), /* az-Arab-IR */
-    static_cast<uint64_t>(0x617a417261624951), /* az-Arab-IQ */
-    static_cast<uint64_t>(0x617a417261624952), /* az-Arab-IR */
-    static_cast<uint64_t>(0x617a4379726c5255), /* az-Cyrl-RU */
-    static_cast<uint64_t>(0x62614379726c5255), /* ba-Cyrl-RU */
-    static_cast<uint64_t>(0x840b41726162504b), /* bal-Arab-PK */
-    static_cast<uint64_t>(0x840d4c61746e4944), /* ban-Latn-ID */
-    static_cast<uint64_t>(0x840f446576614e50), /* bap-Deva-NP */
-    static_cast<uint64_t>(0x84114c61746e4154), /* bar-Latn-AT */
-    static_cast<uint64_t>(0x84124c61746e434d), /* bas-Latn-CM */
-    static_cast<uint64_t>(0x84154c61746e5a5a), /* bav-Latn-ZZ */
-    static_cast<uint64_t>(0x841742616d75434d), /* bax-Bamu-CM */
-    static_cast<uint64_t>(0x84204c61746e5a5a), /* bba-Latn-ZZ */
-    static_cast<uint64_t>(0x84214c61746e5a5a), /* bbb-Latn-ZZ */
-    static_cast<uint64_t>(0x84224c61746e4944), /* bbc-Latn-ID */
-    static_cast<uint64_t>(0x84234c61746e5a5a), /* bbd-Latn-ZZ */
-    static_cast<uint64_t>(0x84294c61746e434d), /* bbj-Latn-CM */
-    static_cast<uint64_t>(0x842f4c61746e5a5a), /* bbp-Latn-ZZ */
-    static_cast<uint64_t>(0x84314c61746e5a5a), /* bbr-Latn-ZZ */
-    static_cast<uint64_t>(0x84454c61746e5a5a), /* bcf-Latn-ZZ */
-    static_cast<uint64_t>(0x84474c61746e5a5a), /* bch-Latn-ZZ */
-    static_cast<uint64_t>(0x84484c61746e4349), /* bci-Latn-CI */
-    static_cast<uint64_t>(0x844c4c61746e5a5a), /* bcm-Latn-ZZ */
-    static_cast<uint64_t>(0x844d4c61746e5a5a), /* bcn-Latn-ZZ */
-    static_cast<uint64_t>(0x844e4c61746e5a5a), /* bco-Latn-ZZ */
-    static_cast<uint64_t>(0x8450457468695a5a), /* bcq-Ethi-ZZ */
-    static_cast<uint64_t>(0x84544c61746e5a5a), /* bcu-Latn-ZZ */
-    static_cast<uint64_t>(0x84634c61746e5a5a), /* bdd-Latn-ZZ */
-    static_cast<uint64_t>(0x62654379726c4259), /* be-Cyrl-BY */
-    static_cast<uint64_t>(0x84854c61746e5a5a), /* bef-Latn-ZZ */
-    static_cast<uint64_t>(0x84874c61746e5a5a), /* beh-Latn-ZZ */
-    static_cast<uint64_t>(0x8489417261625344), /* bej-Arab-SD */
-    static_cast<uint64_t>(0x848c4c61746e5a4d), /* bem-Latn-ZM */
-    static_cast<uint64_t>(0x84934c61746e5a5a), /* bet-Latn-ZZ */
-    static_cast<uint64_t>(0x84964c61746e4944), /* bew-Latn-ID */
-    static_cast<uint64_t>(0x84974c61746e5a5a), /* bex-Latn-ZZ */
-    static_cast<uint64_t>(0x84994c61746e545a), /* bez-Latn-TZ */
-    static_cast<uint64_t>(0x84a34c61746e434d), /* bfd-Latn-CM */
-    static_cast<uint64_t>(0x84b054616d6c494e), /* bfq-Taml-IN */
-    static_cast<uint64_t>(0x84b341726162504b), /* bft-Arab-PK */
-    static_cast<uint64_t>(0x84b844657661494e), /* bfy-Deva-IN */
-    static_cast<uint64_t>(0x62674379726c4247), /* bg-Cyrl-BG */
-    static_cast<uint64_t>(0x84c244657661494e), /* bgc-Deva-IN */
-    static_cast<uint64_t>(0x84cd41726162504b), /* bgn-Arab-PK */
-    static_cast<uint64_t>(0x84d74772656b5452), /* bgx-Grek-TR */
-    static_cast<uint64_t>(0x84e144657661494e), /* bhb-Deva-IN */
-    static_cast<uint64_t>(0x84e64c61746e5a5a), /* bhg-Latn-ZZ */
-    static_cast<uint64_t>(0x84e844657661494e), /* bhi-Deva-IN */
-    static_cast<uint64_t>(0x84eb4c61746e5a5a), /* bhl-Latn-ZZ */
-    static_cast<uint64_t>(0x84ee44657661494e), /* bho-Deva-IN */
-    static_cast<uint64_t>(0x84f84c61746e5a5a), /* bhy-Latn-ZZ */
-    static_cast<uint64_t>(0x62694c61746e5655), /* bi-Latn-VU */
-    static_cast<uint64_t>(0x85014c61746e5a5a), /* bib-Latn-ZZ */
-    static_cast<uint64_t>(0x85064c61746e5a5a), /* big-Latn-ZZ */
-    static_cast<uint64_t>(0x850a4c61746e5048), /* bik-Latn-PH */
-    static_cast<uint64_t>(0x850c4c61746e5a5a), /* bim-Latn-ZZ */
-    static_cast<uint64_t>(0x850d4c61746e4e47), /* bin-Latn-NG */
-    static_cast<uint64_t>(0x850e4c61746e5a5a), /* bio-Latn-ZZ */
-    static_cast<uint64_t>(0x85104c61746e5a5a), /* biq-Latn-ZZ */
-    static_cast<uint64_t>(0x85274c61746e5a5a), /* bjh-Latn-ZZ */
-    static_cast<uint64_t>(0x8528457468695a5a), /* bji-Ethi-ZZ */
-    static_cast<uint64_t>(0x852944657661494e), /* bjj-Deva-IN */
-    static_cast<uint64_t>(0x852d4c61746e4944), /* bjn-Latn-ID */
-    static_cast<uint64_t>(0x852e4c61746e5a5a), /* bjo-Latn-ZZ */
-    static_cast<uint64_t>(0x85314c61746e5a5a), /* bjr-Latn-ZZ */
-    static_cast<uint64_t>(0x85334c61746e534e), /* bjt-Latn-SN */
-    static_cast<uint64_t>(0x85394c61746e5a5a), /* bjz-Latn-ZZ */
-    static_cast<uint64_t>(0x85424c61746e5a5a), /* bkc-Latn-ZZ */
-    static_cast<uint64_t>(0x854c4c61746e434d), /* bkm-Latn-CM */
-    static_cast<uint64_t>(0x85504c61746e5a5a), /* bkq-Latn-ZZ */
-    static_cast<uint64_t>(0x85544c61746e5048), /* bku-Latn-PH */
-    static_cast<uint64_t>(0x85554c61746e5a5a), /* bkv-Latn-ZZ */
-    static_cast<uint64_t>(0x857354617674564e), /* blt-Tavt-VN */
-    static_cast<uint64_t>(0x626d4c61746e4d4c), /* bm-Latn-ML */
-    static_cast<uint64_t>(0x85874c61746e5a5a), /* bmh-Latn-ZZ */
-    static_cast<uint64_t>(0x858a4c61746e5a5a), /* bmk-Latn-ZZ */
-    static_cast<uint64_t>(0x85904c61746e4d4c), /* bmq-Latn-ML */
-    static_cast<uint64_t>(0x85944c61746e5a5a), /* bmu-Latn-ZZ */
-    static_cast<uint64_t>(0x626e42656e674244), /* bn-Beng-BD */
-    static_cast<uint64_t>(0x85a64c61746e5a5a), /* bng-Latn-ZZ */
-    static_cast<uint64_t>(0x85ac4c61746e5a5a), /* bnm-Latn-ZZ */
-    static_cast<uint64_t>(0x85af4c61746e5a5a), /* bnp-Latn-ZZ */
-    static_cast<uint64_t>(0x626f54696274434e), /* bo-Tibt-CN */
-    static_cast<uint64_t>(0x85c94c61746e5a5a), /* boj-Latn-ZZ */
-    static_cast<uint64_t>(0x85cc4c61746e5a5a), /* bom-Latn-ZZ */
-    static_cast<uint64_t>(0x85cd4c61746e5a5a), /* bon-Latn-ZZ */
-    static_cast<uint64_t>(0x85f842656e67494e), /* bpy-Beng-IN */
-    static_cast<uint64_t>(0x86024c61746e5a5a), /* bqc-Latn-ZZ */
-    static_cast<uint64_t>(0x8608417261624952), /* bqi-Arab-IR */
-    static_cast<uint64_t>(0x860f4c61746e5a5a), /* bqp-Latn-ZZ */
-    static_cast<uint64_t>(0x86154c61746e4349), /* bqv-Latn-CI */
-    static_cast<uint64_t>(0x62724c61746e4652), /* br-Latn-FR */
-    static_cast<uint64_t>(0x862044657661494e), /* bra-Deva-IN */
-    static_cast<uint64_t>(0x862741726162504b), /* brh-Arab-PK */
-    static_cast<uint64_t>(0x863744657661494e), /* brx-Deva-IN */
-    static_cast<uint64_t>(0x86394c61746e5a5a), /* brz-Latn-ZZ */
-    static_cast<uint64_t>(0x62734c61746e4241), /* bs-Latn-BA */
-    static_cast<uint64_t>(0x86494c61746e5a5a), /* bsj-Latn-ZZ */
-    static_cast<uint64_t>(0x8650426173734c52), /* bsq-Bass-LR */
-    static_cast<uint64_t>(0x86524c61746e434d), /* bss-Latn-CM */
-    static_cast<uint64_t>(0x8653457468695a5a), /* bst-Ethi-ZZ */
-    static_cast<uint64_t>(0x866e4c61746e5048), /* bto-Latn-PH */
-    static_cast<uint64_t>(0x86734c61746e5a5a), /* btt-Latn-ZZ */
-    static_cast<uint64_t>(0x867544657661504b), /* btv-Deva-PK */
-    static_cast<uint64_t>(0x86804379726c5255), /* bua-Cyrl-RU */
-    static_cast<uint64_t>(0x86824c61746e5954), /* buc-Latn-YT */
-    static_cast<uint64_t>(0x86834c61746e5a5a), /* bud-Latn-ZZ */
-    static_cast<uint64_t>(0x86864c61746e4944), /* bug-Latn-ID */
-    static_cast<uint64_t>(0x868a4c61746e5a5a), /* buk-Latn-ZZ */
-    static_cast<uint64_t>(0x868c4c61746e434d), /* bum-Latn-CM */
-    static_cast<uint64_t>(0x868e4c61746e5a5a), /* buo-Latn-ZZ */
-    static_cast<uint64_t>(0x86924c61746e5a5a), /* bus-Latn-ZZ */
-    static_cast<uint64_t>(0x86944c61746e5a5a), /* buu-Latn-ZZ */
-    static_cast<uint64_t>(0x86a14c61746e4751), /* bvb-Latn-GQ */
-    static_cast<uint64_t>(0x86c34c61746e5a5a), /* bwd-Latn-ZZ */
-    static_cast<uint64_t>(0x86d14c61746e5a5a), /* bwr-Latn-ZZ */
-    static_cast<uint64_t>(0x86e74c61746e5a5a), /* bxh-Latn-ZZ */
-    static_cast<uint64_t>(0x87044c61746e5a5a), /* bye-Latn-ZZ */
-    static_cast<uint64_t>(0x870d457468694552), /* byn-Ethi-ER */
-    static_cast<uint64_t>(0x87114c61746e5a5a), /* byr-Latn-ZZ */
-    static_cast<uint64_t>(0x87124c61746e5a5a), /* bys-Latn-ZZ */
-    static_cast<uint64_t>(0x87154c61746e434d), /* byv-Latn-CM */
-    static_cast<uint64_t>(0x87174c61746e5a5a), /* byx-Latn-ZZ */
-    static_cast<uint64_t>(0x87204c61746e5a5a), /* bza-Latn-ZZ */
-    static_cast<uint64_t>(0x87244c61746e4d4c), /* bze-Latn-ML */
-    static_cast<uint64_t>(0x87254c61746e5a5a), /* bzf-Latn-ZZ */
-    static_cast<uint64_t>(0x87274c61746e5a5a), /* bzh-Latn-ZZ */
-    static_cast<uint64_t>(0x87364c61746e5a5a), /* bzw-Latn-ZZ */
-    static_cast<uint64_t>(0x63614c61746e4553), /* ca-Latn-ES */
-    static_cast<uint64_t>(0x88034c61746e5553), /* cad-Latn-US */
-    static_cast<uint64_t>(0x880d4c61746e5a5a), /* can-Latn-ZZ */
-    static_cast<uint64_t>(0x88294c61746e5a5a), /* cbj-Latn-ZZ */
-    static_cast<uint64_t>(0x88474c61746e4e47), /* cch-Latn-NG */
-    static_cast<uint64_t>(0x884f43616b6d4244), /* ccp-Cakm-BD */
-    static_cast<uint64_t>(0x63654379726c5255), /* ce-Cyrl-RU */
-    static_cast<uint64_t>(0x88814c61746e5048), /* ceb-Latn-PH */
-    static_cast<uint64_t>(0x88a04c61746e5a5a), /* cfa-Latn-ZZ */
-    static_cast<uint64_t>(0x88c64c61746e5547), /* cgg-Latn-UG */
-    static_cast<uint64_t>(0x63684c61746e4755), /* ch-Latn-GU */
-    static_cast<uint64_t>(0x88ea4c61746e464d), /* chk-Latn-FM */
-    static_cast<uint64_t>(0x88ec4379726c5255), /* chm-Cyrl-RU */
-    static_cast<uint64_t>(0x88ee4c61746e5553), /* cho-Latn-US */
-    static_cast<uint64_t>(0x88ef4c61746e4341), /* chp-Latn-CA */
-    static_cast<uint64_t>(0x88f1436865725553), /* chr-Cher-US */
-    static_cast<uint64_t>(0x89024c61746e5553), /* cic-Latn-US */
-    static_cast<uint64_t>(0x8920417261624b48), /* cja-Arab-KH */
-    static_cast<uint64_t>(0x892c4368616d564e), /* cjm-Cham-VN */
-    static_cast<uint64_t>(0x89354c61746e5a5a), /* cjv-Latn-ZZ */
-    static_cast<uint64_t>(0x8941417261624951), /* ckb-Arab-IQ */
-    static_cast<uint64_t>(0x894b4c61746e5a5a), /* ckl-Latn-ZZ */
-    static_cast<uint64_t>(0x894e4c61746e5a5a), /* cko-Latn-ZZ */
-    static_cast<uint64_t>(0x89584c61746e5a5a), /* cky-Latn-ZZ */
-    static_cast<uint64_t>(0x89604c61746e5a5a), /* cla-Latn-ZZ */
-    static_cast<uint64_t>(0x89844c61746e5a5a), /* cme-Latn-ZZ */
-    static_cast<uint64_t>(0x8986536f796f4d4e), /* cmg-Soyo-MN */
-    static_cast<uint64_t>(0x636f4c61746e4652), /* co-Latn-FR */
-    static_cast<uint64_t>(0x89cf436f70744547), /* cop-Copt-EG */
-    static_cast<uint64_t>(0x89f24c61746e5048), /* cps-Latn-PH */
-    static_cast<uint64_t>(0x637243616e734341), /* cr-Cans-CA */
-    static_cast<uint64_t>(0x8a274379726c5541), /* crh-Cyrl-UA */
-    static_cast<uint64_t>(0x8a2943616e734341), /* crj-Cans-CA */
-    static_cast<uint64_t>(0x8a2a43616e734341), /* crk-Cans-CA */
-    static_cast<uint64_t>(0x8a2b43616e734341), /* crl-Cans-CA */
-    static_cast<uint64_t>(0x8a2c43616e734341), /* crm-Cans-CA */
-    static_cast<uint64_t>(0x8a324c61746e5343), /* crs-Latn-SC */
-    static_cast<uint64_t>(0x63734c61746e435a), /* cs-Latn-CZ */
-    static_cast<uint64_t>(0x8a414c61746e504c), /* csb-Latn-PL */
-    static_cast<uint64_t>(0x8a5643616e734341), /* csw-Cans-CA */
-    static_cast<uint64_t>(0x8a63506175634d4d), /* ctd-Pauc-MM */
-    static_cast<uint64_t>(0x63754379726c5255), /* cu-Cyrl-RU */
-    static_cast<uint64_t>(0x6375476c61674247), /* cu-Glag-BG */
-    static_cast<uint64_t>(0x63764379726c5255), /* cv-Cyrl-RU */
-    static_cast<uint64_t>(0x63794c61746e4742), /* cy-Latn-GB */
-    static_cast<uint64_t>(0x64614c61746e444b), /* da-Latn-DK */
-    static_cast<uint64_t>(0x8c034c61746e5a5a), /* dad-Latn-ZZ */
-    static_cast<uint64_t>(0x8c054c61746e4349), /* daf-Latn-CI */
-    static_cast<uint64_t>(0x8c064c61746e5a5a), /* dag-Latn-ZZ */
-    static_cast<uint64_t>(0x8c074c61746e5a5a), /* dah-Latn-ZZ */
-    static_cast<uint64_t>(0x8c0a4c61746e5553), /* dak-Latn-US */
-    static_cast<uint64_t>(0x8c114379726c5255), /* dar-Cyrl-RU */
-    static_cast<uint64_t>(0x8c154c61746e4b45), /* dav-Latn-KE */
-    static_cast<uint64_t>(0x8c234c61746e5a5a), /* dbd-Latn-ZZ */
-    static_cast<uint64_t>(0x8c304c61746e5a5a), /* dbq-Latn-ZZ */
-    static_cast<uint64_t>(0x8c4241726162494e), /* dcc-Arab-IN */
-    static_cast<uint64_t>(0x8c6d4c61746e5a5a), /* ddn-Latn-ZZ */
-    static_cast<uint64_t>(0x64654c61746e4445), /* de-Latn-DE */
-    static_cast<uint64_t>(0x8c834c61746e5a5a), /* ded-Latn-ZZ */
-    static_cast<uint64_t>(0x8c8d4c61746e4341), /* den-Latn-CA */
-    static_cast<uint64_t>(0x8cc04c61746e5a5a), /* dga-Latn-ZZ */
-    static_cast<uint64_t>(0x8cc74c61746e5a5a), /* dgh-Latn-ZZ */
-    static_cast<uint64_t>(0x8cc84c61746e5a5a), /* dgi-Latn-ZZ */
-    static_cast<uint64_t>(0x8ccb417261625a5a), /* dgl-Arab-ZZ */
-    static_cast<uint64_t>(0x8cd14c61746e4341), /* dgr-Latn-CA */
-    static_cast<uint64_t>(0x8cd94c61746e5a5a), /* dgz-Latn-ZZ */
-    static_cast<uint64_t>(0x8d004c61746e5a5a), /* dia-Latn-ZZ */
-    static_cast<uint64_t>(0x8d244c61746e4e45), /* dje-Latn-NE */
-    static_cast<uint64_t>(0x8da94c61746e4349), /* dnj-Latn-CI */
-    static_cast<uint64_t>(0x8dc14c61746e5a5a), /* dob-Latn-ZZ */
-    static_cast<uint64_t>(0x8dc844657661494e), /* doi-Deva-IN */
-    static_cast<uint64_t>(0x8dcf4c61746e5a5a), /* dop-Latn-ZZ */
-    static_cast<uint64_t>(0x8dd64c61746e5a5a), /* dow-Latn-ZZ */
-    static_cast<uint64_t>(0x8e274d6f6e67434e), /* drh-Mong-CN */
-    static_cast<uint64_t>(0x8e284c61746e5a5a), /* dri-Latn-ZZ */
-    static_cast<uint64_t>(0x8e32457468695a5a), /* drs-Ethi-ZZ */
-    static_cast<uint64_t>(0x8e414c61746e4445), /* dsb-Latn-DE */
-    static_cast<uint64_t>(0x8e6c4c61746e4d4c), /* dtm-Latn-ML */
-    static_cast<uint64_t>(0x8e6f4c61746e4d59), /* dtp-Latn-MY */
-    static_cast<uint64_t>(0x8e724c61746e5a5a), /* dts-Latn-ZZ */
-    static_cast<uint64_t>(0x8e78446576614e50), /* dty-Deva-NP */
-    static_cast<uint64_t>(0x8e804c61746e434d), /* dua-Latn-CM */
-    static_cast<uint64_t>(0x8e824c61746e5a5a), /* duc-Latn-ZZ */
-    static_cast<uint64_t>(0x8e834c61746e5a5a), /* dud-Latn-ZZ */
-    static_cast<uint64_t>(0x8e864c61746e5a5a), /* dug-Latn-ZZ */
-    static_cast<uint64_t>(0x6476546861614d56), /* dv-Thaa-MV */
-    static_cast<uint64_t>(0x8ea04c61746e5a5a), /* dva-Latn-ZZ */
-    static_cast<uint64_t>(0x8ed64c61746e5a5a), /* dww-Latn-ZZ */
-    static_cast<uint64_t>(0x8f0e4c61746e534e), /* dyo-Latn-SN */
-    static_cast<uint64_t>(0x8f144c61746e4246), /* dyu-Latn-BF */
-    static_cast<uint64_t>(0x647a546962744254), /* dz-Tibt-BT */
-    static_cast<uint64_t>(0x8f264c61746e5a5a), /* dzg-Latn-ZZ */
-    static_cast<uint64_t>(0x90344c61746e4b45), /* ebu-Latn-KE */
-    static_cast<uint64_t>(0x65654c61746e4748), /* ee-Latn-GH */
-    static_cast<uint64_t>(0x90a84c61746e4e47), /* efi-Latn-NG */
-    static_cast<uint64_t>(0x90cb4c61746e4954), /* egl-Latn-IT */
-    static_cast<uint64_t>(0x90d8456779704547), /* egy-Egyp-EG */
-    static_cast<uint64_t>(0x91404c61746e5a5a), /* eka-Latn-ZZ */
-    static_cast<uint64_t>(0x91584b616c694d4d), /* eky-Kali-MM */
-    static_cast<uint64_t>(0x656c4772656b4752), /* el-Grek-GR */
-    static_cast<uint64_t>(0x91804c61746e5a5a), /* ema-Latn-ZZ */
-    static_cast<uint64_t>(0x91884c61746e5a5a), /* emi-Latn-ZZ */
-    static_cast<uint64_t>(0x656e4c61746e5553), /* en-Latn-US */
-    static_cast<uint64_t>(0x656e536861774742), /* en-Shaw-GB */
-    static_cast<uint64_t>(0x91ad4c61746e5a5a), /* enn-Latn-ZZ */
-    static_cast<uint64_t>(0x91b04c61746e5a5a), /* enq-Latn-ZZ */
-    static_cast<uint64_t>(0x656f4c61746e8001), /* eo-Latn-001 */
-    static_cast<uint64_t>(0x92284c61746e5a5a), /* eri-Latn-ZZ */
-    static_cast<uint64_t>(0x65734c61746e4553), /* es-Latn-ES */
-    static_cast<uint64_t>(0x9246476f6e6d494e), /* esg-Gonm-IN */
-    static_cast<uint64_t>(0x92544c61746e5553), /* esu-Latn-US */
-    static_cast<uint64_t>(0x65744c61746e4545), /* et-Latn-EE */
-    static_cast<uint64_t>(0x92714c61746e5a5a), /* etr-Latn-ZZ */
-    static_cast<uint64_t>(0x92734974616c4954), /* ett-Ital-IT */
-    static_cast<uint64_t>(0x92744c61746e5a5a), /* etu-Latn-ZZ */
-    static_cast<uint64_t>(0x92774c61746e5a5a), /* etx-Latn-ZZ */
-    static_cast<uint64_t>(0x65754c61746e4553), /* eu-Latn-ES */
-    static_cast<uint64_t>(0x92ce4c61746e434d), /* ewo-Latn-CM */
-    static_cast<uint64_t>(0x92f34c61746e4553), /* ext-Latn-ES */
-    static_cast<uint64_t>(0x93204c61746e5a5a), /* eza-Latn-ZZ */
-    static_cast<uint64_t>(0x6661417261624952), /* fa-Arab-IR */
-    static_cast<uint64_t>(0x94004c61746e5a5a), /* faa-Latn-ZZ */
-    static_cast<uint64_t>(0x94014c61746e5a5a), /* fab-Latn-ZZ */
-    static_cast<uint64_t>(0x94064c61746e5a5a), /* fag-Latn-ZZ */
-    static_cast<uint64_t>(0x94084c61746e5a5a), /* fai-Latn-ZZ */
-    static_cast<uint64_t>(0x940d4c61746e4751), /* fan-Latn-GQ */
-    static_cast<uint64_t>(0x66664c61746e534e), /* ff-Latn-SN */
-    static_cast<uint64_t>(0x666641646c6d474e), /* ff-Adlm-GN */
-    static_cast<uint64_t>(0x94a84c61746e5a5a), /* ffi-Latn-ZZ */
-    static_cast<uint64_t>(0x94ac4c61746e4d4c), /* ffm-Latn-ML */
-    static_cast<uint64_t>(0x66694c61746e4649), /* fi-Latn-FI */
-    static_cast<uint64_t>(0x9500417261625344), /* fia-Arab-SD */
-    static_cast<uint64_t>(0x950b4c61746e5048), /* fil-Latn-PH */
-    static_cast<uint64_t>(0x95134c61746e5345), /* fit-Latn-SE */
-    static_cast<uint64_t>(0x666a4c61746e464a), /* fj-Latn-FJ */
-    static_cast<uint64_t>(0x95714c61746e5a5a), /* flr-Latn-ZZ */
-    static_cast<uint64_t>(0x958f4c61746e5a5a), /* fmp-Latn-ZZ */
-    static_cast<uint64_t>(0x666f4c61746e464f), /* fo-Latn-FO */
-    static_cast<uint64_t>(0x95c34c61746e5a5a), /* fod-Latn-ZZ */
-    static_cast<uint64_t>(0x95cd4c61746e424a), /* fon-Latn-BJ */
-    static_cast<uint64_t>(0x95d14c61746e5a5a), /* for-Latn-ZZ */
-    static_cast<uint64_t>(0x95e44c61746e5a5a), /* fpe-Latn-ZZ */
-    static_cast<uint64_t>(0x96124c61746e5a5a), /* fqs-Latn-ZZ */
-    static_cast<uint64_t>(0x66724c61746e4652), /* fr-Latn-FR */
-    static_cast<uint64_t>(0x96224c61746e5553), /* frc-Latn-US */
-    static_cast<uint64_t>(0x962f4c61746e4652), /* frp-Latn-FR */
-    static_cast<uint64_t>(0x96314c61746e4445), /* frr-Latn-DE */
-    static_cast<uint64_t>(0x96324c61746e4445), /* frs-Latn-DE */
-    static_cast<uint64_t>(0x968141726162434d), /* fub-Arab-CM */
-    static_cast<uint64_t>(0x96834c61746e5746), /* fud-Latn-WF */
-    static_cast<uint64_t>(0x96844c61746e5a5a), /* fue-Latn-ZZ */
-    static_cast<uint64_t>(0x96854c61746e474e), /* fuf-Latn-GN */
-    static_cast<uint64_t>(0x96874c61746e5a5a), /* fuh-Latn-ZZ */
-    static_cast<uint64_t>(0x96904c61746e4e45), /* fuq-Latn-NE */
-    static_cast<uint64_t>(0x96914c61746e4954), /* fur-Latn-IT */
-    static_cast<uint64_t>(0x96954c61746e4e47), /* fuv-Latn-NG */
-    static_cast<uint64_t>(0x96984c61746e5a5a), /* fuy-Latn-ZZ */
-    static_cast<uint64_t>(0x96b14c61746e5344), /* fvr-Latn-SD */
-    static_cast<uint64_t>(0x66794c61746e4e4c), /* fy-Latn-NL */
-    static_cast<uint64_t>(0x67614c61746e4945), /* ga-Latn-IE */
-    static_cast<uint64_t>(0x98004c61746e4748), /* gaa-Latn-GH */
-    static_cast<uint64_t>(0x98054c61746e5a5a), /* gaf-Latn-ZZ */
-    static_cast<uint64_t>(0x98064c61746e4d44), /* gag-Latn-MD */
-    static_cast<uint64_t>(0x98074c61746e5a5a), /* gah-Latn-ZZ */
-    static_cast<uint64_t>(0x98094c61746e5a5a), /* gaj-Latn-ZZ */
-    static_cast<uint64_t>(0x980c4c61746e5a5a), /* gam-Latn-ZZ */
-    static_cast<uint64_t>(0x980d48616e73434e), /* gan-Hans-CN */
-    static_cast<uint64_t>(0x98164c61746e5a5a), /* gaw-Latn-ZZ */
-    static_cast<uint64_t>(0x98184c61746e4944), /* gay-Latn-ID */
-    static_cast<uint64_t>(0x98204c61746e5a5a), /* gba-Latn-ZZ */
-    static_cast<uint64_t>(0x98254c61746e5a5a), /* gbf-Latn-ZZ */
-    static_cast<uint64_t>(0x982c44657661494e), /* gbm-Deva-IN */
-    static_cast<uint64_t>(0x98384c61746e5a5a), /* gby-Latn-ZZ */
-    static_cast<uint64_t>(0x9839417261624952), /* gbz-Arab-IR */
-    static_cast<uint64_t>(0x98514c61746e4746), /* gcr-Latn-GF */
-    static_cast<uint64_t>(0x67644c61746e4742), /* gd-Latn-GB */
-    static_cast<uint64_t>(0x98644c61746e5a5a), /* gde-Latn-ZZ */
-    static_cast<uint64_t>(0x986d4c61746e5a5a), /* gdn-Latn-ZZ */
-    static_cast<uint64_t>(0x98714c61746e5a5a), /* gdr-Latn-ZZ */
-    static_cast<uint64_t>(0x98814c61746e5a5a), /* geb-Latn-ZZ */
-    static_cast<uint64_t>(0x98894c61746e5a5a), /* gej-Latn-ZZ */
-    static_cast<uint64_t>(0x988b4c61746e5a5a), /* gel-Latn-ZZ */
-    static_cast<uint64_t>(0x9899457468694554), /* gez-Ethi-ET */
-    static_cast<uint64_t>(0x98aa4c61746e5a5a), /* gfk-Latn-ZZ */
-    static_cast<uint64_t>(0x98cd446576614e50), /* ggn-Deva-NP */
-    static_cast<uint64_t>(0x98f24c61746e5a5a), /* ghs-Latn-ZZ */
-    static_cast<uint64_t>(0x990b4c61746e4b49), /* gil-Latn-KI */
-    static_cast<uint64_t>(0x990c4c61746e5a5a), /* gim-Latn-ZZ */
-    static_cast<uint64_t>(0x992a41726162504b), /* gjk-Arab-PK */
-    static_cast<uint64_t>(0x992d4c61746e5a5a), /* gjn-Latn-ZZ */
-    static_cast<uint64_t>(0x993441726162504b), /* gju-Arab-PK */
-    static_cast<uint64_t>(0x994d4c61746e5a5a), /* gkn-Latn-ZZ */
-    static_cast<uint64_t>(0x994f4c61746e5a5a), /* gkp-Latn-ZZ */
-    static_cast<uint64_t>(0x676c4c61746e4553), /* gl-Latn-ES */
-    static_cast<uint64_t>(0x996a417261624952), /* glk-Arab-IR */
-    static_cast<uint64_t>(0x998c4c61746e5a5a), /* gmm-Latn-ZZ */
-    static_cast<uint64_t>(0x9995457468695a5a), /* gmv-Ethi-ZZ */
-    static_cast<uint64_t>(0x676e4c61746e5059), /* gn-Latn-PY */
-    static_cast<uint64_t>(0x99a34c61746e5a5a), /* gnd-Latn-ZZ */
-    static_cast<uint64_t>(0x99a64c61746e5a5a), /* gng-Latn-ZZ */
-    static_cast<uint64_t>(0x99c34c61746e5a5a), /* god-Latn-ZZ */
-    static_cast<uint64_t>(0x99c5457468695a5a), /* gof-Ethi-ZZ */
-    static_cast<uint64_t>(0x99c84c61746e5a5a), /* goi-Latn-ZZ */
-    static_cast<uint64_t>(0x99cc44657661494e), /* gom-Deva-IN */
-    static_cast<uint64_t>(0x99cd54656c75494e), /* gon-Telu-IN */
-    static_cast<uint64_t>(0x99d14c61746e4944), /* gor-Latn-ID */
-    static_cast<uint64_t>(0x99d24c61746e4e4c), /* gos-Latn-NL */
-    static_cast<uint64_t>(0x99d3476f74685541), /* got-Goth-UA */
-    static_cast<uint64_t>(0x9a214c61746e5a5a), /* grb-Latn-ZZ */
-    static_cast<uint64_t>(0x9a22437072744359), /* grc-Cprt-CY */
-    static_cast<uint64_t>(0x9a224c696e624752), /* grc-Linb-GR */
-    static_cast<uint64_t>(0x9a3342656e67494e), /* grt-Beng-IN */
-    static_cast<uint64_t>(0x9a364c61746e5a5a), /* grw-Latn-ZZ */
-    static_cast<uint64_t>(0x9a564c61746e4348), /* gsw-Latn-CH */
-    static_cast<uint64_t>(0x677547756a72494e), /* gu-Gujr-IN */
-    static_cast<uint64_t>(0x9a814c61746e4252), /* gub-Latn-BR */
-    static_cast<uint64_t>(0x9a824c61746e434f), /* guc-Latn-CO */
-    static_cast<uint64_t>(0x9a834c61746e5a5a), /* gud-Latn-ZZ */
-    static_cast<uint64_t>(0x9a914c61746e4748), /* gur-Latn-GH */
-    static_cast<uint64_t>(0x9a964c61746e5a5a), /* guw-Latn-ZZ */
-    static_cast<uint64_t>(0x9a974c61746e5a5a), /* gux-Latn-ZZ */
-    static_cast<uint64_t>(0x9a994c61746e4b45), /* guz-Latn-KE */
-    static_cast<uint64_t>(0x67764c61746e494d), /* gv-Latn-IM */
-    static_cast<uint64_t>(0x9aa54c61746e5a5a), /* gvf-Latn-ZZ */
-    static_cast<uint64_t>(0x9ab1446576614e50), /* gvr-Deva-NP */
-    static_cast<uint64_t>(0x9ab24c61746e5a5a), /* gvs-Latn-ZZ */
-    static_cast<uint64_t>(0x9ac2417261625a5a), /* gwc-Arab-ZZ */
-    static_cast<uint64_t>(0x9ac84c61746e4341), /* gwi-Latn-CA */
-    static_cast<uint64_t>(0x9ad3417261625a5a), /* gwt-Arab-ZZ */
-    static_cast<uint64_t>(0x9b084c61746e5a5a), /* gyi-Latn-ZZ */
-    static_cast<uint64_t>(0x68614c61746e4e47), /* ha-Latn-NG */
-    static_cast<uint64_t>(0x686141726162434d), /* ha-Arab-CM */
-    static_cast<uint64_t>(0x6861417261625344), /* ha-Arab-SD */
-    static_cast<uint64_t>(0x9c064c61746e5a5a), /* hag-Latn-ZZ */
-    static_cast<uint64_t>(0x9c0a48616e73434e), /* hak-Hans-CN */
-    static_cast<uint64_t>(0x9c0c4c61746e5a5a), /* ham-Latn-ZZ */
-    static_cast<uint64_t>(0x9c164c61746e5553), /* haw-Latn-US */
-    static_cast<uint64_t>(0x9c19417261624146), /* haz-Arab-AF */
-    static_cast<uint64_t>(0x9c214c61746e5a5a), /* hbb-Latn-ZZ */
-    static_cast<uint64_t>(0x9c78457468695a5a), /* hdy-Ethi-ZZ */
-    static_cast<uint64_t>(0x686548656272494c), /* he-Hebr-IL */
-    static_cast<uint64_t>(0x9cf84c61746e5a5a), /* hhy-Latn-ZZ */
-    static_cast<uint64_t>(0x686944657661494e), /* hi-Deva-IN */
-    static_cast<uint64_t>(0x9d004c61746e5a5a), /* hia-Latn-ZZ */
-    static_cast<uint64_t>(0x9d054c61746e464a), /* hif-Latn-FJ */
-    static_cast<uint64_t>(0x9d064c61746e5a5a), /* hig-Latn-ZZ */
-    static_cast<uint64_t>(0x9d074c61746e5a5a), /* hih-Latn-ZZ */
-    static_cast<uint64_t>(0x9d0b4c61746e5048), /* hil-Latn-PH */
-    static_cast<uint64_t>(0x9d604c61746e5a5a), /* hla-Latn-ZZ */
-    static_cast<uint64_t>(0x9d74486c75775452), /* hlu-Hluw-TR */
-    static_cast<uint64_t>(0x9d83506c7264434e), /* hmd-Plrd-CN */
-    static_cast<uint64_t>(0x9d934c61746e5a5a), /* hmt-Latn-ZZ */
-    static_cast<uint64_t>(0x9da341726162504b), /* hnd-Arab-PK */
-    static_cast<uint64_t>(0x9da444657661494e), /* hne-Deva-IN */
-    static_cast<uint64_t>(0x9da9486d6e674c41), /* hnj-Hmng-LA */
-    static_cast<uint64_t>(0x9dad4c61746e5048), /* hnn-Latn-PH */
-    static_cast<uint64_t>(0x9dae41726162504b), /* hno-Arab-PK */
-    static_cast<uint64_t>(0x686f4c61746e5047), /* ho-Latn-PG */
-    static_cast<uint64_t>(0x9dc244657661494e), /* hoc-Deva-IN */
-    static_cast<uint64_t>(0x9dc944657661494e), /* hoj-Deva-IN */
-    static_cast<uint64_t>(0x9dd34c61746e5a5a), /* hot-Latn-ZZ */
-    static_cast<uint64_t>(0x68724c61746e4852), /* hr-Latn-HR */
-    static_cast<uint64_t>(0x9e414c61746e4445), /* hsb-Latn-DE */
-    static_cast<uint64_t>(0x9e4d48616e73434e), /* hsn-Hans-CN */
-    static_cast<uint64_t>(0x68744c61746e4854), /* ht-Latn-HT */
-    static_cast<uint64_t>(0x68754c61746e4855), /* hu-Latn-HU */
-    static_cast<uint64_t>(0x9e884c61746e5a5a), /* hui-Latn-ZZ */
-    static_cast<uint64_t>(0x687941726d6e414d), /* hy-Armn-AM */
-    static_cast<uint64_t>(0x687a4c61746e4e41), /* hz-Latn-NA */
-    static_cast<uint64_t>(0x69614c61746e8001), /* ia-Latn-001 */
-    static_cast<uint64_t>(0xa00d4c61746e5a5a), /* ian-Latn-ZZ */
-    static_cast<uint64_t>(0xa0114c61746e5a5a), /* iar-Latn-ZZ */
-    static_cast<uint64_t>(0xa0204c61746e4d59), /* iba-Latn-MY */
-    static_cast<uint64_t>(0xa0214c61746e4e47), /* ibb-Latn-NG */
-    static_cast<uint64_t>(0xa0384c61746e5a5a), /* iby-Latn-ZZ */
-    static_cast<uint64_t>(0xa0404c61746e5a5a), /* ica-Latn-ZZ */
-    static_cast<uint64_t>(0xa0474c61746e5a5a), /* ich-Latn-ZZ */
-    static_cast<uint64_t>(0x69644c61746e4944), /* id-Latn-ID */
-    static_cast<uint64_t>(0xa0634c61746e5a5a), /* idd-Latn-ZZ */
-    static_cast<uint64_t>(0xa0684c61746e5a5a), /* idi-Latn-ZZ */
-    static_cast<uint64_t>(0xa0744c61746e5a5a), /* idu-Latn-ZZ */
-    static_cast<uint64_t>(0xa0a44c61746e5447), /* ife-Latn-TG */
-    static_cast<uint64_t>(0x69674c61746e4e47), /* ig-Latn-NG */
-    static_cast<uint64_t>(0xa0c14c61746e5a5a), /* igb-Latn-ZZ */
-    static_cast<uint64_t>(0xa0c44c61746e5a5a), /* ige-Latn-ZZ */
-    static_cast<uint64_t>(0x696959696969434e), /* ii-Yiii-CN */
-    static_cast<uint64_t>(0xa1294c61746e5a5a), /* ijj-Latn-ZZ */
-    static_cast<uint64_t>(0x696b4c61746e5553), /* ik-Latn-US */
-    static_cast<uint64_t>(0xa14a4c61746e5a5a), /* ikk-Latn-ZZ */
-    static_cast<uint64_t>(0xa1534c61746e4341), /* ikt-Latn-CA */
-    static_cast<uint64_t>(0xa1564c61746e5a5a), /* ikw-Latn-ZZ */
-    static_cast<uint64_t>(0xa1574c61746e5a5a), /* ikx-Latn-ZZ */
-    static_cast<uint64_t>(0xa16e4c61746e5048), /* ilo-Latn-PH */
-    static_cast<uint64_t>(0xa18e4c61746e5a5a), /* imo-Latn-ZZ */
-    static_cast<uint64_t>(0x696e4c61746e4944), /* in-Latn-ID */
-    static_cast<uint64_t>(0xa1a74379726c5255), /* inh-Cyrl-RU */
-    static_cast<uint64_t>(0x696f4c61746e8001), /* io-Latn-001 */
-    static_cast<uint64_t>(0xa1d44c61746e5a5a), /* iou-Latn-ZZ */
-    static_cast<uint64_t>(0xa2284c61746e5a5a), /* iri-Latn-ZZ */
-    static_cast<uint64_t>(0x69734c61746e4953), /* is-Latn-IS */
-    static_cast<uint64_t>(0x69744c61746e4954), /* it-Latn-IT */
-    static_cast<uint64_t>(0x697543616e734341), /* iu-Cans-CA */
-    static_cast<uint64_t>(0x697748656272494c), /* iw-Hebr-IL */
-    static_cast<uint64_t>(0xa2cc4c61746e5a5a), /* iwm-Latn-ZZ */
-    static_cast<uint64_t>(0xa2d24c61746e5a5a), /* iws-Latn-ZZ */
-    static_cast<uint64_t>(0xa3274c61746e5255), /* izh-Latn-RU */
-    static_cast<uint64_t>(0xa3284c61746e5a5a), /* izi-Latn-ZZ */
-    static_cast<uint64_t>(0x6a614a70616e4a50), /* ja-Jpan-JP */
-    static_cast<uint64_t>(0xa4014c61746e5a5a), /* jab-Latn-ZZ */
-    static_cast<uint64_t>(0xa40c4c61746e4a4d), /* jam-Latn-JM */
-    static_cast<uint64_t>(0xa4114c61746e5a5a), /* jar-Latn-ZZ */
-    static_cast<uint64_t>(0xa42e4c61746e8001), /* jbo-Latn-001 */
-    static_cast<uint64_t>(0xa4344c61746e5a5a), /* jbu-Latn-ZZ */
-    static_cast<uint64_t>(0xa48d4c61746e5a5a), /* jen-Latn-ZZ */
-    static_cast<uint64_t>(0xa4ca4c61746e5a5a), /* jgk-Latn-ZZ */
-    static_cast<uint64_t>(0xa4ce4c61746e434d), /* jgo-Latn-CM */
-    static_cast<uint64_t>(0x6a69486562725541), /* ji-Hebr-UA */
-    static_cast<uint64_t>(0xa5014c61746e5a5a), /* jib-Latn-ZZ */
-    static_cast<uint64_t>(0xa5824c61746e545a), /* jmc-Latn-TZ */
-    static_cast<uint64_t>(0xa58b446576614e50), /* jml-Deva-NP */
-    static_cast<uint64_t>(0xa6204c61746e5a5a), /* jra-Latn-ZZ */
-    static_cast<uint64_t>(0xa6934c61746e444b), /* jut-Latn-DK */
-    static_cast<uint64_t>(0x6a764c61746e4944), /* jv-Latn-ID */
-    static_cast<uint64_t>(0x6a774c61746e4944), /* jw-Latn-ID */
-    static_cast<uint64_t>(0x6b6147656f724745), /* ka-Geor-GE */
-    static_cast<uint64_t>(0xa8004379726c555a), /* kaa-Cyrl-UZ */
-    static_cast<uint64_t>(0xa8014c61746e445a), /* kab-Latn-DZ */
-    static_cast<uint64_t>(0xa8024c61746e4d4d), /* kac-Latn-MM */
-    static_cast<uint64_t>(0xa8034c61746e5a5a), /* kad-Latn-ZZ */
-    static_cast<uint64_t>(0xa8084c61746e5a5a), /* kai-Latn-ZZ */
-    static_cast<uint64_t>(0xa8094c61746e4e47), /* kaj-Latn-NG */
-    static_cast<uint64_t>(0xa80c4c61746e4b45), /* kam-Latn-KE */
-    static_cast<uint64_t>(0xa80e4c61746e4d4c), /* kao-Latn-ML */
-    static_cast<uint64_t>(0xa8234379726c5255), /* kbd-Cyrl-RU */
-    static_cast<uint64_t>(0xa82c4c61746e5a5a), /* kbm-Latn-ZZ */
-    static_cast<uint64_t>(0xa82f4c61746e5a5a), /* kbp-Latn-ZZ */
-    static_cast<uint64_t>(0xa8304c61746e5a5a), /* kbq-Latn-ZZ */
-    static_cast<uint64_t>(0xa8374c61746e5a5a), /* kbx-Latn-ZZ */
-    static_cast<uint64_t>(0xa838417261624e45), /* kby-Arab-NE */
-    static_cast<uint64_t>(0xa8464c61746e4e47), /* kcg-Latn-NG */
-    static_cast<uint64_t>(0xa84a4c61746e5a57), /* kck-Latn-ZW */
-    static_cast<uint64_t>(0xa84b4c61746e5a5a), /* kcl-Latn-ZZ */
-    static_cast<uint64_t>(0xa8534c61746e5a5a), /* kct-Latn-ZZ */
-    static_cast<uint64_t>(0xa8644c61746e545a), /* kde-Latn-TZ */
-    static_cast<uint64_t>(0xa867417261625447), /* kdh-Arab-TG */
-    static_cast<uint64_t>(0xa86b4c61746e5a5a), /* kdl-Latn-ZZ */
-    static_cast<uint64_t>(0xa873546861695448), /* kdt-Thai-TH */
-    static_cast<uint64_t>(0xa8804c61746e4356), /* kea-Latn-CV */
-    static_cast<uint64_t>(0xa88d4c61746e434d), /* ken-Latn-CM */
-    static_cast<uint64_t>(0xa8994c61746e5a5a), /* kez-Latn-ZZ */
-    static_cast<uint64_t>(0xa8ae4c61746e4349), /* kfo-Latn-CI */
-    static_cast<uint64_t>(0xa8b144657661494e), /* kfr-Deva-IN */
-    static_cast<uint64_t>(0xa8b844657661494e), /* kfy-Deva-IN */
-    static_cast<uint64_t>(0x6b674c61746e4344), /* kg-Latn-CD */
-    static_cast<uint64_t>(0xa8c44c61746e4944), /* kge-Latn-ID */
-    static_cast<uint64_t>(0xa8c54c61746e5a5a), /* kgf-Latn-ZZ */
-    static_cast<uint64_t>(0xa8cf4c61746e4252), /* kgp-Latn-BR */
-    static_cast<uint64_t>(0xa8e04c61746e494e), /* kha-Latn-IN */
-    static_cast<uint64_t>(0xa8e154616c75434e), /* khb-Talu-CN */
-    static_cast<uint64_t>(0xa8ed44657661494e), /* khn-Deva-IN */
-    static_cast<uint64_t>(0xa8f04c61746e4d4c), /* khq-Latn-ML */
-    static_cast<uint64_t>(0xa8f24c61746e5a5a), /* khs-Latn-ZZ */
-    static_cast<uint64_t>(0xa8f34d796d72494e), /* kht-Mymr-IN */
-    static_cast<uint64_t>(0xa8f641726162504b), /* khw-Arab-PK */
-    static_cast<uint64_t>(0xa8f94c61746e5a5a), /* khz-Latn-ZZ */
-    static_cast<uint64_t>(0x6b694c61746e4b45), /* ki-Latn-KE */
-    static_cast<uint64_t>(0xa9094c61746e5a5a), /* kij-Latn-ZZ */
-    static_cast<uint64_t>(0xa9144c61746e5452), /* kiu-Latn-TR */
-    static_cast<uint64_t>(0xa9164c61746e5a5a), /* kiw-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6a4c61746e4e41), /* kj-Latn-NA */
-    static_cast<uint64_t>(0xa9234c61746e5a5a), /* kjd-Latn-ZZ */
-    static_cast<uint64_t>(0xa9264c616f6f4c41), /* kjg-Laoo-LA */
-    static_cast<uint64_t>(0xa9324c61746e5a5a), /* kjs-Latn-ZZ */
-    static_cast<uint64_t>(0xa9384c61746e5a5a), /* kjy-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6b4379726c4b5a), /* kk-Cyrl-KZ */
-    static_cast<uint64_t>(0x6b6b417261624146), /* kk-Arab-AF */
-    static_cast<uint64_t>(0x6b6b41726162434e), /* kk-Arab-CN */
-    static_cast<uint64_t>(0x6b6b41726162434e), /* kk-Arab-CN */
-    static_cast<uint64_t>(0x6b6b417261624952), /* kk-Arab-IR */
-    static_cast<uint64_t>(0x6b6b417261624d4e), /* kk-Arab-MN */
-    static_cast<uint64_t>(0xa9424c61746e5a5a), /* kkc-Latn-ZZ */
-    static_cast<uint64_t>(0xa9494c61746e434d), /* kkj-Latn-CM */
-    static_cast<uint64_t>(0x6b6c4c61746e474c), /* kl-Latn-GL */
-    static_cast<uint64_t>(0xa96d4c61746e4b45), /* kln-Latn-KE */
-    static_cast<uint64_t>(0xa9704c61746e5a5a), /* klq-Latn-ZZ */
-    static_cast<uint64_t>(0xa9734c61746e5a5a), /* klt-Latn-ZZ */
-    static_cast<uint64_t>(0xa9774c61746e5a5a), /* klx-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6d4b686d724b48), /* km-Khmr-KH */
-    static_cast<uint64_t>(0xa9814c61746e414f), /* kmb-Latn-AO */
-    static_cast<uint64_t>(0xa9874c61746e5a5a), /* kmh-Latn-ZZ */
-    static_cast<uint64_t>(0xa98e4c61746e5a5a), /* kmo-Latn-ZZ */
-    static_cast<uint64_t>(0xa9924c61746e5a5a), /* kms-Latn-ZZ */
-    static_cast<uint64_t>(0xa9944c61746e5a5a), /* kmu-Latn-ZZ */
-    static_cast<uint64_t>(0xa9964c61746e5a5a), /* kmw-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6e4b6e6461494e), /* kn-Knda-IN */
-    static_cast<uint64_t>(0xa9a54c61746e4757), /* knf-Latn-GW */
-    static_cast<uint64_t>(0xa9af4c61746e5a5a), /* knp-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6f4b6f72654b52), /* ko-Kore-KR */
-    static_cast<uint64_t>(0xa9c84379726c5255), /* koi-Cyrl-RU */
-    static_cast<uint64_t>(0xa9ca44657661494e), /* kok-Deva-IN */
-    static_cast<uint64_t>(0xa9cb4c61746e5a5a), /* kol-Latn-ZZ */
-    static_cast<uint64_t>(0xa9d24c61746e464d), /* kos-Latn-FM */
-    static_cast<uint64_t>(0xa9d94c61746e5a5a), /* koz-Latn-ZZ */
-    static_cast<uint64_t>(0xa9e44c61746e4c52), /* kpe-Latn-LR */
-    static_cast<uint64_t>(0xa9e54c61746e5a5a), /* kpf-Latn-ZZ */
-    static_cast<uint64_t>(0xa9ee4c61746e5a5a), /* kpo-Latn-ZZ */
-    static_cast<uint64_t>(0xa9f14c61746e5a5a), /* kpr-Latn-ZZ */
-    static_cast<uint64_t>(0xa9f74c61746e5a5a), /* kpx-Latn-ZZ */
-    static_cast<uint64_t>(0xaa014c61746e5a5a), /* kqb-Latn-ZZ */
-    static_cast<uint64_t>(0xaa054c61746e5a5a), /* kqf-Latn-ZZ */
-    static_cast<uint64_t>(0xaa124c61746e5a5a), /* kqs-Latn-ZZ */
-    static_cast<uint64_t>(0xaa18457468695a5a), /* kqy-Ethi-ZZ */
-    static_cast<uint64_t>(0x6b724c61746e5a5a), /* kr-Latn-ZZ */
-    static_cast<uint64_t>(0xaa224379726c5255), /* krc-Cyrl-RU */
-    static_cast<uint64_t>(0xaa284c61746e534c), /* kri-Latn-SL */
-    static_cast<uint64_t>(0xaa294c61746e5048), /* krj-Latn-PH */
-    static_cast<uint64_t>(0xaa2b4c61746e5255), /* krl-Latn-RU */
-    static_cast<uint64_t>(0xaa324c61746e5a5a), /* krs-Latn-ZZ */
-    static_cast<uint64_t>(0xaa3444657661494e), /* kru-Deva-IN */
-    static_cast<uint64_t>(0x6b7341726162494e), /* ks-Arab-IN */
-    static_cast<uint64_t>(0xaa414c61746e545a), /* ksb-Latn-TZ */
-    static_cast<uint64_t>(0xaa434c61746e5a5a), /* ksd-Latn-ZZ */
-    static_cast<uint64_t>(0xaa454c61746e434d), /* ksf-Latn-CM */
-    static_cast<uint64_t>(0xaa474c61746e4445), /* ksh-Latn-DE */
-    static_cast<uint64_t>(0xaa494c61746e5a5a), /* ksj-Latn-ZZ */
-    static_cast<uint64_t>(0xaa514c61746e5a5a), /* ksr-Latn-ZZ */
-    static_cast<uint64_t>(0xaa61457468695a5a), /* ktb-Ethi-ZZ */
-    static_cast<uint64_t>(0xaa6c4c61746e5a5a), /* ktm-Latn-ZZ */
-    static_cast<uint64_t>(0xaa6e4c61746e5a5a), /* kto-Latn-ZZ */
-    static_cast<uint64_t>(0xaa714c61746e4d59), /* ktr-Latn-MY */
-    static_cast<uint64_t>(0x6b754c61746e5452), /* ku-Latn-TR */
-    static_cast<uint64_t>(0x6b75417261624951), /* ku-Arab-IQ */
-    static_cast<uint64_t>(0x6b75417261624c42), /* ku-Arab-LB */
-    static_cast<uint64_t>(0x6b7559657a694745), /* ku-Yezi-GE */
-    static_cast<uint64_t>(0xaa814c61746e5a5a), /* kub-Latn-ZZ */
-    static_cast<uint64_t>(0xaa834c61746e5a5a), /* kud-Latn-ZZ */
-    static_cast<uint64_t>(0xaa844c61746e5a5a), /* kue-Latn-ZZ */
-    static_cast<uint64_t>(0xaa894c61746e5a5a), /* kuj-Latn-ZZ */
-    static_cast<uint64_t>(0xaa8c4379726c5255), /* kum-Cyrl-RU */
-    static_cast<uint64_t>(0xaa8d4c61746e5a5a), /* kun-Latn-ZZ */
-    static_cast<uint64_t>(0xaa8f4c61746e5a5a), /* kup-Latn-ZZ */
-    static_cast<uint64_t>(0xaa924c61746e5a5a), /* kus-Latn-ZZ */
-    static_cast<uint64_t>(0x6b764379726c5255), /* kv-Cyrl-RU */
-    static_cast<uint64_t>(0xaaa64c61746e5a5a), /* kvg-Latn-ZZ */
-    static_cast<uint64_t>(0xaab14c61746e4944), /* kvr-Latn-ID */
-    static_cast<uint64_t>(0xaab741726162504b), /* kvx-Arab-PK */
-    static_cast<uint64_t>(0x6b774c61746e4742), /* kw-Latn-GB */
-    static_cast<uint64_t>(0xaac94c61746e5a5a), /* kwj-Latn-ZZ */
-    static_cast<uint64_t>(0xaace4c61746e5a5a), /* kwo-Latn-ZZ */
-    static_cast<uint64_t>(0xaad04c61746e5a5a), /* kwq-Latn-ZZ */
-    static_cast<uint64_t>(0xaae04c61746e5a5a), /* kxa-Latn-ZZ */
-    static_cast<uint64_t>(0xaae2457468695a5a), /* kxc-Ethi-ZZ */
-    static_cast<uint64_t>(0xaae44c61746e5a5a), /* kxe-Latn-ZZ */
-    static_cast<uint64_t>(0xaaeb44657661494e), /* kxl-Deva-IN */
-    static_cast<uint64_t>(0xaaec546861695448), /* kxm-Thai-TH */
-    static_cast<uint64_t>(0xaaef41726162504b), /* kxp-Arab-PK */
-    static_cast<uint64_t>(0xaaf64c61746e5a5a), /* kxw-Latn-ZZ */
-    static_cast<uint64_t>(0xaaf94c61746e5a5a), /* kxz-Latn-ZZ */
-    static_cast<uint64_t>(0x6b794379726c4b47), /* ky-Cyrl-KG */
-    static_cast<uint64_t>(0x6b7941726162434e), /* ky-Arab-CN */
-    static_cast<uint64_t>(0x6b7941726162434e), /* ky-Arab-CN */
-    static_cast<uint64_t>(0x6b794c61746e5452), /* ky-Latn-TR */
-    static_cast<uint64_t>(0x6b794c61746e5452), /* ky-Latn-TR */
-    static_cast<uint64_t>(0xab044c61746e5a5a), /* kye-Latn-ZZ */
-    static_cast<uint64_t>(0xab174c61746e5a5a), /* kyx-Latn-ZZ */
-    static_cast<uint64_t>(0xab27417261625a5a), /* kzh-Arab-ZZ */
-    static_cast<uint64_t>(0xab294c61746e4d59), /* kzj-Latn-MY */
-    static_cast<uint64_t>(0xab314c61746e5a5a), /* kzr-Latn-ZZ */
-    static_cast<uint64_t>(0xab334c61746e4d59), /* kzt-Latn-MY */
-    static_cast<uint64_t>(0x6c614c61746e5641), /* la-Latn-VA */
-    static_cast<uint64_t>(0xac014c696e614752), /* lab-Lina-GR */
-    static_cast<uint64_t>(0xac0348656272494c), /* lad-Hebr-IL */
-    static_cast<uint64_t>(0xac064c61746e545a), /* lag-Latn-TZ */
-    static_cast<uint64_t>(0xac0741726162504b), /* lah-Arab-PK */
-    static_cast<uint64_t>(0xac094c61746e5547), /* laj-Latn-UG */
-    static_cast<uint64_t>(0xac124c61746e5a5a), /* las-Latn-ZZ */
-    static_cast<uint64_t>(0x6c624c61746e4c55), /* lb-Latn-LU */
-    static_cast<uint64_t>(0xac244379726c5255), /* lbe-Cyrl-RU */
-    static_cast<uint64_t>(0xac344c61746e5a5a), /* lbu-Latn-ZZ */
-    static_cast<uint64_t>(0xac364c61746e4944), /* lbw-Latn-ID */
-    static_cast<uint64_t>(0xac4c4c61746e5a5a), /* lcm-Latn-ZZ */
-    static_cast<uint64_t>(0xac4f54686169434e), /* lcp-Thai-CN */
-    static_cast<uint64_t>(0xac614c61746e5a5a), /* ldb-Latn-ZZ */
-    static_cast<uint64_t>(0xac834c61746e5a5a), /* led-Latn-ZZ */
-    static_cast<uint64_t>(0xac844c61746e5a5a), /* lee-Latn-ZZ */
-    static_cast<uint64_t>(0xac8c4c61746e5a5a), /* lem-Latn-ZZ */
-    static_cast<uint64_t>(0xac8f4c657063494e), /* lep-Lepc-IN */
-    static_cast<uint64_t>(0xac904c61746e5a5a), /* leq-Latn-ZZ */
-    static_cast<uint64_t>(0xac944c61746e5a5a), /* leu-Latn-ZZ */
-    static_cast<uint64_t>(0xac994379726c5255), /* lez-Cyrl-RU */
-    static_cast<uint64_t>(0x6c674c61746e5547), /* lg-Latn-UG */
-    static_cast<uint64_t>(0xacc64c61746e5a5a), /* lgg-Latn-ZZ */
-    static_cast<uint64_t>(0x6c694c61746e4e4c), /* li-Latn-NL */
-    static_cast<uint64_t>(0xad004c61746e5a5a), /* lia-Latn-ZZ */
-    static_cast<uint64_t>(0xad034c61746e5a5a), /* lid-Latn-ZZ */
-    static_cast<uint64_t>(0xad05446576614e50), /* lif-Deva-NP */
-    static_cast<uint64_t>(0xad054c696d62494e), /* lif-Limb-IN */
-    static_cast<uint64_t>(0xad064c61746e5a5a), /* lig-Latn-ZZ */
-    static_cast<uint64_t>(0xad074c61746e5a5a), /* lih-Latn-ZZ */
-    static_cast<uint64_t>(0xad094c61746e4954), /* lij-Latn-IT */
-    static_cast<uint64_t>(0xad124c697375434e), /* lis-Lisu-CN */
-    static_cast<uint64_t>(0xad2f4c61746e4944), /* ljp-Latn-ID */
-    static_cast<uint64_t>(0xad48417261624952), /* lki-Arab-IR */
-    static_cast<uint64_t>(0xad534c61746e5553), /* lkt-Latn-US */
-    static_cast<uint64_t>(0xad644c61746e5a5a), /* lle-Latn-ZZ */
-    static_cast<uint64_t>(0xad6d4c61746e5a5a), /* lln-Latn-ZZ */
-    static_cast<uint64_t>(0xad8d54656c75494e), /* lmn-Telu-IN */
-    static_cast<uint64_t>(0xad8e4c61746e4954), /* lmo-Latn-IT */
-    static_cast<uint64_t>(0xad8f4c61746e5a5a), /* lmp-Latn-ZZ */
-    static_cast<uint64_t>(0x6c6e4c61746e4344), /* ln-Latn-CD */
-    static_cast<uint64_t>(0xadb24c61746e5a5a), /* lns-Latn-ZZ */
-    static_cast<uint64_t>(0xadb44c61746e5a5a), /* lnu-Latn-ZZ */
-    static_cast<uint64_t>(0x6c6f4c616f6f4c41), /* lo-Laoo-LA */
-    static_cast<uint64_t>(0xadc94c61746e5a5a), /* loj-Latn-ZZ */
-    static_cast<uint64_t>(0xadca4c61746e5a5a), /* lok-Latn-ZZ */
-    static_cast<uint64_t>(0xadcb4c61746e4344), /* lol-Latn-CD */
-    static_cast<uint64_t>(0xadd14c61746e5a5a), /* lor-Latn-ZZ */
-    static_cast<uint64_t>(0xadd24c61746e5a5a), /* los-Latn-ZZ */
-    static_cast<uint64_t>(0xadd94c61746e5a4d), /* loz-Latn-ZM */
-    static_cast<uint64_t>(0xae22417261624952), /* lrc-Arab-IR */
-    static_cast<uint64_t>(0x6c744c61746e4c54), /* lt-Latn-LT */
-    static_cast<uint64_t>(0xae664c61746e4c56), /* ltg-Latn-LV */
-    static_cast<uint64_t>(0x6c754c61746e4344), /* lu-Latn-CD */
-    static_cast<uint64_t>(0xae804c61746e4344), /* lua-Latn-CD */
-    static_cast<uint64_t>(0xae8e4c61746e4b45), /* luo-Latn-KE */
-    static_cast<uint64_t>(0xae984c61746e4b45), /* luy-Latn-KE */
-    static_cast<uint64_t>(0xae99417261624952), /* luz-Arab-IR */
-    static_cast<uint64_t>(0x6c764c61746e4c56), /* lv-Latn-LV */
-    static_cast<uint64_t>(0xaecb546861695448), /* lwl-Thai-TH */
-    static_cast<uint64_t>(0xaf2748616e73434e), /* lzh-Hans-CN */
-    static_cast<uint64_t>(0xaf394c61746e5452), /* lzz-Latn-TR */
-    static_cast<uint64_t>(0xb0034c61746e4944), /* mad-Latn-ID */
-    static_cast<uint64_t>(0xb0054c61746e434d), /* maf-Latn-CM */
-    static_cast<uint64_t>(0xb00644657661494e), /* mag-Deva-IN */
-    static_cast<uint64_t>(0xb00844657661494e), /* mai-Deva-IN */
-    static_cast<uint64_t>(0xb00a4c61746e4944), /* mak-Latn-ID */
-    static_cast<uint64_t>(0xb00d4c61746e474d), /* man-Latn-GM */
-    static_cast<uint64_t>(0xb00d4e6b6f6f474e), /* man-Nkoo-GN */
-    static_cast<uint64_t>(0xb00d4e6b6f6f474e), /* man-Nkoo-GN */
-    static_cast<uint64_t>(0xb0124c61746e4b45), /* mas-Latn-KE */
-    static_cast<uint64_t>(0xb0164c61746e5a5a), /* maw-Latn-ZZ */
-    static_cast<uint64_t>(0xb0194c61746e4d58), /* maz-Latn-MX */
-    static_cast<uint64_t>(0xb0274c61746e5a5a), /* mbh-Latn-ZZ */
-    static_cast<uint64_t>(0xb02e4c61746e5a5a), /* mbo-Latn-ZZ */
-    static_cast<uint64_t>(0xb0304c61746e5a5a), /* mbq-Latn-ZZ */
-    static_cast<uint64_t>(0xb0344c61746e5a5a), /* mbu-Latn-ZZ */
-    static_cast<uint64_t>(0xb0364c61746e5a5a), /* mbw-Latn-ZZ */
-    static_cast<uint64_t>(0xb0484c61746e5a5a), /* mci-Latn-ZZ */
-    static_cast<uint64_t>(0xb04f4c61746e5a5a), /* mcp-Latn-ZZ */
-    static_cast<uint64_t>(0xb0504c61746e5a5a), /* mcq-Latn-ZZ */
-    static_cast<uint64_t>(0xb0514c61746e5a5a), /* mcr-Latn-ZZ */
-    static_cast<uint64_t>(0xb0544c61746e5a5a), /* mcu-Latn-ZZ */
-    static_cast<uint64_t>(0xb0604c61746e5a5a), /* mda-Latn-ZZ */
-    static_cast<uint64_t>(0xb064417261625a5a), /* mde-Arab-ZZ */
-    static_cast<uint64_t>(0xb0654379726c5255), /* mdf-Cyrl-RU */
-    static_cast<uint64_t>(0xb0674c61746e5048), /* mdh-Latn-PH */
-    static_cast<uint64_t>(0xb0694c61746e5a5a), /* mdj-Latn-ZZ */
-    static_cast<uint64_t>(0xb0714c61746e4944), /* mdr-Latn-ID */
-    static_cast<uint64_t>(0xb077457468695a5a), /* mdx-Ethi-ZZ */
-    static_cast<uint64_t>(0xb0834c61746e5a5a), /* med-Latn-ZZ */
-    static_cast<uint64_t>(0xb0844c61746e5a5a), /* mee-Latn-ZZ */
-    static_cast<uint64_t>(0xb08a4c61746e5a5a), /* mek-Latn-ZZ */
-    static_cast<uint64_t>(0xb08d4c61746e534c), /* men-Latn-SL */
-    static_cast<uint64_t>(0xb0914c61746e4b45), /* mer-Latn-KE */
-    static_cast<uint64_t>(0xb0934c61746e5a5a), /* met-Latn-ZZ */
-    static_cast<uint64_t>(0xb0944c61746e5a5a), /* meu-Latn-ZZ */
-    static_cast<uint64_t>(0xb0a0417261625448), /* mfa-Arab-TH */
-    static_cast<uint64_t>(0xb0a44c61746e4d55), /* mfe-Latn-MU */
-    static_cast<uint64_t>(0xb0ad4c61746e5a5a), /* mfn-Latn-ZZ */
-    static_cast<uint64_t>(0xb0ae4c61746e5a5a), /* mfo-Latn-ZZ */
-    static_cast<uint64_t>(0xb0b04c61746e5a5a), /* mfq-Latn-ZZ */
-    static_cast<uint64_t>(0x6d674c61746e4d47), /* mg-Latn-MG */
-    static_cast<uint64_t>(0xb0c74c61746e4d5a), /* mgh-Latn-MZ */
-    static_cast<uint64_t>(0xb0cb4c61746e5a5a), /* mgl-Latn-ZZ */
-    static_cast<uint64_t>(0xb0ce4c61746e434d), /* mgo-Latn-CM */
-    static_cast<uint64_t>(0xb0cf446576614e50), /* mgp-Deva-NP */
-    static_cast<uint64_t>(0xb0d84c61746e545a), /* mgy-Latn-TZ */
-    static_cast<uint64_t>(0x6d684c61746e4d48), /* mh-Latn-MH */
-    static_cast<uint64_t>(0xb0e84c61746e5a5a), /* mhi-Latn-ZZ */
-    static_cast<uint64_t>(0xb0eb4c61746e5a5a), /* mhl-Latn-ZZ */
-    static_cast<uint64_t>(0x6d694c61746e4e5a), /* mi-Latn-NZ */
-    static_cast<uint64_t>(0xb1054c61746e5a5a), /* mif-Latn-ZZ */
-    static_cast<uint64_t>(0xb10d4c61746e4944), /* min-Latn-ID */
-    static_cast<uint64_t>(0xb112486174724951), /* mis-Hatr-IQ */
-    static_cast<uint64_t>(0xb1124d6564664e47), /* mis-Medf-NG */
-    static_cast<uint64_t>(0xb1164c61746e5a5a), /* miw-Latn-ZZ */
-    static_cast<uint64_t>(0x6d6b4379726c4d4b), /* mk-Cyrl-MK */
-    static_cast<uint64_t>(0xb148417261625a5a), /* mki-Arab-ZZ */
-    static_cast<uint64_t>(0xb14b4c61746e5a5a), /* mkl-Latn-ZZ */
-    static_cast<uint64_t>(0xb14f4c61746e5a5a), /* mkp-Latn-ZZ */
-    static_cast<uint64_t>(0xb1564c61746e5a5a), /* mkw-Latn-ZZ */
-    static_cast<uint64_t>(0x6d6c4d6c796d494e), /* ml-Mlym-IN */
-    static_cast<uint64_t>(0xb1644c61746e5a5a), /* mle-Latn-ZZ */
-    static_cast<uint64_t>(0xb16f4c61746e5a5a), /* mlp-Latn-ZZ */
-    static_cast<uint64_t>(0xb1724c61746e5344), /* mls-Latn-SD */
-    static_cast<uint64_t>(0xb18e4c61746e5a5a), /* mmo-Latn-ZZ */
-    static_cast<uint64_t>(0xb1944c61746e5a5a), /* mmu-Latn-ZZ */
-    static_cast<uint64_t>(0xb1974c61746e5a5a), /* mmx-Latn-ZZ */
-    static_cast<uint64_t>(0x6d6e4379726c4d4e), /* mn-Cyrl-MN */
-    static_cast<uint64_t>(0x6d6e4d6f6e67434e), /* mn-Mong-CN */
-    static_cast<uint64_t>(0x6d6e4d6f6e67434e), /* mn-Mong-CN */
-    static_cast<uint64_t>(0xb1a04c61746e5a5a), /* mna-Latn-ZZ */
-    static_cast<uint64_t>(0xb1a54c61746e5a5a), /* mnf-Latn-ZZ */
-    static_cast<uint64_t>(0xb1a842656e67494e), /* mni-Beng-IN */
-    static_cast<uint64_t>(0xb1b64d796d724d4d), /* mnw-Mymr-MM */
-    static_cast<uint64_t>(0x6d6f4c61746e524f), /* mo-Latn-RO */
-    static_cast<uint64_t>(0xb1c04c61746e5a5a), /* moa-Latn-ZZ */
-    static_cast<uint64_t>(0xb1c44c61746e4341), /* moe-Latn-CA */
-    static_cast<uint64_t>(0xb1c74c61746e4341), /* moh-Latn-CA */
-    static_cast<uint64_t>(0xb1d24c61746e4246), /* mos-Latn-BF */
-    static_cast<uint64_t>(0xb1d74c61746e5a5a), /* mox-Latn-ZZ */
-    static_cast<uint64_t>(0xb1ef4c61746e5a5a), /* mpp-Latn-ZZ */
-    static_cast<uint64_t>(0xb1f24c61746e5a5a), /* mps-Latn-ZZ */
-    static_cast<uint64_t>(0xb1f34c61746e5a5a), /* mpt-Latn-ZZ */
-    static_cast<uint64_t>(0xb1f74c61746e5a5a), /* mpx-Latn-ZZ */
-    static_cast<uint64_t>(0xb20b4c61746e5a5a), /* mql-Latn-ZZ */
-    static_cast<uint64_t>(0x6d7244657661494e), /* mr-Deva-IN */
-    static_cast<uint64_t>(0xb223446576614e50), /* mrd-Deva-NP */
-    static_cast<uint64_t>(0xb2294379726c5255), /* mrj-Cyrl-RU */
-    static_cast<uint64_t>(0xb22e4d726f6f4244), /* mro-Mroo-BD */
-    static_cast<uint64_t>(0x6d734c61746e4d59), /* ms-Latn-MY */
-    static_cast<uint64_t>(0x6d73417261624343), /* ms-Arab-CC */
-    static_cast<uint64_t>(0x6d744c61746e4d54), /* mt-Latn-MT */
-    static_cast<uint64_t>(0xb2624c61746e5a5a), /* mtc-Latn-ZZ */
-    static_cast<uint64_t>(0xb2654c61746e5a5a), /* mtf-Latn-ZZ */
-    static_cast<uint64_t>(0xb2684c61746e5a5a), /* mti-Latn-ZZ */
-    static_cast<uint64_t>(0xb27144657661494e), /* mtr-Deva-IN */
-    static_cast<uint64_t>(0xb2804c61746e434d), /* mua-Latn-CM */
-    static_cast<uint64_t>(0xb2914c61746e5a5a), /* mur-Latn-ZZ */
-    static_cast<uint64_t>(0xb2924c61746e5553), /* mus-Latn-US */
-    static_cast<uint64_t>(0xb2a04c61746e5a5a), /* mva-Latn-ZZ */
-    static_cast<uint64_t>(0xb2ad4c61746e5a5a), /* mvn-Latn-ZZ */
-    static_cast<uint64_t>(0xb2b841726162504b), /* mvy-Arab-PK */
-    static_cast<uint64_t>(0xb2ca4c61746e4d4c), /* mwk-Latn-ML */
-    static_cast<uint64_t>(0xb2d144657661494e), /* mwr-Deva-IN */
-    static_cast<uint64_t>(0xb2d54c61746e4944), /* mwv-Latn-ID */
-    static_cast<uint64_t>(0xb2d6486d6e705553), /* mww-Hmnp-US */
-    static_cast<uint64_t>(0xb2e24c61746e5a57), /* mxc-Latn-ZW */
-    static_cast<uint64_t>(0xb2ec4c61746e5a5a), /* mxm-Latn-ZZ */
-    static_cast<uint64_t>(0x6d794d796d724d4d), /* my-Mymr-MM */
-    static_cast<uint64_t>(0xb30a4c61746e5a5a), /* myk-Latn-ZZ */
-    static_cast<uint64_t>(0xb30c457468695a5a), /* mym-Ethi-ZZ */
-    static_cast<uint64_t>(0xb3154379726c5255), /* myv-Cyrl-RU */
-    static_cast<uint64_t>(0xb3164c61746e5a5a), /* myw-Latn-ZZ */
-    static_cast<uint64_t>(0xb3174c61746e5547), /* myx-Latn-UG */
-    static_cast<uint64_t>(0xb3194d616e644952), /* myz-Mand-IR */
-    static_cast<uint64_t>(0xb32a4c61746e5a5a), /* mzk-Latn-ZZ */
-    static_cast<uint64_t>(0xb32c4c61746e5a5a), /* mzm-Latn-ZZ */
-    static_cast<uint64_t>(0xb32d417261624952), /* mzn-Arab-IR */
-    static_cast<uint64_t>(0xb32f4c61746e5a5a), /* mzp-Latn-ZZ */
-    static_cast<uint64_t>(0xb3364c61746e5a5a), /* mzw-Latn-ZZ */
-    static_cast<uint64_t>(0xb3394c61746e5a5a), /* mzz-Latn-ZZ */
-    static_cast<uint64_t>(0x6e614c61746e4e52), /* na-Latn-NR */
-    static_cast<uint64_t>(0xb4024c61746e5a5a), /* nac-Latn-ZZ */
-    static_cast<uint64_t>(0xb4054c61746e5a5a), /* naf-Latn-ZZ */
-    static_cast<uint64_t>(0xb40a4c61746e5a5a), /* nak-Latn-ZZ */
-    static_cast<uint64_t>(0xb40d48616e73434e), /* nan-Hans-CN */
-    static_cast<uint64_t>(0xb40f4c61746e4954), /* nap-Latn-IT */
-    static_cast<uint64_t>(0xb4104c61746e4e41), /* naq-Latn-NA */
-    static_cast<uint64_t>(0xb4124c61746e5a5a), /* nas-Latn-ZZ */
-    static_cast<uint64_t>(0x6e624c61746e4e4f), /* nb-Latn-NO */
-    static_cast<uint64_t>(0xb4404c61746e5a5a), /* nca-Latn-ZZ */
-    static_cast<uint64_t>(0xb4444c61746e5a5a), /* nce-Latn-ZZ */
-    static_cast<uint64_t>(0xb4454c61746e5a5a), /* ncf-Latn-ZZ */
-    static_cast<uint64_t>(0xb4474c61746e4d58), /* nch-Latn-MX */
-    static_cast<uint64_t>(0xb44e4c61746e5a5a), /* nco-Latn-ZZ */
-    static_cast<uint64_t>(0xb4544c61746e5a5a), /* ncu-Latn-ZZ */
-    static_cast<uint64_t>(0x6e644c61746e5a57), /* nd-Latn-ZW */
-    static_cast<uint64_t>(0xb4624c61746e4d5a), /* ndc-Latn-MZ */
-    static_cast<uint64_t>(0xb4724c61746e4445), /* nds-Latn-DE */
-    static_cast<uint64_t>(0x6e65446576614e50), /* ne-Deva-NP */
-    static_cast<uint64_t>(0xb4814c61746e5a5a), /* neb-Latn-ZZ */
-    static_cast<uint64_t>(0xb496446576614e50), /* new-Deva-NP */
-    static_cast<uint64_t>(0xb4974c61746e5a5a), /* nex-Latn-ZZ */
-    static_cast<uint64_t>(0xb4b14c61746e5a5a), /* nfr-Latn-ZZ */
-    static_cast<uint64_t>(0x6e674c61746e4e41), /* ng-Latn-NA */
-    static_cast<uint64_t>(0xb4c04c61746e5a5a), /* nga-Latn-ZZ */
-    static_cast<uint64_t>(0xb4c14c61746e5a5a), /* ngb-Latn-ZZ */
-    static_cast<uint64_t>(0xb4cb4c61746e4d5a), /* ngl-Latn-MZ */
-    static_cast<uint64_t>(0xb4e14c61746e5a5a), /* nhb-Latn-ZZ */
-    static_cast<uint64_t>(0xb4e44c61746e4d58), /* nhe-Latn-MX */
-    static_cast<uint64_t>(0xb4f64c61746e4d58), /* nhw-Latn-MX */
-    static_cast<uint64_t>(0xb5054c61746e5a5a), /* nif-Latn-ZZ */
-    static_cast<uint64_t>(0xb5084c61746e5a5a), /* nii-Latn-ZZ */
-    static_cast<uint64_t>(0xb5094c61746e4944), /* nij-Latn-ID */
-    static_cast<uint64_t>(0xb50d4c61746e5a5a), /* nin-Latn-ZZ */
-    static_cast<uint64_t>(0xb5144c61746e4e55), /* niu-Latn-NU */
-    static_cast<uint64_t>(0xb5184c61746e5a5a), /* niy-Latn-ZZ */
-    static_cast<uint64_t>(0xb5194c61746e5a5a), /* niz-Latn-ZZ */
-    static_cast<uint64_t>(0xb52e4c61746e494e), /* njo-Latn-IN */
-    static_cast<uint64_t>(0xb5464c61746e5a5a), /* nkg-Latn-ZZ */
-    static_cast<uint64_t>(0xb54e4c61746e5a5a), /* nko-Latn-ZZ */
-    static_cast<uint64_t>(0x6e6c4c61746e4e4c), /* nl-Latn-NL */
-    static_cast<uint64_t>(0xb5864c61746e434d), /* nmg-Latn-CM */
-    static_cast<uint64_t>(0xb5994c61746e5a5a), /* nmz-Latn-ZZ */
-    static_cast<uint64_t>(0x6e6e4c61746e4e4f), /* nn-Latn-NO */
-    static_cast<uint64_t>(0xb5a54c61746e5a5a), /* nnf-Latn-ZZ */
-    static_cast<uint64_t>(0xb5a74c61746e434d), /* nnh-Latn-CM */
-    static_cast<uint64_t>(0xb5aa4c61746e5a5a), /* nnk-Latn-ZZ */
-    static_cast<uint64_t>(0xb5ac4c61746e5a5a), /* nnm-Latn-ZZ */
-    static_cast<uint64_t>(0xb5af5763686f494e), /* nnp-Wcho-IN */
-    static_cast<uint64_t>(0x6e6f4c61746e4e4f), /* no-Latn-NO */
-    static_cast<uint64_t>(0xb5c34c616e615448), /* nod-Lana-TH */
-    static_cast<uint64_t>(0xb5c444657661494e), /* noe-Deva-IN */
-    static_cast<uint64_t>(0xb5cd52756e725345), /* non-Runr-SE */
-    static_cast<uint64_t>(0xb5cf4c61746e5a5a), /* nop-Latn-ZZ */
-    static_cast<uint64_t>(0xb5d44c61746e5a5a), /* nou-Latn-ZZ */
-    static_cast<uint64_t>(0xb60e4e6b6f6f474e), /* nqo-Nkoo-GN */
-    static_cast<uint64_t>(0x6e724c61746e5a41), /* nr-Latn-ZA */
-    static_cast<uint64_t>(0xb6214c61746e5a5a), /* nrb-Latn-ZZ */
-    static_cast<uint64_t>(0xb64a43616e734341), /* nsk-Cans-CA */
-    static_cast<uint64_t>(0xb64d4c61746e5a5a), /* nsn-Latn-ZZ */
-    static_cast<uint64_t>(0xb64e4c61746e5a41), /* nso-Latn-ZA */
-    static_cast<uint64_t>(0xb6524c61746e5a5a), /* nss-Latn-ZZ */
-    static_cast<uint64_t>(0xb66c4c61746e5a5a), /* ntm-Latn-ZZ */
-    static_cast<uint64_t>(0xb6714c61746e5a5a), /* ntr-Latn-ZZ */
-    static_cast<uint64_t>(0xb6884c61746e5a5a), /* nui-Latn-ZZ */
-    static_cast<uint64_t>(0xb68f4c61746e5a5a), /* nup-Latn-ZZ */
-    static_cast<uint64_t>(0xb6924c61746e5353), /* nus-Latn-SS */
-    static_cast<uint64_t>(0xb6954c61746e5a5a), /* nuv-Latn-ZZ */
-    static_cast<uint64_t>(0xb6974c61746e5a5a), /* nux-Latn-ZZ */
-    static_cast<uint64_t>(0x6e764c61746e5553), /* nv-Latn-US */
-    static_cast<uint64_t>(0xb6c14c61746e5a5a), /* nwb-Latn-ZZ */
-    static_cast<uint64_t>(0xb6f04c61746e434e), /* nxq-Latn-CN */
-    static_cast<uint64_t>(0xb6f14c61746e5a5a), /* nxr-Latn-ZZ */
-    static_cast<uint64_t>(0x6e794c61746e4d57), /* ny-Latn-MW */
-    static_cast<uint64_t>(0xb70c4c61746e545a), /* nym-Latn-TZ */
-    static_cast<uint64_t>(0xb70d4c61746e5547), /* nyn-Latn-UG */
-    static_cast<uint64_t>(0xb7284c61746e4748), /* nzi-Latn-GH */
-    static_cast<uint64_t>(0x6f634c61746e4652), /* oc-Latn-FR */
-    static_cast<uint64_t>(0xb8c24c61746e5a5a), /* ogc-Latn-ZZ */
-    static_cast<uint64_t>(0xb9514c61746e5a5a), /* okr-Latn-ZZ */
-    static_cast<uint64_t>(0xb9554c61746e5a5a), /* okv-Latn-ZZ */
-    static_cast<uint64_t>(0x6f6d4c61746e4554), /* om-Latn-ET */
-    static_cast<uint64_t>(0xb9a64c61746e5a5a), /* ong-Latn-ZZ */
-    static_cast<uint64_t>(0xb9ad4c61746e5a5a), /* onn-Latn-ZZ */
-    static_cast<uint64_t>(0xb9b24c61746e5a5a), /* ons-Latn-ZZ */
-    static_cast<uint64_t>(0xb9ec4c61746e5a5a), /* opm-Latn-ZZ */
-    static_cast<uint64_t>(0x6f724f727961494e), /* or-Orya-IN */
-    static_cast<uint64_t>(0xba2e4c61746e5a5a), /* oro-Latn-ZZ */
-    static_cast<uint64_t>(0xba34417261625a5a), /* oru-Arab-ZZ */
-    static_cast<uint64_t>(0x6f734379726c4745), /* os-Cyrl-GE */
-    static_cast<uint64_t>(0xba404f7367655553), /* osa-Osge-US */
-    static_cast<uint64_t>(0xba60417261625a5a), /* ota-Arab-ZZ */
-    static_cast<uint64_t>(0xba6a4f726b684d4e), /* otk-Orkh-MN */
-    static_cast<uint64_t>(0xbb2c4c61746e5a5a), /* ozm-Latn-ZZ */
-    static_cast<uint64_t>(0x706147757275494e), /* pa-Guru-IN */
-    static_cast<uint64_t>(0x706141726162504b), /* pa-Arab-PK */
-    static_cast<uint64_t>(0x706141726162504b), /* pa-Arab-PK */
-    static_cast<uint64_t>(0xbc064c61746e5048), /* pag-Latn-PH */
-    static_cast<uint64_t>(0xbc0b50686c694952), /* pal-Phli-IR */
-    static_cast<uint64_t>(0xbc0b50686c70434e), /* pal-Phlp-CN */
-    static_cast<uint64_t>(0xbc0c4c61746e5048), /* pam-Latn-PH */
-    static_cast<uint64_t>(0xbc0f4c61746e4157), /* pap-Latn-AW */
-    static_cast<uint64_t>(0xbc144c61746e5057), /* pau-Latn-PW */
-    static_cast<uint64_t>(0xbc284c61746e5a5a), /* pbi-Latn-ZZ */
-    static_cast<uint64_t>(0xbc434c61746e4652), /* pcd-Latn-FR */
-    static_cast<uint64_t>(0xbc4c4c61746e4e47), /* pcm-Latn-NG */
-    static_cast<uint64_t>(0xbc624c61746e5553), /* pdc-Latn-US */
-    static_cast<uint64_t>(0xbc734c61746e4341), /* pdt-Latn-CA */
-    static_cast<uint64_t>(0xbc834c61746e5a5a), /* ped-Latn-ZZ */
-    static_cast<uint64_t>(0xbc8e5870656f4952), /* peo-Xpeo-IR */
-    static_cast<uint64_t>(0xbc974c61746e5a5a), /* pex-Latn-ZZ */
-    static_cast<uint64_t>(0xbcab4c61746e4445), /* pfl-Latn-DE */
-    static_cast<uint64_t>(0xbceb417261625a5a), /* phl-Arab-ZZ */
-    static_cast<uint64_t>(0xbced50686e784c42), /* phn-Phnx-LB */
-    static_cast<uint64_t>(0xbd0b4c61746e5a5a), /* pil-Latn-ZZ */
-    static_cast<uint64_t>(0xbd0f4c61746e5a5a), /* pip-Latn-ZZ */
-    static_cast<uint64_t>(0xbd4042726168494e), /* pka-Brah-IN */
-    static_cast<uint64_t>(0xbd4e4c61746e4b45), /* pko-Latn-KE */
-    static_cast<uint64_t>(0x706c4c61746e504c), /* pl-Latn-PL */
-    static_cast<uint64_t>(0xbd604c61746e5a5a), /* pla-Latn-ZZ */
-    static_cast<uint64_t>(0xbd924c61746e4954), /* pms-Latn-IT */
-    static_cast<uint64_t>(0xbda64c61746e5a5a), /* png-Latn-ZZ */
-    static_cast<uint64_t>(0xbdad4c61746e5a5a), /* pnn-Latn-ZZ */
-    static_cast<uint64_t>(0xbdb34772656b4752), /* pnt-Grek-GR */
-    static_cast<uint64_t>(0xbdcd4c61746e464d), /* pon-Latn-FM */
-    static_cast<uint64_t>(0xbde044657661494e), /* ppa-Deva-IN */
-    static_cast<uint64_t>(0xbdee4c61746e5a5a), /* ppo-Latn-ZZ */
-    static_cast<uint64_t>(0xbe204b686172504b), /* pra-Khar-PK */
-    static_cast<uint64_t>(0xbe23417261624952), /* prd-Arab-IR */
-    static_cast<uint64_t>(0xbe264c61746e8001), /* prg-Latn-001 */
-    static_cast<uint64_t>(0x7073417261624146), /* ps-Arab-AF */
-    static_cast<uint64_t>(0xbe524c61746e5a5a), /* pss-Latn-ZZ */
-    static_cast<uint64_t>(0x70744c61746e4252), /* pt-Latn-BR */
-    static_cast<uint64_t>(0xbe6f4c61746e5a5a), /* ptp-Latn-ZZ */
-    static_cast<uint64_t>(0xbe944c61746e4741), /* puu-Latn-GA */
-    static_cast<uint64_t>(0xbec04c61746e5a5a), /* pwa-Latn-ZZ */
-    static_cast<uint64_t>(0x71754c61746e5045), /* qu-Latn-PE */
-    static_cast<uint64_t>(0xc2824c61746e4754), /* quc-Latn-GT */
-    static_cast<uint64_t>(0xc2864c61746e4543), /* qug-Latn-EC */
-    static_cast<uint64_t>(0xc4084c61746e5a5a), /* rai-Latn-ZZ */
-    static_cast<uint64_t>(0xc40944657661494e), /* raj-Deva-IN */
-    static_cast<uint64_t>(0xc40e4c61746e5a5a), /* rao-Latn-ZZ */
-    static_cast<uint64_t>(0xc4454c61746e5245), /* rcf-Latn-RE */
-    static_cast<uint64_t>(0xc4894c61746e4944), /* rej-Latn-ID */
-    static_cast<uint64_t>(0xc48b4c61746e5a5a), /* rel-Latn-ZZ */
-    static_cast<uint64_t>(0xc4924c61746e5a5a), /* res-Latn-ZZ */
-    static_cast<uint64_t>(0xc4cd4c61746e4954), /* rgn-Latn-IT */
-    static_cast<uint64_t>(0xc4e6417261624d4d), /* rhg-Arab-MM */
-    static_cast<uint64_t>(0xc5004c61746e494e), /* ria-Latn-IN */
-    static_cast<uint64_t>(0xc50554666e674d41), /* rif-Tfng-MA */
-    static_cast<uint64_t>(0xc5054c61746e4e4c), /* rif-Latn-NL */
-    static_cast<uint64_t>(0xc532446576614e50), /* rjs-Deva-NP */
-    static_cast<uint64_t>(0xc55342656e674244), /* rkt-Beng-BD */
-    static_cast<uint64_t>(0x726d4c61746e4348), /* rm-Latn-CH */
-    static_cast<uint64_t>(0xc5854c61746e4649), /* rmf-Latn-FI */
-    static_cast<uint64_t>(0xc58e4c61746e4348), /* rmo-Latn-CH */
-    static_cast<uint64_t>(0xc593417261624952), /* rmt-Arab-IR */
-    static_cast<uint64_t>(0xc5944c61746e5345), /* rmu-Latn-SE */
-    static_cast<uint64_t>(0x726e4c61746e4249), /* rn-Latn-BI */
-    static_cast<uint64_t>(0xc5a04c61746e5a5a), /* rna-Latn-ZZ */
-    static_cast<uint64_t>(0xc5a64c61746e4d5a), /* rng-Latn-MZ */
-    static_cast<uint64_t>(0x726f4c61746e524f), /* ro-Latn-RO */
-    static_cast<uint64_t>(0xc5c14c61746e4944), /* rob-Latn-ID */
-    static_cast<uint64_t>(0xc5c54c61746e545a), /* rof-Latn-TZ */
-    static_cast<uint64_t>(0xc5ce4c61746e5a5a), /* roo-Latn-ZZ */
-    static_cast<uint64_t>(0xc62e4c61746e5a5a), /* rro-Latn-ZZ */
-    static_cast<uint64_t>(0xc66c4c61746e464a), /* rtm-Latn-FJ */
-    static_cast<uint64_t>(0x72754379726c5255), /* ru-Cyrl-RU */
-    static_cast<uint64_t>(0xc6844379726c5541), /* rue-Cyrl-UA */
-    static_cast<uint64_t>(0xc6864c61746e5342), /* rug-Latn-SB */
-    static_cast<uint64_t>(0x72774c61746e5257), /* rw-Latn-RW */
-    static_cast<uint64_t>(0xc6ca4c61746e545a), /* rwk-Latn-TZ */
-    static_cast<uint64_t>(0xc6ce4c61746e5a5a), /* rwo-Latn-ZZ */
-    static_cast<uint64_t>(0xc7144b616e614a50), /* ryu-Kana-JP */
-    static_cast<uint64_t>(0x736144657661494e), /* sa-Deva-IN */
-    static_cast<uint64_t>(0xc8054c61746e4748), /* saf-Latn-GH */
-    static_cast<uint64_t>(0xc8074379726c5255), /* sah-Cyrl-RU */
-    static_cast<uint64_t>(0xc8104c61746e4b45), /* saq-Latn-KE */
-    static_cast<uint64_t>(0xc8124c61746e4944), /* sas-Latn-ID */
-    static_cast<uint64_t>(0xc8134f6c636b494e), /* sat-Olck-IN */
-    static_cast<uint64_t>(0xc8154c61746e534e), /* sav-Latn-SN */
-    static_cast<uint64_t>(0xc81953617572494e), /* saz-Saur-IN */
-    static_cast<uint64_t>(0xc8204c61746e5a5a), /* sba-Latn-ZZ */
-    static_cast<uint64_t>(0xc8244c61746e5a5a), /* sbe-Latn-ZZ */
-    static_cast<uint64_t>(0xc82f4c61746e545a), /* sbp-Latn-TZ */
-    static_cast<uint64_t>(0x73634c61746e4954), /* sc-Latn-IT */
-    static_cast<uint64_t>(0xc84a44657661494e), /* sck-Deva-IN */
-    static_cast<uint64_t>(0xc84b417261625a5a), /* scl-Arab-ZZ */
-    static_cast<uint64_t>(0xc84d4c61746e4954), /* scn-Latn-IT */
-    static_cast<uint64_t>(0xc84e4c61746e4742), /* sco-Latn-GB */
-    static_cast<uint64_t>(0xc8524c61746e4341), /* scs-Latn-CA */
-    static_cast<uint64_t>(0x736441726162504b), /* sd-Arab-PK */
-    static_cast<uint64_t>(0x736444657661494e), /* sd-Deva-IN */
-    static_cast<uint64_t>(0x73644b686f6a494e), /* sd-Khoj-IN */
-    static_cast<uint64_t>(0x736453696e64494e), /* sd-Sind-IN */
-    static_cast<uint64_t>(0xc8624c61746e4954), /* sdc-Latn-IT */
-    static_cast<uint64_t>(0xc867417261624952), /* sdh-Arab-IR */
-    static_cast<uint64_t>(0x73654c61746e4e4f), /* se-Latn-NO */
-    static_cast<uint64_t>(0xc8854c61746e4349), /* sef-Latn-CI */
-    static_cast<uint64_t>(0xc8874c61746e4d5a), /* seh-Latn-MZ */
-    static_cast<uint64_t>(0xc8884c61746e4d58), /* sei-Latn-MX */
-    static_cast<uint64_t>(0xc8924c61746e4d4c), /* ses-Latn-ML */
-    static_cast<uint64_t>(0x73674c61746e4346), /* sg-Latn-CF */
-    static_cast<uint64_t>(0xc8c04f67616d4945), /* sga-Ogam-IE */
-    static_cast<uint64_t>(0xc8d24c61746e4c54), /* sgs-Latn-LT */
-    static_cast<uint64_t>(0xc8d6457468695a5a), /* sgw-Ethi-ZZ */
-    static_cast<uint64_t>(0xc8d94c61746e5a5a), /* sgz-Latn-ZZ */
-    static_cast<uint64_t>(0xc8e854666e674d41), /* shi-Tfng-MA */
-    static_cast<uint64_t>(0xc8ea4c61746e5a5a), /* shk-Latn-ZZ */
-    static_cast<uint64_t>(0xc8ed4d796d724d4d), /* shn-Mymr-MM */
-    static_cast<uint64_t>(0xc8f4417261625a5a), /* shu-Arab-ZZ */
-    static_cast<uint64_t>(0x736953696e684c4b), /* si-Sinh-LK */
-    static_cast<uint64_t>(0xc9034c61746e4554), /* sid-Latn-ET */
-    static_cast<uint64_t>(0xc9064c61746e5a5a), /* sig-Latn-ZZ */
-    static_cast<uint64_t>(0xc90b4c61746e5a5a), /* sil-Latn-ZZ */
-    static_cast<uint64_t>(0xc90c4c61746e5a5a), /* sim-Latn-ZZ */
-    static_cast<uint64_t>(0xc9314c61746e5a5a), /* sjr-Latn-ZZ */
-    static_cast<uint64_t>(0x736b4c61746e534b), /* sk-Latn-SK */
-    static_cast<uint64_t>(0xc9424c61746e5a5a), /* skc-Latn-ZZ */
-    static_cast<uint64_t>(0xc95141726162504b), /* skr-Arab-PK */
-    static_cast<uint64_t>(0xc9524c61746e5a5a), /* sks-Latn-ZZ */
-    static_cast<uint64_t>(0x736c4c61746e5349), /* sl-Latn-SI */
-    static_cast<uint64_t>(0xc9634c61746e5a5a), /* sld-Latn-ZZ */
-    static_cast<uint64_t>(0xc9684c61746e504c), /* sli-Latn-PL */
-    static_cast<uint64_t>(0xc96b4c61746e5a5a), /* sll-Latn-ZZ */
-    static_cast<uint64_t>(0xc9784c61746e4944), /* sly-Latn-ID */
-    static_cast<uint64_t>(0x736d4c61746e5753), /* sm-Latn-WS */
-    static_cast<uint64_t>(0xc9804c61746e5345), /* sma-Latn-SE */
-    static_cast<uint64_t>(0xc9894c61746e5345), /* smj-Latn-SE */
-    static_cast<uint64_t>(0xc98d4c61746e4649), /* smn-Latn-FI */
-    static_cast<uint64_t>(0xc98f53616d72494c), /* smp-Samr-IL */
-    static_cast<uint64_t>(0xc9904c61746e5a5a), /* smq-Latn-ZZ */
-    static_cast<uint64_t>(0xc9924c61746e4649), /* sms-Latn-FI */
-    static_cast<uint64_t>(0x736e4c61746e5a57), /* sn-Latn-ZW */
-    static_cast<uint64_t>(0xc9a24c61746e5a5a), /* snc-Latn-ZZ */
-    static_cast<uint64_t>(0xc9aa4c61746e4d4c), /* snk-Latn-ML */
-    static_cast<uint64_t>(0xc9af4c61746e5a5a), /* snp-Latn-ZZ */
-    static_cast<uint64_t>(0xc9b74c61746e5a5a), /* snx-Latn-ZZ */
-    static_cast<uint64_t>(0xc9b84c61746e5a5a), /* sny-Latn-ZZ */
-    static_cast<uint64_t>(0x736f4c61746e534f), /* so-Latn-SO */
-    static_cast<uint64_t>(0xc9c6536f6764555a), /* sog-Sogd-UZ */
-    static_cast<uint64_t>(0xc9ca4c61746e5a5a), /* sok-Latn-ZZ */
-    static_cast<uint64_t>(0xc9d04c61746e5a5a), /* soq-Latn-ZZ */
-    static_cast<uint64_t>(0xc9d4546861695448), /* sou-Thai-TH */
-    static_cast<uint64_t>(0xc9d84c61746e5a5a), /* soy-Latn-ZZ */
-    static_cast<uint64_t>(0xc9e34c61746e5a5a), /* spd-Latn-ZZ */
-    static_cast<uint64_t>(0xc9eb4c61746e5a5a), /* spl-Latn-ZZ */
-    static_cast<uint64_t>(0xc9f24c61746e5a5a), /* sps-Latn-ZZ */
-    static_cast<uint64_t>(0x73714c61746e414c), /* sq-Latn-AL */
-    static_cast<uint64_t>(0x73724379726c5253), /* sr-Cyrl-RS */
-    static_cast<uint64_t>(0x73724c61746e4d45), /* sr-Latn-ME */
-    static_cast<uint64_t>(0x73724c61746e524f), /* sr-Latn-RO */
-    static_cast<uint64_t>(0x73724c61746e5255), /* sr-Latn-RU */
-    static_cast<uint64_t>(0x73724c61746e5452), /* sr-Latn-TR */
-    static_cast<uint64_t>(0xca21536f7261494e), /* srb-Sora-IN */
-    static_cast<uint64_t>(0xca2d4c61746e5352), /* srn-Latn-SR */
-    static_cast<uint64_t>(0xca314c61746e534e), /* srr-Latn-SN */
-    static_cast<uint64_t>(0xca3744657661494e), /* srx-Deva-IN */
-    static_cast<uint64_t>(0x73734c61746e5a41), /* ss-Latn-ZA */
-    static_cast<uint64_t>(0xca434c61746e5a5a), /* ssd-Latn-ZZ */
-    static_cast<uint64_t>(0xca464c61746e5a5a), /* ssg-Latn-ZZ */
-    static_cast<uint64_t>(0xca584c61746e4552), /* ssy-Latn-ER */
-    static_cast<uint64_t>(0x73744c61746e5a41), /* st-Latn-ZA */
-    static_cast<uint64_t>(0xca6a4c61746e5a5a), /* stk-Latn-ZZ */
-    static_cast<uint64_t>(0xca704c61746e4445), /* stq-Latn-DE */
-    static_cast<uint64_t>(0x73754c61746e4944), /* su-Latn-ID */
-    static_cast<uint64_t>(0xca804c61746e5a5a), /* sua-Latn-ZZ */
-    static_cast<uint64_t>(0xca844c61746e5a5a), /* sue-Latn-ZZ */
-    static_cast<uint64_t>(0xca8a4c61746e545a), /* suk-Latn-TZ */
-    static_cast<uint64_t>(0xca914c61746e5a5a), /* sur-Latn-ZZ */
-    static_cast<uint64_t>(0xca924c61746e474e), /* sus-Latn-GN */
-    static_cast<uint64_t>(0x73764c61746e5345), /* sv-Latn-SE */
-    static_cast<uint64_t>(0x73774c61746e545a), /* sw-Latn-TZ */
-    static_cast<uint64_t>(0xcac1417261625954), /* swb-Arab-YT */
-    static_cast<uint64_t>(0xcac24c61746e4344), /* swc-Latn-CD */
-    static_cast<uint64_t>(0xcac64c61746e4445), /* swg-Latn-DE */
-    static_cast<uint64_t>(0xcacf4c61746e5a5a), /* swp-Latn-ZZ */
-    static_cast<uint64_t>(0xcad544657661494e), /* swv-Deva-IN */
-    static_cast<uint64_t>(0xcaed4c61746e4944), /* sxn-Latn-ID */
-    static_cast<uint64_t>(0xcaf64c61746e5a5a), /* sxw-Latn-ZZ */
-    static_cast<uint64_t>(0xcb0b42656e674244), /* syl-Beng-BD */
-    static_cast<uint64_t>(0xcb11537972634951), /* syr-Syrc-IQ */
-    static_cast<uint64_t>(0xcb2b4c61746e504c), /* szl-Latn-PL */
-    static_cast<uint64_t>(0x746154616d6c494e), /* ta-Taml-IN */
-    static_cast<uint64_t>(0xcc09446576614e50), /* taj-Deva-NP */
-    static_cast<uint64_t>(0xcc0b4c61746e5a5a), /* tal-Latn-ZZ */
-    static_cast<uint64_t>(0xcc0d4c61746e5a5a), /* tan-Latn-ZZ */
-    static_cast<uint64_t>(0xcc104c61746e5a5a), /* taq-Latn-ZZ */
-    static_cast<uint64_t>(0xcc224c61746e5a5a), /* tbc-Latn-ZZ */
-    static_cast<uint64_t>(0xcc234c61746e5a5a), /* tbd-Latn-ZZ */
-    static_cast<uint64_t>(0xcc254c61746e5a5a), /* tbf-Latn-ZZ */
-    static_cast<uint64_t>(0xcc264c61746e5a5a), /* tbg-Latn-ZZ */
-    static_cast<uint64_t>(0xcc2e4c61746e5a5a), /* tbo-Latn-ZZ */
-    static_cast<uint64_t>(0xcc364c61746e5048), /* tbw-Latn-PH */
-    static_cast<uint64_t>(0xcc394c61746e5a5a), /* tbz-Latn-ZZ */
-    static_cast<uint64_t>(0xcc484c61746e5a5a), /* tci-Latn-ZZ */
-    static_cast<uint64_t>(0xcc584b6e6461494e), /* tcy-Knda-IN */
-    static_cast<uint64_t>(0xcc6354616c65434e), /* tdd-Tale-CN */
-    static_cast<uint64_t>(0xcc66446576614e50), /* tdg-Deva-NP */
-    static_cast<uint64_t>(0xcc67446576614e50), /* tdh-Deva-NP */
-    static_cast<uint64_t>(0xcc744c61746e4d59), /* tdu-Latn-MY */
-    static_cast<uint64_t>(0x746554656c75494e), /* te-Telu-IN */
-    static_cast<uint64_t>(0xcc834c61746e5a5a), /* ted-Latn-ZZ */
-    static_cast<uint64_t>(0xcc8c4c61746e534c), /* tem-Latn-SL */
-    static_cast<uint64_t>(0xcc8e4c61746e5547), /* teo-Latn-UG */
-    static_cast<uint64_t>(0xcc934c61746e544c), /* tet-Latn-TL */
-    static_cast<uint64_t>(0xcca84c61746e5a5a), /* tfi-Latn-ZZ */
-    static_cast<uint64_t>(0x74674379726c544a), /* tg-Cyrl-TJ */
-    static_cast<uint64_t>(0x746741726162504b), /* tg-Arab-PK */
-    static_cast<uint64_t>(0x746741726162504b), /* tg-Arab-PK */
-    static_cast<uint64_t>(0xccc24c61746e5a5a), /* tgc-Latn-ZZ */
-    static_cast<uint64_t>(0xccce4c61746e5a5a), /* tgo-Latn-ZZ */
-    static_cast<uint64_t>(0xccd44c61746e5a5a), /* tgu-Latn-ZZ */
-    static_cast<uint64_t>(0x7468546861695448), /* th-Thai-TH */
-    static_cast<uint64_t>(0xcceb446576614e50), /* thl-Deva-NP */
-    static_cast<uint64_t>(0xccf0446576614e50), /* thq-Deva-NP */
-    static_cast<uint64_t>(0xccf1446576614e50), /* thr-Deva-NP */
-    static_cast<uint64_t>(0x7469457468694554), /* ti-Ethi-ET */
-    static_cast<uint64_t>(0xcd054c61746e5a5a), /* tif-Latn-ZZ */
-    static_cast<uint64_t>(0xcd06457468694552), /* tig-Ethi-ER */
-    static_cast<uint64_t>(0xcd0a4c61746e5a5a), /* tik-Latn-ZZ */
-    static_cast<uint64_t>(0xcd0c4c61746e5a5a), /* tim-Latn-ZZ */
-    static_cast<uint64_t>(0xcd0e4c61746e5a5a), /* tio-Latn-ZZ */
-    static_cast<uint64_t>(0xcd154c61746e4e47), /* tiv-Latn-NG */
-    static_cast<uint64_t>(0x746b4c61746e544d), /* tk-Latn-TM */
-    static_cast<uint64_t>(0xcd4b4c61746e544b), /* tkl-Latn-TK */
-    static_cast<uint64_t>(0xcd514c61746e415a), /* tkr-Latn-AZ */
-    static_cast<uint64_t>(0xcd53446576614e50), /* tkt-Deva-NP */
-    static_cast<uint64_t>(0x746c4c61746e5048), /* tl-Latn-PH */
-    static_cast<uint64_t>(0xcd654c61746e5a5a), /* tlf-Latn-ZZ */
-    static_cast<uint64_t>(0xcd774c61746e5a5a), /* tlx-Latn-ZZ */
-    static_cast<uint64_t>(0xcd784c61746e415a), /* tly-Latn-AZ */
-    static_cast<uint64_t>(0xcd874c61746e4e45), /* tmh-Latn-NE */
-    static_cast<uint64_t>(0xcd984c61746e5a5a), /* tmy-Latn-ZZ */
-    static_cast<uint64_t>(0x746e4c61746e5a41), /* tn-Latn-ZA */
-    static_cast<uint64_t>(0xcda74c61746e5a5a), /* tnh-Latn-ZZ */
-    static_cast<uint64_t>(0x746f4c61746e544f), /* to-Latn-TO */
-    static_cast<uint64_t>(0xcdc54c61746e5a5a), /* tof-Latn-ZZ */
-    static_cast<uint64_t>(0xcdc64c61746e4d57), /* tog-Latn-MW */
-    static_cast<uint64_t>(0xcdd04c61746e5a5a), /* toq-Latn-ZZ */
-    static_cast<uint64_t>(0xcde84c61746e5047), /* tpi-Latn-PG */
-    static_cast<uint64_t>(0xcdec4c61746e5a5a), /* tpm-Latn-ZZ */
-    static_cast<uint64_t>(0xcdf94c61746e5a5a), /* tpz-Latn-ZZ */
-    static_cast<uint64_t>(0xce0e4c61746e5a5a), /* tqo-Latn-ZZ */
-    static_cast<uint64_t>(0x74724c61746e5452), /* tr-Latn-TR */
-    static_cast<uint64_t>(0xce344c61746e5452), /* tru-Latn-TR */
-    static_cast<uint64_t>(0xce354c61746e5457), /* trv-Latn-TW */
-    static_cast<uint64_t>(0xce3641726162504b), /* trw-Arab-PK */
-    static_cast<uint64_t>(0x74734c61746e5a41), /* ts-Latn-ZA */
-    static_cast<uint64_t>(0xce434772656b4752), /* tsd-Grek-GR */
-    static_cast<uint64_t>(0xce45446576614e50), /* tsf-Deva-NP */
-    static_cast<uint64_t>(0xce464c61746e5048), /* tsg-Latn-PH */
-    static_cast<uint64_t>(0xce49546962744254), /* tsj-Tibt-BT */
-    static_cast<uint64_t>(0xce564c61746e5a5a), /* tsw-Latn-ZZ */
-    static_cast<uint64_t>(0x74744379726c5255), /* tt-Cyrl-RU */
-    static_cast<uint64_t>(0xce634c61746e5a5a), /* ttd-Latn-ZZ */
-    static_cast<uint64_t>(0xce644c61746e5a5a), /* tte-Latn-ZZ */
-    static_cast<uint64_t>(0xce694c61746e5547), /* ttj-Latn-UG */
-    static_cast<uint64_t>(0xce714c61746e5a5a), /* ttr-Latn-ZZ */
-    static_cast<uint64_t>(0xce72546861695448), /* tts-Thai-TH */
-    static_cast<uint64_t>(0xce734c61746e415a), /* ttt-Latn-AZ */
-    static_cast<uint64_t>(0xce874c61746e5a5a), /* tuh-Latn-ZZ */
-    static_cast<uint64_t>(0xce8b4c61746e5a5a), /* tul-Latn-ZZ */
-    static_cast<uint64_t>(0xce8c4c61746e4d57), /* tum-Latn-MW */
-    static_cast<uint64_t>(0xce904c61746e5a5a), /* tuq-Latn-ZZ */
-    static_cast<uint64_t>(0xcea34c61746e5a5a), /* tvd-Latn-ZZ */
-    static_cast<uint64_t>(0xceab4c61746e5456), /* tvl-Latn-TV */
-    static_cast<uint64_t>(0xceb44c61746e5a5a), /* tvu-Latn-ZZ */
-    static_cast<uint64_t>(0xcec74c61746e5a5a), /* twh-Latn-ZZ */
-    static_cast<uint64_t>(0xced04c61746e4e45), /* twq-Latn-NE */
-    static_cast<uint64_t>(0xcee654616e67434e), /* txg-Tang-CN */
-    static_cast<uint64_t>(0x74794c61746e5046), /* ty-Latn-PF */
-    static_cast<uint64_t>(0xcf004c61746e5a5a), /* tya-Latn-ZZ */
-    static_cast<uint64_t>(0xcf154379726c5255), /* tyv-Cyrl-RU */
-    static_cast<uint64_t>(0xcf2c4c61746e4d41), /* tzm-Latn-MA */
-    static_cast<uint64_t>(0xd0344c61746e5a5a), /* ubu-Latn-ZZ */
-    static_cast<uint64_t>(0xd06c4379726c5255), /* udm-Cyrl-RU */
-    static_cast<uint64_t>(0x756741726162434e), /* ug-Arab-CN */
-    static_cast<uint64_t>(0x75674379726c4b5a), /* ug-Cyrl-KZ */
-    static_cast<uint64_t>(0x75674379726c4b5a), /* ug-Cyrl-KZ */
-    static_cast<uint64_t>(0x75674379726c4d4e), /* ug-Cyrl-MN */
-    static_cast<uint64_t>(0xd0c0556761725359), /* uga-Ugar-SY */
-    static_cast<uint64_t>(0x756b4379726c5541), /* uk-Cyrl-UA */
-    static_cast<uint64_t>(0xd1684c61746e464d), /* uli-Latn-FM */
-    static_cast<uint64_t>(0xd1814c61746e414f), /* umb-Latn-AO */
-    static_cast<uint64_t>(0xd1b142656e67494e), /* unr-Beng-IN */
-    static_cast<uint64_t>(0xd1b1446576614e50), /* unr-Deva-NP */
-    static_cast<uint64_t>(0xd1b1446576614e50), /* unr-Deva-NP */
-    static_cast<uint64_t>(0xd1b742656e67494e), /* unx-Beng-IN */
-    static_cast<uint64_t>(0xd1ca4c61746e5a5a), /* uok-Latn-ZZ */
-    static_cast<uint64_t>(0x757241726162504b), /* ur-Arab-PK */
-    static_cast<uint64_t>(0xd2284c61746e5a5a), /* uri-Latn-ZZ */
-    static_cast<uint64_t>(0xd2334c61746e5a5a), /* urt-Latn-ZZ */
-    static_cast<uint64_t>(0xd2364c61746e5a5a), /* urw-Latn-ZZ */
-    static_cast<uint64_t>(0xd2404c61746e5a5a), /* usa-Latn-ZZ */
-    static_cast<uint64_t>(0xd2674c61746e5a5a), /* uth-Latn-ZZ */
-    static_cast<uint64_t>(0xd2714c61746e5a5a), /* utr-Latn-ZZ */
-    static_cast<uint64_t>(0xd2a74c61746e5a5a), /* uvh-Latn-ZZ */
-    static_cast<uint64_t>(0xd2ab4c61746e5a5a), /* uvl-Latn-ZZ */
-    static_cast<uint64_t>(0x757a4c61746e555a), /* uz-Latn-UZ */
-    static_cast<uint64_t>(0x757a417261624146), /* uz-Arab-AF */
-    static_cast<uint64_t>(0x757a417261624146), /* uz-Arab-AF */
-    static_cast<uint64_t>(0x757a4379726c434e), /* uz-Cyrl-CN */
-    static_cast<uint64_t>(0xd4064c61746e5a5a), /* vag-Latn-ZZ */
-    static_cast<uint64_t>(0xd408566169694c52), /* vai-Vaii-LR */
-    static_cast<uint64_t>(0xd40d4c61746e5a5a), /* van-Latn-ZZ */
-    static_cast<uint64_t>(0x76654c61746e5a41), /* ve-Latn-ZA */
-    static_cast<uint64_t>(0xd4824c61746e4954), /* vec-Latn-IT */
-    static_cast<uint64_t>(0xd48f4c61746e5255), /* vep-Latn-RU */
-    static_cast<uint64_t>(0x76694c61746e564e), /* vi-Latn-VN */
-    static_cast<uint64_t>(0xd5024c61746e5358), /* vic-Latn-SX */
-    static_cast<uint64_t>(0xd5154c61746e5a5a), /* viv-Latn-ZZ */
-    static_cast<uint64_t>(0xd5724c61746e4245), /* vls-Latn-BE */
-    static_cast<uint64_t>(0xd5854c61746e4445), /* vmf-Latn-DE */
-    static_cast<uint64_t>(0xd5964c61746e4d5a), /* vmw-Latn-MZ */
-    static_cast<uint64_t>(0x766f4c61746e8001), /* vo-Latn-001 */
-    static_cast<uint64_t>(0xd5d34c61746e5255), /* vot-Latn-RU */
-    static_cast<uint64_t>(0xd62e4c61746e4545), /* vro-Latn-EE */
-    static_cast<uint64_t>(0xd68d4c61746e545a), /* vun-Latn-TZ */
-    static_cast<uint64_t>(0xd6934c61746e5a5a), /* vut-Latn-ZZ */
-    static_cast<uint64_t>(0x77614c61746e4245), /* wa-Latn-BE */
-    static_cast<uint64_t>(0xd8044c61746e4348), /* wae-Latn-CH */
-    static_cast<uint64_t>(0xd8094c61746e5a5a), /* waj-Latn-ZZ */
-    static_cast<uint64_t>(0xd80b457468694554), /* wal-Ethi-ET */
-    static_cast<uint64_t>(0xd80d4c61746e5a5a), /* wan-Latn-ZZ */
-    static_cast<uint64_t>(0xd8114c61746e5048), /* war-Latn-PH */
-    static_cast<uint64_t>(0xd82f4c61746e4155), /* wbp-Latn-AU */
-    static_cast<uint64_t>(0xd83054656c75494e), /* wbq-Telu-IN */
-    static_cast<uint64_t>(0xd83144657661494e), /* wbr-Deva-IN */
-    static_cast<uint64_t>(0xd8484c61746e5a5a), /* wci-Latn-ZZ */
-    static_cast<uint64_t>(0xd8914c61746e5a5a), /* wer-Latn-ZZ */
-    static_cast<uint64_t>(0xd8c84c61746e5a5a), /* wgi-Latn-ZZ */
-    static_cast<uint64_t>(0xd8e64c61746e5a5a), /* whg-Latn-ZZ */
-    static_cast<uint64_t>(0xd9014c61746e5a5a), /* wib-Latn-ZZ */
-    static_cast<uint64_t>(0xd9144c61746e5a5a), /* wiu-Latn-ZZ */
-    static_cast<uint64_t>(0xd9154c61746e5a5a), /* wiv-Latn-ZZ */
-    static_cast<uint64_t>(0xd9204c61746e5a5a), /* wja-Latn-ZZ */
-    static_cast<uint64_t>(0xd9284c61746e5a5a), /* wji-Latn-ZZ */
-    static_cast<uint64_t>(0xd9724c61746e5746), /* wls-Latn-WF */
-    static_cast<uint64_t>(0xd98e4c61746e5a5a), /* wmo-Latn-ZZ */
-    static_cast<uint64_t>(0xd9a24c61746e5a5a), /* wnc-Latn-ZZ */
-    static_cast<uint64_t>(0xd9a8417261624b4d), /* wni-Arab-KM */
-    static_cast<uint64_t>(0xd9b44c61746e5a5a), /* wnu-Latn-ZZ */
-    static_cast<uint64_t>(0x776f4c61746e534e), /* wo-Latn-SN */
-    static_cast<uint64_t>(0xd9c14c61746e5a5a), /* wob-Latn-ZZ */
-    static_cast<uint64_t>(0xd9d24c61746e5a5a), /* wos-Latn-ZZ */
-    static_cast<uint64_t>(0xda324c61746e5a5a), /* wrs-Latn-ZZ */
-    static_cast<uint64_t>(0xda46476f6e67494e), /* wsg-Gong-IN */
-    static_cast<uint64_t>(0xda4a4c61746e5a5a), /* wsk-Latn-ZZ */
-    static_cast<uint64_t>(0xda6c44657661494e), /* wtm-Deva-IN */
-    static_cast<uint64_t>(0xda9448616e73434e), /* wuu-Hans-CN */
-    static_cast<uint64_t>(0xda954c61746e5a5a), /* wuv-Latn-ZZ */
-    static_cast<uint64_t>(0xdac04c61746e5a5a), /* wwa-Latn-ZZ */
-    static_cast<uint64_t>(0xdc154c61746e4252), /* xav-Latn-BR */
-    static_cast<uint64_t>(0xdc284c61746e5a5a), /* xbi-Latn-ZZ */
-    static_cast<uint64_t>(0xdc4e43687273555a), /* xco-Chrs-UZ */
-    static_cast<uint64_t>(0xdc51436172695452), /* xcr-Cari-TR */
-    static_cast<uint64_t>(0xdc924c61746e5a5a), /* xes-Latn-ZZ */
-    static_cast<uint64_t>(0x78684c61746e5a41), /* xh-Latn-ZA */
-    static_cast<uint64_t>(0xdd604c61746e5a5a), /* xla-Latn-ZZ */
-    static_cast<uint64_t>(0xdd624c7963695452), /* xlc-Lyci-TR */
-    static_cast<uint64_t>(0xdd634c7964695452), /* xld-Lydi-TR */
-    static_cast<uint64_t>(0xdd8547656f724745), /* xmf-Geor-GE */
-    static_cast<uint64_t>(0xdd8d4d616e69434e), /* xmn-Mani-CN */
-    static_cast<uint64_t>(0xdd914d6572635344), /* xmr-Merc-SD */
-    static_cast<uint64_t>(0xdda04e6172625341), /* xna-Narb-SA */
-    static_cast<uint64_t>(0xddb144657661494e), /* xnr-Deva-IN */
-    static_cast<uint64_t>(0xddc64c61746e5547), /* xog-Latn-UG */
-    static_cast<uint64_t>(0xddcd4c61746e5a5a), /* xon-Latn-ZZ */
-    static_cast<uint64_t>(0xddf1507274694952), /* xpr-Prti-IR */
-    static_cast<uint64_t>(0xde214c61746e5a5a), /* xrb-Latn-ZZ */
-    static_cast<uint64_t>(0xde40536172625945), /* xsa-Sarb-YE */
-    static_cast<uint64_t>(0xde484c61746e5a5a), /* xsi-Latn-ZZ */
-    static_cast<uint64_t>(0xde4c4c61746e5a5a), /* xsm-Latn-ZZ */
-    static_cast<uint64_t>(0xde51446576614e50), /* xsr-Deva-NP */
-    static_cast<uint64_t>(0xdec44c61746e5a5a), /* xwe-Latn-ZZ */
-    static_cast<uint64_t>(0xe00c4c61746e5a5a), /* yam-Latn-ZZ */
-    static_cast<uint64_t>(0xe00e4c61746e4d5a), /* yao-Latn-MZ */
-    static_cast<uint64_t>(0xe00f4c61746e464d), /* yap-Latn-FM */
-    static_cast<uint64_t>(0xe0124c61746e5a5a), /* yas-Latn-ZZ */
-    static_cast<uint64_t>(0xe0134c61746e5a5a), /* yat-Latn-ZZ */
-    static_cast<uint64_t>(0xe0154c61746e434d), /* yav-Latn-CM */
-    static_cast<uint64_t>(0xe0184c61746e5a5a), /* yay-Latn-ZZ */
-    static_cast<uint64_t>(0xe0194c61746e5a5a), /* yaz-Latn-ZZ */
-    static_cast<uint64_t>(0xe0204c61746e5a5a), /* yba-Latn-ZZ */
-    static_cast<uint64_t>(0xe0214c61746e434d), /* ybb-Latn-CM */
-    static_cast<uint64_t>(0xe0384c61746e5a5a), /* yby-Latn-ZZ */
-    static_cast<uint64_t>(0xe0914c61746e5a5a), /* yer-Latn-ZZ */
-    static_cast<uint64_t>(0xe0d14c61746e5a5a), /* ygr-Latn-ZZ */
-    static_cast<uint64_t>(0xe0d64c61746e5a5a), /* ygw-Latn-ZZ */
-    static_cast<uint64_t>(0x7969486562728001), /* yi-Hebr-001 */
-    static_cast<uint64_t>(0xe14e4c61746e5a5a), /* yko-Latn-ZZ */
-    static_cast<uint64_t>(0xe1644c61746e5a5a), /* yle-Latn-ZZ */
-    static_cast<uint64_t>(0xe1664c61746e5a5a), /* ylg-Latn-ZZ */
-    static_cast<uint64_t>(0xe16b4c61746e5a5a), /* yll-Latn-ZZ */
-    static_cast<uint64_t>(0xe18b4c61746e5a5a), /* yml-Latn-ZZ */
-    static_cast<uint64_t>(0x796f4c61746e4e47), /* yo-Latn-NG */
-    static_cast<uint64_t>(0xe1cd4c61746e5a5a), /* yon-Latn-ZZ */
-    static_cast<uint64_t>(0xe2214c61746e5a5a), /* yrb-Latn-ZZ */
-    static_cast<uint64_t>(0xe2244c61746e5a5a), /* yre-Latn-ZZ */
-    static_cast<uint64_t>(0xe22b4c61746e4252), /* yrl-Latn-BR */
-    static_cast<uint64_t>(0xe2524c61746e5a5a), /* yss-Latn-ZZ */
-    static_cast<uint64_t>(0xe2804c61746e4d58), /* yua-Latn-MX */
-    static_cast<uint64_t>(0xe28448616e74484b), /* yue-Hant-HK */
-    static_cast<uint64_t>(0xe28448616e73434e), /* yue-Hans-CN */
-    static_cast<uint64_t>(0xe28448616e73434e), /* yue-Hans-CN */
-    static_cast<uint64_t>(0xe2894c61746e5a5a), /* yuj-Latn-ZZ */
-    static_cast<uint64_t>(0xe2934c61746e5a5a), /* yut-Latn-ZZ */
-    static_cast<uint64_t>(0xe2964c61746e5a5a), /* yuw-Latn-ZZ */
-    static_cast<uint64_t>(0x7a614c61746e434e), /* za-Latn-CN */
-    static_cast<uint64_t>(0xe4064c61746e5344), /* zag-Latn-SD */
-    static_cast<uint64_t>(0xe469417261624b4d), /* zdj-Arab-KM */
-    static_cast<uint64_t>(0xe4804c61746e4e4c), /* zea-Latn-NL */
-    static_cast<uint64_t>(0xe4c754666e674d41), /* zgh-Tfng-MA */
-    static_cast<uint64_t>(0x7a6848616e73434e), /* zh-Hans-CN */
-    static_cast<uint64_t>(0x7a6848616e744155), /* zh-Hant-AU */
-    static_cast<uint64_t>(0x7a6848616e74424e), /* zh-Hant-BN */
-    static_cast<uint64_t>(0x7a68426f706f5457), /* zh-Bopo-TW */
-    static_cast<uint64_t>(0x7a6848616e744742), /* zh-Hant-GB */
-    static_cast<uint64_t>(0x7a6848616e744746), /* zh-Hant-GF */
-    static_cast<uint64_t>(0x7a6848616e74484b), /* zh-Hant-HK */
-    static_cast<uint64_t>(0x7a6848616e625457), /* zh-Hanb-TW */
-    static_cast<uint64_t>(0x7a6848616e745457), /* zh-Hant-TW */
-    static_cast<uint64_t>(0x7a6848616e744944), /* zh-Hant-ID */
-    static_cast<uint64_t>(0x7a6848616e744d4f), /* zh-Hant-MO */
-    static_cast<uint64_t>(0x7a6848616e745041), /* zh-Hant-PA */
-    static_cast<uint64_t>(0x7a6848616e745046), /* zh-Hant-PF */
-    static_cast<uint64_t>(0x7a6848616e745048), /* zh-Hant-PH */
-    static_cast<uint64_t>(0x7a6848616e745352), /* zh-Hant-SR */
-    static_cast<uint64_t>(0x7a6848616e745448), /* zh-Hant-TH */
-    static_cast<uint64_t>(0x7a6848616e745457), /* zh-Hant-TW */
-    static_cast<uint64_t>(0x7a6848616e745553), /* zh-Hant-US */
-    static_cast<uint64_t>(0x7a6848616e74564e), /* zh-Hant-VN */
-    static_cast<uint64_t>(0xe4f74e736875434e), /* zhx-Nshu-CN */
-    static_cast<uint64_t>(0xe5004c61746e5a5a), /* zia-Latn-ZZ */
-    static_cast<uint64_t>(0xe5534b697473434e), /* zkt-Kits-CN */
-    static_cast<uint64_t>(0xe56c4c61746e5447), /* zlm-Latn-TG */
-    static_cast<uint64_t>(0xe5884c61746e4d59), /* zmi-Latn-MY */
-    static_cast<uint64_t>(0xe5a44c61746e5a5a), /* zne-Latn-ZZ */
-    static_cast<uint64_t>(0x7a754c61746e5a41), /* zu-Latn-ZA */
-    static_cast<uint64_t>(0xe7204c61746e5452), /* zza-Latn-TR */
-};
+template<size_t N>
+constexpr bool IsSortedByKey(const std::array<LocaleDataEntry, N>& entries)
+{
+    for (size_t i = 1; i < N; ++i) {
+        if (entries[i - 1].key >= entries[i].key) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<size_t N>
+constexpr bool IsSorted(const std::array<uint64_t, N>& codes)
+{
+    for (size_t i = 1; i < N; ++i) {
+        if (codes[i - 1] >= codes[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(IsSortedByKey(LOCALE_PARENTS), "LOCALE_PARENTS must be sorted by key");
+static_assert(IsSortedByKey(LIKELY_TAGS), "LIKELY_TAGS must be sorted by key");
+static_assert(IsSorted(TYPICAL_CODES), "TYPICAL_CODES must be sorted");
+
+template<size_t N>
+bool FindEntry(const std::array<LocaleDataEntry, N>& entries, uint64_t key, uint64_t& value)
+{
+    auto iter = std::lower_bound(entries.begin(), entries.end(), key,
+        [](const LocaleDataEntry& entry, uint64_t target) { return entry.key < target; });
+    if (iter == entries.end() || iter->key != key) {
+        return false;
+    }
+    value = iter->value;
+    return true;
+}
+} // namespace
+
+bool LocaleData::FindParentLocale(uint64_t encodedLocale, uint64_t& parentLocale)
+{
+    return FindEntry(LOCALE_PARENTS, encodedLocale, parentLocale);
+}
+
+bool LocaleData::FindLikelyLocale(uint64_t encodedLocale, uint64_t& likelyLocale)
+{
+    return FindEntry(LIKELY_TAGS, encodedLocale, likelyLocale);
+}
+
+bool LocaleData::IsTypicalLocale(uint64_t encodedLocale)
+{
+    return std::binary_search(TYPICAL_CODES.begin(), TYPICAL_CODES.end(), encodedLocale);
+}
 } // namespace I18n
 } // namespace Global
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -235,10 +235,9 @@ uint64_t LocaleMatcher::SearchParentLocale(uint64_t encodedLocale, const LocaleI
         }
     }
     if (IsContainRegion(encodedLocale)) {
-        for (size_t i = 0; i < LocaleData::LOCALE_PARENTS_KEY.size(); i++) {
-            if (LocaleData::LOCALE_PARENTS_KEY[i] == tempEncodedLocale) {
-                return LocaleData::LOCALE_PARENTS_VALUE[i];
-            }
+        uint64_t parentLocale = LocaleMatcher::ROOT_LOCALE;
+        if (LocaleData::FindParentLocale(tempEncodedLocale, parentLocale)) {
+            return parentLocale;
         }
         return ClearRegion(encodedLocale);
     }
@@ -350,18 +349,15 @@ uint16_t LocaleMatcher::FindDefaultRegionEncode(const char *language, const char
     if (encodedLocale == LocaleUtil::EncodeLocale("en", "Qaag", nullptr)) {
         encodedLocale = LocaleUtil::EncodeLocale("en", "Latn", nullptr);
     }
-    for (size_t i = 0; i < LocaleData::LIKELY_TAGS_CODES_KEY.size(); i++) {
-        if (LocaleData::LIKELY_TAGS_CODES_KEY[i] == encodedLocale) {
-            return static_cast<uint16_t>((LocaleData::LIKELY_TAGS_CODES_VALUE[i] & 0x000000000000ffff));
-        }
+    uint64_t likelyLocale = LocaleMatcher::NULL_LOCALE;
+    if (LocaleData::FindLikelyLocale(encodedLocale, likelyLocale)) {
+        return static_cast<uint16_t>((likelyLocale & 0x000000000000ffff));
     }
     /* if not found and script is not null,try language */
     if (script != nullptr) {
         encodedLocale = LocaleUtil::EncodeLocale(language, nullptr, nullptr);
-        for (size_t i = 0; i < LocaleData::LIKELY_TAGS_CODES_KEY.size(); i++) {
-            if (LocaleData::LIKELY_TAGS_CODES_KEY[i] == encodedLocale) {
-                return static_cast<uint16_t>((LocaleData::LIKELY_TAGS_CODES_VALUE[i] & 0x000000000000ffff));
-            }
+        if (LocaleData::FindLikelyLocale(encodedLocale, likelyLocale)) {
+            return static_cast<uint16_t>((likelyLocale & 0x000000000000ffff));
         }
     }
     return LocaleMatcher::NULL_REGION;
@@ -480,12 +476,7 @@ bool LocaleMatcher::IsDefaultLocale(const char *language, const char *script, co
     if (ClearRegion(encodedLocale) == LocaleMatcher::EN_QAAG_ENCODE) {
         encodedLocale = LocaleUtil::EncodeLocale("en", "Latn", region);
     }
-    for (size_t i = 0; i < LocaleData::TYPICAL_CODES_VALUE.size(); i++) {
-        if (LocaleData::TYPICAL_CODES_VALUE[i] == encodedLocale) {
-            return true;
-        }
-    }
-    return false;
+    return LocaleData::IsTypicalLocale(encodedLocale);
 }
 
 int8_t LocaleMatcher::CompareLanguageIgnoreOldNewCode(const LocaleInfo *current, const LocaleInfo *other,
@@ -556,19 +547,16 @@ bool LocaleMatcher::CompareScript(const LocaleInfo *current, const LocaleInfo *o
 uint32_t LocaleMatcher::FindDefaultScriptEncode(const char *language, const char *region)
 {
     uint64_t encodedLocale = LocaleUtil::EncodeLocale(language, nullptr, region);
-    for (size_t i = 0; i < LocaleData::LIKELY_TAGS_CODES_KEY.size(); i++) {
-        if (LocaleData::LIKELY_TAGS_CODES_KEY[i] == encodedLocale) {
-            // 16 is the offset of script
-            return static_cast<uint32_t>((LocaleData::LIKELY_TAGS_CODES_VALUE[i] & 0x0000ffffffff0000) >> 16);
-        }
+    uint64_t likelyLocale = LocaleMatcher::NULL_LOCALE;
+    if (LocaleData::FindLikelyLocale(encodedLocale, likelyLocale)) {
+        // 16 is the offset of script
+        return static_cast<uint32_t>((likelyLocale & 0x0000ffffffff0000) >> 16);
     }
     if (region != nullptr) {
         encodedLocale = LocaleUtil::EncodeLocale(language, nullptr, nullptr);
-        for (size_t i = 0; i < LocaleData::LIKELY_TAGS_CODES_KEY.size(); i++) {
-            if (LocaleData::LIKELY_TAGS_CODES_KEY[i] == encodedLocale) {
-                // 16 is the offset of script
-                return static_cast<uint32_t>((LocaleData::LIKELY_TAGS_CODES_VALUE[i] & 0x0000ffffffff0000) >> 16);
-            }
+        if (LocaleData::FindLikelyLocale(encodedLocale, likelyLocale)) {
+            // 16 is the offset of script
+            return static_cast<uint32_t>((likelyLocale & 0x0000ffffffff0000) >> 16);
         }
     }
     return LocaleMatcher::NULL_SCRIPT;
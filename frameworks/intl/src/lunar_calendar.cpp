@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include "i18n_hilog.h"
 #include "unicode/gregocal.h"
 #include "lunar_calendar.h"
@@ -19,37 +20,10 @@
 namespace OHOS {
 namespace Global {
 namespace I18n {
-std::unordered_map<int32_t, int32_t> LunarCalendar::daysOfMonth {
-    { 1, 31 },
-    { 2, 28 },
-    { 3, 31 },
-    { 4, 30 },
-    { 5, 31 },
-    { 6, 30 },
-    { 7, 31 },
-    { 8, 31 },
-    { 9, 30 },
-    { 10, 31 },
-    { 11, 30 },
-    { 12, 31 }
-};
-
-std::unordered_map<int32_t, int32_t> LunarCalendar::accDaysOfMonth {
-    { 1, 0 },
-    { 2, 31 },
-    { 3, 59 },
-    { 4, 90 },
-    { 5, 120 },
-    { 6, 151 },
-    { 7, 181 },
-    { 8, 212 },
-    { 9, 243 },
-    { 10, 273 },
-    { 11, 304 },
-    { 12, 334 }
-};
+static constexpr int32_t DAYS_OF_MONTH[] = { 0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+static constexpr int32_t ACC_DAYS_OF_MONTH[] = { 0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
 
-std::vector<uint32_t> LunarCalendar::lunarDateInfo {
+static constexpr uint32_t LUNAR_DATE_INFO[] = {
     0x04bd8, 0x04ae0, 0x0a570, 0x054d5, 0x0d260, 0x0d950, 0x16554, 0x056a0, 0x09ad0, 0x055d2,
     0x04ae0, 0x0a5b6, 0x0a4d0, 0x0d250, 0x1d255, 0x0b540, 0x0d6a0, 0x0ada2, 0x095b0, 0x14977,
     0x04970, 0x0a4b0, 0x0b4b5, 0x06a50, 0x06d40, 0x1ab54, 0x02b60, 0x09570, 0x052f2, 0x04970,
@@ -73,13 +47,35 @@ std::vector<uint32_t> LunarCalendar::lunarDateInfo {
     0x0d520,
 };
 
+constexpr LunarCalendar::LunarYearTable LunarCalendar::BuildLunarYearTable()
+{
+    static_assert(sizeof(LUNAR_DATE_INFO) / sizeof(LUNAR_DATE_INFO[0]) == LUNAR_YEAR_COUNT,
+        "LUNAR_DATE_INFO must cover every supported year");
+    LunarYearTable table {};
+    for (int32_t year = 0; year < LUNAR_YEAR_COUNT; ++year) {
+        uint32_t info = LUNAR_DATE_INFO[year];
+        int32_t days = BASE_DAYS_PER_LUNAR_YEAR;
+        for (uint32_t i = 0x8000; i > 0x8; i = i >> 1) {
+            days += ((info & i) == i) ? 1 : 0;
+        }
+        if ((info & 0xf) != 0) {
+            days += (info & 0x10000) == 0x10000 ? DAYS_IN_BIG_MONTH : DAYS_IN_SMALL_MONTH;
+        }
+        table.daysOfYear[year] = days;
+        table.accDaysOfYear[year + 1] = table.accDaysOfYear[year] + days;
+    }
+    return table;
+}
+
+const LunarCalendar::LunarYearTable LunarCalendar::lunarYearTable = LunarCalendar::BuildLunarYearTable();
+
 int32_t LunarCalendar::GetLeapDaysInYear(int32_t year)
 {
     if ((year < VALID_START_YEAR) || (year > VALID_END_YEAR)) {
         return -1;
     }
     if (GetLeapMonthInYear(year) != 0) {
-        return (lunarDateInfo[year - START_YEAR] & 0x10000) == 0x10000 ? DAYS_IN_BIG_MONTH : DAYS_IN_SMALL_MONTH;
+        return (LUNAR_DATE_INFO[year - START_YEAR] & 0x10000) == 0x10000 ? DAYS_IN_BIG_MONTH : DAYS_IN_SMALL_MONTH;
     }
     return 0;
 }
@@ -89,7 +85,7 @@ int32_t LunarCalendar::GetLeapMonthInYear(int32_t year)
     if ((year < VALID_START_YEAR) || (year > VALID_END_YEAR)) {
         return -1;
     }
-    return lunarDateInfo[year - START_YEAR] & 0xf;
+    return LUNAR_DATE_INFO[year - START_YEAR] & 0xf;
 }
 
 int32_t LunarCalendar::GetDaysInMonth(int32_t year, int32_t month)
@@ -101,7 +97,7 @@ int32_t LunarCalendar::GetDaysInMonth(int32_t year, int32_t month)
         return -1;
     }
     uint32_t offset = 0x10000 >> static_cast<uint32_t>(month);
-    return (lunarDateInfo[year - START_YEAR] & offset) == offset ? DAYS_IN_BIG_MONTH : DAYS_IN_SMALL_MONTH;
+    return (LUNAR_DATE_INFO[year - START_YEAR] & offset) == offset ? DAYS_IN_BIG_MONTH : DAYS_IN_SMALL_MONTH;
 }
 
 LunarCalendar::LunarCalendar()
@@ -133,6 +129,7 @@ bool LunarCalendar::SetGregorianDate(int32_t year, int32_t month, int32_t day)
     if (!isValidDate) {
         return false;
     }
+    isGregorianLeapYear = IsGregorianLeapYear(year);
     solarYear = year;
     solarMonth = month;
     solarDay = day;
@@ -170,88 +167,112 @@ void LunarCalendar::ConvertDate(int32_t& year, int32_t& month, int32_t& day)
 
 void LunarCalendar::CalcDaysFromBaseDate()
 {
-    daysCounts = DAYS_OF_YEAR * (solarYear - START_YEAR);
-    daysCounts += accDaysOfMonth[solarMonth];
-    if (isGregorianLeapYear && solarMonth > MONTH_FEB) {
-        daysCounts++;
+    daysCounts = GetDaysFromBaseDate(solarYear, solarMonth, solarDay, isGregorianLeapYear);
+}
+
+int32_t LunarCalendar::GetDaysFromBaseDate(int32_t year, int32_t month, int32_t day, bool isLeapYear)
+{
+    int32_t days = DAYS_OF_YEAR * (year - START_YEAR);
+    days += ACC_DAYS_OF_MONTH[month];
+    if (isLeapYear && month > MONTH_FEB) {
+        days++;
     }
-    daysCounts--;
-    daysCounts += solarDay;
-    daysCounts += (solarYear - START_YEAR) / FREQ_LEAP_YEAR;
-    if (isGregorianLeapYear) {
-        daysCounts--;
+    days--;
+    days += day;
+    days += (year - START_YEAR) / FREQ_LEAP_YEAR;
+    if (isLeapYear) {
+        days--;
     }
-    if (solarYear >= VALID_END_YEAR) {
-        daysCounts--;
+    if (year >= VALID_END_YEAR) {
+        days--;
     }
+    return days;
 }
 
 void LunarCalendar::SolarDateToLunarDate()
 {
-    int32_t daysInPerLunarYear = 0;
-    int32_t daysInPerLunarMonth = 0;
-    int32_t leapMonth = 0xf;
-    int tempDaysCounts = daysCounts;
-    tempDaysCounts -= DAYS_FROM_SOLAR_TO_LUNAR;
-    int32_t i = 0;
-    for (i = START_YEAR; (tempDaysCounts > 0) && (i < END_YEAR); i++) {
-        daysInPerLunarYear = GetDaysPerLunarYear(i);
-        tempDaysCounts -= daysInPerLunarYear;
-    }
+    LunarDate date = DaysToLunarDate(daysCounts);
+    lunarYear = date.year;
+    lunarMonth = date.month;
+    lunarDay = date.day;
+    isLeapMonth = date.isLeapMonth;
+}
+
+LunarDate LunarCalendar::DaysToLunarDate(int32_t daysCounts)
+{
+    int32_t tempDaysCounts = daysCounts - DAYS_FROM_SOLAR_TO_LUNAR;
+    // Find the first lunar year which ends at or after tempDaysCounts, stopping at END_YEAR.
+    const int32_t* accDays = lunarYearTable.accDaysOfYear;
+    int32_t index = static_cast<int32_t>(
+        std::lower_bound(accDays, accDays + (END_YEAR - START_YEAR), tempDaysCounts) - accDays);
+    tempDaysCounts -= accDays[index];
+    LunarDate date;
+    date.year = START_YEAR + index;
     if (tempDaysCounts < 0) {
-        tempDaysCounts += daysInPerLunarYear;
-        --i;
+        tempDaysCounts += (index > 0) ? lunarYearTable.daysOfYear[index - 1] : 0;
+        --date.year;
     }
-    lunarYear = i;
 
-    leapMonth = GetLeapMonthInYear(lunarYear);
-    isLeapMonth = false;
+    int32_t daysInPerLunarMonth = 0;
+    int32_t leapMonth = GetLeapMonthInYear(date.year);
+    bool isLeap = false;
+    int32_t i = 0;
     for (i = 1; i <= VALID_END_MONTH && tempDaysCounts > 0; i++) {
-        if (leapMonth > 0 && (leapMonth + 1) == i && !isLeapMonth) {
+        if (leapMonth > 0 && (leapMonth + 1) == i && !isLeap) {
             --i;
-            isLeapMonth = true;
-            daysInPerLunarMonth = GetLeapDaysInYear(lunarYear);
+            isLeap = true;
+            daysInPerLunarMonth = GetLeapDaysInYear(date.year);
         } else {
-            daysInPerLunarMonth = GetDaysInMonth(lunarYear, i);
+            daysInPerLunarMonth = GetDaysInMonth(date.year, i);
         }
-        if (isLeapMonth && (leapMonth + 1) == i) {
-            isLeapMonth = false;
+        if (isLeap && (leapMonth + 1) == i) {
+            isLeap = false;
         }
         tempDaysCounts -= daysInPerLunarMonth;
     }
-    AdjustLeapMonth(i, tempDaysCounts, leapMonth);
+    AdjustLeapMonth(i, tempDaysCounts, leapMonth, isLeap);
     if (tempDaysCounts < 0) {
         tempDaysCounts += daysInPerLunarMonth;
         --i;
     }
-    lunarMonth = i;
-    lunarDay = tempDaysCounts + 1;
+    date.month = i;
+    date.day = tempDaysCounts + 1;
+    date.isLeapMonth = isLeap;
+    return date;
 }
 
-void LunarCalendar::AdjustLeapMonth(int32_t& i, int32_t tempDaysCounts, int32_t leapMonth)
+void LunarCalendar::AdjustLeapMonth(int32_t& i, int32_t tempDaysCounts, int32_t leapMonth, bool& isLeap)
 {
     if (tempDaysCounts == 0 && leapMonth > 0 && i == leapMonth + 1) {
-        if (isLeapMonth) {
-            isLeapMonth = false;
+        if (isLeap) {
+            isLeap = false;
         } else {
-            isLeapMonth = true;
+            isLeap = true;
             --i;
         }
     }
 }
 
-int32_t LunarCalendar::GetDaysPerLunarYear(int32_t lunarYear)
+bool LunarCalendar::GetLunarDates(int32_t year, int32_t month, int32_t day, size_t count,
+    std::vector<LunarDate>& lunarDates)
 {
-    int32_t daysPerLunarYear = 0;
-    if ((lunarYear < START_YEAR) || (lunarYear > END_YEAR)) {
-        return 0;
+    lunarDates.clear();
+    ConvertDate(year, month, day);
+    if (!VerifyDate(year, month, day)) {
+        return false;
     }
-    daysPerLunarYear += BASE_DAYS_PER_LUNAR_YEAR;
-    for (uint32_t i = 0x8000; i > 0x8; i = i >> 1) {
-        daysPerLunarYear += ((lunarDateInfo[lunarYear - START_YEAR] & i) == i) ? 1 : 0;
+    int32_t firstDays = GetDaysFromBaseDate(year, month, day, IsGregorianLeapYear(year));
+    int32_t lastDays = GetDaysFromBaseDate(VALID_END_YEAR, VALID_END_MONTH, DAYS_OF_MONTH[VALID_END_MONTH],
+        IsGregorianLeapYear(VALID_END_YEAR));
+    if (count > static_cast<size_t>(lastDays - firstDays) + 1) {
+        HILOG_ERROR_I18N("GetLunarDates: days out of the supported range");
+        return false;
     }
-    daysPerLunarYear += GetLeapDaysInYear(lunarYear);
-    return daysPerLunarYear;
+    lunarDates.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        lunarDates.push_back(DaysToLunarDate(firstDays + static_cast<int32_t>(i)));
+    }
+    return true;
 }
 
 bool LunarCalendar::VerifyDate(int32_t year, int32_t month, int32_t day)
@@ -266,10 +287,9 @@ bool LunarCalendar::VerifyDate(int32_t year, int32_t month, int32_t day)
         return false;
     }
 
-    int32_t validEndDay = daysOfMonth[month];
-    isGregorianLeapYear = IsGregorianLeapYear(year);
+    int32_t validEndDay = DAYS_OF_MONTH[month];
     if (month == MONTH_FEB) {
-        validEndDay = isGregorianLeapYear ? validEndDay + 1 : validEndDay;
+        validEndDay = IsGregorianLeapYear(year) ? validEndDay + 1 : validEndDay;
     }
 
     if ((month < VALID_START_DAY) || (month > validEndDay)) {
@@ -17,6 +17,7 @@
 #include <unordered_map>
 #include <cmath>
 #include "i18n_hilog.h"
+#include "measure_unit_catalog.h"
 #include "utils.h"
 
 namespace OHOS {
@@ -33,7 +34,6 @@ const int REGION_OFFSET = 7;
 const int BASE_VALUE_SIZE = 2;
 const int FACTOR_SIZE = 2;
 const int CHAR_OFFSET = 48;
-const int MAX_UNIT_NUM = 502;
 const size_t REGION_SIZE = 2;
 
 const std::unordered_map<std::string, std::vector<std::string>> USAGE_001 {
@@ -671,24 +671,31 @@ bool ConvertDate(double& number, std::string& unit)
 int Convert(double &value, const string &fromUnit, const string &fromMeasSys, const string &toUnit,
     const string &toMeasSys)
 {
-    double baseResult = 0.0;
-    double result = 0.0;
+    UnitConversionPlan plan;
+    if (!CreateConversionPlan(fromUnit, fromMeasSys, toUnit, toMeasSys, plan)) {
+        return 0;
+    }
+    value = plan.Apply(value);
+    return 1;
+}
+
+int CreateConversionPlan(const string &fromUnit, const string &fromMeasSys, const string &toUnit,
+    const string &toMeasSys, UnitConversionPlan &plan)
+{
     vector<double> fromFactors = {0.0, 0.0};
     string fromUnitType;
     string toUnitType;
-    icu::MeasureUnit unitArray[MAX_UNIT_NUM];
-    UErrorCode icuStatus = U_ZERO_ERROR;
-    icu::MeasureUnit::getAvailable(unitArray, MAX_UNIT_NUM, icuStatus);
-    if (!U_SUCCESS(icuStatus)) {
+    const MeasureUnitCatalog& catalog = MeasureUnitCatalog::GetInstance();
+    if (!catalog.IsValid()) {
         return 0;
     }
-    for (icu::MeasureUnit curUnit : unitArray) {
-        if (!strcmp(curUnit.getSubtype(), fromUnit.c_str())) {
-            fromUnitType = curUnit.getType();
-        }
-        if (!strcmp(curUnit.getSubtype(), toUnit.c_str())) {
-            toUnitType = curUnit.getType();
-        }
+    const icu::MeasureUnit* fromMeasureUnit = catalog.Find(fromUnit);
+    if (fromMeasureUnit != nullptr) {
+        fromUnitType = fromMeasureUnit->getType();
+    }
+    const icu::MeasureUnit* toMeasureUnit = catalog.Find(toUnit);
+    if (toMeasureUnit != nullptr) {
+        toUnitType = toMeasureUnit->getType();
     }
     if (fromUnitType.empty() || toUnitType.empty() || strcmp(fromUnitType.c_str(), toUnitType.c_str())) {
         return 0;
@@ -702,14 +709,21 @@ int Convert(double &value, const string &fromUnit, const string &fromMeasSys, co
     if (!status) {
         return 0;
     }
-    if (fromFactors.size() == FACTOR_SIZE) {
-        baseResult = fromFactors[0] * value + fromFactors[1];
+    plan.fromFactor = fromFactors[0];
+    plan.fromOffset = fromFactors[1];
+    plan.toFactor = toFactors[0];
+    plan.toOffset = toFactors[1];
+    return 1;
+}
+
+void ConvertBatch(const UnitConversionPlan &plan, double *values, size_t count)
+{
+    if (values == nullptr) {
+        return;
     }
-    if (toFactors.size() == FACTOR_SIZE) {
-        result = (baseResult - toFactors[1]) / toFactors[0];
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = plan.Apply(values[i]);
     }
-    value = result;
-    return 1;
 }
 } // namespace I18n
 } // namespace Global
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "measure_unit_catalog.h"
+
+#include "i18n_hilog.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+const MeasureUnitCatalog& MeasureUnitCatalog::GetInstance()
+{
+    static MeasureUnitCatalog catalog;
+    return catalog;
+}
+
+MeasureUnitCatalog::MeasureUnitCatalog()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t count = icu::MeasureUnit::getAvailable(nullptr, 0, status);
+    if (status != U_BUFFER_OVERFLOW_ERROR || count <= 0) {
+        HILOG_ERROR_I18N("MeasureUnitCatalog: Get available unit count failed.");
+        return;
+    }
+    status = U_ZERO_ERROR;
+    units.resize(static_cast<size_t>(count));
+    icu::MeasureUnit::getAvailable(units.data(), count, status);
+    if (U_FAILURE(status)) {
+        HILOG_ERROR_I18N("MeasureUnitCatalog: Get available units failed.");
+        units.clear();
+        return;
+    }
+    subtypeIndex.reserve(units.size());
+    for (size_t i = 0; i < units.size(); ++i) {
+        // Later units win on duplicated subtypes, the same as the former linear scans.
+        subtypeIndex[units[i].getSubtype()] = i;
+    }
+    valid = true;
+}
+
+const icu::MeasureUnit* MeasureUnitCatalog::Find(const std::string& subtype) const
+{
+    auto iter = subtypeIndex.find(subtype);
+    if (iter == subtypeIndex.end()) {
+        return nullptr;
+    }
+    return &units[iter->second];
+}
+
+bool MeasureUnitCatalog::IsValid() const
+{
+    return valid;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
@@ -22,6 +22,7 @@
 #include "format_utils.h"
 #include "i18n_hilog.h"
 #include "locale_helper.h"
+#include "measure_unit_catalog.h"
 #include "ohos/init_data.h"
 #include "parameter.h"
 #include "unicode/ucurr.h"
@@ -233,9 +234,7 @@ void NumberFormat::ResolveLocaleTags(const std::vector<std::string> &localeTags,
             }
             locale = localeInfo->GetLocale();
             localeBaseName = localeInfo->GetBaseName();
-            icu::MeasureUnit::getAvailable(unitArray, MAX_UNIT_NUM, status);
-            if (U_FAILURE(status)) {
-                status = U_ZERO_ERROR;
+            if (!MeasureUnitCatalog::GetInstance().IsValid()) {
                 continue;
             }
             createSuccess = true;
@@ -255,9 +254,7 @@ void NumberFormat::CreateNumberFormatWithDefaultLocale(const std::string &system
         if (localeInfo != nullptr && localeInfo->InitSuccess()) {
             locale = localeInfo->GetLocale();
             localeBaseName = localeInfo->GetBaseName();
-            UErrorCode status = U_ZERO_ERROR;
-            icu::MeasureUnit::getAvailable(unitArray, MAX_UNIT_NUM, status);
-            if (U_SUCCESS(status)) {
+            if (MeasureUnitCatalog::GetInstance().IsValid()) {
                 createSuccess = true;
                 ParseExtParam(systemLocale);
             }
@@ -387,15 +384,11 @@ void NumberFormat::InitUnitProperties(icu::number::UnlocalizedNumberFormatter &f
     if (styleString.empty() || styleString.compare("unit") != 0) {
         return;
     }
-    bool foundUnit = false;
-    for (icu::MeasureUnit curUnit : unitArray) {
-        if (!strcmp(curUnit.getSubtype(), unit.c_str())) {
-            formatter = formatter.unit(curUnit);
-            foundUnit = true;
-            unitType = curUnit.getType();
-        }
-    }
-    if (!foundUnit && fromArkTs) {
+    const icu::MeasureUnit* curUnit = MeasureUnitCatalog::GetInstance().Find(unit);
+    if (curUnit != nullptr) {
+        formatter = formatter.unit(*curUnit);
+        unitType = curUnit->getType();
+    } else if (fromArkTs) {
         SetPerUnit(formatter);
     }
 
@@ -703,11 +696,10 @@ void NumberFormat::SetUnit(std::string &preferredUnit)
     if (preferredUnit.empty()) {
         return;
     }
-    for (icu::MeasureUnit curUnit : unitArray) {
-        if (!strcmp(curUnit.getSubtype(), preferredUnit.c_str())) {
-            numberFormat = numberFormat.unit(curUnit);
-            styleRangeFormatter = styleRangeFormatter.unit(curUnit);
-        }
+    const icu::MeasureUnit* curUnit = MeasureUnitCatalog::GetInstance().Find(preferredUnit);
+    if (curUnit != nullptr) {
+        numberFormat = numberFormat.unit(*curUnit);
+        styleRangeFormatter = styleRangeFormatter.unit(*curUnit);
     }
 }
 
@@ -759,14 +751,23 @@ void NumberFormat::FormatToParts(std::vector<std::vector<std::string>> &result)
 {
     double number = uprv_getNaN();
     icu::number::FormattedNumber formattedNumber = FormatToFormattedNumber(number);
-    FormattedNumberParts(formattedNumber, result, "nan", number);
+    FormattedParts parts;
+    FormattedNumberParts(formattedNumber, parts, "nan", number);
+    FormatUtils::AppendPartStrings(parts, result);
 }
 
 void NumberFormat::FormatBigIntToParts(const std::string &number, std::vector<std::vector<std::string>> &result)
+{
+    FormattedParts parts;
+    FormatBigIntToParts(number, parts);
+    FormatUtils::AppendPartStrings(parts, result);
+}
+
+void NumberFormat::FormatBigIntToParts(const std::string &number, FormattedParts &parts)
 {
     icu::number::FormattedNumber formattedNumber = FormatDecimalToFormattedNumber(number);
     double numDouble = GetBigIntFieldType(number);
-    FormattedNumberParts(formattedNumber, result, "bigint", numDouble);
+    FormattedNumberParts(formattedNumber, parts, "bigint", numDouble);
 }
 
 double NumberFormat::GetBigIntFieldType(const std::string &bigIntStr)
@@ -786,24 +787,51 @@ void NumberFormat::FormatToParts(double number, std::vector<std::vector<std::str
         return;
     }
     icu::number::FormattedNumber formattedNumber = FormatToFormattedNumber(number);
-    FormattedNumberParts(formattedNumber, result, "number", number);
+    FormattedParts parts;
+    FormattedNumberParts(formattedNumber, parts, "number", number);
+    FormatUtils::AppendPartStrings(parts, result);
+}
+
+void NumberFormat::FormatToParts(double number, FormattedParts &parts)
+{
+    parts.text.clear();
+    parts.spans.clear();
+    std::string finalUnit = unit;
+    if (IsRelativeTimeFormat(number, finalUnit)) {
+        std::vector<std::vector<std::string>> result;
+        RelativeDateTimeFormatToParts(number, finalUnit, result);
+        for (const std::vector<std::string> &part : result) {
+            if (part.size() < 2) { // 2 is the size of [type, value]
+                continue;
+            }
+            int32_t begin = static_cast<int32_t>(parts.text.length());
+            parts.text.append(part[1]);
+            parts.spans.push_back({ FormatUtils::GetPartType(part[0]), begin,
+                static_cast<int32_t>(parts.text.length()) });
+        }
+        return;
+    }
+    icu::number::FormattedNumber formattedNumber = FormatToFormattedNumber(number);
+    FormattedNumberParts(formattedNumber, parts, "number", number);
 }
 
 void NumberFormat::FormattedNumberParts(icu::number::FormattedNumber &formattedNumber,
-    std::vector<std::vector<std::string>> &result, const std::string &napiType,
-    const double &number)
+    FormattedParts &parts, const std::string &napiType, const double &number)
 {
+    parts.text.clear();
+    parts.spans.clear();
     UErrorCode status = U_ZERO_ERROR;
     icu::UnicodeString formatResult = formattedNumber.toString(status);
     if (U_FAILURE(status)) {
         HILOG_ERROR_I18N("NumberFormat::FormatToParts: UnicodeString toString failed.");
         return;
     }
-    FindAllFormatParts(formattedNumber, result, number, napiType, formatResult);
+    FindAllFormatParts(formattedNumber, parts.spans, number, napiType, formatResult);
+    FormatUtils::SetFormattedText(formatResult, parts);
 }
 
 void NumberFormat::FindAllFormatParts(icu::FormattedValue &formattedNumber,
-    std::vector<std::vector<std::string>> &result, double number,
+    std::vector<FormatPartSpan> &spans, double number,
     const std::string &napiType, icu::UnicodeString &formatResult)
 {
     icu::ConstrainedFieldPosition cfpo;
@@ -815,19 +843,18 @@ void NumberFormat::FindAllFormatParts(icu::FormattedValue &formattedNumber,
     while (formattedNumber.nextPosition(cfpo, status)) {
         if (U_FAILURE(status)) {
             HILOG_ERROR_I18N("NumberFormat::FindAllFormatParts: Get next position failed.");
-            result.clear();
+            spans.clear();
             return;
         }
-        SetEveryFormatPartItem(cfpo, formatResult, result, param);
+        SetEveryFormatPartItem(cfpo, spans, param);
     }
     if (formatResult.length() > param.previousLimit) {
-        std::string typeString = "literal";
-        AddFormatParts(typeString, result, formatResult, param.previousLimit, formatResult.length());
+        AddFormatParts(FormatPartType::LITERAL, spans, param.previousLimit, formatResult.length());
     }
 }
 
 void NumberFormat::FindAllFormatParts(icu::FormattedValue &formattedNumber,
-    std::vector<std::vector<std::string>> &result, const double &first,
+    std::vector<FormatPartSpan> &spans, const double &first,
     const double &second, icu::UnicodeString &formatResult)
 {
     icu::ConstrainedFieldPosition cfpo;
@@ -840,7 +867,7 @@ void NumberFormat::FindAllFormatParts(icu::FormattedValue &formattedNumber,
     while (formattedNumber.nextPosition(cfpo, status)) {
         if (U_FAILURE(status)) {
             HILOG_ERROR_I18N("NumberFormat::FindAllFormatParts: Get next position failed.");
-            result.clear();
+            spans.clear();
             return;
         }
         if (static_cast<UFieldCategory>(cfpo.getCategory()) == UFIELD_CATEGORY_NUMBER_RANGE_SPAN) {
@@ -849,75 +876,62 @@ void NumberFormat::FindAllFormatParts(icu::FormattedValue &formattedNumber,
         if (rangeSpanCount > 1) {
             param.number = second;
         }
-        SetEveryFormatPartItem(cfpo, formatResult, result, param);
+        SetEveryFormatPartItem(cfpo, spans, param);
     }
     if (formatResult.length() > param.previousLimit) {
-        std::string typeString = "literal";
-        AddFormatParts(typeString, result, formatResult, param.previousLimit, formatResult.length());
+        AddFormatParts(FormatPartType::LITERAL, spans, param.previousLimit, formatResult.length());
     }
 }
 
-void NumberFormat::SetEveryFormatPartItem(icu::ConstrainedFieldPosition &cfpo, icu::UnicodeString &formatResult,
-    std::vector<std::vector<std::string>> &result, FormatPartParam &param)
+void NumberFormat::SetEveryFormatPartItem(icu::ConstrainedFieldPosition &cfpo, std::vector<FormatPartSpan> &spans,
+    FormatPartParam &param)
 {
     int32_t fieldId = cfpo.getField();
     int32_t start = cfpo.getStart();
     int32_t limit = cfpo.getLimit();
-    std::string typeString = "literal";
+    FormatPartType type = FormatPartType::LITERAL;
     if (static_cast<UFieldCategory>(cfpo.getCategory()) == UFIELD_CATEGORY_NUMBER_RANGE_SPAN) {
         if (param.previousLimit < start) {
-            AddFormatParts(typeString, result, formatResult, param.previousLimit, start);
+            AddFormatParts(type, spans, param.previousLimit, start);
             param.previousLimit = start;
         }
         return;
     }
     if (static_cast<UNumberFormatFields>(fieldId) == UNUM_GROUPING_SEPARATOR_FIELD) {
-        typeString = "integer";
-        AddFormatParts(typeString, result, formatResult, param.previousLimit, start);
+        type = FormatPartType::INTEGER;
+        AddFormatParts(type, spans, param.previousLimit, start);
         {
-            typeString = FormatUtils::GetNumberFieldType(param.napiType, fieldId, param.number);
-            AddFormatParts(typeString, result, formatResult, start, limit);
+            type = FormatUtils::GetNumberFieldPartType(param.napiType, fieldId, param.number);
+            AddFormatParts(type, spans, start, limit);
         }
         param.lastFieldGroup = true;
         param.groupLeapLength = start - param.previousLimit + 1;
         param.previousLimit = limit;
         return;
     } else if (start > param.previousLimit) {
-        AddFormatParts(typeString, result, formatResult, param.previousLimit, start);
+        AddFormatParts(type, spans, param.previousLimit, start);
     }
     if (param.lastFieldGroup) {
         start = start + param.groupLeapLength;
         param.lastFieldGroup = false;
     }
     if (styleString.compare("unit") == 0 && static_cast<UNumberFormatFields>(fieldId) == UNUM_PERCENT_FIELD) {
-        typeString = "unit";
+        type = FormatPartType::UNIT;
     } else {
-        typeString = FormatUtils::GetNumberFieldType(param.napiType, fieldId, param.number);
+        type = FormatUtils::GetNumberFieldPartType(param.napiType, fieldId, param.number);
     }
     if (start < param.previousLimit && param.previousLimit < limit) {
-        AddFormatParts(typeString, result, formatResult, param.previousLimit, limit);
+        AddFormatParts(type, spans, param.previousLimit, limit);
     } else {
-        AddFormatParts(typeString, result, formatResult, start, limit);
+        AddFormatParts(type, spans, start, limit);
     }
     param.previousLimit = limit;
 }
 
-void NumberFormat::AddFormatParts(std::string typeString, std::vector<std::vector<std::string>> &result,
-    icu::UnicodeString &formatResult, int32_t start, int32_t end)
-{
-    std::string value = GetSubString(formatResult, start, end);
-    std::vector<std::string> info;
-    info.push_back(typeString);
-    info.push_back(value);
-    result.push_back(info);
-}
-
-std::string NumberFormat::GetSubString(icu::UnicodeString &formatResult, int32_t start, int32_t end)
+void NumberFormat::AddFormatParts(FormatPartType type, std::vector<FormatPartSpan> &spans, int32_t start,
+    int32_t end)
 {
-    icu::UnicodeString substring = formatResult.tempSubStringBetween(start, end);
-    std::string val;
-    substring.toUTF8String(val);
-    return val;
+    spans.push_back({ type, start, end });
 }
 
 void NumberFormat::RelativeDateTimeFormatToParts(double number, std::string &finalUnit,
@@ -1106,7 +1120,10 @@ void NumberFormat::FormatRangeToParts(double first, double second,
         HILOG_ERROR_I18N("NumberFormat::FormatableRangeToParts: icu::UnicodeString.toString() failed.");
         return;
     }
-    FindAllFormatParts(numberRange, result, first, second, res);
+    FormattedParts parts;
+    FindAllFormatParts(numberRange, parts.spans, first, second, res);
+    FormatUtils::SetFormattedText(res, parts);
+    FormatUtils::AppendPartStrings(parts, result);
 }
 
 NumberFormatParts NumberFormat::FormatFormattableRangeToParts(icu::Formattable first, icu::Formattable second,
@@ -1869,13 +1886,12 @@ bool NumberFormat::DealWithUnitConvert(double& finalNumber, std::string& finalUn
 bool NumberFormat::ToMeasureUnit(const std::string &sanctionedUnit,
     icu::MeasureUnit &measureUnit)
 {
-    for (auto &unitItem : unitArray) {
-        if (std::strcmp(sanctionedUnit.c_str(), unitItem.getSubtype()) == 0) {
-            measureUnit = unitItem;
-            return true;
-        }
+    const icu::MeasureUnit* unitItem = MeasureUnitCatalog::GetInstance().Find(sanctionedUnit);
+    if (unitItem == nullptr) {
+        return false;
     }
-    return false;
+    measureUnit = *unitItem;
+    return true;
 }
 
 bool NumberFormat::IsWellFormedUnitIdentifier(icu::MeasureUnit &icuUnit,
@@ -13,9 +13,9 @@
  * limitations under the License.
  */
 #include "phone_number_format.h"
-#include <cctype>
+#include <algorithm>
+#include <array>
 #include <dlfcn.h>
-#include <regex>
 #include "unicode/localebuilder.h"
 #include "locale_config.h"
 #include "unicode/locid.h"
@@ -24,6 +24,7 @@
 #include "new"
 #include "set"
 #include "securec.h"
+#include "system_locale_snapshot.h"
 #include "string"
 #include "taboo_utils.h"
 #include "utility"
@@ -33,74 +34,34 @@ namespace OHOS {
 namespace Global {
 namespace I18n {
 const int RECV_CHAR_LEN = 128;
+constexpr size_t PHONE_CHAR_TABLE_SIZE = 256;
 using i18n::phonenumbers::PhoneNumberUtil;
 void* PhoneNumberFormat::dynamicHandler = nullptr;
-std::mutex PhoneNumberFormat::phoneMutex;
-std::mutex PhoneNumberFormat::AS_YOU_TYPE_FORMAT_MUTEX;
+std::atomic<ExposeLocationName> PhoneNumberFormat::locationNameFunc { nullptr };
+std::shared_mutex PhoneNumberFormat::phoneMutex;
+PhoneLocationCache PhoneNumberFormat::locationCache(PhoneNumberFormat::LOCATION_CACHE_SIZE);
 size_t PhoneNumberFormat::MAX_NUMBER_LENGTH = 30;
-std::map<char, char> PhoneNumberFormat::VALID_PHONE_NUMBER_CHARS {
-    { '+', '+' },
-    { ' ', ' ' },
-    { '*', '*' },
-    { '-', '-' },
-    { '#', '#' },
-    { '(', '(' },
-    { ')', ')' },
-    { ';', ';' },
-    { ',', ',' },
-    { 'A', '2' },
-    { 'B', '2' },
-    { 'C', '2' },
-    { 'D', '3' },
-    { 'E', '3' },
-    { 'F', '3' },
-    { 'G', '4' },
-    { 'H', '4' },
-    { 'I', '4' },
-    { 'J', '5' },
-    { 'K', '5' },
-    { 'L', '5' },
-    { 'M', '6' },
-    { 'N', '6' },
-    { 'O', '6' },
-    { 'P', '7' },
-    { 'Q', '7' },
-    { 'R', '7' },
-    { 'S', '7' },
-    { 'T', '8' },
-    { 'U', '8' },
-    { 'V', '8' },
-    { 'W', '9' },
-    { 'X', '9' },
-    { 'Y', '9' },
-    { 'Z', '9' },
-    { 'a', '2' },
-    { 'b', '2' },
-    { 'c', '2' },
-    { 'd', '3' },
-    { 'e', '3' },
-    { 'f', '3' },
-    { 'g', '4' },
-    { 'h', '4' },
-    { 'i', '4' },
-    { 'j', '5' },
-    { 'k', '5' },
-    { 'l', '5' },
-    { 'm', '6' },
-    { 'n', '6' },
-    { 'o', '6' },
-    { 'p', '7' },
-    { 'q', '7' },
-    { 'r', '7' },
-    { 's', '7' },
-    { 't', '8' },
-    { 'u', '8' },
-    { 'v', '8' },
-    { 'w', '9' },
-    { 'x', '9' },
-    { 'y', '9' },
-    { 'z', '9' },
-};
+
+// Digits and separators map to themselves, letters to their keypad digit, other bytes to 0.
+static constexpr std::array<char, PHONE_CHAR_TABLE_SIZE> BuildPhoneCharTable()
+{
+    std::array<char, PHONE_CHAR_TABLE_SIZE> table {};
+    const char* keypadDigits = "22233344455566677778889999";
+    for (char c = 'A'; c <= 'Z'; ++c) {
+        table[static_cast<unsigned char>(c)] = keypadDigits[c - 'A'];
+        table[static_cast<unsigned char>(c - 'A' + 'a')] = keypadDigits[c - 'A'];
+    }
+    for (char c = '0'; c <= '9'; ++c) {
+        table[static_cast<unsigned char>(c)] = c;
+    }
+    const char* separators = "+ *-#();,";
+    for (const char* c = separators; *c != '\0'; ++c) {
+        table[static_cast<unsigned char>(*c)] = *c;
+    }
+    return table;
+}
+
+static constexpr std::array<char, PHONE_CHAR_TABLE_SIZE> PHONE_CHAR_TABLE = BuildPhoneCharTable();
 
 PhoneNumberFormat::PhoneNumberFormat(const std::string &countryTag,
                                      const std::map<std::string, std::string> &options)
@@ -133,6 +94,10 @@ PhoneNumberFormat::PhoneNumberFormat(const std::string &countryTag,
     }
     if (formatType.compare("TYPING") == 0 && util != nullptr) {
         formatter = std::unique_ptr<AsYouTypeFormatter>(util->GetAsYouTypeFormatter(country));
+        inputDigits.reserve(MAX_NUMBER_LENGTH);
+        lastFormatNumber.reserve(MAX_NUMBER_LENGTH);
+    } else {
+        digitSubstitution = CreateDigitSubstitution(SystemLocaleSnapshot::Get()->version);
     }
 }
 
@@ -142,13 +107,24 @@ PhoneNumberFormat::~PhoneNumberFormat()
 
 void PhoneNumberFormat::CloseDynamicHandler()
 {
-    std::lock_guard<std::mutex> phoneLock(phoneMutex);
+    std::unique_lock<std::shared_mutex> phoneLock(phoneMutex);
+    locationNameFunc.store(nullptr, std::memory_order_release);
     if (dynamicHandler != nullptr) {
         dlclose(dynamicHandler);
     }
     dynamicHandler = nullptr;
 }
 
+uint64_t PhoneNumberFormat::GetLocationCacheHitCount()
+{
+    return locationCache.GetHitCount();
+}
+
+uint64_t PhoneNumberFormat::GetLocationCacheMissCount()
+{
+    return locationCache.GetMissCount();
+}
+
 std::unique_ptr<PhoneNumberFormat> PhoneNumberFormat::CreateInstance(const std::string &countryTag,
     const std::map<std::string, std::string> &options)
 {
@@ -199,52 +175,96 @@ std::string PhoneNumberFormat::format(const std::string &number)
     } else {
         util->Format(phoneNumber, phoneNumberFormat, &formattedNumber);
     }
+    return PseudoLocalizationProcessor(SubstituteDigits(formattedNumber));
+}
+
+std::string PhoneNumberFormat::SubstituteDigits(const std::string &formattedNumber)
+{
+    std::shared_ptr<const DigitSubstitution> substitution = GetDigitSubstitution();
+    if (substitution == nullptr || !substitution->enabled) {
+        return formattedNumber;
+    }
+    static const std::string leftToRightOverride = "\u202d";
+    static const std::string popDirectionalFormatting = "\u202c";
+    std::string result;
+    result.reserve(formattedNumber.length() * substitution->maxDigitLength + leftToRightOverride.length() +
+        popDirectionalFormatting.length());
+    if (substitution->addDirectionMarks) {
+        result.append(leftToRightOverride);
+    }
+    for (char c : formattedNumber) {
+        if (c >= '0' && c <= '9') {
+            result.append(substitution->digits[c - '0']);
+        } else {
+            result.push_back(c);
+        }
+    }
+    if (substitution->addDirectionMarks) {
+        result.append(popDirectionalFormatting);
+    }
+    return result;
+}
+
+std::shared_ptr<const PhoneNumberFormat::DigitSubstitution> PhoneNumberFormat::GetDigitSubstitution()
+{
+    uint64_t localeVersion = SystemLocaleSnapshot::Get()->version;
+    std::shared_ptr<const DigitSubstitution> substitution = std::atomic_load(&digitSubstitution);
+    if (substitution != nullptr && substitution->localeVersion == localeVersion) {
+        return substitution;
+    }
+    substitution = CreateDigitSubstitution(localeVersion);
+    std::atomic_store(&digitSubstitution, substitution);
+    return substitution;
+}
+
+std::shared_ptr<const PhoneNumberFormat::DigitSubstitution> PhoneNumberFormat::CreateDigitSubstitution(
+    uint64_t localeVersion)
+{
+    std::shared_ptr<DigitSubstitution> substitution = std::make_shared<DigitSubstitution>();
+    substitution->localeVersion = localeVersion;
     std::string usingNumberingSystem;
     LocaleConfig::GetUsingNumberingSystem(usingNumberingSystem);
     icu::UnicodeString replaceDigit = LocaleConfig::GetNumberingSystemDigit(usingNumberingSystem).c_str();
     if (replaceDigit.isEmpty() || usingNumberingSystem.compare("latn") == 0) {
-        return PseudoLocalizationProcessor(formattedNumber);
-    }
-    icu::UnicodeString replaceNumber;
-    for (auto& number : formattedNumber) {
-        if (number <= '9' && number >= '0') {
-            replaceNumber += replaceDigit.char32At(number - '0');
-            continue;
-        } else {
-            replaceNumber += number;
-        }
+        return substitution;
     }
-    if (usingNumberingSystem.compare("arabext") == 0 || usingNumberingSystem.compare("arab") == 0) {
-        replaceNumber =  "\u202d" + replaceNumber + "\u202c";
+    for (size_t i = 0; i < DIGIT_COUNT; ++i) {
+        icu::UnicodeString digit(replaceDigit.char32At(static_cast<int32_t>(i)));
+        digit.toUTF8String(substitution->digits[i]);
+        substitution->maxDigitLength = std::max(substitution->maxDigitLength, substitution->digits[i].length());
     }
-    std::string result;
-    replaceNumber.toUTF8String(result);
-    return PseudoLocalizationProcessor(result);
+    substitution->enabled = true;
+    substitution->addDirectionMarks = usingNumberingSystem.compare("arabext") == 0 ||
+        usingNumberingSystem.compare("arab") == 0;
+    return substitution;
 }
 
 std::string PhoneNumberFormat::GetAsYouTypeFormatResult(const std::string &number)
 {
-    std::lock_guard<std::mutex> formatLock(AS_YOU_TYPE_FORMAT_MUTEX);
+    std::lock_guard<std::mutex> formatLock(asYouTypeMutex);
     if (formatter == nullptr || number.length() > MAX_NUMBER_LENGTH) {
         return number;
     }
-    std::regex pattern("[^\\d]");
-    std::string phoneNumber = std::regex_replace(number, pattern, "");
-    if (lastFormatNumber.length() > 0 && phoneNumber.length() == lastFormatNumber.length() + 1) {
-        if (phoneNumber.compare(0, lastFormatNumber.length(), lastFormatNumber) != 0) {
-            return FormatAllInputNumber(number, phoneNumber);
+    inputDigits.clear();
+    for (char c : number) {
+        if (c >= '0' && c <= '9') {
+            inputDigits.push_back(c);
         }
-        char lastChar = *(phoneNumber.rbegin());
-        std::string result;
-        this->lastFormatNumber = phoneNumber;
-        return formatter->InputDigit(lastChar, &result);
+    }
+    if (lastFormatNumber.length() > 0 && inputDigits.length() == lastFormatNumber.length() + 1) {
+        if (inputDigits.compare(0, lastFormatNumber.length(), lastFormatNumber) != 0) {
+            return FormatAllInputNumber(number, inputDigits);
+        }
+        char lastChar = *(inputDigits.rbegin());
+        this->lastFormatNumber.push_back(lastChar);
+        return formatter->InputDigit(lastChar, &typingResult);
     }
 
-    return FormatAllInputNumber(number, phoneNumber);
+    return FormatAllInputNumber(number, inputDigits);
 }
 
 std::string PhoneNumberFormat::FormatAllInputNumber(const std::string &originalNumber,
-                                                    std::string &replacedNumber)
+                                                    const std::string &replacedNumber)
 {
     if (formatter == nullptr) {
         HILOG_ERROR_I18N("PhoneNumberFormat::FormatAllInputNumber: formatter is nullptr.");
@@ -252,19 +272,14 @@ std::string PhoneNumberFormat::FormatAllInputNumber(const std::string &originalN
     }
     formatter->Clear();
     this->lastFormatNumber = replacedNumber;
-    std::string result;
-    std::string formattedNumber;
-    for (size_t i = 0; i < originalNumber.length(); i++) {
-        char c = originalNumber.at(i);
-        auto iter = VALID_PHONE_NUMBER_CHARS.find(c);
-        if (isdigit(c)) {
-            formattedNumber = formatter->InputDigit(c, &result);
-        } else if (iter != VALID_PHONE_NUMBER_CHARS.end()) {
-            char replacedChar = VALID_PHONE_NUMBER_CHARS[c];
-            formattedNumber = formatter->InputDigit(replacedChar, &result);
+    typingResult.clear();
+    for (char c : originalNumber) {
+        char replacedChar = PHONE_CHAR_TABLE[static_cast<unsigned char>(c)];
+        if (replacedChar != '\0') {
+            formatter->InputDigit(replacedChar, &typingResult);
         }
     }
-    return formattedNumber;
+    return typingResult;
 }
 
 std::string GetRegionDisplayName(const std::string &regionCode, const icu::Locale &displayLocale)
@@ -342,40 +357,49 @@ std::string PhoneNumberFormat::getPhoneLocationName(
     const std::string& number, const std::string& phoneLocale,
     const std::string& displayLocale)
 {
-    OpenHandler();
-    std::lock_guard<std::mutex> phoneLock(phoneMutex);
+    bool isTyping = (formatType == "TYPING");
+    // The library resolves the longest matching prefix internally, so the whole number is the key.
+    std::string cacheKey = phoneLocale + (isTyping ? "|T|" : "|N|") + number;
     std::string locName;
-    if (dynamicHandler) {
-        HILOG_INFO_I18N("LocationNameFunc Init");
-        ExposeLocationName locationNameFunc = reinterpret_cast<ExposeLocationName>(
-            dlsym(dynamicHandler, "exposeLocationName"));
-        if (locationNameFunc) {
-            // The function uses the same locale for phone and display.
-            char recvArr[RECV_CHAR_LEN];
-            const char* numberArr = number.c_str();
-            const char* phoneLocaleArr = phoneLocale.c_str();
-            locationNameFunc(numberArr, phoneLocaleArr, recvArr, RECV_CHAR_LEN, (formatType == "TYPING"));
-            locName = recvArr;
+    if (locationCache.Find(cacheKey, locName)) {
+        return locName;
+    }
+    OpenHandler();
+    {
+        std::shared_lock<std::shared_mutex> phoneLock(phoneMutex);
+        ExposeLocationName func = locationNameFunc.load(std::memory_order_acquire);
+        if (func == nullptr) {
+            return locName;
         }
+        // The function uses the same locale for phone and display.
+        char recvArr[RECV_CHAR_LEN] = { 0 };
+        func(number.c_str(), phoneLocale.c_str(), recvArr, RECV_CHAR_LEN, isTyping);
+        locName = recvArr;
     }
+    locationCache.Insert(cacheKey, locName);
     return locName;
 }
 
 void PhoneNumberFormat::OpenHandler()
 {
+    if (locationNameFunc.load(std::memory_order_acquire) != nullptr) {
+        return;
+    }
+    HILOG_INFO_I18N("DynamicHandler init.");
+    std::unique_lock<std::shared_mutex> phoneLock(phoneMutex);
     if (dynamicHandler == nullptr) {
-        HILOG_INFO_I18N("DynamicHandler init.");
-        std::lock_guard<std::mutex> phoneLock(phoneMutex);
-        if (dynamicHandler == nullptr) {
-            HILOG_INFO_I18N("DynamicHandler lock init.");
+        HILOG_INFO_I18N("DynamicHandler lock init.");
 #ifndef SUPPORT_ASAN
-            const char* geocodingSO = "libgeocoding.z.so";
+        const char* geocodingSO = "libgeocoding.z.so";
 #else
-            const char* geocodingSO = "system/asan/lib64/platformsdk/libgeocoding.z.so";
+        const char* geocodingSO = "system/asan/lib64/platformsdk/libgeocoding.z.so";
 #endif
-            HILOG_INFO_I18N("DynamicHandler lock init.");
-            dynamicHandler = dlopen(geocodingSO, RTLD_NOW);
-        }
+        dynamicHandler = dlopen(geocodingSO, RTLD_NOW);
+    }
+    if (dynamicHandler != nullptr && locationNameFunc.load(std::memory_order_relaxed) == nullptr) {
+        HILOG_INFO_I18N("LocationNameFunc Init");
+        locationNameFunc.store(reinterpret_cast<ExposeLocationName>(dlsym(dynamicHandler, "exposeLocationName")),
+            std::memory_order_release);
     }
 }
 
@@ -387,8 +411,7 @@ bool PhoneNumberFormat::getBlockedRegionName(
         HILOG_ERROR_I18N("PhoneNumberFormat::getBlockedRegionName: tabooUtils is nullptr.");
         return false;
     }
-    std::unordered_set<std::string> blockedRegions = tabooUtils->GetBlockedRegions(language);
-    return blockedRegions.find(regionCode) != blockedRegions.end();
+    return tabooUtils->IsBlockedRegion(regionCode, language);
 }
 
 std::string PhoneNumberFormat::getCityName(const std::string& language, const std::string& phonenumber,
@@ -399,11 +422,8 @@ std::string PhoneNumberFormat::getCityName(const std::string& language, const st
         HILOG_ERROR_I18N("PhoneNumberFormat::getCityName: tabooUtils is nullptr.");
         return locationName;
     }
-    std::unordered_set<std::string> blockedPhoneNumbers = tabooUtils->GetBlockedPhoneNumbers();
-    for (const auto& blockedPhoneNumber : blockedPhoneNumbers) {
-        if (phonenumber.compare(0, blockedPhoneNumber.length(), blockedPhoneNumber) == 0) {
-            return "";
-        }
+    if (tabooUtils->IsBlockedPhoneNumber(phonenumber)) {
+        return "";
     }
     return tabooUtils->ReplacePhoneLocationName(phonenumber, language, locationName);
 }
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "phone_prefix_trie.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+PhonePrefixTrie::PhonePrefixTrie() : nodes(1)
+{
+}
+
+void PhonePrefixTrie::Insert(const std::string& prefix)
+{
+    uint32_t node = 0;
+    for (char c : prefix) {
+        int64_t child = FindChild(node, c);
+        if (child < 0) {
+            uint32_t next = static_cast<uint32_t>(nodes.size());
+            nodes.emplace_back();
+            nodes[node].children.emplace_back(c, next);
+            node = next;
+        } else {
+            node = static_cast<uint32_t>(child);
+        }
+    }
+    nodes[node].isEnd = true;
+}
+
+bool PhonePrefixTrie::FindLongestPrefix(const std::string& phoneNumber, size_t& length) const
+{
+    bool found = nodes[0].isEnd;
+    length = 0;
+    uint32_t node = 0;
+    for (size_t i = 0; i < phoneNumber.length(); ++i) {
+        int64_t child = FindChild(node, phoneNumber[i]);
+        if (child < 0) {
+            break;
+        }
+        node = static_cast<uint32_t>(child);
+        if (nodes[node].isEnd) {
+            found = true;
+            length = i + 1;
+        }
+    }
+    return found;
+}
+
+bool PhonePrefixTrie::Empty() const
+{
+    return nodes.size() == 1 && !nodes[0].isEnd;
+}
+
+int64_t PhonePrefixTrie::FindChild(uint32_t node, char c) const
+{
+    for (const auto& child : nodes[node].children) {
+        if (child.first == c) {
+            return static_cast<int64_t>(child.second);
+        }
+    }
+    return -1;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
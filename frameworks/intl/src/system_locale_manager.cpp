@@ -14,6 +14,7 @@
  */
 
 #include <cctype>
+#include <numeric>
 #include "i18n_hilog.h"
 #include "locale_config.h"
 #include "system_locale_manager.h"
@@ -225,6 +226,17 @@ LocaleItem SystemLocaleManager::GetLocaleItem(const std::string &region,
     return item;
 }
 
+template<typename T>
+static void ApplySortOrder(const std::vector<size_t> &order, std::vector<T> &items)
+{
+    std::vector<T> sorted;
+    sorted.reserve(items.size());
+    for (size_t index : order) {
+        sorted.push_back(std::move(items[index]));
+    }
+    items.swap(sorted);
+}
+
 void SystemLocaleManager::SortLocaleItemList(std::vector<LocaleItem> &localeItemList, const SortOptions &options)
 {
     std::vector<std::string> collatorLocaleTags { options.localeTag };
@@ -233,36 +245,29 @@ void SystemLocaleManager::SortLocaleItemList(std::vector<LocaleItem> &localeItem
     if (collator == nullptr) {
         return;
     }
-    auto compareFunc = [collator, options](LocaleItem item1, LocaleItem item2) {
-        if (options.isSuggestedFirst) {
-            if (item1.suggestionType < item2.suggestionType) {
-                return false;
-            } else if (item1.suggestionType > item2.suggestionType) {
-                return true;
-            }
-        }
-        CompareResult result = CompareResult::INVALID;
-        if (item1.localName.length() != 0) {
-            result = collator->Compare(item1.localName, item2.localName);
-            if (result == CompareResult::SMALLER) {
-                return true;
-            }
-            if (result == CompareResult::INVALID) {
-                HILOG_ERROR_I18N("SystemLocaleManager: invalid compare result for local name.");
-            }
-            return false;
-        }
-        result = collator->Compare(item1.displayName, item2.displayName);
-        if (result == CompareResult::SMALLER) {
-            return true;
-        }
-        if (result == CompareResult::INVALID) {
-            HILOG_ERROR_I18N("SystemLocaleManager: invalid compare result for display name.");
+    std::vector<std::string> sortTexts;
+    sortTexts.reserve(localeItemList.size());
+    for (const LocaleItem &item : localeItemList) {
+        sortTexts.push_back(item.localName.length() != 0 ? item.localName : item.displayName);
+    }
+    SortKeyBatch sortKeys;
+    bool success = collator->GetSortKeys(sortTexts, sortKeys);
+    delete collator;
+    if (!success) {
+        HILOG_ERROR_I18N("SystemLocaleManager::SortLocaleItemList: get sort keys failed.");
+        return;
+    }
+    std::vector<size_t> order(localeItemList.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto compareFunc = [&localeItemList, &sortKeys, &options](size_t first, size_t second) {
+        if (options.isSuggestedFirst &&
+            localeItemList[first].suggestionType != localeItemList[second].suggestionType) {
+            return localeItemList[first].suggestionType > localeItemList[second].suggestionType;
         }
-        return false;
+        return sortKeys.Less(first, second);
     };
-    std::sort(localeItemList.begin(), localeItemList.end(), compareFunc);
-    delete collator;
+    std::stable_sort(order.begin(), order.end(), compareFunc);
+    ApplySortOrder(order, localeItemList);
 }
 
 bool SystemLocaleManager::IsLanguageSimRegionSuggest(const std::unordered_set<std::string> &simRegions,
@@ -321,16 +326,17 @@ std::vector<TimeZoneCityItem> SystemLocaleManager::GetTimezoneCityInfoArray(I18n
 std::vector<TimeZoneCityItem> SystemLocaleManager::GetTimezoneCityInfoArray()
 {
     std::vector<TimeZoneCityItem> result;
-    std::unordered_set<std::string> zoneCityIds = I18nTimeZone::GetAvailableZoneCityIDs();
+    std::shared_ptr<const std::unordered_set<std::string>> zoneCityIds = I18nTimeZone::GetAvailableZoneCityIDSet();
     std::string locale = LocaleConfig::GetEffectiveLocale();
     std::string localeBaseName = I18nTimeZone::GetLocaleBaseName(locale);
-    std::map<std::string, std::string> displayNameMap = I18nTimeZone::FindCityDisplayNameMap(localeBaseName);
+    std::shared_ptr<const CityDisplayNameTable> displayNames = I18nTimeZone::GetCityDisplayNameTable(localeBaseName);
     std::map<std::string, icu::TimeZone*> tzMap;
-    for (const auto& cityId : zoneCityIds) {
-        if (displayNameMap.find(cityId) == displayNameMap.end()) {
+    for (const auto& cityId : *zoneCityIds) {
+        auto displayNameIter = displayNames->find(cityId);
+        if (displayNameIter == displayNames->end()) {
             continue;
         }
-        std::string cityDisplayName = displayNameMap.find(cityId)->second;
+        std::string cityDisplayName = displayNameIter->second;
         cityDisplayName = GetCityDisplayNameWithTaboo(cityId, localeBaseName, cityDisplayName);
         int32_t rawOffset = 0;
         int32_t dstOffset = 0;
@@ -379,19 +385,24 @@ void SystemLocaleManager::SortTimezoneCityItemList(const std::string &locale,
     if (collator == nullptr) {
         return;
     }
-    auto sortFunc = [collator](TimeZoneCityItem item1, TimeZoneCityItem item2) {
-        CompareResult result = CompareResult::INVALID;
-        result = collator->Compare(item1.cityDisplayName, item2.cityDisplayName);
-        if (result == CompareResult::SMALLER) {
-            return true;
-        }
-        if (result == CompareResult::INVALID) {
-            HILOG_ERROR_I18N("SystemLocaleManager: invalid compare result for city display name.");
-        }
-        return false;
-    };
-    std::sort(timezoneCityItemList.begin(), timezoneCityItemList.end(), sortFunc);
+    std::vector<std::string> sortTexts;
+    sortTexts.reserve(timezoneCityItemList.size());
+    for (const TimeZoneCityItem &item : timezoneCityItemList) {
+        sortTexts.push_back(item.cityDisplayName);
+    }
+    SortKeyBatch sortKeys;
+    bool success = collator->GetSortKeys(sortTexts, sortKeys);
     delete collator;
+    if (!success) {
+        HILOG_ERROR_I18N("SystemLocaleManager::SortTimezoneCityItemList: get sort keys failed.");
+        return;
+    }
+    std::vector<size_t> order(timezoneCityItemList.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sortKeys](size_t first, size_t second) {
+        return sortKeys.Less(first, second);
+    });
+    ApplySortOrder(order, timezoneCityItemList);
 }
 
 std::unordered_set<std::string> SystemLocaleManager::GetCountryCodeFromSimCard()
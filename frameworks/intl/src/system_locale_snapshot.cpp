@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "system_locale_snapshot.h"
+
+#include <atomic>
+#include "i18n_hilog.h"
+#include "locale_config.h"
+#include "parameter.h"
+#include "unicode/locid.h"
+#include "utils.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+namespace {
+const std::string PSEUDO_LOCALE_TAG = "en-XA";
+const std::string DEFAULT_LOCALE = "zh-Hans-CN";
+const std::string DEFAULT_LANGUAGE = "zh-Hans";
+const std::string DEFAULT_REGION = "CN";
+constexpr uint32_t INVALID_PARAMETER_HANDLE = static_cast<uint32_t>(-1);
+constexpr uint32_t RESOLVED_COUNT_OFFSET = 48;
+
+class SystemParameterBackend : public SystemLocaleSnapshot::ParameterBackend {
+public:
+    explicit SystemParameterBackend(const std::vector<std::string>& keys) : keys(keys), handles(keys.size())
+    {
+        for (std::atomic<uint32_t>& handle : handles) {
+            handle.store(INVALID_PARAMETER_HANDLE);
+        }
+        ResolveHandles();
+    }
+
+    std::string Read(const std::string& key) override
+    {
+        return ReadSystemParameter(key.c_str(), LocaleConfig::CONFIG_LEN);
+    }
+
+    uint64_t GetSerial() override
+    {
+        // A parameter which does not exist yet is looked up again only after some parameter was written.
+        if (resolvedCount.load() < handles.size()) {
+            long long systemCommitId = GetSystemCommitId();
+            if (lastSystemCommitId.exchange(systemCommitId) != systemCommitId) {
+                ResolveHandles();
+            }
+        }
+        uint64_t serial = 0;
+        for (const std::atomic<uint32_t>& handle : handles) {
+            uint32_t value = handle.load();
+            if (value != INVALID_PARAMETER_HANDLE) {
+                serial += GetParameterCommitId(value);
+            }
+        }
+        // The resolved count takes part in the serial so that a parameter created later is also detected.
+        return (static_cast<uint64_t>(resolvedCount.load()) << RESOLVED_COUNT_OFFSET) + serial;
+    }
+
+private:
+    void ResolveHandles()
+    {
+        std::lock_guard<std::mutex> lock(resolveMutex);
+        size_t count = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (handles[i].load() == INVALID_PARAMETER_HANDLE) {
+                handles[i].store(FindParameter(keys[i].c_str()));
+            }
+            if (handles[i].load() != INVALID_PARAMETER_HANDLE) {
+                ++count;
+            }
+        }
+        resolvedCount.store(count);
+    }
+
+    const std::vector<std::string> keys;
+    std::vector<std::atomic<uint32_t>> handles;
+    std::atomic<size_t> resolvedCount { 0 };
+    std::atomic<long long> lastSystemCommitId { 0 };
+    std::mutex resolveMutex;
+};
+} // namespace
+
+std::mutex SystemLocaleSnapshot::updateMutex;
+std::shared_ptr<const SystemLocaleSnapshot::SnapshotEntry> SystemLocaleSnapshot::snapshot = nullptr;
+std::shared_ptr<SystemLocaleSnapshot::ParameterBackend> SystemLocaleSnapshot::parameterBackend = nullptr;
+
+std::shared_ptr<const SystemLocaleInfo> SystemLocaleSnapshot::Get()
+{
+    std::shared_ptr<ParameterBackend> backend = GetParameterBackend();
+    uint64_t serial = backend->GetSerial();
+    std::shared_ptr<const SnapshotEntry> current = std::atomic_load(&snapshot);
+    if (current != nullptr && current->serial == serial) {
+        return current->info;
+    }
+    std::lock_guard<std::mutex> lock(updateMutex);
+    current = std::atomic_load(&snapshot);
+    if (current != nullptr && current->serial == serial) {
+        return current->info;
+    }
+    uint64_t version = (current == nullptr) ? 1 : current->info->version + 1;
+    auto updated = std::make_shared<SnapshotEntry>();
+    updated->info = Load(*backend, version);
+    updated->serial = serial;
+    std::atomic_store(&snapshot, std::shared_ptr<const SnapshotEntry>(updated));
+    return updated->info;
+}
+
+void SystemLocaleSnapshot::SetParameterBackend(std::shared_ptr<ParameterBackend> backend)
+{
+    std::lock_guard<std::mutex> lock(updateMutex);
+    std::atomic_store(&parameterBackend, backend);
+    std::atomic_store(&snapshot, std::shared_ptr<const SnapshotEntry>(nullptr));
+}
+
+std::shared_ptr<SystemLocaleSnapshot::ParameterBackend> SystemLocaleSnapshot::GetParameterBackend()
+{
+    static std::shared_ptr<ParameterBackend> systemBackend = std::make_shared<SystemParameterBackend>(GetWatchedKeys());
+    std::shared_ptr<ParameterBackend> backend = std::atomic_load(&parameterBackend);
+    return (backend == nullptr) ? systemBackend : backend;
+}
+
+const std::vector<std::string>& SystemLocaleSnapshot::GetWatchedKeys()
+{
+    static const std::vector<std::string> watchedKeys = {
+        LocaleConfig::LOCALE_KEY,
+        LocaleConfig::DEFAULT_LOCALE_KEY,
+        LocaleConfig::LANGUAGE_KEY,
+        LocaleConfig::DEFAULT_LANGUAGE_KEY,
+        LocaleConfig::TIMEZONE_KEY,
+        LocaleConfig::HOUR_KEY,
+    };
+    return watchedKeys;
+}
+
+std::shared_ptr<const SystemLocaleInfo> SystemLocaleSnapshot::Load(ParameterBackend& backend, uint64_t version)
+{
+    auto info = std::make_shared<SystemLocaleInfo>();
+    info->version = version;
+    std::string effectiveLocale = backend.Read(LocaleConfig::LOCALE_KEY);
+    if (effectiveLocale.empty()) {
+        effectiveLocale = backend.Read(LocaleConfig::DEFAULT_LOCALE_KEY);
+    }
+    if (effectiveLocale.empty()) {
+        HILOG_ERROR_I18N("SystemLocaleSnapshot::Load: Read default system locale failed.");
+        effectiveLocale = DEFAULT_LOCALE;
+    }
+    info->locale = effectiveLocale;
+    std::vector<std::pair<size_t, std::string>> positions = LocaleConfig::GetExtParamPositions(effectiveLocale);
+    if (positions[0].first != std::string::npos) {
+        info->locale = effectiveLocale.substr(0, positions[0].first);
+    }
+    info->language = backend.Read(LocaleConfig::LANGUAGE_KEY);
+    if (info->language.empty()) {
+        info->language = backend.Read(LocaleConfig::DEFAULT_LANGUAGE_KEY);
+    }
+    if (info->language.empty()) {
+        info->language = DEFAULT_LANGUAGE;
+    }
+    info->region = ReadRegion(backend);
+    info->timezone = backend.Read(LocaleConfig::TIMEZONE_KEY);
+    if (info->timezone.empty()) {
+        info->timezone = LocaleConfig::DEFAULT_TIMEZONE;
+    }
+    std::string is24Hour = backend.Read(LocaleConfig::HOUR_KEY);
+    if (is24Hour.compare("default") == 0) {
+        info->is24HourClock = LocaleConfig::Is24HourLocale(effectiveLocale);
+    } else {
+        info->is24HourClock = (is24Hour.compare("true") == 0);
+    }
+    info->pseudoLocalization = (info->locale.compare(PSEUDO_LOCALE_TAG) == 0);
+    return info;
+}
+
+std::string SystemLocaleSnapshot::ReadRegion(ParameterBackend& backend)
+{
+    for (const std::string& key : { LocaleConfig::LOCALE_KEY, std::string(LocaleConfig::DEFAULT_LOCALE_KEY) }) {
+        std::string localeTag = backend.Read(key);
+        if (localeTag.empty()) {
+            continue;
+        }
+        UErrorCode status = U_ZERO_ERROR;
+        icu::Locale locale = icu::Locale::forLanguageTag(localeTag, status);
+        if (U_SUCCESS(status) && strlen(locale.getCountry()) > 0) {
+            return locale.getCountry();
+        }
+    }
+    return DEFAULT_REGION;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
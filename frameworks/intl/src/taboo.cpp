@@ -77,6 +77,7 @@ Taboo::Taboo(const std::string& path) : tabooDataPath(path)
     ParseTabooData(tabooConfigFilePath, DataFileType::CONFIG_FILE);
     ReadResourceList();
     InitFallBackSuffixes();
+    ResolveFallBackData();
 }
 
 Taboo::~Taboo()
@@ -90,81 +91,27 @@ std::string Taboo::ReplaceCountryName(const std::string& region, const std::stri
         HILOG_ERROR_I18N("Taboo::ReplaceCountryName: Taboo data not exist.");
         return name;
     }
-    if (supportedRegions.find(region) == supportedRegions.end()) {
-        return name;
-    }
-    std::string fallbackLanguage;
-    std::string fileName;
-    std::tie(fallbackLanguage, fileName) = LanguageFallBack(displayLanguage);
-    if (fallbackLanguage.empty()) {
-        return name;
-    }
-    InitLocaleTabooData(fallbackLanguage, fileName);
-    auto tabooData = localeTabooData[fallbackLanguage];
-    std::string key = REGION_KEY + region;
-    std::vector<std::string> fallbackRegionKeys = QueryKeyFallBack(key);
-    for (auto& fallbackRegionKey : fallbackRegionKeys) {
-        if (tabooData.find(fallbackRegionKey) != tabooData.end()) {
-            return tabooData.at(fallbackRegionKey);
-        }
-    }
-    return name;
+    return ReplaceName(regionFallBackKeys, region, displayLanguage, name);
 }
 
 std::string Taboo::ReplaceLanguageName(const std::string& language, const std::string& displayLanguage,
     const std::string& name)
 {
     if (!isTabooDataExist) {
-        HILOG_ERROR_I18N("Taboo::ReplaceCountryName: Taboo data not exist.");
+        HILOG_ERROR_I18N("Taboo::ReplaceLanguageName: Taboo data not exist.");
         return name;
     }
-    if (supportedLanguages.find(language) == supportedLanguages.end()) {
-        return name;
-    }
-    std::string fallbackLanguage;
-    std::string fileName;
-    std::tie(fallbackLanguage, fileName) = LanguageFallBack(displayLanguage);
-    if (fallbackLanguage.empty()) {
-        return name;
-    }
-    InitLocaleTabooData(fallbackLanguage, fileName);
-    auto tabooData = localeTabooData[fallbackLanguage];
-    std::string key = LANGUAGE_KEY + language;
-    std::vector<std::string> fallbackLanguageKeys = QueryKeyFallBack(key);
-    for (const auto& fallbackLanguageKey : fallbackLanguageKeys) {
-        if (tabooData.find(fallbackLanguageKey) != tabooData.end()) {
-            return tabooData.at(fallbackLanguageKey);
-        }
-    }
-    return name;
+    return ReplaceName(languageFallBackKeys, language, displayLanguage, name);
 }
 
 std::string Taboo::ReplaceTimeZoneName(const std::string& tzId, const std::string& displayLanguage,
     const std::string& name)
 {
     if (!isTabooDataExist) {
-        HILOG_ERROR_I18N("Taboo::ReplaceCountryName: Taboo data not exist.");
-        return name;
-    }
-    if (supportedTimeZones.find(tzId) == supportedTimeZones.end()) {
-        return name;
-    }
-    std::string fallbackLanguage;
-    std::string fileName;
-    std::tie(fallbackLanguage, fileName) = LanguageFallBack(displayLanguage);
-    if (fallbackLanguage.empty()) {
+        HILOG_ERROR_I18N("Taboo::ReplaceTimeZoneName: Taboo data not exist.");
         return name;
     }
-    InitLocaleTabooData(fallbackLanguage, fileName);
-    auto tabooData = localeTabooData[fallbackLanguage];
-    std::string key = TIME_ZONE_KEY + tzId;
-    std::vector<std::string> fallbackTimeZoneKeys = QueryKeyFallBack(key);
-    for (const auto& fallbackTimeZoneKey : fallbackTimeZoneKeys) {
-        if (tabooData.find(fallbackTimeZoneKey) != tabooData.end()) {
-            return tabooData.at(fallbackTimeZoneKey);
-        }
-    }
-    return name;
+    return ReplaceName(timeZoneFallBackKeys, tzId, displayLanguage, name);
 }
 
 std::string Taboo::ReplaceCityName(const std::string& cityId, const std::string& displayLanguage,
@@ -174,42 +121,28 @@ std::string Taboo::ReplaceCityName(const std::string& cityId, const std::string&
         HILOG_ERROR_I18N("Taboo::ReplaceCityName: Taboo data not exist.");
         return name;
     }
-    if (supportedcities.find(cityId) == supportedcities.end()) {
-        return name;
-    }
-    std::string fallbackLanguage;
-    std::string fileName;
-    std::tie(fallbackLanguage, fileName) = LanguageFallBack(displayLanguage);
-    if (fallbackLanguage.empty()) {
-        return name;
-    }
-    InitLocaleTabooData(fallbackLanguage, fileName);
-    auto tabooData = localeTabooData[fallbackLanguage];
-    std::string key = CITY_KEY + cityId;
-    std::vector<std::string> fallbackCityKeys = QueryKeyFallBack(key);
-    for (const auto& fallbackCityKey : fallbackCityKeys) {
-        if (tabooData.find(fallbackCityKey) != tabooData.end()) {
-            return tabooData.at(fallbackCityKey);
-        }
-    }
-    return name;
+    return ReplaceName(cityFallBackKeys, cityId, displayLanguage, name);
 }
 
 std::string Taboo::ReplacePhoneLocationName(const std::string& phoneNumber, const std::string& displayLanguage,
     const std::string& name)
 {
     if (!isTabooDataExist) {
-        HILOG_ERROR_I18N("Taboo::ReplaceCountryName: Taboo data not exist.");
+        HILOG_ERROR_I18N("Taboo::ReplacePhoneLocationName: Taboo data not exist.");
         return name;
     }
-    std::string prefix;
-    for (const auto& supportedPhoneNumber : supportedPhoneNumbers) {
-        if (phoneNumber.compare(0, supportedPhoneNumber.length(), supportedPhoneNumber) == 0) {
-            prefix = supportedPhoneNumber;
-            break;
-        }
+    size_t prefixLength = 0;
+    if (!supportedPhoneNumberTrie.FindLongestPrefix(phoneNumber, prefixLength) || prefixLength == 0) {
+        return name;
     }
-    if (prefix.empty()) {
+    return ReplaceName(phoneNumberFallBackKeys, phoneNumber.substr(0, prefixLength), displayLanguage, name);
+}
+
+std::string Taboo::ReplaceName(const FallbackKeyMap& fallbackKeys, const std::string& id,
+    const std::string& displayLanguage, const std::string& name)
+{
+    auto keysIter = fallbackKeys.find(id);
+    if (keysIter == fallbackKeys.end()) {
         return name;
     }
     std::string fallbackLanguage;
@@ -218,13 +151,14 @@ std::string Taboo::ReplacePhoneLocationName(const std::string& phoneNumber, cons
     if (fallbackLanguage.empty()) {
         return name;
     }
-    InitLocaleTabooData(fallbackLanguage, fileName);
-    auto tabooData = localeTabooData[fallbackLanguage];
-    std::string key = PHONE_NUMBER_KEY + prefix;
-    std::vector<std::string> fallbackPhoneNunberKeys = QueryKeyFallBack(key);
-    for (const auto& fallbackPhoneNunberKey : fallbackPhoneNunberKeys) {
-        if (tabooData.find(fallbackPhoneNunberKey) != tabooData.end()) {
-            return tabooData.at(fallbackPhoneNunberKey);
+    const TabooNameMap* tabooData = GetLocaleTabooData(fallbackLanguage, fileName);
+    if (tabooData == nullptr) {
+        return name;
+    }
+    for (const auto& fallbackKey : keysIter->second) {
+        auto iter = tabooData->find(fallbackKey);
+        if (iter != tabooData->end()) {
+            return iter->second;
         }
     }
     return name;
@@ -232,24 +166,12 @@ std::string Taboo::ReplacePhoneLocationName(const std::string& phoneNumber, cons
 
 std::unordered_set<std::string> Taboo::GetBlockedLanguages() const
 {
-    std::vector<std::string> fallbackKeys = QueryKeyFallBack(BLOCKED_LANG_TAG);
-    for (const auto& fallbackKey : fallbackKeys) {
-        if (blockedLanguages.find(fallbackKey) != blockedLanguages.end()) {
-            return blockedLanguages.at(fallbackKey);
-        }
-    }
-    return {};
+    return resolvedBlockedLanguages == nullptr ? std::unordered_set<std::string>() : *resolvedBlockedLanguages;
 }
 
 std::unordered_set<std::string> Taboo::GetBlockedRegions() const
 {
-    std::vector<std::string> fallbackKeys = QueryKeyFallBack(BLOCKED_LANG_TAG);
-    for (const auto& fallbackKey : fallbackKeys) {
-        if (blockedRegions.find(fallbackKey) != blockedRegions.end()) {
-            return blockedRegions.at(fallbackKey);
-        }
-    }
-    return {};
+    return resolvedBlockedRegions == nullptr ? std::unordered_set<std::string>() : *resolvedBlockedRegions;
 }
 
 std::unordered_set<std::string> Taboo::GetBlockedRegions(const std::string& language) const
@@ -258,41 +180,72 @@ std::unordered_set<std::string> Taboo::GetBlockedRegions(const std::string& lang
     if (language.empty()) {
         return result;
     }
-    std::unordered_set<std::string> temp;
-    std::vector<std::string> fallbackKeys = QueryKeyFallBack(BLOCKED_LANG_TAG);
-    for (const auto& fallbackKey : fallbackKeys) {
-        if (languageBlockedRegions.find(fallbackKey) != languageBlockedRegions.end()) {
-            auto languageBlockedRegion = languageBlockedRegions.at(fallbackKey);
-            if (languageBlockedRegion.find(language) != languageBlockedRegion.end()) {
-                temp = languageBlockedRegion.at(language);
-            }
-            break;
-        }
+    const std::unordered_set<std::string>* languageBlocked = FindLanguageBlockedRegions(language);
+    if (languageBlocked != nullptr) {
+        result.insert(languageBlocked->begin(), languageBlocked->end());
     }
-    result.insert(temp.begin(), temp.end());
     return result;
 }
 
 std::unordered_set<std::string> Taboo::GetBlockedCities() const
 {
-    std::vector<std::string> fallbackKeys = QueryKeyFallBack(BLOCKED_CITY_TAG);
-    for (const auto& fallbackKey : fallbackKeys) {
-        if (blockedCities.find(fallbackKey) != blockedCities.end()) {
-            return blockedCities.at(fallbackKey);
-        }
-    }
-    return {};
+    return resolvedBlockedCities == nullptr ? std::unordered_set<std::string>() : *resolvedBlockedCities;
 }
 
 std::unordered_set<std::string> Taboo::GetBlockedPhoneNumbers() const
 {
-    std::vector<std::string> fallbackKeys = QueryKeyFallBack(BLOCKED_PHONE_NUMBER_TAG);
-    for (const auto& fallbackKey : fallbackKeys) {
-        if (blockedPhoneNumbers.find(fallbackKey) != blockedPhoneNumbers.end()) {
-            return blockedPhoneNumbers.at(fallbackKey);
+    return resolvedBlockedPhoneNumbers == nullptr ? std::unordered_set<std::string>() : *resolvedBlockedPhoneNumbers;
+}
+
+bool Taboo::IsBlockedLanguage(const std::string& language) const
+{
+    return resolvedBlockedLanguages != nullptr &&
+        resolvedBlockedLanguages->find(language) != resolvedBlockedLanguages->end();
+}
+
+bool Taboo::IsBlockedRegion(const std::string& region, const std::string& language) const
+{
+    if (resolvedBlockedRegions != nullptr && resolvedBlockedRegions->find(region) != resolvedBlockedRegions->end()) {
+        return true;
+    }
+    if (language.empty()) {
+        return false;
+    }
+    const std::unordered_set<std::string>* languageBlocked = FindLanguageBlockedRegions(language);
+    return languageBlocked != nullptr && languageBlocked->find(region) != languageBlocked->end();
+}
+
+bool Taboo::IsBlockedCity(const std::string& cityId) const
+{
+    return resolvedBlockedCities != nullptr && resolvedBlockedCities->find(cityId) != resolvedBlockedCities->end();
+}
+
+bool Taboo::IsBlockedPhoneNumber(const std::string& phoneNumber) const
+{
+    size_t prefixLength = 0;
+    return blockedPhoneNumberTrie.FindLongestPrefix(phoneNumber, prefixLength);
+}
+
+const std::unordered_set<std::string>* Taboo::FindBlockedData(
+    const std::unordered_map<std::string, std::unordered_set<std::string>>& blockedData,
+    const std::string& tag) const
+{
+    for (const auto& fallbackKey : QueryKeyFallBack(tag)) {
+        auto iter = blockedData.find(fallbackKey);
+        if (iter != blockedData.end()) {
+            return &iter->second;
         }
     }
-    return {};
+    return nullptr;
+}
+
+const std::unordered_set<std::string>* Taboo::FindLanguageBlockedRegions(const std::string& language) const
+{
+    if (resolvedLanguageBlockedRegions == nullptr) {
+        return nullptr;
+    }
+    auto regions = resolvedLanguageBlockedRegions->find(language);
+    return regions == resolvedLanguageBlockedRegions->end() ? nullptr : &regions->second;
 }
 
 void Taboo::ParseTabooData(const std::string& path, DataFileType fileType, const std::string& locale)
@@ -370,13 +323,11 @@ void Taboo::ProcessTabooConfigData(const std::string& key, const std::string& va
 
 void Taboo::ProcessTabooLocaleData(const std::string& locale, const std::string& name, const std::string& value)
 {
-    if (localeTabooData.find(locale) != localeTabooData.end()) {
-        localeTabooData[locale][name] = value;
+    auto iter = localeTabooData.find(locale);
+    if (iter == localeTabooData.end()) {
         return;
     }
-    std::unordered_map<std::string, std::string> data;
-    data[name] = value;
-    localeTabooData[locale] = data;
+    iter->second.names[name] = value;
 }
 
 std::vector<std::string> Taboo::QueryKeyFallBack(const std::string& key) const
@@ -505,19 +456,25 @@ void Taboo::ParseBlockedPhoneNumbers(const std::string& key, const std::string&
     blockedPhoneNumbers[key] = blockedPhoneNumber;
 }
 
-void Taboo::InitLocaleTabooData(const std::string& fallbackLanguage, const std::string& fileName)
+const Taboo::TabooNameMap* Taboo::GetLocaleTabooData(const std::string& fallbackLanguage,
+    const std::string& fileName)
 {
-    if (initResourcesList.find(fallbackLanguage) != initResourcesList.end()) {
-        return;
+    auto iter = localeTabooData.find(fallbackLanguage);
+    if (iter == localeTabooData.end()) {
+        return nullptr;
+    }
+    LocaleTabooData& data = iter->second;
+    if (data.isLoaded.load(std::memory_order_acquire)) {
+        return &data.names;
     }
     std::lock_guard<std::mutex> tabooLock(tabooMutex);
-    if (initResourcesList.find(fallbackLanguage) != initResourcesList.end()) {
-        return;
+    if (data.isLoaded.load(std::memory_order_relaxed)) {
+        return &data.names;
     }
-    localeTabooData[fallbackLanguage] = {};
     std::string localeTabooDataFilePath = tabooDataPath + fileName + FILE_PATH_SPLITOR + TABOO_DATA_FILE;
     ParseTabooData(localeTabooDataFilePath, DataFileType::DATA_FILE, fallbackLanguage);
-    initResourcesList.insert(fallbackLanguage);
+    data.isLoaded.store(true, std::memory_order_release);
+    return &data.names;
 }
 
 void Taboo::InitFallBackSuffixes()
@@ -560,6 +517,45 @@ void Taboo::InitFallBackSuffixes()
     }
     fallBackSuffixes.emplace_back(COMMON_SUFFIX);
 }
+
+void Taboo::ResolveFallBackData()
+{
+    BuildFallBackKeys(supportedRegions, REGION_KEY, regionFallBackKeys);
+    BuildFallBackKeys(supportedLanguages, LANGUAGE_KEY, languageFallBackKeys);
+    BuildFallBackKeys(supportedTimeZones, TIME_ZONE_KEY, timeZoneFallBackKeys);
+    BuildFallBackKeys(supportedcities, CITY_KEY, cityFallBackKeys);
+    BuildFallBackKeys(supportedPhoneNumbers, PHONE_NUMBER_KEY, phoneNumberFallBackKeys);
+    for (const auto& phoneNumber : supportedPhoneNumbers) {
+        supportedPhoneNumberTrie.Insert(phoneNumber);
+    }
+    for (const auto& resource : resources) {
+        localeTabooData.try_emplace(resource.first);
+    }
+    resolvedBlockedLanguages = FindBlockedData(blockedLanguages, BLOCKED_LANG_TAG);
+    resolvedBlockedRegions = FindBlockedData(blockedRegions, BLOCKED_LANG_TAG);
+    for (const auto& fallbackKey : QueryKeyFallBack(BLOCKED_LANG_TAG)) {
+        auto iter = languageBlockedRegions.find(fallbackKey);
+        if (iter != languageBlockedRegions.end()) {
+            resolvedLanguageBlockedRegions = &iter->second;
+            break;
+        }
+    }
+    resolvedBlockedCities = FindBlockedData(blockedCities, BLOCKED_CITY_TAG);
+    resolvedBlockedPhoneNumbers = FindBlockedData(blockedPhoneNumbers, BLOCKED_PHONE_NUMBER_TAG);
+    if (resolvedBlockedPhoneNumbers != nullptr) {
+        for (const auto& phoneNumber : *resolvedBlockedPhoneNumbers) {
+            blockedPhoneNumberTrie.Insert(phoneNumber);
+        }
+    }
+}
+
+void Taboo::BuildFallBackKeys(const std::unordered_set<std::string>& ids, const std::string& keyPrefix,
+    FallbackKeyMap& fallbackKeys) const
+{
+    for (const auto& id : ids) {
+        fallbackKeys.emplace(id, QueryKeyFallBack(keyPrefix + id));
+    }
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
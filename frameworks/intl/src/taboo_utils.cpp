@@ -117,6 +117,42 @@ std::unordered_set<std::string> TabooUtils::GetBlockedPhoneNumbers() const
     }
     return systemTaboo->GetBlockedPhoneNumbers();
 }
+
+bool TabooUtils::IsBlockedLanguage(const std::string& language) const
+{
+    if (systemTaboo == nullptr) {
+        HILOG_ERROR_I18N("TabooUtils::IsBlockedLanguage: systemTaboo is nullptr.");
+        return false;
+    }
+    return systemTaboo->IsBlockedLanguage(language);
+}
+
+bool TabooUtils::IsBlockedRegion(const std::string& region, const std::string& language) const
+{
+    if (systemTaboo == nullptr) {
+        HILOG_ERROR_I18N("TabooUtils::IsBlockedRegion: systemTaboo is nullptr.");
+        return false;
+    }
+    return systemTaboo->IsBlockedRegion(region, language);
+}
+
+bool TabooUtils::IsBlockedCity(const std::string& cityId) const
+{
+    if (systemTaboo == nullptr) {
+        HILOG_ERROR_I18N("TabooUtils::IsBlockedCity: systemTaboo is nullptr.");
+        return false;
+    }
+    return systemTaboo->IsBlockedCity(cityId);
+}
+
+bool TabooUtils::IsBlockedPhoneNumber(const std::string& phoneNumber) const
+{
+    if (systemTaboo == nullptr) {
+        HILOG_ERROR_I18N("TabooUtils::IsBlockedPhoneNumber: systemTaboo is nullptr.");
+        return false;
+    }
+    return systemTaboo->IsBlockedPhoneNumber(phoneNumber);
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "timezone_location_index.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <png.h>
+#include <sys/stat.h>
+#include <tuple>
+#include <unordered_map>
+#include "i18n_hilog.h"
+#include "i18n_timezone.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+TimezoneLocationIndex& TimezoneLocationIndex::GetInstance()
+{
+    static TimezoneLocationIndex index;
+    return index;
+}
+
+TimezoneLocationIndex::TimezoneLocationIndex()
+{
+    systemDataPaths = std::make_shared<const std::vector<std::string>>(std::vector<std::string> {
+        I18nTimeZone::TZ_PIXEL_PATH, I18nTimeZone::DISTRO_TZ_PIXEL_PATH });
+    dataPaths = systemDataPaths;
+}
+
+std::vector<int> TimezoneLocationIndex::GetPixel(const double x, const double y)
+{
+    std::shared_ptr<TileSet> current = GetTileSet();
+    if (current == nullptr) {
+        return {};
+    }
+    Tile* tile = FindTile(*current, x);
+    if (tile == nullptr || !EnsureDecoded(*tile)) {
+        return {};
+    }
+    return ReadPixel(*current, *tile, x, y);
+}
+
+std::vector<std::vector<int>> TimezoneLocationIndex::GetPixels(const std::vector<std::pair<double, double>>& locations)
+{
+    std::vector<std::vector<int>> result(locations.size());
+    std::shared_ptr<TileSet> current = GetTileSet();
+    if (current == nullptr) {
+        return result;
+    }
+    // group the locations by tile so that each tile is looked up and decoded once for the whole batch.
+    std::unordered_map<Tile*, std::vector<size_t>> groups;
+    for (size_t i = 0; i < locations.size(); i++) {
+        Tile* tile = FindTile(*current, locations[i].first);
+        if (tile != nullptr) {
+            groups[tile].push_back(i);
+        }
+    }
+    for (const auto& group : groups) {
+        if (!EnsureDecoded(*group.first)) {
+            continue;
+        }
+        for (size_t i : group.second) {
+            result[i] = ReadPixel(*current, *group.first, locations[i].first, locations[i].second);
+        }
+    }
+    return result;
+}
+
+void TimezoneLocationIndex::SetDataPaths(const std::vector<std::string>& paths)
+{
+    std::shared_ptr<const std::vector<std::string>> updated = paths.empty() ? systemDataPaths :
+        std::make_shared<const std::vector<std::string>>(paths);
+    std::atomic_store(&dataPaths, updated);
+}
+
+std::vector<int> TimezoneLocationIndex::ReadPixel(const TileSet& tileSet, const Tile& tile, const double x,
+    const double y)
+{
+    std::vector<int> result;
+    size_t fileCount = tileSet.tiles.size();
+    uint32_t width = tileSet.width;
+    uint32_t height = tileSet.height;
+    const double xPlus = I18nTimeZone::TZ_X_PLUS;
+    const double halfOfSize = I18nTimeZone::TZ_HALF_OF_SIZE;
+    double calculateX = y * width / xPlus + width / halfOfSize;
+    double calculateY = x * ((height * fileCount) / (xPlus * halfOfSize)) + (height * fileCount) / halfOfSize;
+    uint16_t fixedX = static_cast<uint16_t>(calculateX);
+    uint16_t fixedY = static_cast<uint16_t>(calculateY);
+    if (I18nTimeZone::ParamExceedScope(fixedX, fixedY, width, height * fileCount)) {
+        HILOG_ERROR_I18N("invalid width:%{public}d or height: %{public}d", fixedX, fixedY);
+        return result;
+    }
+    uint16_t actualHeight = fileCount > 1 ? (fixedY % height) : fixedY;
+    size_t offset = static_cast<size_t>(actualHeight) * tile.rowBytes +
+        static_cast<size_t>(fixedX) * RGB_PIXEL_LENGTH;
+    if (offset + RGB_PIXEL_LENGTH > tile.pixels.size()) {
+        HILOG_ERROR_I18N("TimezoneLocationIndex::ReadPixel: pixel is out of %{public}s.", tile.path.c_str());
+        return result;
+    }
+    for (size_t i = 0; i < RGB_PIXEL_LENGTH; i++) {
+        result.push_back(tile.pixels[offset + i]);
+    }
+    return result;
+}
+
+std::shared_ptr<TimezoneLocationIndex::TileSet> TimezoneLocationIndex::GetTileSet()
+{
+    std::shared_ptr<const std::vector<std::string>> paths = std::atomic_load(&dataPaths);
+    std::vector<int64_t> stamp = GetDataStamp(*paths);
+    std::shared_ptr<TileSet> current = std::atomic_load(&tileSet);
+    if (current == nullptr || current->dataPaths != paths || current->stamp != stamp) {
+        std::lock_guard<std::mutex> lock(loadMutex);
+        current = std::atomic_load(&tileSet);
+        if (current == nullptr || current->dataPaths != paths || current->stamp != stamp) {
+            current = std::make_shared<TileSet>();
+            current->dataPaths = paths;
+            current->stamp = std::move(stamp);
+            LoadTiles(*current);
+            std::atomic_store(&tileSet, current);
+        }
+    }
+    return current->tiles.empty() ? nullptr : current;
+}
+
+std::vector<int64_t> TimezoneLocationIndex::GetDataStamp(const std::vector<std::string>& paths)
+{
+    // a data set is installed by adding files, which updates the modification time of its directory.
+    std::vector<int64_t> stamp;
+    stamp.reserve(paths.size() * STAMP_FIELD_COUNT);
+    for (const std::string& path : paths) {
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0) {
+            stamp.insert(stamp.end(), { -1, -1 });
+            continue;
+        }
+        stamp.insert(stamp.end(), { static_cast<int64_t>(info.st_mtim.tv_sec),
+            static_cast<int64_t>(info.st_mtim.tv_nsec) });
+    }
+    return stamp;
+}
+
+void TimezoneLocationIndex::LoadTiles(TileSet& tileSet)
+{
+    std::vector<std::string> filePaths = I18nTimeZone::FindTzData(*tileSet.dataPaths);
+    if (filePaths.empty()) {
+        return;
+    }
+    std::tie(tileSet.width, tileSet.height) = I18nTimeZone::GetTzDataWidth(filePaths);
+    if (tileSet.width == 0 || tileSet.height == 0) {
+        HILOG_ERROR_I18N("TimezoneLocationIndex::LoadTiles: read tile size failed.");
+        return;
+    }
+    for (const std::string& path : filePaths) {
+        std::unique_ptr<Tile> tile = std::make_unique<Tile>();
+        tile->path = path;
+        if (filePaths.size() > 1) {
+            // tile names end with the longitude range they cover, such as tz_2024001-000180.dat
+            tile->left = atoi(path.substr(path.find("-") + 1, 3).c_str());
+            tile->right = atoi(path.substr(path.find("-") + 4, 3).c_str());
+        }
+        tileSet.tiles.push_back(std::move(tile));
+    }
+}
+
+TimezoneLocationIndex::Tile* TimezoneLocationIndex::FindTile(const TileSet& tileSet, const double x)
+{
+    if (tileSet.tiles.size() == 1) {
+        return tileSet.tiles[0].get();
+    }
+    int fixedX = static_cast<int>(x + I18nTimeZone::TZ_X_PLUS);
+    for (const std::unique_ptr<Tile>& tile : tileSet.tiles) {
+        if (fixedX >= tile->left && fixedX < tile->right) {
+            return tile.get();
+        }
+    }
+    return nullptr;
+}
+
+bool TimezoneLocationIndex::EnsureDecoded(Tile& tile)
+{
+    if (tile.decoded.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(loadMutex);
+    if (tile.decoded.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    if (!DecodeTile(tile)) {
+        return false;
+    }
+    tile.decoded.store(true, std::memory_order_release);
+    return true;
+}
+
+bool TimezoneLocationIndex::DecodeTile(Tile& tile)
+{
+    FILE *fp = nullptr;
+    png_structp png_ptr = nullptr;
+    png_infop info_ptr = nullptr;
+    if (I18nTimeZone::InitPngptr(png_ptr, info_ptr, &fp, tile.path) != 0) {
+        return false;
+    }
+    bool success = false;
+    try {
+        rewind(fp);
+        png_init_io(png_ptr, fp);
+        png_read_info(png_ptr, info_ptr);
+        size_t rowBytes = png_get_rowbytes(png_ptr, info_ptr);
+        uint32_t rows = png_get_image_height(png_ptr, info_ptr);
+        std::vector<uint8_t> pixels(rowBytes * rows);
+        png_start_read_image(png_ptr);
+        for (uint32_t i = 0; i < rows; i++) {
+            png_read_row(png_ptr, pixels.data() + i * rowBytes, NULL);
+        }
+        tile.rowBytes = rowBytes;
+        tile.pixels.swap(pixels);
+        success = true;
+    } catch (...) {
+        HILOG_ERROR_I18N("TimezoneLocationIndex::DecodeTile: decode %{public}s failed.", tile.path.c_str());
+    }
+    png_destroy_read_struct(&png_ptr, &info_ptr, 0);
+    I18nTimeZone::CloseFile(fp);
+    return success;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
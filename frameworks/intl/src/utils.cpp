@@ -31,6 +31,7 @@
 #include "ipc_skeleton.h"
 #include "locale_config.h"
 #include "parameter.h"
+#include "system_locale_snapshot.h"
 #include "tokenid_kit.h"
 #include "unicode/localebuilder.h"
 
@@ -38,7 +39,6 @@ namespace OHOS {
 namespace Global {
 namespace I18n {
 using namespace std;
-static const std::string PSEUDO_LOCALE_TAG = "en-XA";
 static const std::string PSEUDO_START_TAG = "{";
 static const std::string PSEUDO_END_TAG = "}";
 static const char CHAR_A = 'A';
@@ -47,6 +47,7 @@ constexpr const char *TIMEZONE_LIST_CONFIG_PATH = "/system/etc/zoneinfo/timezone
 constexpr const char *DISTRO_TIMEZONE_LIST_CONFIG = "/system/etc/tzdata_distro/timezone_list.cfg";
 static std::mutex g_validLocaleMutex;
 static std::mutex g_availableIDsMutex;
+static std::shared_ptr<const std::set<std::string>> g_availableIDs = nullptr;
 
 void Split(const string &src, const string &sep, vector<string> &dest)
 {
@@ -367,11 +368,7 @@ std::string trim(std::string &s)
 
 bool GetPseudoLocalizationEnforce()
 {
-    std::string systemLocale = LocaleConfig::GetSystemLocale();
-    if (systemLocale.compare(PSEUDO_LOCALE_TAG) == 0) {
-        return true;
-    }
-    return false;
+    return SystemLocaleSnapshot::Get()->pseudoLocalization;
 }
 
 std::string PseudoLocalizationProcessor(const std::string &input)
@@ -404,11 +401,17 @@ bool CheckSystemPermission()
 }
 
 std::set<std::string> GetTimeZoneAvailableIDs()
+{
+    return *GetTimeZoneAvailableIDSet();
+}
+
+std::shared_ptr<const std::set<std::string>> GetTimeZoneAvailableIDSet()
 {
     std::lock_guard<std::mutex> availableIDsLock(g_availableIDsMutex);
-    if (availableIDs.size() != 0) {
-        return availableIDs;
+    if (g_availableIDs != nullptr) {
+        return g_availableIDs;
     }
+    std::shared_ptr<std::set<std::string>> availableIDs = std::make_shared<std::set<std::string>>();
     struct stat s;
     const char *tzIdConfigPath = stat(DISTRO_TIMEZONE_LIST_CONFIG, &s) == 0 ?
         DISTRO_TIMEZONE_LIST_CONFIG : TIMEZONE_LIST_CONFIG_PATH;
@@ -433,9 +436,12 @@ std::set<std::string> GetTimeZoneAvailableIDs()
             break;
         }
         line.resize(line.find_last_not_of("\r\n") + 1);
-        availableIDs.insert(line);
+        availableIDs->insert(line);
     }
     file.close();
+    if (!availableIDs->empty()) {
+        g_availableIDs = availableIDs;
+    }
     return availableIDs;
 }
 
@@ -232,6 +232,38 @@ HWTEST_F(CollatorTest, CollatorFuncTest010, TestSize.Level1)
     EXPECT_EQ(static_cast<int>(collator.Compare("ヽ", "\u20c1")), -1);
     EXPECT_EQ(static_cast<int>(collator.Compare("৴", "\u20c1")), 1);
 }
+
+/**
+ * @tc.name: CollatorFuncTest011
+ * @tc.desc: Test Intl Collator.Sort and sort keys
+ * @tc.type: FUNC
+ */
+HWTEST_F(CollatorTest, CollatorFuncTest011, TestSize.Level1)
+{
+    std::vector<std::string> locales {"zh-Hans"};
+    std::map<std::string, std::string> options {};
+    Collator collator(locales, options);
+    std::vector<std::string> texts {"中国", "阿富汗", "Zambia", "bahamas", "澳门", "Austria", "巴西", "阿富汗", ""};
+    SortKeyBatch batch;
+    EXPECT_TRUE(collator.GetSortKeys(texts, batch));
+    EXPECT_EQ(batch.Size(), texts.size());
+    for (size_t i = 0; i < texts.size(); ++i) {
+        for (size_t j = 0; j < texts.size(); ++j) {
+            bool smaller = collator.Compare(texts[i], texts[j]) == CompareResult::SMALLER;
+            EXPECT_EQ(batch.Less(i, j), smaller);
+        }
+    }
+    std::vector<uint8_t> sortKey;
+    EXPECT_TRUE(collator.GetSortKey(texts[0], sortKey));
+    EXPECT_FALSE(sortKey.empty());
+
+    collator.Sort(texts);
+    EXPECT_EQ(texts.size(), 9);
+    EXPECT_EQ(texts[0], "");
+    for (size_t i = 1; i < texts.size(); ++i) {
+        EXPECT_NE(collator.Compare(texts[i - 1], texts[i]), CompareResult::GREATER);
+    }
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
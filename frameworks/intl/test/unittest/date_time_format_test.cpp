@@ -16,6 +16,8 @@
 #include <gtest/gtest.h>
 
 #include "date_time_format_test.h"
+#include "date_time_format.h"
+#include "date_time_pattern_cache.h"
 #include "intl_date_time_format.h"
 #include "locale_config.h"
 #include "styled_date_time_format.h"
@@ -504,6 +506,168 @@ HWTEST_F(DateTimeFormatTest, DateTimeFormatFuncTest015, TestSize.Level1)
     EXPECT_EQ(status, I18nErrorCode::INVALID_PARAM);
     EXPECT_EQ(result, 0);
 }
+
+/**
+ * @tc.name: DateTimeFormatFuncTest016
+ * @tc.desc: Test DateTimePatternCache returns the same patterns as a fresh generator
+ * @tc.type: FUNC
+ */
+HWTEST_F(DateTimeFormatTest, DateTimeFormatFuncTest016, TestSize.Level1)
+{
+    DateTimePatternCache::Clear();
+    icu::Locale locale("zh-Hans-CN");
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<icu::DateTimePatternGenerator> expected(
+        icu::DateTimePatternGenerator::createInstance(locale, status));
+    ASSERT_TRUE(U_SUCCESS(status));
+    for (int i = 0; i < 2; ++i) {
+        std::unique_ptr<icu::DateTimePatternGenerator> cached(DateTimePatternCache::CreateGenerator(locale, status));
+        ASSERT_TRUE(U_SUCCESS(status));
+        ASSERT_TRUE(cached != nullptr);
+        EXPECT_EQ(cached->getBestPattern("yMMMd", status), expected->getBestPattern("yMMMd", status));
+    }
+
+    icu::UnicodeString pattern;
+    EXPECT_FALSE(DateTimePatternCache::FindPattern(locale, "yMd", pattern));
+    DateTimePatternCache::AddPattern(locale, "yMd", "y/M/d");
+    EXPECT_TRUE(DateTimePatternCache::FindPattern(locale, "yMd", pattern));
+    EXPECT_EQ(pattern, icu::UnicodeString("y/M/d"));
+    EXPECT_FALSE(DateTimePatternCache::FindPattern(icu::Locale("en-US"), "yMd", pattern));
+
+    std::unordered_map<std::string, std::string> first = DateTimeFormat::GetPatternsFromLocale("en-Latn-US");
+    std::unordered_map<std::string, std::string> second = DateTimeFormat::GetPatternsFromLocale("en-Latn-US");
+    EXPECT_EQ(first, second);
+    DateTimePatternCache::Clear();
+}
+
+/**
+ * @tc.name: DateTimeFormatFuncTest017
+ * @tc.desc: Test IntlDateTimeFormat created from the prototype cache formats the same as a fresh one
+ * @tc.type: FUNC
+ */
+HWTEST_F(DateTimeFormatTest, DateTimeFormatFuncTest017, TestSize.Level1)
+{
+    IntlDateTimeFormat::ClearPrototypeCache();
+    std::vector<std::vector<std::string>> localeList = { { "zh-Hans-CN" }, { "en-US" }, { "ar-EG", "fr-FR" } };
+    std::vector<std::unordered_map<std::string, std::string>> configList = {
+        {},
+        { { "timeZone", "America/New_York" }, { "dateStyle", "full" }, { "timeStyle", "long" } },
+        { { "year", "numeric" }, { "month", "long" }, { "hour", "numeric" }, { "hour12", "true" } },
+        { { "calendar", "chinese" }, { "numberingSystem", "arab" }, { "fractionalSecondDigits", "2" },
+          { "second", "2-digit" } }
+    };
+    const double start = 1735689600123;
+    const double end = 1738368000456;
+    for (const auto& localeTags : localeList) {
+        for (const auto& configs : configList) {
+            uint64_t missCount = IntlDateTimeFormat::GetPrototypeCacheMissCount();
+            std::string errMessage;
+            IntlDateTimeFormat expected(localeTags, configs, errMessage);
+            EXPECT_EQ(errMessage, "");
+            EXPECT_EQ(IntlDateTimeFormat::GetPrototypeCacheMissCount(), missCount + 1);
+
+            uint64_t hitCount = IntlDateTimeFormat::GetPrototypeCacheHitCount();
+            IntlDateTimeFormat cached(localeTags, configs, errMessage);
+            EXPECT_EQ(errMessage, "");
+            EXPECT_EQ(IntlDateTimeFormat::GetPrototypeCacheHitCount(), hitCount + 1);
+
+            EXPECT_EQ(cached.Format(start), expected.Format(start));
+            std::string cachedErr;
+            std::string expectedErr;
+            EXPECT_EQ(cached.FormatToParts(start, cachedErr), expected.FormatToParts(start, expectedErr));
+            EXPECT_EQ(cached.FormatRange(start, end, cachedErr), expected.FormatRange(start, end, expectedErr));
+            EXPECT_EQ(cached.FormatRangeToParts(start, end, cachedErr),
+                expected.FormatRangeToParts(start, end, expectedErr));
+            std::unordered_map<std::string, std::string> cachedOptions;
+            std::unordered_map<std::string, std::string> expectedOptions;
+            cached.ResolvedOptions(cachedOptions);
+            expected.ResolvedOptions(expectedOptions);
+            EXPECT_EQ(cachedOptions, expectedOptions);
+        }
+    }
+
+    std::string errMessage;
+    uint64_t missCount = IntlDateTimeFormat::GetPrototypeCacheMissCount();
+    IntlDateTimeFormat invalid({ "en-US" }, { { "timeZone", "Invalid/Zone" } }, errMessage);
+    EXPECT_EQ(errMessage, "invalid timeZone");
+    errMessage.clear();
+    IntlDateTimeFormat invalidAgain({ "en-US" }, { { "timeZone", "Invalid/Zone" } }, errMessage);
+    EXPECT_EQ(errMessage, "invalid timeZone");
+    EXPECT_EQ(IntlDateTimeFormat::GetPrototypeCacheMissCount(), missCount + 2);
+    IntlDateTimeFormat::ClearPrototypeCache();
+}
+
+/**
+ * @tc.name: DateTimeFormatFuncTest018
+ * @tc.desc: Test IntlDateTimeFormat.FormatToParts with FormattedParts matches the map parts
+ * @tc.type: FUNC
+ */
+HWTEST_F(DateTimeFormatTest, DateTimeFormatFuncTest018, TestSize.Level1)
+{
+    std::vector<std::string> localeList = { "en-US", "ar-EG", "zh-Hans-CN", "ja-JP-u-ca-japanese" };
+    std::unordered_map<std::string, std::string> configs = {
+        { "dateStyle", "full" }, { "timeStyle", "full" }, { "timeZone", "Asia/Shanghai" }
+    };
+    const double milliseconds = 1735689600123;
+    for (const std::string& locale : localeList) {
+        std::string errMessage;
+        IntlDateTimeFormat formatter({ locale }, configs, errMessage);
+        EXPECT_EQ(errMessage, "");
+        std::vector<std::unordered_map<std::string, std::string>> expected =
+            formatter.FormatToParts(milliseconds, errMessage);
+        EXPECT_EQ(errMessage, "");
+        FormattedParts parts;
+        formatter.FormatToParts(milliseconds, parts, errMessage);
+        EXPECT_EQ(errMessage, "");
+        ASSERT_EQ(parts.spans.size(), expected.size());
+        std::string joined;
+        for (size_t i = 0; i < parts.spans.size(); ++i) {
+            const FormatPartSpan& span = parts.spans[i];
+            std::string value = parts.text.substr(span.begin, span.end - span.begin);
+            EXPECT_EQ(FormatUtils::GetPartTypeName(span.type), expected[i][IntlDateTimeFormat::PART_TYPE_TAG]);
+            EXPECT_EQ(value, expected[i][IntlDateTimeFormat::PART_VALUE_TAG]);
+            joined += value;
+        }
+        EXPECT_EQ(parts.text, joined);
+    }
+}
+
+/**
+ * @tc.name: DateTimeFormatFuncTest019
+ * @tc.desc: Test IntlDateTimeFormat.FormatToParts with FormattedParts against the expected parts
+ * @tc.type: FUNC
+ */
+HWTEST_F(DateTimeFormatTest, DateTimeFormatFuncTest019, TestSize.Level1)
+{
+    using PartList = std::vector<std::vector<std::string>>;
+    std::unordered_map<std::string, std::string> configs = {
+        { "dateStyle", "medium" }, { "timeStyle", "short" }, { "timeZone", "Asia/Shanghai" }
+    };
+    const double milliseconds = 1735689600123;
+    std::string errMessage;
+    IntlDateTimeFormat formatter({ "en-US" }, configs, errMessage);
+    EXPECT_EQ(errMessage, "");
+    FormattedParts parts;
+    formatter.FormatToParts(milliseconds, parts, errMessage);
+    EXPECT_EQ(errMessage, "");
+    PartList result;
+    FormatUtils::AppendPartStrings(parts, result);
+    PartList expected = { { "month", "Jan" }, { "literal", " " }, { "day", "1" }, { "literal", ", " },
+        { "year", "2025" }, { "literal", ", " }, { "hour", "8" }, { "literal", ":" }, { "minute", "00" },
+        { "literal", "\u202f" }, { "dayPeriod", "AM" } };
+    EXPECT_EQ(result, expected);
+
+    IntlDateTimeFormat arabicFormatter({ "ar-EG" }, configs, errMessage);
+    EXPECT_EQ(errMessage, "");
+    arabicFormatter.FormatToParts(milliseconds, parts, errMessage);
+    EXPECT_EQ(errMessage, "");
+    result.clear();
+    FormatUtils::AppendPartStrings(parts, result);
+    expected = { { "day", "٠١" }, { "literal", "\u200f/" }, { "month", "٠١" }, { "literal", "\u200f/" },
+        { "year", "٢٠٢٥" }, { "literal", "، " }, { "hour", "٨" }, { "literal", ":" }, { "minute", "٠٠" },
+        { "literal", " " }, { "dayPeriod", "ص" } };
+    EXPECT_EQ(result, expected);
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -14,12 +14,15 @@
  */
 
 #include <gtest/gtest.h>
+#include "entity_recognition_stream.h"
 #include "entity_recognizer.h"
+#include "entity_rules_registry.h"
 #include "i18n_break_iterator.h"
 #include "i18n_calendar.h"
 #include "i18n_normalizer.h"
 #include "i18n_timezone_mock.h"
 #include "locale_config.h"
+#include "locale_data.h"
 #include "locale_info.h"
 #include "locale_matcher.h"
 #include "locale_util.h"
@@ -29,6 +32,8 @@
 #include "preferred_language.h"
 #include "simple_date_time_format.h"
 #include "simple_number_format.h"
+#include "taboo_utils.h"
+#include "text_normalizer.h"
 #include "utils.h"
 
 using namespace OHOS::Global::I18n;
@@ -1992,6 +1997,240 @@ HWTEST_F(I18nTest, I18nFuncTest076, TestSize.Level1)
     canonicalLocale = ConvertCanonicalLocaleIdentifier("");
     EXPECT_EQ(canonicalLocale, "");
 }
+
+/**
+ * @tc.name: I18nFuncTest077
+ * @tc.desc: Test I18n LocaleData lookup tables
+ * @tc.type: FUNC
+ */
+HWTEST_F(I18nTest, I18nFuncTest077, TestSize.Level1)
+{
+    uint64_t result = 0;
+    EXPECT_TRUE(LocaleData::FindParentLocale(LocaleUtil::EncodeLocale("en", nullptr, "AU"), result));
+    EXPECT_EQ(result, LocaleUtil::EncodeLocale("en", nullptr, "001"));
+    EXPECT_TRUE(LocaleData::FindParentLocale(LocaleUtil::EncodeLocale("ar", nullptr, "DZ"), result));
+    EXPECT_EQ(result, LocaleUtil::EncodeLocale("ar", nullptr, "015"));
+    EXPECT_FALSE(LocaleData::FindParentLocale(LocaleUtil::EncodeLocale("en", nullptr, "US"), result));
+
+    EXPECT_TRUE(LocaleData::FindLikelyLocale(LocaleUtil::EncodeLocale("zh", nullptr, nullptr), result));
+    EXPECT_EQ(result, LocaleUtil::EncodeLocale("zh", "Hans", "CN"));
+    EXPECT_TRUE(LocaleData::FindLikelyLocale(LocaleUtil::EncodeLocale("zu", nullptr, nullptr), result));
+    EXPECT_EQ(result, LocaleUtil::EncodeLocale("zu", "Latn", "ZA"));
+    EXPECT_FALSE(LocaleData::FindLikelyLocale(0, result));
+
+    EXPECT_TRUE(LocaleData::IsTypicalLocale(LocaleUtil::EncodeLocale("aa", "Latn", "ET")));
+    EXPECT_FALSE(LocaleData::IsTypicalLocale(LocaleUtil::EncodeLocale("en", "Latn", "CN")));
+
+    std::vector<std::string> candidates = { "en-GB", "en-AU", "en-US", "zh-Hans-CN" };
+    EXPECT_EQ(LocaleMatcher::GetBestMatchedLocale("en-AU", candidates), "en-AU");
+    EXPECT_EQ(LocaleMatcher::GetBestMatchedLocale("zh-CN", candidates), "zh-Hans-CN");
+}
+
+/**
+ * @tc.name: I18nFuncTest078
+ * @tc.desc: Test TextNormalizer ToHalfWidth
+ * @tc.type: FUNC
+ */
+HWTEST_F(I18nTest, I18nFuncTest078, TestSize.Level1)
+{
+    icu::UnicodeString ascii("call 010-12345678 at 10:30");
+    EXPECT_TRUE(TextNormalizer::ToHalfWidth(ascii) == ascii);
+    icu::UnicodeString fullWidth("电话：（０１０）１２３４５６７８，【ＡＢｃ】﹣１—２∕３﹡");
+    std::string result;
+    TextNormalizer::ToHalfWidth(fullWidth).toUTF8String(result);
+    EXPECT_EQ(result, "电话:(010)12345678,[ABc]-1-2/3*");
+    // full-width symbols outside the recognizer table are kept
+    icu::UnicodeString kept("＃＠～");
+    EXPECT_TRUE(TextNormalizer::ToHalfWidth(kept) == kept);
+    EXPECT_EQ(TextNormalizer::ToHalfWidth(static_cast<UChar>(0xFF10)), static_cast<UChar>('0'));
+}
+
+/**
+ * @tc.name: I18nFuncTest079
+ * @tc.desc: Test city display names cached for several locales
+ * @tc.type: FUNC
+ */
+HWTEST_F(I18nTest, I18nFuncTest079, TestSize.Level1)
+{
+    std::string cityId = "Auckland";
+    std::string enLocale = "en-Latn-US";
+    std::string zhLocale = "zh-Hans";
+    std::string enName = I18nTimeZone::GetCityDisplayName(cityId, enLocale);
+    EXPECT_EQ(enName, "Auckland (New Zealand)");
+    std::string zhName = I18nTimeZone::GetCityDisplayName(cityId, zhLocale);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(I18nTimeZone::GetCityDisplayName(cityId, enLocale), enName);
+        EXPECT_EQ(I18nTimeZone::GetCityDisplayName(cityId, zhLocale), zhName);
+    }
+
+    std::string enBaseName = I18nTimeZone::GetLocaleBaseName(enLocale);
+    std::shared_ptr<const CityDisplayNameTable> table = I18nTimeZone::GetCityDisplayNameTable(enBaseName);
+    ASSERT_TRUE(table != nullptr);
+    EXPECT_EQ(table, I18nTimeZone::GetCityDisplayNameTable(enBaseName));
+    std::map<std::string, std::string> displayNameMap = I18nTimeZone::FindCityDisplayNameMap(enBaseName);
+    EXPECT_EQ(displayNameMap.size(), table->size());
+
+    CityDisplayNameCache cache(2);
+    auto first = std::make_shared<const CityDisplayNameTable>(CityDisplayNameTable { { "a", "A" } });
+    auto second = std::make_shared<const CityDisplayNameTable>(CityDisplayNameTable { { "b", "B" } });
+    auto third = std::make_shared<const CityDisplayNameTable>(CityDisplayNameTable { { "c", "C" } });
+    std::shared_ptr<const CityDisplayNameTable> found;
+    EXPECT_EQ(cache.Insert("first", first), first);
+    EXPECT_EQ(cache.Insert("second", second), second);
+    EXPECT_EQ(cache.Insert("second", third), second);
+    EXPECT_TRUE(cache.Find("first", found));
+    EXPECT_EQ(found, first);
+    cache.Insert("third", third);
+    EXPECT_TRUE(cache.Find("first", found));
+    EXPECT_EQ(found, first);
+    EXPECT_FALSE(cache.Find("second", found));
+    EXPECT_TRUE(cache.Find("third", found));
+    EXPECT_EQ(found, third);
+}
+
+/**
+ * @tc.name: I18nFuncTest080
+ * @tc.desc: Test shared timezone id sets and taboo membership queries
+ * @tc.type: FUNC
+ */
+HWTEST_F(I18nTest, I18nFuncTest080, TestSize.Level1)
+{
+    std::shared_ptr<const std::set<std::string>> zoneIds = I18nTimeZone::GetAvailableIDSet();
+    ASSERT_TRUE(zoneIds != nullptr);
+    if (!zoneIds->empty()) {
+        EXPECT_EQ(zoneIds, I18nTimeZone::GetAvailableIDSet());
+        EXPECT_TRUE(I18nTimeZone::IsAvailableID(*zoneIds->begin()));
+    }
+    EXPECT_EQ(*zoneIds, I18nTimeZone::GetAvailableIDs());
+    EXPECT_FALSE(I18nTimeZone::IsAvailableID("fake zone id"));
+
+    std::shared_ptr<const std::unordered_set<std::string>> cityIds = I18nTimeZone::GetAvailableZoneCityIDSet();
+    ASSERT_TRUE(cityIds != nullptr);
+    EXPECT_EQ(cityIds, I18nTimeZone::GetAvailableZoneCityIDSet());
+    EXPECT_EQ(*cityIds, I18nTimeZone::GetAvailableZoneCityIDs());
+    EXPECT_TRUE(I18nTimeZone::IsAvailableZoneCityID("Auckland"));
+    EXPECT_FALSE(I18nTimeZone::IsAvailableZoneCityID("fake city id"));
+
+    TabooUtils* tabooUtils = TabooUtils::GetInstance();
+    ASSERT_TRUE(tabooUtils != nullptr);
+    for (const auto& city : tabooUtils->GetBlockedCities()) {
+        EXPECT_TRUE(tabooUtils->IsBlockedCity(city));
+        EXPECT_FALSE(I18nTimeZone::IsAvailableZoneCityID(city));
+    }
+    for (const auto& language : tabooUtils->GetBlockedLanguages()) {
+        EXPECT_TRUE(tabooUtils->IsBlockedLanguage(language));
+    }
+    for (const auto& region : tabooUtils->GetBlockedRegions("en")) {
+        EXPECT_TRUE(tabooUtils->IsBlockedRegion(region, "en"));
+    }
+    for (const auto& phoneNumber : tabooUtils->GetBlockedPhoneNumbers()) {
+        EXPECT_TRUE(tabooUtils->IsBlockedPhoneNumber(phoneNumber + "1234"));
+    }
+    EXPECT_FALSE(tabooUtils->IsBlockedCity("fake city id"));
+}
+
+/**
+ * @tc.name: I18nFuncTest081
+ * @tc.desc: Test I18n EntityRecognizer shares compiled rules between instances
+ * @tc.type: FUNC
+ */
+HWTEST_F(I18nTest, I18nFuncTest081, TestSize.Level1)
+{
+    std::shared_ptr<PhoneNumberRule> phoneNumberRule = EntityRulesRegistry::GetPhoneNumberRule("CN");
+    EXPECT_EQ(EntityRulesRegistry::GetPhoneNumberRule("CN"), phoneNumberRule);
+    EXPECT_NE(EntityRulesRegistry::GetPhoneNumberRule("GB"), phoneNumberRule);
+    std::shared_ptr<DateRuleInit> dateRule = EntityRulesRegistry::GetDateRule("zh");
+    EXPECT_EQ(EntityRulesRegistry::GetDateRule("zh"), dateRule);
+
+    std::string localeStr = "zh-CN";
+    UErrorCode status = U_ZERO_ERROR;
+    icu::Locale locale = icu::Locale::forLanguageTag(localeStr, status);
+    std::string message = "您好，您的包裹已送至指定地点，请尽快签收：快递员：刘某某，手机：15912345678，QQ：123456789。";
+    std::unique_ptr<EntityRecognizer> first = std::make_unique<EntityRecognizer>(locale);
+    std::unique_ptr<EntityRecognizer> second = std::make_unique<EntityRecognizer>(locale);
+    EXPECT_EQ(phoneNumberRule.use_count(), 3);
+    std::vector<std::vector<int>> firstResult = first->FindEntityInfo(message);
+    first.reset();
+    std::vector<std::vector<int>> secondResult = second->FindEntityInfo(message);
+    EXPECT_EQ(firstResult, secondResult);
+    EXPECT_EQ(secondResult[0][0], 1);
+    EXPECT_EQ(secondResult[0][1], 32);
+    EXPECT_EQ(secondResult[0][2], 43);
+}
+
+/**
+ * @tc.name: I18nFuncTest082
+ * @tc.desc: Test I18n EntityRecognitionStream
+ * @tc.type: FUNC
+ */
+HWTEST_F(I18nTest, I18nFuncTest082, TestSize.Level1)
+{
+    std::string localeStr = "zh-CN";
+    UErrorCode status = U_ZERO_ERROR;
+    icu::Locale locale = icu::Locale::forLanguageTag(localeStr, status);
+    std::string message = "您好，您的包裹已送至指定地点，请尽快签收：快递员：刘某某，手机：15912345678，QQ：123456789。";
+    std::string document;
+    const size_t repeatCount = 20;
+    for (size_t i = 0; i < repeatCount; ++i) {
+        document += message;
+    }
+    EntityRecognizer recognizer(locale);
+    std::vector<EntitySpan> phoneSpans;
+    auto callback = [&phoneSpans](const EntitySpan& span) {
+        if (span.kind == EntityKind::PHONE_NUMBER) {
+            phoneSpans.push_back(span);
+        }
+    };
+    const size_t chunkLength = 128;
+    const size_t overlapLength = 64;
+    EntityRecognitionStream stream(recognizer, callback, chunkLength, overlapLength);
+    const size_t pieceLength = 7;
+    for (size_t i = 0; i < document.length(); i += pieceLength) {
+        stream.Append(document.substr(i, pieceLength));
+    }
+    stream.Finish();
+
+    std::vector<std::vector<int>> res = recognizer.FindEntityInfo(document);
+    ASSERT_EQ(res[0][0], static_cast<int>(repeatCount));
+    ASSERT_EQ(phoneSpans.size(), repeatCount);
+    for (size_t i = 0; i < repeatCount; ++i) {
+        EXPECT_EQ(phoneSpans[i].utf16Begin, static_cast<size_t>(res[0][2 * i + 1]));
+        EXPECT_EQ(phoneSpans[i].utf16End, static_cast<size_t>(res[0][2 * i + 2]));
+        std::string phoneNumber = document.substr(phoneSpans[i].utf8Begin,
+            phoneSpans[i].utf8End - phoneSpans[i].utf8Begin);
+        EXPECT_EQ(phoneNumber, "15912345678");
+    }
+}
+
+/**
+ * @tc.name: I18nFuncTest083
+ * @tc.desc: Test I18n MeasureData conversion plan
+ * @tc.type: FUNC
+ */
+HWTEST_F(I18nTest, I18nFuncTest083, TestSize.Level1)
+{
+    std::vector<std::pair<std::string, std::string>> unitPairs {
+        { "kilometer-per-hour", "meter-per-second" },
+        { "celsius", "fahrenheit" },
+        { "hectopascal", "kilopascal" },
+        { "acre", "hectare" },
+    };
+    std::vector<double> readings { -40.0, 0.0, 12.5, 36.6, 1013.25 };
+    for (const auto& unitPair : unitPairs) {
+        UnitConversionPlan plan;
+        ASSERT_EQ(CreateConversionPlan(unitPair.first, "SI", unitPair.second, "SI", plan), 1);
+        std::vector<double> converted = readings;
+        ConvertBatch(plan, converted.data(), converted.size());
+        for (size_t i = 0; i < readings.size(); ++i) {
+            double value = readings[i];
+            EXPECT_EQ(Convert(value, unitPair.first, "SI", unitPair.second, "SI"), 1);
+            EXPECT_EQ(converted[i], value);
+        }
+    }
+    UnitConversionPlan plan;
+    EXPECT_EQ(CreateConversionPlan("acre", "US", "foot", "US", plan), 0);
+    EXPECT_EQ(CreateConversionPlan("fake unit", "US", "foot", "US", plan), 0);
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -1986,6 +1986,34 @@ HWTEST_F(IntlTest, IntlFuncTest0046, TestSize.Level1)
     delete dateFormat;
     delete dateFormat2;
 }
+
+/**
+ * @tc.name: IntlFuncTest00106
+ * @tc.desc: Test Intl DateTimeFormat batch Format
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest00106, TestSize.Level1)
+{
+    vector<string> locales = { "en-US" };
+    map<string, string> options = {
+        { "timeZone", "Asia/Shanghai" },
+        { "dateStyle", "medium" },
+        { "timeStyle", "medium" }
+    };
+    std::unique_ptr<DateTimeFormat> dateFormat = std::make_unique<DateTimeFormat>(locales, options);
+    ASSERT_TRUE(dateFormat != nullptr);
+    vector<int64_t> timestamps = { 0, 123456789, 987654321000 };
+    vector<string> results = dateFormat->Format(timestamps);
+    ASSERT_EQ(results.size(), timestamps.size());
+    for (size_t i = 0; i < timestamps.size(); ++i) {
+        EXPECT_EQ(results[i], dateFormat->Format(timestamps[i]));
+    }
+    EXPECT_EQ(results[0], "Jan 1, 1970, 8:00:00\u202fAM");
+    EXPECT_EQ(results[1], "Jan 2, 1970, 6:17:36\u202fPM");
+    EXPECT_EQ(dateFormat->FormatRange(0, 123456789),
+        "Jan 1, 1970, 8:00:00\u202fAM\u2009\u2013\u2009Jan 2, 1970, 6:17:36\u202fPM");
+    EXPECT_TRUE(dateFormat->Format(vector<int64_t>()).empty());
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
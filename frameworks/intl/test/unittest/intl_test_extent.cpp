@@ -15,7 +15,9 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <atomic>
 #include <map>
+#include <thread>
 #include <vector>
 #include "border_rule.h"
 #include "character.h"
@@ -46,6 +48,7 @@
 #include "parameter.h"
 #include "phone_number_format.h"
 #include "phone_number_rule.h"
+#include "phone_prefix_trie.h"
 #include "plural_rules.h"
 #include "positive_rule.h"
 #include "preferred_language.h"
@@ -660,8 +663,8 @@ HWTEST_F(IntlTest, IntlFuncTest0063, TestSize.Level1)
         regexRule2->IsValid(possibleNumber.get(), message);
     EXPECT_TRUE(phoneNumberMatch != nullptr);
     regexRule2->GetType();
-    std::unique_ptr<icu::RegexPattern> regexPattern =
-        std::unique_ptr<icu::RegexPattern>(regexRule2->GetPattern());
+    const icu::RegexPattern* regexPattern = regexRule2->GetPattern();
+    EXPECT_TRUE(regexPattern != nullptr);
     isValidType = "Rawstr";
     std::unique_ptr<RegexRule> regexRule3 = std::make_unique<RegexRule>(regex, isValidType,
         handleType, insensitive, type);
@@ -1096,7 +1099,7 @@ HWTEST_F(IntlTest, IntlFuncTest0076, TestSize.Level1)
     std::string handleType = "Operator";
     std::string insensitive = "True";
     std::unique_ptr<PositiveRule> pRule = std::make_unique<PositiveRule>(regex, handleType, insensitive);
-    icu::RegexPattern* regexP = pRule->GetPattern();
+    const icu::RegexPattern* regexP = pRule->GetPattern();
     std::string msg = "(0075 665";
     icu::UnicodeString message(msg.c_str());
     std::vector<MatchedNumberInfo> vector = pRule->HandleInner(possibleNumber.get(), message);
@@ -1112,7 +1115,7 @@ HWTEST_F(IntlTest, IntlFuncTest0076, TestSize.Level1)
     std::unique_ptr<PhoneNumberMatch> posbNumber = std::make_unique<PhoneNumberMatch>(start, rawStr, phoneNumber);
     vector = pRule3->Handle(posbNumber.get(), message);
     EXPECT_EQ(vector.size(), 1);
-    delete regexP;
+    EXPECT_EQ(pRule->GetPattern(), regexP);
 
     EXPECT_FALSE(IsDirExist(nullptr));
     std::string strForTrim;
@@ -1221,8 +1224,8 @@ HWTEST_F(IntlTest, IntlFuncTest0080, TestSize.Level1)
     std::unique_ptr<PhoneNumberMatch> possibleNumber =
         std::make_unique<PhoneNumberMatch>(start, rawStr, phoneNumber);
     RegexRule* regexRule = new RegexRule(regex, isValidType, handleType, insensitive, type);
-    std::unique_ptr<icu::RegexPattern> regexPattern =
-        std::unique_ptr<icu::RegexPattern>(regexRule->GetPattern());
+    const icu::RegexPattern* regexPattern = regexRule->GetPattern();
+    EXPECT_TRUE(regexPattern != nullptr);
     std::string msg = "00222a-86753564A-";
     icu::UnicodeString message(msg.c_str());
     ASSERT_TRUE(possibleNumber != nullptr);
@@ -1394,7 +1397,7 @@ HWTEST_F(IntlTest, IntlFuncTest0085, TestSize.Level1)
     std::string insensitive = "False";
     std::string type = "CONTAIN_OR_INTERSECT";
     std::unique_ptr<BorderRule> borderRule = std::make_unique<BorderRule>(regex, insensitive, type);
-    icu::RegexPattern* regexPattern = borderRule->GetPattern();
+    const icu::RegexPattern* regexPattern = borderRule->GetPattern();
     std::string msg = "2222U-(010)86753564a-hha";
     std::string input = "(010)86753564";
     size_t start = 6;
@@ -1409,7 +1412,7 @@ HWTEST_F(IntlTest, IntlFuncTest0085, TestSize.Level1)
     std::unique_ptr<BorderRule> bRule = std::make_unique<BorderRule>(regex, insensitive, type);
     flag = bRule->Handle(match.get(), message);
     EXPECT_TRUE(flag);
-    delete regexPattern;
+    EXPECT_EQ(borderRule->GetPattern(), regexPattern);
 }
 
 /**
@@ -1428,9 +1431,9 @@ HWTEST_F(IntlTest, IntlFuncTest0086, TestSize.Level1)
     icu::UnicodeString newRegex;
     insensitive = "True";
     std::unique_ptr<FindRule> findRule = std::make_unique<FindRule>(newRegex, insensitive);
-    icu::RegexPattern* regexPattern = findRule->GetPattern();
+    const icu::RegexPattern* regexPattern = findRule->GetPattern();
     EXPECT_TRUE(regexPattern != nullptr);
-    delete regexPattern;
+    EXPECT_EQ(findRule->GetPattern(), regexPattern);
     std::string emptyStr = "";
     icu::UnicodeString emptyRegex(emptyStr.c_str());
     std::unique_ptr<BorderRule> emptyBorderRule =
@@ -2072,6 +2075,187 @@ HWTEST_F(IntlTest, IntlFuncTest00105, TestSize.Level1)
     res = LocaleConfig::SetUnicodeWrappedBidiDirection(text, direction);
     EXPECT_EQ(res, text);
 }
+
+/**
+ * @tc.name: IntlFuncTest00107
+ * @tc.desc: Test RulesEngine reuses the patterns compiled in Init
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest00107, TestSize.Level1)
+{
+    std::string locale = "en";
+    std::unique_ptr<DateTimeRule> dtRule = std::make_unique<DateTimeRule>(locale);
+    ASSERT_TRUE(dtRule != nullptr);
+    std::unordered_map<std::string, std::string> rulesMap = { { "digits", "\\d+" } };
+    std::unordered_map<std::string, std::string> emptyMap = {};
+    RulesSet rulesSet(rulesMap, emptyMap, emptyMap, emptyMap);
+    RulesEngine rulesEngine(dtRule.get(), rulesSet);
+    icu::UnicodeString message("abc 123 de 45");
+    std::vector<MatchedDateTimeInfo> matches = rulesEngine.Match(message);
+    ASSERT_EQ(matches.size(), 2);
+    EXPECT_EQ(matches[0].GetBegin(), 4);
+    EXPECT_EQ(matches[0].GetEnd(), 7);
+    EXPECT_EQ(matches[1].GetBegin(), 11);
+    EXPECT_EQ(matches[1].GetRegex(), "digits");
+
+    RulesEngine copiedEngine = rulesEngine;
+    std::vector<MatchedDateTimeInfo> copiedMatches = copiedEngine.Match(message);
+    ASSERT_EQ(copiedMatches.size(), matches.size());
+    EXPECT_EQ(copiedMatches[1].GetEnd(), matches[1].GetEnd());
+}
+
+/**
+ * @tc.name: IntlFuncTest00108
+ * @tc.desc: Test PhonePrefixTrie longest prefix match and Taboo phone location replacement
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest00108, TestSize.Level1)
+{
+    PhonePrefixTrie trie;
+    EXPECT_TRUE(trie.Empty());
+    size_t length = 0;
+    EXPECT_FALSE(trie.FindLongestPrefix("8613800000000", length));
+    trie.Insert("86");
+    trie.Insert("86138");
+    trie.Insert("1");
+    EXPECT_FALSE(trie.Empty());
+    EXPECT_TRUE(trie.FindLongestPrefix("8613800000000", length));
+    EXPECT_EQ(length, 5);
+    EXPECT_TRUE(trie.FindLongestPrefix("8613900000000", length));
+    EXPECT_EQ(length, 2);
+    EXPECT_TRUE(trie.FindLongestPrefix("12015550123", length));
+    EXPECT_EQ(length, 1);
+    EXPECT_FALSE(trie.FindLongestPrefix("4420", length));
+    EXPECT_EQ(length, 0);
+
+    TabooUtils* tabooUtils = TabooUtils::GetInstance();
+    ASSERT_TRUE(tabooUtils != nullptr);
+    std::string location = tabooUtils->ReplacePhoneLocationName("8613800000000", "zh-Hans", "location");
+    EXPECT_EQ(location, tabooUtils->ReplacePhoneLocationName("8613800000000", "zh-Hans", "location"));
+    EXPECT_EQ(tabooUtils->ReplaceCountryName("CN", "en", "China"), "China");
+}
+
+/**
+ * @tc.name: IntlFuncTest00109
+ * @tc.desc: Test Intl PhoneNumberFormat location cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest00109, TestSize.Level1)
+{
+    PhoneLocationCache cache(2);
+    std::string locationName;
+    EXPECT_FALSE(cache.Find("zh-CN|N|13228901234", locationName));
+    cache.Insert("zh-CN|N|13228901234", "西藏拉萨市");
+    cache.Insert("zh-CN|N|15156712345", "安徽省亳州市");
+    EXPECT_TRUE(cache.Find("zh-CN|N|13228901234", locationName));
+    EXPECT_EQ(locationName, "西藏拉萨市");
+    cache.Insert("zh-CN|N|17673241234", "湖南省株洲市");
+    EXPECT_FALSE(cache.Find("zh-CN|N|15156712345", locationName));
+    EXPECT_TRUE(cache.Find("zh-CN|N|17673241234", locationName));
+    EXPECT_EQ(cache.GetHitCount(), 2);
+    EXPECT_EQ(cache.GetMissCount(), 2);
+
+    map<string, string> options = {
+        { "type", "NATIONAL" }
+    };
+    std::unique_ptr<PhoneNumberFormat> phoneNumberFormat =
+        std::make_unique<PhoneNumberFormat>("zh-CN", options);
+    std::string location = phoneNumberFormat->getLocationName("15156712345", "zh-CN");
+    uint64_t hitCount = PhoneNumberFormat::GetLocationCacheHitCount();
+    EXPECT_EQ(phoneNumberFormat->getLocationName("15156712345", "zh-CN"), location);
+    if (!location.empty()) {
+        EXPECT_EQ(PhoneNumberFormat::GetLocationCacheHitCount(), hitCount + 1);
+    }
+    EXPECT_GE(PhoneNumberFormat::GetLocationCacheMissCount(), 1);
+}
+
+/**
+ * @tc.name: IntlFuncTest00110
+ * @tc.desc: Test PhoneNumberFormat.format() refreshes digits after the locale changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest00110, TestSize.Level1)
+{
+    std::string originalLanguage = LocaleConfig::GetSystemLanguage();
+    std::string originalLocale = LocaleConfig::GetSystemLocale();
+    map<string, string> options = {
+        { "type", "NATIONAL" }
+    };
+    std::unique_ptr<PhoneNumberFormat> phoneNumberFormat = std::make_unique<PhoneNumberFormat>("CN", options);
+    LocaleConfig::SetSystemLanguage("zh-Hans");
+    LocaleConfig::SetSystemLocale("zh-Hans-CN");
+    EXPECT_EQ(phoneNumberFormat->format("+8618622350085"), "186 2235 0085");
+
+    LocaleConfig::SetSystemLanguage("ar");
+    LocaleConfig::SetSystemLocale("ar-EG");
+    std::string expected = "\u202d\u0661\u0668\u0666 \u0662\u0662\u0663\u0665 \u0660\u0660\u0668\u0665\u202c";
+    EXPECT_EQ(phoneNumberFormat->format("+8618622350085"), expected);
+    EXPECT_EQ(phoneNumberFormat->format("+8618622350085"), expected);
+
+    LocaleConfig::SetSystemLanguage(originalLanguage);
+    LocaleConfig::SetSystemLocale(originalLocale);
+}
+
+/**
+ * @tc.name: IntlFuncTest00111
+ * @tc.desc: Test HolidayManager range queries and concurrent IsHoliday lookups
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest00111, TestSize.Level1)
+{
+    HolidayManager holidayManager(nullptr);
+    std::map<std::string, std::vector<HolidayInfoItem>> holidayDataMap;
+    std::vector<HolidayLocalName> localNames;
+    holidayDataMap["20230101"] = { {"New Year", 2023, 1, 1, localNames} };
+    holidayDataMap["20220625"] = { {"First", 2022, 6, 25, localNames}, {"Second", 2022, 6, 25, localNames} };
+    holidayDataMap["20221231"] = { {"Year End", 2022, 12, 31, localNames} };
+    holidayDataMap["2022-1-1"] = { {"Invalid", 2022, 1, 1, localNames} };
+    holidayManager.SetHolidayData(holidayDataMap);
+
+    EXPECT_EQ(HolidayManager::GetDateKey(2022, 6, 25), 20220625);
+    EXPECT_EQ(HolidayManager::GetDateKey(2022, 13, 1), -1);
+    EXPECT_EQ(HolidayManager::GetDateKey(2022, 1, 0), -1);
+
+    HolidayInfoItemRange range = holidayManager.GetHolidayInfoItems(HolidayManager::GetDateKey(2022, 1, 1),
+        HolidayManager::GetDateKey(2023, 1, 1));
+    ASSERT_EQ(range.size(), 3);
+    EXPECT_EQ(range.first[0].baseName, "First");
+    EXPECT_EQ(range.first[1].baseName, "Second");
+    EXPECT_EQ(range.first[2].baseName, "Year End");
+    range = holidayManager.GetHolidayInfoItems(HolidayManager::GetDateKey(2022, 6, 26),
+        HolidayManager::GetDateKey(2022, 12, 31));
+    EXPECT_TRUE(range.empty());
+    range = holidayManager.GetHolidayInfoItems(HolidayManager::GetDateKey(2023, 1, 1),
+        HolidayManager::GetDateKey(2022, 1, 1));
+    EXPECT_TRUE(range.empty());
+    EXPECT_EQ(holidayManager.GetHolidayInfoItemArray(2022).size(), 3);
+    EXPECT_EQ(holidayManager.GetHolidayInfoItemArray(2023).size(), 1);
+    EXPECT_EQ(holidayManager.GetHolidayInfoItemArray(10000).size(), 0);
+
+    const int32_t threadCount = 8;
+    const int32_t loopCount = 10000;
+    std::atomic<int32_t> holidayCount(0);
+    std::atomic<int32_t> workdayCount(0);
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < threadCount; i++) {
+        threads.emplace_back([&holidayManager, &holidayCount, &workdayCount, loopCount]() {
+            for (int32_t j = 0; j < loopCount; j++) {
+                if (holidayManager.IsHoliday(2022, 6, 25)) {
+                    holidayCount++;
+                }
+                if (!holidayManager.IsHoliday(2022, 6, 26)) {
+                    workdayCount++;
+                }
+                holidayManager.IsHoliday();
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(holidayCount.load(), threadCount * loopCount);
+    EXPECT_EQ(workdayCount.load(), threadCount * loopCount);
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -15,10 +15,13 @@
 
 #include "locale_config_test.h"
 #include <gtest/gtest.h>
+#include "date_time_format.h"
 #include "locale_config.h"
 #include "locale_config_ext.h"
+#include "system_locale_snapshot.h"
 #include "unicode/locid.h"
 #include "parameter.h"
+#include "utils.h"
 
 using namespace OHOS::Global::I18n;
 using testing::ext::TestSize;
@@ -27,6 +30,31 @@ using namespace std;
 namespace OHOS {
 namespace Global {
 namespace I18n {
+class FakeParameterBackend : public SystemLocaleSnapshot::ParameterBackend {
+public:
+    std::string Read(const std::string& key) override
+    {
+        ++readCount;
+        auto iter = values.find(key);
+        return (iter == values.end()) ? "" : iter->second;
+    }
+
+    uint64_t GetSerial() override
+    {
+        return serial;
+    }
+
+    void Write(const std::string& key, const std::string& value)
+    {
+        values[key] = value;
+        ++serial;
+    }
+
+    std::map<std::string, std::string> values;
+    uint64_t serial = 0;
+    size_t readCount = 0;
+};
+
 class LocaleConfigTest : public testing::Test {
 public:
     static string originalLanguage;
@@ -781,6 +809,78 @@ HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest030, TestSize.Level1)
     LocaleConfig::SetSystemLanguage(systemLanguage);
     LocaleConfig::SetSystemLocale(systemLocale);
 }
+
+/**
+ * @tc.name: LocaleConfigFuncTest031
+ * @tc.desc: Test SystemLocaleSnapshot refreshes only when a parameter changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest031, TestSize.Level1)
+{
+    auto backend = std::make_shared<FakeParameterBackend>();
+    backend->Write("persist.global.locale", "en-Latn-US-u-mu=celsius");
+    backend->Write("persist.global.language", "en-Latn-US");
+    backend->Write("persist.time.timezone", "America/New_York");
+    backend->Write("persist.global.is24Hour", "true");
+    SystemLocaleSnapshot::SetParameterBackend(backend);
+
+    std::shared_ptr<const SystemLocaleInfo> info = SystemLocaleSnapshot::Get();
+    ASSERT_TRUE(info != nullptr);
+    EXPECT_EQ(info->locale, "en-Latn-US");
+    EXPECT_EQ(info->language, "en-Latn-US");
+    EXPECT_EQ(info->region, "US");
+    EXPECT_EQ(info->timezone, "America/New_York");
+    EXPECT_TRUE(info->is24HourClock);
+    EXPECT_FALSE(info->pseudoLocalization);
+
+    size_t readCount = backend->readCount;
+    std::shared_ptr<const SystemLocaleInfo> cached = SystemLocaleSnapshot::Get();
+    EXPECT_EQ(cached, info);
+    EXPECT_EQ(backend->readCount, readCount);
+
+    backend->Write("persist.global.locale", "en-XA");
+    std::shared_ptr<const SystemLocaleInfo> updated = SystemLocaleSnapshot::Get();
+    EXPECT_GT(updated->version, info->version);
+    EXPECT_TRUE(updated->pseudoLocalization);
+    EXPECT_EQ(info->locale, "en-Latn-US");
+    EXPECT_TRUE(GetPseudoLocalizationEnforce());
+
+    backend->Write("persist.time.timezone", "");
+    EXPECT_EQ(SystemLocaleSnapshot::Get()->timezone, "GMT");
+    SystemLocaleSnapshot::SetParameterBackend(nullptr);
+}
+
+/**
+ * @tc.name: LocaleConfigFuncTest032
+ * @tc.desc: Test DateTimeFormat drops its cached time zone when the system time zone changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest032, TestSize.Level1)
+{
+    auto backend = std::make_shared<FakeParameterBackend>();
+    backend->Write("persist.global.locale", "en-Latn-US");
+    backend->Write("persist.time.timezone", "Asia/Shanghai");
+    SystemLocaleSnapshot::SetParameterBackend(backend);
+
+    vector<string> locales = { "en-US" };
+    map<string, string> options = {
+        { "dateStyle", "medium" },
+        { "timeStyle", "medium" }
+    };
+    std::unique_ptr<DateTimeFormat> dateFormat = std::make_unique<DateTimeFormat>(locales, options);
+    ASSERT_TRUE(dateFormat != nullptr);
+    EXPECT_EQ(dateFormat->Format(0), "Jan 1, 1970, 8:00:00\u202fAM");
+    EXPECT_EQ(dateFormat->Format(0), "Jan 1, 1970, 8:00:00\u202fAM");
+
+    backend->Write("persist.time.timezone", "America/New_York");
+    EXPECT_EQ(dateFormat->Format(0), "Dec 31, 1969, 7:00:00\u202fPM");
+    EXPECT_EQ(dateFormat->FormatRange(0, 123456789),
+        "Dec 31, 1969, 7:00:00\u202fPM\u2009\u2013\u2009Jan 2, 1970, 5:17:36\u202fAM");
+    vector<string> results = dateFormat->Format(vector<int64_t>{ 0 });
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0], "Dec 31, 1969, 7:00:00\u202fPM");
+    SystemLocaleSnapshot::SetParameterBackend(nullptr);
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
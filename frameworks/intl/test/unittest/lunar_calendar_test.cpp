@@ -55,6 +55,114 @@ bool IsGregorianLeapYear(int32_t year)
     return false;
 }
 
+static const uint32_t LUNAR_DATE_INFO[] = {
+    0x04bd8, 0x04ae0, 0x0a570, 0x054d5, 0x0d260, 0x0d950, 0x16554, 0x056a0, 0x09ad0, 0x055d2,
+    0x04ae0, 0x0a5b6, 0x0a4d0, 0x0d250, 0x1d255, 0x0b540, 0x0d6a0, 0x0ada2, 0x095b0, 0x14977,
+    0x04970, 0x0a4b0, 0x0b4b5, 0x06a50, 0x06d40, 0x1ab54, 0x02b60, 0x09570, 0x052f2, 0x04970,
+    0x06566, 0x0d4a0, 0x0ea50, 0x16a95, 0x05ad0, 0x02b60, 0x186e3, 0x092e0, 0x1c8d7, 0x0c950,
+    0x0d4a0, 0x1d8a6, 0x0b550, 0x056a0, 0x1a5b4, 0x025d0, 0x092d0, 0x0d2b2, 0x0a950, 0x0b557,
+    0x06ca0, 0x0b550, 0x15355, 0x04da0, 0x0a5b0, 0x14573, 0x052b0, 0x0a9a8, 0x0e950, 0x06aa0,
+    0x0aea6, 0x0ab50, 0x04b60, 0x0aae4, 0x0a570, 0x05260, 0x0f263, 0x0d950, 0x05b57, 0x056a0,
+    0x096d0, 0x04dd5, 0x04ad0, 0x0a4d0, 0x0d4d4, 0x0d250, 0x0d558, 0x0b540, 0x0b6a0, 0x195a6,
+    0x095b0, 0x049b0, 0x0a974, 0x0a4b0, 0x0b27a, 0x06a50, 0x06d40, 0x0af46, 0x0ab60, 0x09570,
+    0x04af5, 0x04970, 0x064b0, 0x074a3, 0x0ea50, 0x06b58, 0x05ac0, 0x0ab60, 0x096d5, 0x092e0,
+    0x0c960, 0x0d954, 0x0d4a0, 0x0da50, 0x07552, 0x056a0, 0x0abb7, 0x025d0, 0x092d0, 0x0cab5,
+    0x0a950, 0x0b4a0, 0x0baa4, 0x0ad50, 0x055d9, 0x04ba0, 0x0a5b0, 0x15176, 0x052b0, 0x0a930,
+    0x07954, 0x06aa0, 0x0ad50, 0x05b52, 0x04b60, 0x0a6e6, 0x0a4e0, 0x0d260, 0x0ea65, 0x0d530,
+    0x05aa0, 0x076a3, 0x096d0, 0x04afb, 0x04ad0, 0x0a4d0, 0x1d0b6, 0x0d250, 0x0d520, 0x0dd45,
+    0x0b5a0, 0x056d0, 0x055b2, 0x049b0, 0x0a577, 0x0a4b0, 0x0aa50, 0x1b255, 0x06d20, 0x0ada0,
+    0x14b63, 0x09370, 0x049f8, 0x04970, 0x064b0, 0x168a6, 0x0ea50, 0x06aa0, 0x1a6c4, 0x0aae0,
+    0x092e0, 0x0d2e3, 0x0c960, 0x0d557, 0x0d4a0, 0x0da50, 0x05d55, 0x056a0, 0x0a6d0, 0x055d4,
+    0x052d0, 0x0a9b8, 0x0a950, 0x0b4a0, 0x0b6a6, 0x0ad50, 0x055a0, 0x0aba4, 0x0a5b0, 0x052b0,
+    0x0b273, 0x06930, 0x07337, 0x06aa0, 0x0ad50, 0x14b55, 0x04b60, 0x0a570, 0x054e4, 0x0d160,
+    0x0e968, 0x0d520, 0x0daa0, 0x16aa6, 0x056d0, 0x04ae0, 0x0a9d4, 0x0a2d0, 0x0d150, 0x0f252,
+    0x0d520,
+};
+static const int32_t ACC_DAYS_OF_MONTH[] = { 0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+static int32_t ReferenceLeapMonth(int32_t year)
+{
+    return LUNAR_DATE_INFO[year - 1900] & 0xf;
+}
+
+static int32_t ReferenceLeapDays(int32_t year)
+{
+    if (ReferenceLeapMonth(year) == 0) {
+        return 0;
+    }
+    return (LUNAR_DATE_INFO[year - 1900] & 0x10000) == 0x10000 ? 30 : 29;
+}
+
+static int32_t ReferenceMonthDays(int32_t year, int32_t month)
+{
+    uint32_t offset = 0x10000 >> static_cast<uint32_t>(month);
+    return (LUNAR_DATE_INFO[year - 1900] & offset) == offset ? 30 : 29;
+}
+
+static int32_t ReferenceYearDays(int32_t year)
+{
+    int32_t days = 348;
+    for (uint32_t i = 0x8000; i > 0x8; i = i >> 1) {
+        days += ((LUNAR_DATE_INFO[year - 1900] & i) == i) ? 1 : 0;
+    }
+    return days + ReferenceLeapDays(year);
+}
+
+/**
+ * The conversion used before the cumulative-day table: it walks the lunar years from 1900 one by one.
+ */
+static LunarDate ReferenceLunarDate(int32_t year, int32_t month, int32_t day)
+{
+    bool isLeapYear = IsGregorianLeapYear(year);
+    int32_t daysCounts = 365 * (year - 1900) + ACC_DAYS_OF_MONTH[month] + day - 1 + (year - 1900) / FREQ_LEAP_YEAR;
+    daysCounts += (isLeapYear && month > 2) ? 1 : 0;
+    daysCounts -= isLeapYear ? 1 : 0;
+    daysCounts -= (year >= 2100) ? 1 : 0;
+    int32_t tempDaysCounts = daysCounts - 30;
+    int32_t daysInPerLunarYear = 0;
+    int32_t i = 0;
+    for (i = 1900; (tempDaysCounts > 0) && (i < 2100); i++) {
+        daysInPerLunarYear = ReferenceYearDays(i);
+        tempDaysCounts -= daysInPerLunarYear;
+    }
+    if (tempDaysCounts < 0) {
+        tempDaysCounts += daysInPerLunarYear;
+        --i;
+    }
+    LunarDate date;
+    date.year = i;
+    int32_t leapMonth = ReferenceLeapMonth(date.year);
+    int32_t daysInPerLunarMonth = 0;
+    for (i = 1; i <= 12 && tempDaysCounts > 0; i++) {
+        if (leapMonth > 0 && (leapMonth + 1) == i && !date.isLeapMonth) {
+            --i;
+            date.isLeapMonth = true;
+            daysInPerLunarMonth = ReferenceLeapDays(date.year);
+        } else {
+            daysInPerLunarMonth = ReferenceMonthDays(date.year, i);
+        }
+        if (date.isLeapMonth && (leapMonth + 1) == i) {
+            date.isLeapMonth = false;
+        }
+        tempDaysCounts -= daysInPerLunarMonth;
+    }
+    if (tempDaysCounts == 0 && leapMonth > 0 && i == leapMonth + 1) {
+        if (date.isLeapMonth) {
+            date.isLeapMonth = false;
+        } else {
+            date.isLeapMonth = true;
+            --i;
+        }
+    }
+    if (tempDaysCounts < 0) {
+        tempDaysCounts += daysInPerLunarMonth;
+        --i;
+    }
+    date.month = i;
+    date.day = tempDaysCounts + 1;
+    return date;
+}
+
 /**
  * @tc.name: LunarCalendarTest0001
  * @tc.desc: Test Intl Chinese Calendar
@@ -158,6 +266,95 @@ HWTEST_F(LunarCalendarTest, LunarCalendarTest0002, TestSize.Level1)
     isLeapMonth = ChineseCalendar::CheckLeapMonth(2101, 42, 6, errCode);
     EXPECT_EQ(errCode, I18nErrorCode::INVALID_PARAM);
 }
+
+/**
+ * @tc.name: LunarCalendarTest0003
+ * @tc.desc: Test LunarCalendar GetLunarDates over the whole supported range
+ * @tc.type: FUNC
+ */
+HWTEST_F(LunarCalendarTest, LunarCalendarTest0003, TestSize.Level1)
+{
+    int32_t monthDays[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    const size_t totalDays = 73414;
+    LunarCalendar lunarCalendar;
+    std::vector<LunarDate> lunarDates;
+    ASSERT_TRUE(lunarCalendar.GetLunarDates(1900, 1, 1, totalDays, lunarDates));
+    ASSERT_EQ(lunarDates.size(), totalDays);
+    size_t index = 0;
+    for (int32_t year = 1900; year <= 2100; year++) {
+        for (int32_t month = 1; month < 13; month++) {
+            int32_t monthDay = monthDays[month - 1];
+            monthDay += IsGregorianLeapYear(year) && month == 2 ? 1 : 0;
+            for (int32_t date = 1; date <= monthDay; date++) {
+                ASSERT_TRUE(lunarCalendar.SetGregorianDate(year, month, date));
+                const LunarDate& lunarDate = lunarDates[index++];
+                EXPECT_EQ(lunarDate.year, lunarCalendar.GetLunarYear());
+                EXPECT_EQ(lunarDate.month, lunarCalendar.GetLunarMonth());
+                EXPECT_EQ(lunarDate.day, lunarCalendar.GetLunarDay());
+                EXPECT_EQ(lunarDate.isLeapMonth, lunarCalendar.IsLeapMonth());
+            }
+        }
+    }
+    EXPECT_EQ(index, totalDays);
+
+    // A month view of 42 cells starting from a day which is normalized first.
+    ASSERT_TRUE(lunarCalendar.GetLunarDates(2025, 7, 0, 42, lunarDates));
+    ASSERT_EQ(lunarDates.size(), 42);
+    EXPECT_EQ(lunarCalendar.GetLunarYear(), 2100);
+    EXPECT_EQ(lunarCalendar.GetLunarMonth(), 12);
+    EXPECT_EQ(lunarCalendar.GetLunarDay(), 1);
+    lunarCalendar.SetGregorianDate(2025, 7, 25);
+    EXPECT_EQ(lunarDates[25].year, 2025);
+    EXPECT_EQ(lunarDates[25].month, 6);
+    EXPECT_EQ(lunarDates[25].day, 1);
+    EXPECT_TRUE(lunarDates[25].isLeapMonth);
+    EXPECT_EQ(lunarDates[25].day, lunarCalendar.GetLunarDay());
+
+    EXPECT_TRUE(lunarCalendar.GetLunarDates(2100, 12, 31, 1, lunarDates));
+    EXPECT_FALSE(lunarCalendar.GetLunarDates(2100, 12, 31, 2, lunarDates));
+    EXPECT_TRUE(lunarDates.empty());
+    ASSERT_TRUE(lunarCalendar.GetLunarDates(2025, 1, 1, 1, lunarDates));
+    EXPECT_FALSE(lunarCalendar.GetLunarDates(2101, 1, 1, 1, lunarDates));
+    EXPECT_TRUE(lunarDates.empty());
+    EXPECT_TRUE(lunarCalendar.GetLunarDates(2025, 1, 1, 0, lunarDates));
+    EXPECT_TRUE(lunarDates.empty());
+}
+
+/**
+ * @tc.name: LunarCalendarTest0004
+ * @tc.desc: Test LunarCalendar against the year by year conversion for every supported day
+ * @tc.type: FUNC
+ */
+HWTEST_F(LunarCalendarTest, LunarCalendarTest0004, TestSize.Level1)
+{
+    int32_t monthDays[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    const size_t totalDays = 73414;
+    LunarCalendar lunarCalendar;
+    std::vector<LunarDate> lunarDates;
+    ASSERT_TRUE(lunarCalendar.GetLunarDates(1900, 1, 1, totalDays, lunarDates));
+    ASSERT_EQ(lunarDates.size(), totalDays);
+    size_t index = 0;
+    for (int32_t year = 1900; year <= 2100; year++) {
+        for (int32_t month = 1; month < 13; month++) {
+            int32_t monthDay = monthDays[month - 1];
+            monthDay += IsGregorianLeapYear(year) && month == 2 ? 1 : 0;
+            for (int32_t date = 1; date <= monthDay; date++) {
+                LunarDate expected = ReferenceLunarDate(year, month, date);
+                ASSERT_TRUE(lunarCalendar.SetGregorianDate(year, month, date));
+                EXPECT_EQ(lunarCalendar.GetLunarYear(), expected.year);
+                EXPECT_EQ(lunarCalendar.GetLunarMonth(), expected.month);
+                EXPECT_EQ(lunarCalendar.GetLunarDay(), expected.day);
+                EXPECT_EQ(lunarCalendar.IsLeapMonth(), expected.isLeapMonth);
+                const LunarDate& lunarDate = lunarDates[index++];
+                EXPECT_EQ(lunarDate.year, expected.year);
+                EXPECT_EQ(lunarDate.month, expected.month);
+                EXPECT_EQ(lunarDate.day, expected.day);
+                EXPECT_EQ(lunarDate.isLeapMonth, expected.isLeapMonth);
+            }
+        }
+    }
+    EXPECT_EQ(index, totalDays);
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
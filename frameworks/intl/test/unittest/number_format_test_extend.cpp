@@ -16,7 +16,9 @@
 #include "number_format_test_extend.h"
 #include <gtest/gtest.h>
 #include "advanced_measure_format.h"
+#include "format_utils.h"
 #include "locale_config.h"
+#include "measure_unit_catalog.h"
 #include "number_format.h"
 #include "simple_number_format.h"
 #include "styled_number_format.h"
@@ -1051,6 +1053,130 @@ HWTEST_F(NumberFormatTest, NumberFormatFuncTest0079, TestSize.Level1)
     EXPECT_EQ(status, I18nErrorCode::INVALID_PARAM);
     EXPECT_EQ(result, 0);
 }
+
+/**
+ * @tc.name: NumberFormatFuncTest0080
+ * @tc.desc: Test MeasureUnitCatalog shared by NumberFormat
+ * @tc.type: FUNC
+ */
+HWTEST_F(NumberFormatTest, NumberFormatFuncTest0080, TestSize.Level1)
+{
+    const MeasureUnitCatalog& catalog = MeasureUnitCatalog::GetInstance();
+    ASSERT_TRUE(catalog.IsValid());
+    const icu::MeasureUnit* kilometer = catalog.Find("kilometer");
+    ASSERT_TRUE(kilometer != nullptr);
+    EXPECT_EQ(std::string(kilometer->getType()), "length");
+    EXPECT_TRUE(catalog.Find("unknown-unit") == nullptr);
+
+    vector<string> locales{"en-US"};
+    map<string, string> options = {
+        { "style", "unit" },
+        { "unit", "kilometer-per-hour" },
+        { "unitDisplay", "short" }
+    };
+    std::unique_ptr<NumberFormat> formatter = std::make_unique<NumberFormat>(locales, options);
+    ASSERT_TRUE(formatter != nullptr);
+    EXPECT_EQ(formatter->Format(12), "12 km/h");
+}
+
+/**
+ * @tc.name: NumberFormatFuncTest0081
+ * @tc.desc: Test NumberFormat.FormatToParts with FormattedParts matches the string parts
+ * @tc.type: FUNC
+ */
+HWTEST_F(NumberFormatTest, NumberFormatFuncTest0081, TestSize.Level1)
+{
+    std::vector<std::vector<std::string>> localeList = { { "en-US" }, { "ar-EG" }, { "zh-Hans-CN" } };
+    std::vector<map<string, string>> optionList = {
+        {},
+        { { "style", "currency" }, { "currency", "EUR" } },
+        { { "style", "percent" }, { "signDisplay", "always" } },
+        { { "notation", "compact" } }
+    };
+    std::vector<double> numbers = { 0, -1234567.891, 0.25, 1e21 };
+    for (const auto& locales : localeList) {
+        for (auto options : optionList) {
+            std::unique_ptr<NumberFormat> numFmt = std::make_unique<NumberFormat>(locales, options);
+            ASSERT_TRUE(numFmt != nullptr);
+            for (double number : numbers) {
+                std::vector<std::vector<std::string>> expected;
+                numFmt->FormatToParts(number, expected);
+                FormattedParts parts;
+                numFmt->FormatToParts(number, parts);
+                ASSERT_EQ(parts.spans.size(), expected.size());
+                std::string joined;
+                for (size_t i = 0; i < parts.spans.size(); ++i) {
+                    const FormatPartSpan& span = parts.spans[i];
+                    ASSERT_LE(span.begin, span.end);
+                    ASSERT_LE(static_cast<size_t>(span.end), parts.text.length());
+                    EXPECT_EQ(FormatUtils::GetPartTypeName(span.type), expected[i][0]);
+                    EXPECT_EQ(parts.text.substr(span.begin, span.end - span.begin), expected[i][1]);
+                    joined += expected[i][1];
+                }
+                EXPECT_EQ(parts.text, joined);
+            }
+            FormattedParts bigIntParts;
+            numFmt->FormatBigIntToParts("-123456789012345678901234567890", bigIntParts);
+            std::vector<std::vector<std::string>> bigIntExpected;
+            numFmt->FormatBigIntToParts("-123456789012345678901234567890", bigIntExpected);
+            ASSERT_EQ(bigIntParts.spans.size(), bigIntExpected.size());
+            for (size_t i = 0; i < bigIntParts.spans.size(); ++i) {
+                const FormatPartSpan& span = bigIntParts.spans[i];
+                EXPECT_EQ(FormatUtils::GetPartTypeName(span.type), bigIntExpected[i][0]);
+                EXPECT_EQ(bigIntParts.text.substr(span.begin, span.end - span.begin), bigIntExpected[i][1]);
+            }
+        }
+    }
+    EXPECT_EQ(FormatUtils::GetPartType("minusSign"), FormatPartType::MINUS_SIGN);
+    EXPECT_EQ(FormatUtils::GetPartType("no such part"), FormatPartType::UNKNOWN);
+}
+
+/**
+ * @tc.name: NumberFormatFuncTest0082
+ * @tc.desc: Test NumberFormat.FormatToParts with FormattedParts against the expected parts
+ * @tc.type: FUNC
+ */
+HWTEST_F(NumberFormatTest, NumberFormatFuncTest0082, TestSize.Level1)
+{
+    using PartList = std::vector<std::vector<std::string>>;
+    auto formatToParts = [](const std::string& locale, std::map<std::string, std::string> options, double number) {
+        NumberFormat numFmt({ locale }, options);
+        FormattedParts parts;
+        numFmt.FormatToParts(number, parts);
+        PartList result;
+        FormatUtils::AppendPartStrings(parts, result);
+        return result;
+    };
+    PartList expected = { { "minusSign", "-" }, { "integer", "1" }, { "group", "," }, { "integer", "234" },
+        { "group", "," }, { "integer", "567" }, { "decimal", "." }, { "fraction", "891" } };
+    EXPECT_EQ(formatToParts("en-US", {}, -1234567.891), expected);
+    expected = { { "integer", "1" }, { "group", "." }, { "integer", "234" }, { "decimal", "," },
+        { "fraction", "50" }, { "literal", "\u00a0" }, { "currency", "€" } };
+    EXPECT_EQ(formatToParts("de-DE", { { "style", "currency" }, { "currency", "EUR" } }, 1234.5), expected);
+    expected = { { "integer", "1" }, { "decimal", "." }, { "fraction", "2" }, { "compact", "亿" } };
+    EXPECT_EQ(formatToParts("zh-Hans-CN", { { "notation", "compact" } }, 123456789), expected);
+    expected = { { "literal", "\u061c" }, { "minusSign", "-" }, { "integer", "١" }, { "group", "٬" },
+        { "integer", "٢٣٤" }, { "group", "٬" }, { "integer", "٥٦٧" }, { "decimal", "٫" }, { "fraction", "٨٩١" } };
+    EXPECT_EQ(formatToParts("ar-EG", {}, -1234567.891), expected);
+    expected = { { "literal", "\u061c" }, { "plusSign", "+" }, { "integer", "٢٥" }, { "percentSign", "٪" },
+        { "literal", "\u061c" } };
+    EXPECT_EQ(formatToParts("ar-EG", { { "style", "percent" }, { "signDisplay", "always" } }, 0.25), expected);
+
+    std::map<std::string, std::string> elapsedOptions = { { "style", "unit" }, { "unit", "day" },
+        { "unitUsage", "elapsed-time-second" } };
+    expected = { { "literal", "yesterday" } };
+    EXPECT_EQ(formatToParts("en-GB", elapsedOptions, -1), expected);
+    expected = { { "literal", "now" } };
+    EXPECT_EQ(formatToParts("en-GB", elapsedOptions, 0), expected);
+    PartList daysAgo = formatToParts("en-GB", elapsedOptions, -3);
+    ASSERT_EQ(daysAgo.size(), 2);
+    EXPECT_EQ(daysAgo[0], std::vector<std::string>({ "integer", "3" }));
+    EXPECT_EQ(daysAgo[1][0], "literal");
+    if (NumberFormatTest::deviceType != "wearable" && NumberFormatTest::deviceType != "liteWearable" &&
+        NumberFormatTest::deviceType != "watch") {
+        EXPECT_EQ(daysAgo[1][1], " days ago");
+    }
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -139,6 +139,32 @@ HWTEST_F(PhoneNumberFormatTest, PhoneNumberFormatTest0004, TestSize.Level1)
     EXPECT_EQ(phoneNumberFormat->getLocationName("13342612345", "zh"), "广东省东莞市");
     EXPECT_EQ(phoneNumberFormat->getLocationName("133426123456", "zh"), "");
 }
+
+/**
+ * @tc.name: PhoneNumberFormatTest0005
+ * @tc.desc: Test format when replaying keystrokes in the typing mode
+ * @tc.type: FUNC
+ */
+HWTEST_F(PhoneNumberFormatTest, PhoneNumberFormatTest0005, TestSize.Level1)
+{
+    map<string, string> options = {{"type", "TYPING"}};
+    std::unique_ptr<PhoneNumberFormat> mobileFormat = std::make_unique<PhoneNumberFormat>("CN", options);
+    std::unique_ptr<PhoneNumberFormat> fixedFormat = std::make_unique<PhoneNumberFormat>("CN", options);
+    std::string mobileNumber = "186223500";
+    std::string fixedNumber = "075576453";
+    std::string mobileFormatted;
+    std::string fixedFormatted;
+    for (size_t i = 0; i < mobileNumber.length(); ++i) {
+        mobileFormatted = mobileFormat->format(mobileFormatted + mobileNumber[i]);
+        fixedFormatted = fixedFormat->format(fixedFormatted + fixedNumber[i]);
+    }
+    EXPECT_EQ(mobileFormatted, "186 2235 00");
+    EXPECT_EQ(fixedFormatted, "0755 7645 3");
+
+    std::unique_ptr<PhoneNumberFormat> letterFormat = std::make_unique<PhoneNumberFormat>("CN", options);
+    std::unique_ptr<PhoneNumberFormat> digitFormat = std::make_unique<PhoneNumberFormat>("CN", options);
+    EXPECT_EQ(letterFormat->format("186-ADG\xe4W"), digitFormat->format("186-2349"));
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -14,8 +14,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <png.h>
 #include <sys/stat.h>
+#include <unistd.h>
 #include "i18n_timezone.h"
+#include "timezone_location_index.h"
 #include "timezone_location_test.h"
 
 using namespace OHOS::Global::I18n;
@@ -26,6 +30,40 @@ using namespace testing;
 namespace OHOS {
 namespace Global {
 namespace I18n {
+namespace {
+// write a single tile covering the whole map, every pixel has the given category values.
+bool WriteTzTile(const std::string& path, const std::vector<png_byte>& rgb)
+{
+    const uint32_t size = 4;
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (fp == nullptr) {
+        return false;
+    }
+    png_structp pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    png_infop infoPtr = (pngPtr == nullptr) ? nullptr : png_create_info_struct(pngPtr);
+    if (infoPtr == nullptr) {
+        png_destroy_write_struct(&pngPtr, nullptr);
+        fclose(fp);
+        return false;
+    }
+    png_init_io(pngPtr, fp);
+    png_set_IHDR(pngPtr, infoPtr, size, size, 8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE,
+        PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(pngPtr, infoPtr);
+    std::vector<png_byte> row;
+    for (uint32_t i = 0; i < size; i++) {
+        row.insert(row.end(), rgb.begin(), rgb.end());
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        png_write_row(pngPtr, row.data());
+    }
+    png_write_end(pngPtr, nullptr);
+    png_destroy_write_struct(&pngPtr, &infoPtr);
+    fclose(fp);
+    return true;
+}
+} // namespace
+
 std::vector<std::tuple<double, double, std::vector<std::string>>> TimeZoneLocationTest::timeZoneTestcases {
     { -180.0, -90.0, { "Antarctica/McMurdo" } },
     { -180.0, -80.0, { "Antarctica/McMurdo" } },
@@ -954,6 +992,86 @@ HWTEST_F(TimeZoneLocationTest, TimeZoneLocationTest0006, TestSize.Level1)
     tzIdList = I18nTimeZone::GetTimezoneIdByLocation(74.43203, 40.13523);
     EXPECT_EQ(tzIdList[0], "Asia/Shanghai");
 }
+
+/**
+ * @tc.name: TimeZoneLocationTest0007
+ * @tc.desc: Test TimezoneLocationIndex returns the same pixel for repeated lookups
+ * @tc.type: FUNC
+ */
+HWTEST_F(TimeZoneLocationTest, TimeZoneLocationTest0007, TestSize.Level1)
+{
+    TimezoneLocationIndex& index = TimezoneLocationIndex::GetInstance();
+    std::vector<int> first = index.GetPixel(116.3, 39.5);
+    EXPECT_EQ(first.size(), 3);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(index.GetPixel(116.3, 39.5), first);
+    }
+    std::vector<std::string> beijing = I18nTimeZone::GetTimezoneIdByLocation(116.3, 39.5);
+    EXPECT_TRUE(beijing.size() == 1 && beijing[0] == "Asia/Shanghai");
+    std::vector<std::string> invalid = I18nTimeZone::GetTimezoneIdByLocation(200.0, 39.5);
+    EXPECT_EQ(invalid.size(), 0);
+}
+
+/**
+ * @tc.name: TimeZoneLocationTest0008
+ * @tc.desc: Test GetTimezoneIdsByLocations matches GetTimezoneIdByLocation
+ * @tc.type: FUNC
+ */
+HWTEST_F(TimeZoneLocationTest, TimeZoneLocationTest0008, TestSize.Level1)
+{
+    std::vector<std::pair<double, double>> locations;
+    for (auto iter = timeZoneTestcases.begin(); iter != timeZoneTestcases.end(); ++iter) {
+        locations.emplace_back(std::get<0>(*iter), std::get<1>(*iter));
+    }
+    locations.emplace_back(200.0, 39.5);
+    std::vector<std::vector<std::string>> tzIdLists = I18nTimeZone::GetTimezoneIdsByLocations(locations);
+    ASSERT_EQ(tzIdLists.size(), locations.size());
+    for (size_t i = 0; i < locations.size(); i++) {
+        EXPECT_EQ(tzIdLists[i], I18nTimeZone::GetTimezoneIdByLocation(locations[i].first, locations[i].second));
+    }
+    EXPECT_TRUE(tzIdLists.back().empty());
+}
+
+/**
+ * @tc.name: TimeZoneLocationTest0009
+ * @tc.desc: Test TimezoneLocationIndex reloads the tiles when the data path changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(TimeZoneLocationTest, TimeZoneLocationTest0009, TestSize.Level1)
+{
+    const std::string firstPath = "/data/log/tz_pixel_first";
+    const std::string secondPath = "/data/log/tz_pixel_second";
+    const std::string tileName = "/tz_2099001-000360.dat";
+    unlink((secondPath + tileName).c_str());
+    rmdir(secondPath.c_str());
+    mkdir(firstPath.c_str(), S_IRWXU);
+    ASSERT_TRUE(WriteTzTile(firstPath + tileName, { 1, 2, 3 }));
+    TimezoneLocationIndex& index = TimezoneLocationIndex::GetInstance();
+    std::vector<int> systemPixel = index.GetPixel(116.3, 39.5);
+
+    index.SetDataPaths({ firstPath });
+    EXPECT_EQ(index.GetPixel(116.3, 39.5), std::vector<int>({ 1, 2, 3 }));
+    std::vector<std::vector<int>> pixels = index.GetPixels({ { 116.3, 39.5 }, { -70.0, -10.0 } });
+    ASSERT_EQ(pixels.size(), 2);
+    EXPECT_EQ(pixels[0], std::vector<int>({ 1, 2, 3 }));
+    EXPECT_EQ(pixels[1], std::vector<int>({ 1, 2, 3 }));
+
+    // the second directory is installed after the index has looked for it.
+    index.SetDataPaths({ secondPath });
+    EXPECT_TRUE(index.GetPixel(116.3, 39.5).empty());
+    mkdir(secondPath.c_str(), S_IRWXU);
+    ASSERT_TRUE(WriteTzTile(secondPath + tileName, { 4, 5, 6 }));
+    EXPECT_EQ(index.GetPixel(116.3, 39.5), std::vector<int>({ 4, 5, 6 }));
+
+    index.SetDataPaths({ firstPath });
+    EXPECT_EQ(index.GetPixel(116.3, 39.5), std::vector<int>({ 1, 2, 3 }));
+    index.SetDataPaths({});
+    EXPECT_EQ(index.GetPixel(116.3, 39.5), systemPixel);
+    unlink((firstPath + tileName).c_str());
+    unlink((secondPath + tileName).c_str());
+    rmdir(firstPath.c_str());
+    rmdir(secondPath.c_str());
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
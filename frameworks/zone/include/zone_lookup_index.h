@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_ZONE_LOOKUP_INDEX_H
+#define OHOS_GLOBAL_I18N_ZONE_LOOKUP_INDEX_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "libxml/tree.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+struct CountryZones {
+    std::string defaultTimezone;
+    bool isBoosted = false;
+    std::vector<std::string> zones;
+};
+
+/**
+ * Immutable snapshot of tzlookup.xml and of the UTC offsets of every known zone during the
+ * current UTC year. A snapshot is built once and shared until the tzlookup path changes or
+ * the current time leaves the year it covers.
+ */
+class ZoneLookupIndex {
+public:
+    /**
+     * @brief Get the index built from the given tzlookup.xml.
+     *
+     * @param tzLookupPath Path of tzlookup.xml, nullptr when only icu data is available.
+     * @return Returns the shared snapshot, never nullptr.
+     */
+    static std::shared_ptr<const ZoneLookupIndex> GetInstance(const char* tzLookupPath);
+
+    bool HasTzLookup() const;
+    const CountryZones* FindCountry(const std::string& region) const;
+    const std::vector<std::string>& GetAvailableZones() const;
+
+    /**
+     * @brief Get the offsets of a zone from the precomputed table.
+     *
+     * @return Returns false when the zone or the time is not covered by the table, callers
+     * should then ask icu directly.
+     */
+    bool GetOffset(const std::string& zoneId, int64_t millis, int32_t& rawOffset, int32_t& dstOffset) const;
+
+private:
+    struct OffsetTable {
+        std::vector<int64_t> starts;
+        std::vector<int32_t> rawOffsets;
+        std::vector<int32_t> dstOffsets;
+    };
+
+    ZoneLookupIndex(const char* tzLookupPath, int64_t now);
+    void ParseTzLookup();
+    bool ParseCountry(xmlNodePtr country);
+    void ParseTimezones(xmlNodePtr value, std::vector<std::string>& zones);
+    void BuildOffsetTable(const std::string& zoneId);
+    static void GetYearRange(int64_t now, int64_t& yearStart, int64_t& yearEnd);
+
+    static std::mutex indexMutex;
+    static std::shared_ptr<const ZoneLookupIndex> current;
+
+    std::string path;
+    bool hasTzLookup = false;
+    int64_t rangeStart = 0;
+    int64_t rangeEnd = 0;
+    std::unordered_map<std::string, CountryZones> countries;
+    std::vector<std::string> availableZones;
+    std::unordered_map<std::string, OffsetTable> offsets;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
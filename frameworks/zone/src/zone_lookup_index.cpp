@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "zone_lookup_index.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <set>
+#include "i18n_hilog.h"
+#include "i18n_timezone.h"
+#include "libxml/globals.h"
+#include "libxml/parser.h"
+#include "libxml/xmlstring.h"
+#include "unicode/basictz.h"
+#include "unicode/timezone.h"
+#include "unicode/tztrans.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+static const char *TIMEZONES_TAG = "timezones";
+static const char *ID_TAG = "id";
+static const char *DEFAULT_TAG = "default";
+static const char *BOOSTED_TAG = "defaultBoost";
+static const char *ROOT_TAG = "countryzones";
+static const char *SECOND_TAG = "country";
+static const char *CODE_TAG = "code";
+static constexpr int64_t MILLIS_PER_SECOND = 1000;
+static constexpr int TM_BASE_YEAR = 1900;
+
+std::mutex ZoneLookupIndex::indexMutex;
+std::shared_ptr<const ZoneLookupIndex> ZoneLookupIndex::current = nullptr;
+
+std::shared_ptr<const ZoneLookupIndex> ZoneLookupIndex::GetInstance(const char* tzLookupPath)
+{
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::string pathKey = tzLookupPath == nullptr ? "" : tzLookupPath;
+    std::lock_guard<std::mutex> lock(indexMutex);
+    if (current != nullptr && current->path == pathKey && now >= current->rangeStart &&
+        now < current->rangeEnd) {
+        return current;
+    }
+    current = std::shared_ptr<const ZoneLookupIndex>(new ZoneLookupIndex(tzLookupPath, now));
+    return current;
+}
+
+ZoneLookupIndex::ZoneLookupIndex(const char* tzLookupPath, int64_t now)
+{
+    GetYearRange(now, rangeStart, rangeEnd);
+    if (tzLookupPath != nullptr) {
+        path = tzLookupPath;
+        hasTzLookup = true;
+        ParseTzLookup();
+    }
+    std::shared_ptr<const std::set<std::string>> availableIDs = I18nTimeZone::GetAvailableIDSet();
+    availableZones.assign(availableIDs->begin(), availableIDs->end());
+    std::set<std::string> zoneIds(availableIDs->begin(), availableIDs->end());
+    for (const auto& country : countries) {
+        zoneIds.insert(country.second.zones.begin(), country.second.zones.end());
+        zoneIds.insert(country.second.defaultTimezone);
+    }
+    for (const std::string& zoneId : zoneIds) {
+        BuildOffsetTable(zoneId);
+    }
+}
+
+bool ZoneLookupIndex::HasTzLookup() const
+{
+    return hasTzLookup;
+}
+
+const CountryZones* ZoneLookupIndex::FindCountry(const std::string& region) const
+{
+    auto iter = countries.find(region);
+    if (iter == countries.end()) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+const std::vector<std::string>& ZoneLookupIndex::GetAvailableZones() const
+{
+    return availableZones;
+}
+
+bool ZoneLookupIndex::GetOffset(const std::string& zoneId, int64_t millis, int32_t& rawOffset,
+    int32_t& dstOffset) const
+{
+    if (millis < rangeStart || millis >= rangeEnd) {
+        return false;
+    }
+    auto iter = offsets.find(zoneId);
+    if (iter == offsets.end()) {
+        return false;
+    }
+    const OffsetTable& table = iter->second;
+    auto next = std::upper_bound(table.starts.begin(), table.starts.end(), millis);
+    if (next == table.starts.begin()) {
+        return false;
+    }
+    size_t index = static_cast<size_t>(next - table.starts.begin()) - 1;
+    rawOffset = table.rawOffsets[index];
+    dstOffset = table.dstOffsets[index];
+    return true;
+}
+
+void ZoneLookupIndex::ParseTzLookup()
+{
+    xmlKeepBlanksDefault(0);
+    xmlDocPtr doc = xmlParseFile(path.c_str());
+    if (!doc) {
+        HILOG_ERROR_I18N("ZoneLookupIndex::ParseTzLookup can not open tzlookup.xml");
+        return;
+    }
+    xmlNodePtr cur = xmlDocGetRootElement(doc);
+    if (!cur || xmlStrcmp(cur->name, reinterpret_cast<const xmlChar *>(ROOT_TAG)) != 0) {
+        xmlFreeDoc(doc);
+        HILOG_ERROR_I18N("ZoneLookupIndex::ParseTzLookup invalid Root_tag");
+        return;
+    }
+    cur = cur->xmlChildrenNode;
+    while (cur != nullptr && xmlStrcmp(cur->name, reinterpret_cast<const xmlChar *>(SECOND_TAG)) == 0) {
+        if (!ParseCountry(cur)) {
+            break;
+        }
+        cur = cur->next;
+    }
+    xmlFreeDoc(doc);
+}
+
+bool ZoneLookupIndex::ParseCountry(xmlNodePtr country)
+{
+    xmlNodePtr value = country->xmlChildrenNode;
+    if (value == nullptr) {
+        return true;
+    }
+    if (xmlStrcmp(value->name, reinterpret_cast<const xmlChar*>(CODE_TAG)) != 0) {
+        HILOG_ERROR_I18N("ZoneLookupIndex::ParseCountry invalid code_tag");
+        return false;
+    }
+    xmlChar *codePtr = xmlNodeGetContent(value);
+    if (codePtr == nullptr) {
+        return true;
+    }
+    std::string region = reinterpret_cast<const char*>(codePtr);
+    xmlFree(codePtr);
+    auto inserted = countries.emplace(region, CountryZones());
+    if (!inserted.second) {
+        return true;
+    }
+    CountryZones& entry = inserted.first->second;
+    value = value->next;
+    if (value == nullptr || xmlStrcmp(value->name, reinterpret_cast<const xmlChar*>(DEFAULT_TAG)) != 0) {
+        HILOG_ERROR_I18N("ZoneLookupIndex::ParseCountry invalid default_tag");
+        return true;
+    }
+    xmlChar *defaultPtr = xmlNodeGetContent(value);
+    if (defaultPtr != nullptr) {
+        entry.defaultTimezone = reinterpret_cast<const char*>(defaultPtr);
+        xmlFree(defaultPtr);
+    }
+    value = value->next;
+    if (value == nullptr) {
+        HILOG_ERROR_I18N("ZoneLookupIndex::ParseCountry doesn't contains id");
+        return true;
+    }
+    if (xmlStrcmp(value->name, reinterpret_cast<const xmlChar *>(BOOSTED_TAG)) == 0) {
+        entry.isBoosted = true;
+        value = value->next;
+    }
+    ParseTimezones(value, entry.zones);
+    return true;
+}
+
+void ZoneLookupIndex::ParseTimezones(xmlNodePtr value, std::vector<std::string>& zones)
+{
+    if (value == nullptr || xmlStrcmp(value->name, reinterpret_cast<const xmlChar *>(TIMEZONES_TAG)) != 0) {
+        HILOG_ERROR_I18N("ZoneLookupIndex::ParseTimezones invalid timezones_tag");
+        return;
+    }
+    value = value->xmlChildrenNode;
+    while (value != nullptr) {
+        if (xmlStrcmp(value->name, reinterpret_cast<const xmlChar *>(ID_TAG)) != 0) {
+            HILOG_ERROR_I18N("ZoneLookupIndex::ParseTimezones invalid id_tag");
+            return;
+        }
+        xmlChar *idPtr = xmlNodeGetContent(value);
+        if (idPtr != nullptr) {
+            zones.push_back(reinterpret_cast<const char*>(idPtr));
+            xmlFree(idPtr);
+        }
+        value = value->next;
+    }
+}
+
+void ZoneLookupIndex::BuildOffsetTable(const std::string& zoneId)
+{
+    if (zoneId.empty()) {
+        return;
+    }
+    icu::UnicodeString unicodeZoneID(zoneId.data(), zoneId.length());
+    std::unique_ptr<icu::TimeZone> timezone(icu::TimeZone::createTimeZone(unicodeZoneID));
+    if (timezone == nullptr) {
+        return;
+    }
+    OffsetTable table;
+    UDate date = static_cast<UDate>(rangeStart);
+    UBool local = false;
+    while (true) {
+        int32_t rawOffset = 0;
+        int32_t dstOffset = 0;
+        UErrorCode status = U_ZERO_ERROR;
+        timezone->getOffset(date, local, rawOffset, dstOffset, status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        table.starts.push_back(static_cast<int64_t>(date));
+        table.rawOffsets.push_back(rawOffset);
+        table.dstOffsets.push_back(dstOffset);
+        icu::BasicTimeZone* btz = static_cast<icu::BasicTimeZone*>(timezone.get());
+        icu::TimeZoneTransition trans;
+        if (!btz->getNextTransition(date, false, trans) || trans.getTime() >= static_cast<UDate>(rangeEnd)) {
+            break;
+        }
+        date = trans.getTime();
+    }
+    offsets.emplace(zoneId, std::move(table));
+}
+
+void ZoneLookupIndex::GetYearRange(int64_t now, int64_t& yearStart, int64_t& yearEnd)
+{
+    time_t seconds = static_cast<time_t>(now / MILLIS_PER_SECOND);
+    struct tm utc = {};
+    if (gmtime_r(&seconds, &utc) == nullptr) {
+        yearStart = 0;
+        yearEnd = 0;
+        return;
+    }
+    struct tm boundary = {};
+    boundary.tm_year = utc.tm_year;
+    boundary.tm_mday = 1;
+    yearStart = static_cast<int64_t>(timegm(&boundary)) * MILLIS_PER_SECOND;
+    boundary = {};
+    boundary.tm_year = utc.tm_year + 1;
+    boundary.tm_mday = 1;
+    yearEnd = static_cast<int64_t>(timegm(&boundary)) * MILLIS_PER_SECOND;
+    HILOG_INFO_I18N("ZoneLookupIndex::GetYearRange build offsets for year %{public}d", utc.tm_year + TM_BASE_YEAR);
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
@@ -22,6 +22,7 @@
 #include "unicode/strenum.h"
 #include "unicode/timezone.h"
 #include "utils.h"
+#include "zone_lookup_index.h"
 #include "zone_util.h"
 
 using namespace OHOS::Global::I18n;
@@ -31,15 +32,7 @@ using namespace std;
 const char *ZoneUtil::COUNTRY_ZONE_DATA_PATH = "/system/usr/ohos_timezone/tzlookup.xml";
 const char *ZoneUtil::DISTRO_COUNTRY_ZONE_DATA_PATH = "/system/etc/tzdata_distro/hos/tzlookup.xml";
 const char *ZoneUtil::DEFAULT_TIMEZONE = "GMT";
-const char *ZoneUtil::TIMEZONES_TAG = "timezones";
-const char *ZoneUtil::ID_TAG = "id";
-const char *ZoneUtil::DEFAULT_TAG = "default";
-const char *ZoneUtil::BOOSTED_TAG = "defaultBoost";
-const char *ZoneUtil::ROOT_TAG = "countryzones";
-const char *ZoneUtil::SECOND_TAG = "country";
-const char *ZoneUtil::CODE_TAG = "code";
 const char *ZoneUtil::TIMEZONE_KEY = "persist.time.timezone";
-const char *ZoneUtil::TZLOOKUP_FILE_PATH = ZoneUtil::GetTZLookupDataPath();
 
 unordered_map<string, string> ZoneUtil::defaultMap = {
     {"AQ", "Antarctica/McMurdo"},
@@ -243,15 +236,16 @@ CountryResult ZoneUtil::LookupTimezoneByCountryAndNITZ(std::string &region, NITZ
     if (systemTimezone.length() == 0) {
         systemTimezone = DEFAULT_TIMEZONE;
     }
-    if (TZLOOKUP_FILE_PATH != nullptr) {
+    std::shared_ptr<const ZoneLookupIndex> index = GetTZLookupIndex();
+    if (index->HasTzLookup()) {
         bool isBoosted = false;
         HILOG_INFO_I18N("ZoneUtil::LookupTimezoneByCountryAndNITZ use tzlookup.xml");
-        GetCountryZones(region, defaultTimezone, isBoosted, zones);
+        GetCountryZones(*index, region, defaultTimezone, isBoosted, zones);
     } else {
         HILOG_INFO_I18N("ZoneUtil::LookupTimezoneByCountryAndNITZ use icu data");
         GetICUCountryZones(region, zones, defaultTimezone);
     }
-    return Match(zones, nitzData, systemTimezone);
+    return Match(*index, zones, nitzData, systemTimezone);
 }
 
 CountryResult ZoneUtil::LookupTimezoneByNITZ(NITZData &nitzData)
@@ -260,16 +254,13 @@ CountryResult ZoneUtil::LookupTimezoneByNITZ(NITZData &nitzData)
     if (systemTimezone.length() == 0) {
         systemTimezone = DEFAULT_TIMEZONE;
     }
-    std::set<std::string> icuTimezones = I18nTimeZone::GetAvailableIDs();
-    std::vector<std::string> validZones;
-    for (auto it = icuTimezones.begin(); it != icuTimezones.end(); ++it) {
-        validZones.push_back(*it);
-    }
+    std::shared_ptr<const ZoneLookupIndex> index = GetTZLookupIndex();
+    const std::vector<std::string>& validZones = index->GetAvailableZones();
 
-    CountryResult result = Match(validZones, nitzData, systemTimezone);
+    CountryResult result = Match(*index, validZones, nitzData, systemTimezone);
     if (result.timezoneId.empty() && nitzData.isDST >= 0) {
         NITZData newNITZData = { -1, nitzData.totalOffset, nitzData.currentMillis };  // -1 means not consider DST
-        result = Match(validZones, newNITZData, systemTimezone);
+        result = Match(*index, validZones, newNITZData, systemTimezone);
     }
     return result;
 }
@@ -280,9 +271,10 @@ CountryResult ZoneUtil::LookupTimezoneByCountry(std::string &region, int64_t cur
     bool isBoosted = false;
     std::string defaultTimezone;
     CountryResult result = { true, MatchQuality::DEFAULT_BOOSTED, defaultTimezone };
-    if (TZLOOKUP_FILE_PATH != nullptr) {
+    std::shared_ptr<const ZoneLookupIndex> index = GetTZLookupIndex();
+    if (index->HasTzLookup()) {
         HILOG_INFO_I18N("ZoneUtil::LookupTimezoneByCountry use tzlookup.xml");
-        GetCountryZones(region, defaultTimezone, isBoosted, zones);
+        GetCountryZones(*index, region, defaultTimezone, isBoosted, zones);
         if (defaultTimezone.empty()) {
             HILOG_ERROR_I18N("ZoneUtil::LookupTimezoneByCountry can't find default timezone for region %{public}s",
                 region.c_str());
@@ -299,7 +291,7 @@ CountryResult ZoneUtil::LookupTimezoneByCountry(std::string &region, int64_t cur
         result.quality = MatchQuality::MULTIPLE_ZONES_DIFFERENT_OFFSET;
     } else if (zones.size() == 1) {
         result.quality = MatchQuality::SINGLE_ZONE;
-    } else if (CheckSameDstOffset(zones, defaultTimezone, currentMillis)) {
+    } else if (CheckSameDstOffset(*index, zones, defaultTimezone, currentMillis)) {
         result.quality = MatchQuality::MULTIPLE_ZONES_SAME_OFFSET;
     } else {
         result.quality = MatchQuality::MULTIPLE_ZONES_DIFFERENT_OFFSET;
@@ -307,6 +299,13 @@ CountryResult ZoneUtil::LookupTimezoneByCountry(std::string &region, int64_t cur
     return result;
 }
 
+std::shared_ptr<const ZoneLookupIndex> ZoneUtil::GetTZLookupIndex()
+{
+    // Both candidates live on the read-only system partition, so the path is resolved once.
+    static const char *tzLookupPath = GetTZLookupDataPath();
+    return ZoneLookupIndex::GetInstance(tzLookupPath);
+}
+
 const char *ZoneUtil::GetTZLookupDataPath()
 {
     using std::filesystem::directory_iterator;
@@ -321,116 +320,21 @@ const char *ZoneUtil::GetTZLookupDataPath()
     }
 }
 
-bool ZoneUtil::IsFindCountry(xmlDocPtr &doc, xmlNodePtr &cur, xmlNodePtr &value,
-    std::string &region)
-{
-    while (cur != nullptr && xmlStrcmp(cur->name, reinterpret_cast<const xmlChar *>(SECOND_TAG)) == 0) {
-        value = cur->xmlChildrenNode;
-        if (value == nullptr) {
-            cur = cur->next;
-            continue;
-        }
-        if (xmlStrcmp(value->name, reinterpret_cast<const xmlChar*>(CODE_TAG)) != 0) {
-            xmlFreeDoc(doc);
-            HILOG_ERROR_I18N("ZoneUtil::GetCountryZones invalid code_tag");
-            return false;
-        }
-        xmlChar *codePtr = xmlNodeGetContent(value);
-        if (codePtr == nullptr) {
-            cur = cur->next;
-            continue;
-        }
-        const char* xmlRegion = reinterpret_cast<const char*>(codePtr);
-        if (region.compare(xmlRegion) == 0) {
-            xmlFree(codePtr);
-            return true;
-        } else {
-            xmlFree(codePtr);
-            cur = cur->next;
-            continue;
-        }
-    }
-    return false;
-}
-
-void ZoneUtil::GetCountryZones(std::string &region, std::string &defaultTimzone, bool &isBoosted,
-    std::vector<std::string> &zones)
-{
-    xmlKeepBlanksDefault(0);
-    xmlDocPtr doc = xmlParseFile(TZLOOKUP_FILE_PATH);
-    if (!doc) {
-        HILOG_ERROR_I18N("ZoneUtil::GetCountryZones can not open tzlookup.xml");
-        return;
-    }
-    xmlNodePtr cur = xmlDocGetRootElement(doc);
-    if (!cur || xmlStrcmp(cur->name, reinterpret_cast<const xmlChar *>(ROOT_TAG)) != 0) {
-        xmlFreeDoc(doc);
-        HILOG_ERROR_I18N("ZoneUtil::GetCountryZones invalid Root_tag");
-        return;
-    }
-    cur = cur->xmlChildrenNode;
-    xmlNodePtr value;
-    bool findCountry = IsFindCountry(doc, cur, value, region);
-    if (findCountry) {
-        value = value->next;
-        GetDefaultAndBoost(value, defaultTimzone, isBoosted, zones);
-    }
-    xmlUnlinkNode(cur);
-    xmlFreeNode(cur);
-    xmlFreeDoc(doc);
-    return;
-}
-
-void ZoneUtil::GetDefaultAndBoost(xmlNodePtr &value, std::string &defaultTimezone, bool &isBoosted,
-    std::vector<std::string> &zones)
-{
-    if (value == nullptr || xmlStrcmp(value->name, reinterpret_cast<const xmlChar*>(DEFAULT_TAG)) != 0) {
-        HILOG_ERROR_I18N("ZoneUtil::GetDefaultAndBoost invalid default_tag");
-        return;
-    }
-    xmlChar *defaultPtr = xmlNodeGetContent(value);
-    if (defaultPtr != nullptr) {
-        defaultTimezone = reinterpret_cast<const char*>(defaultPtr);
-        xmlFree(defaultPtr);
-    }
-    value = value->next;
-    if (value == nullptr) {
-        HILOG_ERROR_I18N("ZoneUtil::GetDefaultAndBoost doesn't contains id");
-        return;
-    }
-    if (xmlStrcmp(value->name, reinterpret_cast<const xmlChar *>(BOOSTED_TAG)) == 0) {
-        isBoosted = true;
-        value = value->next;
-    } else {
-        isBoosted = false;
-    }
-    GetTimezones(value, zones);
-}
-
-void ZoneUtil::GetTimezones(xmlNodePtr &value, std::vector<std::string> &zones)
+void ZoneUtil::GetCountryZones(const ZoneLookupIndex &index, std::string &region, std::string &defaultTimezone,
+    bool &isBoosted, std::vector<std::string> &zones)
 {
-    if (xmlStrcmp(value->name, reinterpret_cast<const xmlChar *>(TIMEZONES_TAG)) != 0) {
-        HILOG_ERROR_I18N("ZoneUtil::GetTimezones invalid timezones_tag");
+    const CountryZones *countryZones = index.FindCountry(region);
+    if (countryZones == nullptr) {
         return;
     }
-    value = value->xmlChildrenNode;
-    while (value != nullptr) {
-        if (xmlStrcmp(value->name, reinterpret_cast<const xmlChar *>(ID_TAG)) != 0) {
-            HILOG_ERROR_I18N("ZoneUtil::GetTimezones invalid id_tag");
-            return;
-        }
-        xmlChar *idPtr = xmlNodeGetContent(value);
-        if (idPtr != nullptr) {
-            zones.push_back(reinterpret_cast<const char*>(idPtr));
-            xmlFree(idPtr);
-        }
-        value = value->next;
-    }
+    defaultTimezone = countryZones->defaultTimezone;
+    isBoosted = countryZones->isBoosted;
+    zones = countryZones->zones;
 }
 
 void ZoneUtil::GetICUCountryZones(std::string &region, std::vector<std::string> &zones, std::string &defaultTimezone)
 {
-    std::set<std::string> validZoneIds = I18nTimeZone::GetAvailableIDs();
+    std::shared_ptr<const std::set<std::string>> validZoneIds = I18nTimeZone::GetAvailableIDSet();
     std::set<std::string> countryZoneIds;
     StringEnumeration *strEnum = TimeZone::createEnumeration(region.c_str());
     UErrorCode status = U_ZERO_ERROR;
@@ -440,7 +344,7 @@ void ZoneUtil::GetICUCountryZones(std::string &region, std::vector<std::string>
         TimeZone::getCanonicalID(*timezoneIdUStr, canonicalUnistring, status);
         std::string timezoneId;
         canonicalUnistring.toUTF8String(timezoneId);
-        if (validZoneIds.find(timezoneId) != validZoneIds.end()) {
+        if (validZoneIds->find(timezoneId) != validZoneIds->end()) {
             countryZoneIds.insert(timezoneId);
         }
         timezoneIdUStr = strEnum->snext(status);
@@ -458,27 +362,18 @@ void ZoneUtil::GetICUCountryZones(std::string &region, std::vector<std::string>
     delete strEnum;
 }
 
-CountryResult ZoneUtil::Match(std::vector<std::string> &zones, NITZData &nitzData, std::string &systemTimezone)
+CountryResult ZoneUtil::Match(const ZoneLookupIndex &index, const std::vector<std::string> &zones,
+    NITZData &nitzData, std::string &systemTimezone)
 {
     bool isOnlyMatch = true;
     std::string matchedZoneId;
-    bool local = false;
     bool useSystemTimezone = false;
     for (size_t i = 0; i < zones.size(); i++) {
-        std::string zoneId = zones[i];
-        UnicodeString unicodeZoneID(zoneId.data(), zoneId.length());
-        TimeZone *timezone = TimeZone::createTimeZone(unicodeZoneID);
-        if (timezone == nullptr) {
-            HILOG_ERROR_I18N("ZoneUtil::Match: Create time zone failed.");
-            continue;
-        }
+        const std::string &zoneId = zones[i];
         int32_t rawOffset;
         int32_t dstOffset;
-        UErrorCode status = UErrorCode::U_ZERO_ERROR;
-        timezone->getOffset(nitzData.currentMillis, static_cast<UBool>(local), rawOffset, dstOffset, status);
-        if (U_FAILURE(status)) {
+        if (!GetOffset(index, zoneId, nitzData.currentMillis, rawOffset, dstOffset)) {
             HILOG_ERROR_I18N("ZoneUtil::Match: Time zone get offset failed.");
-            delete timezone;
             continue;
         }
         if ((nitzData.totalOffset - rawOffset == dstOffset) &&
@@ -493,55 +388,51 @@ CountryResult ZoneUtil::Match(std::vector<std::string> &zones, NITZData &nitzDat
                 useSystemTimezone = true;
             }
             if (!isOnlyMatch && useSystemTimezone) {
-                delete timezone;
                 break;
             }
         }
-        delete timezone;
     }
     CountryResult result = {isOnlyMatch, MatchQuality::DEFAULT_BOOSTED, matchedZoneId};
     return result;
 }
 
-bool ZoneUtil::CheckSameDstOffset(std::vector<std::string> &zones, std::string &defaultTimezoneId,
-    int64_t currentMillis)
+bool ZoneUtil::CheckSameDstOffset(const ZoneLookupIndex &index, std::vector<std::string> &zones,
+    std::string &defaultTimezoneId, int64_t currentMillis)
 {
-    UnicodeString defaultID(defaultTimezoneId.data(), defaultTimezoneId.length());
-    TimeZone *defaultTimezone = TimeZone::createTimeZone(defaultID);
-    if (defaultTimezone == nullptr) {
-        HILOG_ERROR_I18N("ZoneUtil::CheckSameDstOffset: Create default time zone failed.");
-        return false;
-    }
     int32_t rawOffset = 0;
     int32_t dstOffset = 0;
-    bool local = false;
-    UErrorCode status = U_ZERO_ERROR;
-    defaultTimezone->getOffset(currentMillis, (UBool)local, rawOffset, dstOffset, status);
-    if (U_FAILURE(status)) {
-        delete defaultTimezone;
+    if (!GetOffset(index, defaultTimezoneId, currentMillis, rawOffset, dstOffset)) {
         HILOG_ERROR_I18N("ZoneUtil::CheckSameDstOffset can not get timezone defaultID offset");
         return false;
     }
-    delete defaultTimezone;
     int32_t totalOffset = rawOffset + dstOffset;
     for (size_t i = 0; i < zones.size(); i++) {
-        UnicodeString unicodeZoneID(zones[i].data(), zones[i].length());
-        TimeZone *timezone = TimeZone::createTimeZone(unicodeZoneID);
-        if (timezone == nullptr) {
-            HILOG_ERROR_I18N("ZoneUtil::CheckSameDstOffset: Create time zone failed.");
-            return false;
-        }
-        timezone->getOffset(currentMillis, (UBool)local, rawOffset, dstOffset, status);
-        if (U_FAILURE(status)) {
-            delete timezone;
+        if (!GetOffset(index, zones[i], currentMillis, rawOffset, dstOffset)) {
             HILOG_ERROR_I18N("ZoneUtil::CheckSameDstOffset can not get timezone unicodeZoneID offset");
             return false;
         }
         if (totalOffset - rawOffset != dstOffset) {
-            delete timezone;
             return false;
         }
-        delete timezone;
     }
     return true;
 }
+
+bool ZoneUtil::GetOffset(const ZoneLookupIndex &index, const std::string &zoneId, int64_t millis,
+    int32_t &rawOffset, int32_t &dstOffset)
+{
+    if (index.GetOffset(zoneId, millis, rawOffset, dstOffset)) {
+        return true;
+    }
+    UnicodeString unicodeZoneID(zoneId.data(), zoneId.length());
+    TimeZone *timezone = TimeZone::createTimeZone(unicodeZoneID);
+    if (timezone == nullptr) {
+        HILOG_ERROR_I18N("ZoneUtil::GetOffset: Create time zone failed.");
+        return false;
+    }
+    bool local = false;
+    UErrorCode status = U_ZERO_ERROR;
+    timezone->getOffset(millis, static_cast<UBool>(local), rawOffset, dstOffset, status);
+    delete timezone;
+    return U_SUCCESS(status);
+}
@@ -14,8 +14,11 @@
  */
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include "locale_config.h"
+#include "unicode/timezone.h"
 #include "utils.h"
+#include "zone_lookup_index.h"
 #include "zone_util.h"
 
 using namespace OHOS::Global::I18n;
@@ -323,6 +326,46 @@ HWTEST_F(ZoneUtilTest, ZoneUtilFuncTest0012, TestSize.Level1)
         }
     }
 }
+
+/**
+ * @tc.name: ZoneUtilFuncTest0013
+ * @tc.desc: Test ZoneLookupIndex offsets match icu
+ * @tc.type: FUNC
+ */
+HWTEST_F(ZoneUtilTest, ZoneUtilFuncTest0013, TestSize.Level1)
+{
+    std::shared_ptr<const ZoneLookupIndex> index = ZoneLookupIndex::GetInstance(nullptr);
+    ASSERT_TRUE(index != nullptr);
+    EXPECT_EQ(index, ZoneLookupIndex::GetInstance(nullptr));
+    EXPECT_FALSE(index->HasTzLookup());
+    EXPECT_TRUE(index->FindCountry("CN") == nullptr);
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::vector<std::string> zoneIds = { "Asia/Shanghai", "Europe/London", "America/New_York",
+        "Australia/Sydney", "America/Santiago" };
+    for (const std::string& zoneId : zoneIds) {
+        int32_t rawOffset = 0;
+        int32_t dstOffset = 0;
+        ASSERT_TRUE(index->GetOffset(zoneId, now, rawOffset, dstOffset));
+        icu::TimeZone* timezone = icu::TimeZone::createTimeZone(icu::UnicodeString::fromUTF8(zoneId));
+        ASSERT_TRUE(timezone != nullptr);
+        int32_t icuRawOffset = 0;
+        int32_t icuDstOffset = 0;
+        UErrorCode status = U_ZERO_ERROR;
+        timezone->getOffset(now, false, icuRawOffset, icuDstOffset, status);
+        delete timezone;
+        EXPECT_EQ(rawOffset, icuRawOffset);
+        EXPECT_EQ(dstOffset, icuDstOffset);
+    }
+    int32_t rawOffset = 0;
+    int32_t dstOffset = 0;
+    EXPECT_FALSE(index->GetOffset("Asia/Shanghai", 0, rawOffset, dstOffset));
+
+    ZoneUtil util;
+    NITZData nitzData = { 0, 28800000, now };
+    CountryResult result = util.LookupTimezoneByNITZ(nitzData);
+    EXPECT_FALSE(result.timezoneId.empty());
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
@@ -16,12 +16,10 @@
 #ifndef OHOS_GLOBAL_I18N_ZONE_UTIL_H
 #define OHOS_GLOBAL_I18N_ZONE_UTIL_H
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
-#include "libxml/globals.h"
-#include "libxml/tree.h"
-#include "libxml/xmlstring.h"
 #include "unicode/strenum.h"
 
 namespace OHOS {
@@ -41,6 +39,8 @@ enum MatchQuality {
     MULTIPLE_ZONES_DIFFERENT_OFFSET
 };
 
+class ZoneLookupIndex;
+
 struct CountryResult {
     bool isOnlyMatch;
     MatchQuality quality;
@@ -149,31 +149,23 @@ private:
     static void GetString(icu::StringEnumeration *strEnum, std::string &ret);
     static bool Init();
     bool CheckFileExist();
-    bool CheckSameDstOffset(std::vector<std::string> &zones, std::string &defaultTimezone,
-        int64_t currentMillis);
-    void GetTimezones(xmlNodePtr &value, std::vector<std::string> &zones);
-    void GetDefaultAndBoost(xmlNodePtr &value, std::string &defaultTimezone, bool &isBoosted,
-        std::vector<std::string> &zones);
-    bool IsFindCountry(xmlDocPtr &doc, xmlNodePtr &cur, xmlNodePtr &value, std::string &region);
-    void GetCountryZones(std::string &region, std::string &defaultTimezone, bool &isBoosted,
-        std::vector<std::string> &zones);
+    bool CheckSameDstOffset(const ZoneLookupIndex &index, std::vector<std::string> &zones,
+        std::string &defaultTimezone, int64_t currentMillis);
+    void GetCountryZones(const ZoneLookupIndex &index, std::string &region, std::string &defaultTimezone,
+        bool &isBoosted, std::vector<std::string> &zones);
     void GetICUCountryZones(std::string &region, std::vector<std::string> &zones, std::string &defaultTimezone);
-    CountryResult Match(std::vector<std::string> &zones, NITZData &nitzData, std::string &systemTimezone);
+    CountryResult Match(const ZoneLookupIndex &index, const std::vector<std::string> &zones, NITZData &nitzData,
+        std::string &systemTimezone);
+    static bool GetOffset(const ZoneLookupIndex &index, const std::string &zoneId, int64_t millis,
+        int32_t &rawOffset, int32_t &dstOffset);
     static const char *GetTZLookupDataPath();
+    static std::shared_ptr<const ZoneLookupIndex> GetTZLookupIndex();
 
     static const char *COUNTRY_ZONE_DATA_PATH;
     static const char *DISTRO_COUNTRY_ZONE_DATA_PATH;
     static const char *DEFAULT_TIMEZONE;
-    static const char *TIMEZONES_TAG;
-    static const char *ID_TAG;
-    static const char *DEFAULT_TAG;
-    static const char *BOOSTED_TAG;
-    static const char *ROOT_TAG;
-    static const char *SECOND_TAG;
-    static const char *CODE_TAG;
     static const char *TIMEZONE_KEY;
     static constexpr int SYS_PARAM_LEN = 128;
-    static const char *TZLOOKUP_FILE_PATH;
 };
 } // namespace I18n
 } // namespace Global
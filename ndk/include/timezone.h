@@ -440,6 +440,56 @@ I18n_ErrorCode OH_i18n_GetStartTimeAt(TimeArrayTimeZoneRule* rule, int32_t index
  */
 I18n_ErrorCode OH_i18n_GetStartInYear(AnnualTimeZoneRule* rule, int32_t year, TimeZoneRuleQuery* query);
 
+/**
+ * @brief Define a geographic location.
+ *
+ * @since 22
+ */
+typedef struct GeoLocation {
+    /**
+     * @brief Indicates the longitude, in the range [-180, 180).
+     */
+    double longitude;
+
+    /**
+     * @brief Indicates the latitude, in the range [-90, 90).
+     */
+    double latitude;
+} GeoLocation;
+
+/**
+ * @brief Define the timezone IDs found at a geographic location.
+ *
+ * @since 22
+ */
+typedef struct TimeZoneIDList {
+    /**
+     * @brief Indicates the timezone IDs. The caller is responsible for releasing each ID and the array.
+     */
+    char** ids;
+
+    /**
+     * @brief Indicates the num of timezone IDs.
+     */
+    size_t numIds;
+} TimeZoneIDList;
+
+/**
+ * @brief Obtains the timezone IDs of a batch of geographic locations in one pass.
+ *
+ * @param locations Indicates the locations defined by GeoLocation{@link GeoLocation}.
+ * @param numLocations Indicates the num of locations.
+ * @param results Indicates the array of numLocations TimeZoneIDList{@link TimeZoneIDList} receiving the timezone
+ *     IDs of each location in the same order. A location out of range gets an empty list.
+ * @return {@link SUCCESS} 0 - Success.
+ *         {@link ERROR_INVALID_PARAMETER} 8900001 - Invalid parameter. Possible causes:
+ *     Parameter verification failed.
+ *         {@link UNEXPECTED_ERROR} 8900050 - Unexpected error, such as memory error.
+ * @since 22
+ */
+I18n_ErrorCode OH_i18n_GetTimeZoneIDsByLocations(const GeoLocation* locations, size_t numLocations,
+    TimeZoneIDList* results);
+
 #ifdef __cplusplus
 };
 #endif
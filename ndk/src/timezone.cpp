@@ -20,6 +20,7 @@
 #include "unicode/basictz.h"
 #include "unicode/timezone.h"
 #include "i18n_hilog.h"
+#include "i18n_timezone.h"
 #include "utils.h"
 
 static constexpr int32_t MAX_NUM_TRANSITION_RULE = 40;
@@ -47,8 +48,8 @@ bool IsValidTimeZoneID(const std::string& timeZoneID)
         HILOG_ERROR_I18N("IsValidTimeZoneID: timeZoneID is empty.");
         return false;
     }
-    std::set<std::string> availableIDs = OHOS::Global::I18n::GetTimeZoneAvailableIDs();
-    if (availableIDs.find(timeZoneID) == availableIDs.end()) {
+    std::shared_ptr<const std::set<std::string>> availableIDs = OHOS::Global::I18n::GetTimeZoneAvailableIDSet();
+    if (availableIDs->find(timeZoneID) == availableIDs->end()) {
         HILOG_ERROR_I18N("IsValidTimeZoneID: Invalid timeZoneID %{public}s.", timeZoneID.c_str());
         return false;
     }
@@ -471,6 +472,69 @@ I18n_ErrorCode GetStartInYear(AnnualTimeZoneRule* rule, int32_t year, TimeZoneRu
     return I18n_ErrorCode::SUCCESS;
 }
 
+void FreeTimeZoneIDLists(TimeZoneIDList* results, size_t numLocations)
+{
+    for (size_t i = 0; i < numLocations; i++) {
+        if (results[i].ids == nullptr) {
+            continue;
+        }
+        for (size_t j = 0; j < results[i].numIds; j++) {
+            free(results[i].ids[j]);
+        }
+        free(results[i].ids);
+        results[i].ids = nullptr;
+        results[i].numIds = 0;
+    }
+}
+
+I18n_ErrorCode WriteTimeZoneIDList(const std::vector<std::string>& timeZoneIDs, TimeZoneIDList* result)
+{
+    result->ids = nullptr;
+    result->numIds = 0;
+    if (timeZoneIDs.empty()) {
+        return I18n_ErrorCode::SUCCESS;
+    }
+    result->ids = static_cast<char**>(malloc(timeZoneIDs.size() * sizeof(char*)));
+    if (result->ids == nullptr) {
+        HILOG_ERROR_I18N("WriteTimeZoneIDList: malloc failed.");
+        return I18n_ErrorCode::UNEXPECTED_ERROR;
+    }
+    for (const std::string& timeZoneID : timeZoneIDs) {
+        I18n_ErrorCode errCode = WriteString(&result->ids[result->numIds], timeZoneID);
+        if (errCode != I18n_ErrorCode::SUCCESS) {
+            return errCode;
+        }
+        result->numIds++;
+    }
+    return I18n_ErrorCode::SUCCESS;
+}
+
+I18n_ErrorCode GetTimeZoneIDsByLocations(const GeoLocation* locations, size_t numLocations,
+    TimeZoneIDList* results)
+{
+    if (locations == nullptr || results == nullptr || numLocations == 0) {
+        HILOG_ERROR_I18N("GetTimeZoneIDsByLocations: locations or results is invalid.");
+        return I18n_ErrorCode::ERROR_INVALID_PARAMETER;
+    }
+    std::vector<std::pair<double, double>> points;
+    points.reserve(numLocations);
+    for (size_t i = 0; i < numLocations; i++) {
+        points.emplace_back(locations[i].longitude, locations[i].latitude);
+        results[i].ids = nullptr;
+        results[i].numIds = 0;
+    }
+    std::vector<std::vector<std::string>> timeZoneIDLists =
+        OHOS::Global::I18n::I18nTimeZone::GetTimezoneIdsByLocations(points);
+    for (size_t i = 0; i < numLocations && i < timeZoneIDLists.size(); i++) {
+        I18n_ErrorCode errCode = WriteTimeZoneIDList(timeZoneIDLists[i], &results[i]);
+        if (errCode != I18n_ErrorCode::SUCCESS) {
+            FreeTimeZoneIDLists(results, numLocations);
+            return errCode;
+        }
+    }
+    return I18n_ErrorCode::SUCCESS;
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -530,6 +594,12 @@ I18n_ErrorCode OH_i18n_GetStartInYear(AnnualTimeZoneRule* rule, int32_t year, Ti
     return GetStartInYear(rule, year, query);
 }
 
+I18n_ErrorCode OH_i18n_GetTimeZoneIDsByLocations(const GeoLocation* locations, size_t numLocations,
+    TimeZoneIDList* results)
+{
+    return GetTimeZoneIDsByLocations(locations, numLocations, results);
+}
+
 #ifdef __cplusplus
 };
 #endif
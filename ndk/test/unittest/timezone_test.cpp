@@ -130,6 +130,42 @@ HWTEST_F(TimeZoneTest, TimeZoneFuncTest002, TestSize.Level1)
     EXPECT_EQ(errCode, I18n_ErrorCode::SUCCESS);
     EXPECT_EQ(query.result, 1712458800000); // 2024-04-07 11:00:00
 }
+
+/**
+ * @tc.name: TimeZoneFuncTest003
+ * @tc.desc: Test OH_i18n_GetTimeZoneIDsByLocations
+ * @tc.type: FUNC
+ */
+HWTEST_F(TimeZoneTest, TimeZoneFuncTest003, TestSize.Level1)
+{
+    GeoLocation locations[] = {
+        { 116.3, 39.5 }, // Beijing
+        { -118.1, 34.0 }, // Los Angeles
+        { 200.0, 39.5 }, // out of range
+        { 150.5, -33.55 }, // Sydney
+    };
+    const size_t numLocations = sizeof(locations) / sizeof(locations[0]);
+    TimeZoneIDList results[numLocations];
+    I18n_ErrorCode errCode = OH_i18n_GetTimeZoneIDsByLocations(locations, numLocations, results);
+    EXPECT_EQ(errCode, I18n_ErrorCode::SUCCESS);
+    ASSERT_EQ(results[0].numIds, 1);
+    EXPECT_EQ(std::string(results[0].ids[0]), "Asia/Shanghai");
+    ASSERT_EQ(results[1].numIds, 1);
+    EXPECT_EQ(std::string(results[1].ids[0]), "America/Los_Angeles");
+    EXPECT_EQ(results[2].numIds, 0);
+    EXPECT_TRUE(results[2].ids == nullptr);
+    ASSERT_EQ(results[3].numIds, 1);
+    EXPECT_EQ(std::string(results[3].ids[0]), "Australia/Sydney");
+    for (size_t i = 0; i < numLocations; i++) {
+        for (size_t j = 0; j < results[i].numIds; j++) {
+            free(results[i].ids[j]);
+        }
+        free(results[i].ids);
+    }
+
+    errCode = OH_i18n_GetTimeZoneIDsByLocations(nullptr, numLocations, results);
+    EXPECT_EQ(errCode, I18n_ErrorCode::ERROR_INVALID_PARAMETER);
+}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file